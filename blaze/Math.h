@@ -46,6 +46,7 @@
 #include <blaze/math/Band.h>
 #include <blaze/math/BLAS.h>
 #include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Constraints.h>
 #include <blaze/math/CustomMatrix.h>
@@ -66,6 +67,7 @@
 #include <blaze/math/LAPACK.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/PaddingFlag.h>
+#include <blaze/math/PatternMatrix.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/Serialization.h>
@@ -11564,6 +11564,29 @@
 // In the context of C++11 threads, the function will return the previously specified number of
 // threads.
 //
+// By default, the operating system is free to migrate the threads between the available cores.
+// Especially on multi-socket machines it can be beneficial to pin the threads to specific CPUs,
+// such that every thread keeps working on the same socket and on the same part of the operands.
+// The thread affinity can be specified via the environment variable \c BLAZE_THREAD_AFFINITY
+
+   \code
+   export BLAZE_THREAD_AFFINITY=compact  // Fill one socket after the other
+   export BLAZE_THREAD_AFFINITY=scatter  // Distribute the threads among the sockets
+   export BLAZE_THREAD_AFFINITY=0,2,4-7  // Explicit list of CPUs
+   \endcode
+
+// or alternatively via the \c setThreadAffinity() function:
+
+   \code
+   blaze::setThreadAffinity( "scatter" );
+   blaze::setThreadAffinity( "none" );  // Releases all threads
+   \endcode
+
+// Note that pinning threads is currently only supported on Linux. In contrast to the
+// \c setThreadAffinity() function, which throws a \c std::invalid_argument exception in case of
+// an invalid affinity, an invalid value of the environment variable is silently ignored, i.e.
+// the threads are not pinned.
+//
 //
 // \n \section cpp_threads_configuration C++11 Thread Configuration
 // <hr>
@@ -11586,6 +11609,99 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_concurrent_callers Concurrent Callers
+// <hr>
+//
+// In contrast to the OpenMP-based parallelization, the C++11 thread parallelization can be used
+// by several threads of an application at the same time. All threads share the same pool of
+// threads, but every thread only waits for the completion of its own operations. In order to
+// restrict the number of threads that work on the operations of a particular calling thread
+// (for instance to prevent a single request of a multi-tenant service from occupying the
+// complete thread pool), the \c BLAZE_THREAD_LIMIT macro can be used:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   BLAZE_THREAD_LIMIT( 2 )
+   {
+      // Within the scope of the thread limit, all operations are executed by at most two
+      // threads of the thread pool
+      C = A * B;
+   }
+   \endcode
+
+// The thread limit only affects the calling thread and can be nested, in which case the smaller
+// limit applies. Within the scope of a thread limit the getNumThreads() function returns the
+// limited number of threads. Note that the thread limit is only considered by the C++11 and
+// Boost thread parallelizations.
+//
+//
+// \n \section cpp_threads_async_evaluation Asynchronous Evaluation
+// <hr>
+//
+// Every parallel assignment blocks the calling thread until the complete operation has been
+// finished. In order to overlap an operation with other work of the calling thread (as for
+// instance I/O or another independent operation), the operation can be started asynchronously
+// via the \c asyncAssign() and \c evaluateAsync() functions. Both functions return immediately
+// with a \c std::future for the completion or the result of the operation, respectively:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   blaze::DynamicVector<double> x;
+   // ... Resizing and initialization
+
+   std::future<void> product( blaze::asyncAssign( C, A * B ) );
+   auto matvec( blaze::evaluateAsync( A * x ) );
+
+   // ... Work independent of the operands of both operations
+
+   product.get();  // Waiting for the completion of the matrix multiplication
+   blaze::DynamicVector<double> y( matvec.get() );
+   \endcode
+
+// The asynchronous operations are executed in parallel by the same pool of threads. Note that
+// the target and all operands of an asynchronous operation must neither be modified nor
+// destroyed before the operation has been completed. An asynchronous operation that is started
+// from within another asynchronous operation (as for instance by a custom operation of an
+// asynchronously evaluated expression) is performed by an additional thread, such that waiting
+// for its completion cannot deadlock. All asynchronous operations are completed before the end
+// of the program, even if their results are never requested. In case of the OpenMP or HPX based
+// parallelizations, both functions perform the operation immediately.
+//
+//
+// \n \section cpp_threads_task_graphs Task Graphs
+// <hr>
+//
+// In case a sequence of assignments contains independent assignments, the \c TaskGraph class
+// can be used to execute them concurrently. All assignments are recorded first and executed by
+// the \c run() function afterwards. Assignments that depend on each other (i.e. assignments
+// writing a vector or matrix that is read or written by another assignment) are executed in
+// the order of recording:
+
+   \code
+   blaze::DynamicMatrix<double> A, M;
+   blaze::DynamicVector<double> b, x, r, z, p, t;
+   // ... Resizing and initialization
+
+   blaze::TaskGraph graph;
+
+   graph.assign( r, b - A*x );  // Executed concurrently with the second assignment
+   graph.assign( t, p * 2.0 );
+   graph.assign( z, M*r );      // Executed after the first assignment
+   graph.addAssign( t, z );     // Executed after the second and third assignment
+
+   graph.run();
+   \endcode
+
+// Chains of dependent element-wise dense vector assignments are pipelined, i.e. every thread
+// computes a chunk of all assignments of the chain without a barrier between the assignments.
+// Note that scalar factors are evaluated at the time of recording and that all vectors and
+// matrices computed by the task graph must already have their final size when recording
+// expressions that use them as operands. Please see the documentation of the \c TaskGraph
+// class for the details.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -12002,8 +12118,10 @@
 // Outside the scope of the serial section, all operations are run in parallel (if beneficial for
 // the performance).
 //
-// Note that the \c BLAZE_SERIAL_SECTION must only be used within a single thread of execution.
-// The use of the serial section within several concurrent threads will result undefined behavior!
+// Note that in case of the OpenMP and HPX parallelizations the \c BLAZE_SERIAL_SECTION must only
+// be used within a single thread of execution. The use of the serial section within several
+// concurrent threads will result undefined behavior! In case of the C++11 and Boost thread
+// parallelizations every thread of execution can use its own serial section.
 //
 //
 // \n \section serial_execution_deactivate_parallelism Option 3: Deactivation of Parallel Execution
@@ -12409,6 +12527,47 @@
 // thread-based parallelization, are contained within the configuration file
 // <tt><blaze/config/Thresholds.h></tt>.
 //
+// The values in the configuration file only serve as defaults. At runtime, all thresholds can be
+// queried and changed by name, loaded from or saved to a file, and calibrated on the current
+// machine:
+
+   \code
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 16384UL );  // Changing a single threshold
+   blaze::getThreshold( "SMP_DVECASSIGN_THRESHOLD" );           // Querying a single threshold
+
+   blaze::saveThresholds( "blaze.thresholds" );    // Saving all thresholds in a file
+   blaze::loadThresholds( "blaze.thresholds" );    // Loading thresholds from a file
+   blaze::resetThresholds();                       // Restoring the compile time defaults
+   \endcode
+
+// The calibration of the thresholds on the current machine is not part of <tt><blaze/Math.h></tt>
+// and requires the explicit inclusion of the according header file:
+
+   \code
+   #include <blaze/math/Calibration.h>
+
+   blaze::calibrateThresholds();                   // Timing the crossover points on this machine
+   \endcode
+
+// A threshold file contains one \c "NAME = VALUE" pair per line. In addition, on program start
+// \b Blaze loads the threshold file specified by the \c BLAZE_THRESHOLDS environment variable and
+// afterwards applies all environment variables named after a configuration macro:
+
+   \code
+   export BLAZE_THRESHOLDS=/etc/blaze.thresholds
+   export BLAZE_SMP_DMATDMATMULT_THRESHOLD=2500
+   \endcode
+
+// \warning Since these settings are applied during the static initialization of the program,
+// errors cannot be reported: A threshold file that cannot be opened or parsed is ignored as a
+// whole, and an environment variable with an invalid value is ignored individually. In both
+// cases the affected thresholds silently keep their compile time defaults. In order to detect
+// such errors, load the threshold file explicitly via loadThresholds(), which throws an
+// exception for invalid files.
+//
+// Please note that changing thresholds is not thread-safe, i.e. no \b Blaze operation must be
+// executed concurrently.
+//
 //
 // \n \section padding Padding
 // <hr>
@@ -58,3 +58,101 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of tasks per thread for the C++11 and Boost thread-based parallelization.
+// \ingroup config
+//
+// This value specifies the number of tasks per thread that the C++11 and Boost thread-based
+// parallelization creates for a single parallel (compound) assignment. Every thread of the
+// thread pool owns a separate work queue and threads that have completed their own tasks steal
+// tasks from the queues of the other threads. Therefore a larger number of smaller tasks balances
+// the work of operations with unevenly expensive blocks (as for instance triangular or sparse
+// matrices), whereas a smaller number of larger tasks reduces the scheduling overhead. Note that
+// this value must be larger than 0.
+//
+// \note It is possible to specify the number of tasks per thread via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_TASKS_PER_THREAD 4
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_TASKS_PER_THREAD
+#define BLAZE_SMP_TASKS_PER_THREAD 4
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of spin iterations of idle threads of the C++11 and Boost thread-based
+//        parallelization.
+// \ingroup config
+//
+// This value specifies how often an idle thread of the C++11 and Boost thread-based
+// parallelization checks for new tasks before it blocks, and how often the thread waiting for
+// the completion of a parallel operation checks for completion before it blocks. Every check
+// yields the remaining time slice of the thread. Spinning avoids the latency of waking up
+// blocked threads and therefore makes the parallel execution of operations on comparatively
+// small operands worthwhile, but occupies the according cores for a short time after every
+// parallel operation. Therefore spinning is disabled by default (value 0) and has to be enabled
+// explicitly.
+//
+// \note It is possible to specify the number of spin iterations via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SPIN_COUNT 2000
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SPIN_COUNT
+#define BLAZE_SMP_SPIN_COUNT 0
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first-touch initialization of dense vectors and
+//        matrices.
+// \ingroup config
+//
+// On NUMA systems the operating system places every memory page on the NUMA node of the thread
+// that first writes to it. In case this compilation switch is set to 1, newly allocated memory of
+// large dynamic vectors and matrices (i.e. operands exceeding the according SMP assignment
+// threshold) is not written by the calling thread, but first written in parallel, with the same
+// partitioning as any subsequent thread parallel operation on the operand:
+//
+//  - The homogeneous initialization of a dynamic vector or matrix is performed in parallel.
+//  - The elements of a dynamic vector that is newly allocated during a resize operation without
+//    preservation of the elements are not initialized by the calling thread.
+//  - The elements of a dynamic matrix (which due to padding would otherwise be touched row-
+//    or columnwise by the calling thread) are initialized in parallel on allocation.
+//
+// Thus the memory of large operands is distributed among the NUMA nodes of all threads instead of
+// being placed on the NUMA node of the calling thread. Note however that the thread pool assigns
+// the same part of an operand to the same thread on a best-effort basis only, i.e. subsequent
+// operations are not guaranteed to work on memory local to the executing thread. The first-touch
+// initialization is restricted to built-in element types, since elements of any other type (as for
+// instance \c std::complex) are default constructed on the calling thread during the allocation.
+// In case the switch is set to 0, the memory is initialized by the calling thread. The placement
+// of existing vectors and matrices can be explicitly adapted via the numaDistribute() function.
+//
+// Possible settings for the first-touch switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the first-touch initialization via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_FIRST_TOUCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_FIRST_TOUCH
+#define BLAZE_SMP_FIRST_TOUCH 0
+#endif
+//*************************************************************************************************
@@ -2032,3 +2032,275 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a sparse matrix from a list of (row,column,value)
+// triplets (see the blaze::fromTriplets() function) can be executed in parallel. In case the
+// number of given triplets is larger or equal to this threshold, the sorting and combining of the
+// triplets is executed in parallel. If the number of triplets is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATASSEMBLE_THRESHOLD 100000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSEMBLE_THRESHOLD
+#define BLAZE_SMP_SMATASSEMBLE_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the conversion of a sparse matrix between row-major and
+// column-major storage order (as for instance triggered by the assignment of a transpose sparse
+// matrix or the assignment of a sparse matrix with opposite storage order) can be executed in
+// parallel. In case the number of non-zero elements of the sparse matrix is larger or equal to
+// this threshold, the counting and distribution of the elements is executed in parallel. If the
+// number of non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 100000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 100000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRANSPOSE_THRESHOLD
+#define BLAZE_SMP_SMATTRANSPOSE_THRESHOLD 100000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This threshold specifies when the rows of a single level of a level-scheduled sparse triangular
+// solve (see the solve() functions for sparse matrices) can be computed in parallel. In case the
+// number of rows of a level is larger or equal to this threshold, the rows of the level are
+// distributed among the available threads, in case the number of rows is below this threshold the
+// level is processed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 1024. In case the threshold is set to 0, the operation
+// is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATTRSV_THRESHOLD 1024UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATTRSV_THRESHOLD
+#define BLAZE_SMP_SMATTRSV_THRESHOLD 1024UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP permutation threshold.
+// \ingroup config
+//
+// This threshold specifies when the symmetric or general permutation of a sparse matrix or the
+// permutation of a dense vector can be executed in parallel (see the permute() functions). In case
+// the number of non-zero elements of the sparse matrix or the size of the dense vector is equal or
+// higher than this value, the permutation is executed in parallel. Otherwise the permutation is
+// executed by a single thread.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_PERMUTE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_PERMUTE_THRESHOLD
+#define BLAZE_SMP_PERMUTE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix compaction threshold.
+// \ingroup config
+//
+// This threshold specifies when the compaction of a CompressedMatrixBuilder into a contiguous
+// CompressedMatrix can be executed in parallel. In case the number of inserted elements of the
+// builder is smaller than this threshold, the compaction is executed serially. In case the number
+// of elements is larger or equal than this threshold, the compaction is executed in parallel.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATCOMPACT_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATCOMPACT_THRESHOLD
+#define BLAZE_SMP_SMATCOMPACT_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a sparse vector or a sparse matrix (as for
+// instance sum(), min(), max() or prod()) and the computation of the norm of a sparse vector or a
+// sparse matrix (as for instance norm(), sqrNorm(), l1Norm() or maxNorm()) can be executed in
+// parallel. In case the number of non-zero elements of the sparse vector or sparse matrix is equal
+// or higher than this value, the reduction is executed in parallel. Otherwise the reduction is
+// executed by a single thread.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SPARSEREDUCE_THRESHOLD 40000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SPARSEREDUCE_THRESHOLD
+#define BLAZE_SMP_SPARSEREDUCE_THRESHOLD 40000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense vector (as for instance sum(),
+// prod(), min(), max() or reduce()) and the computation of the norm of a dense vector (as for
+// instance norm(), sqrNorm(), l1Norm() or lpNorm()) can be executed in parallel. In case the
+// number of elements of the dense vector is equal or higher than this value, the reduction is
+// executed in parallel. Otherwise the reduction is executed by a single thread.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when the scalar product (inner product) of two dense vectors can be
+// executed in parallel. In case the number of elements of the dense vectors is equal or higher
+// than this value, the inner product is executed in parallel. Otherwise the inner product is
+// executed by a single thread.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs. Also note that the provided default has been
+// determined using the OpenMP parallelization and requires individual adaption for the C++11
+// and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
@@ -0,0 +1,295 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/Calibration.h
+//  \brief Header file for the runtime calibration of the Blaze thresholds
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_CALIBRATION_H_
+#define _BLAZE_MATH_CALIBRATION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/TransposeFlag.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/timing/WcTimer.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CALIBRATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Calibration functions */
+//@{
+void calibrateThresholds();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Measures the runtime of a single execution of the given operation.
+// \ingroup math
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation (in seconds).
+//
+// This function repeats the given operation until a single time measurement takes at least one
+// millisecond and returns the minimum runtime per execution of five such measurements.
+*/
+template< typename OP >  // Type of the operation
+double calibrationTime( OP& op )
+{
+   timing::WcTimer timer;
+   size_t runs( 1UL );
+
+   op();
+
+   while( true ) {
+      timer.start();
+      for( size_t i=0UL; i<runs; ++i ) op();
+      timer.end();
+      if( timer.last() >= 1E-3 ) break;
+      runs *= 2UL;
+   }
+
+   timer.reset();
+
+   for( size_t rep=0UL; rep<5UL; ++rep ) {
+      timer.start();
+      for( size_t i=0UL; i<runs; ++i ) op();
+      timer.end();
+   }
+
+   return timer.min() / runs;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Determines the crossover point of a single threshold.
+// \ingroup math
+//
+// \param threshold The threshold to be calibrated.
+// \param first The smallest problem size to be tested.
+// \param last The largest problem size to be tested.
+// \param unit Conversion of a problem size into the unit of the threshold.
+// \param setup Creates the operation for a given problem size.
+// \return void
+//
+// This function doubles the problem size from \a first to \a last and times the operation
+// created by \a setup once with the maximum threshold (i.e. with serial execution or with the
+// kernel for small operands) and once with the minimum threshold (i.e. with parallel execution
+// or with the kernel for large operands). The threshold is set to the first problem size for
+// which the latter is faster by at least 5 percent. In case there is no such problem size, the
+// threshold is set to at least twice the largest tested problem size.
+*/
+template< typename UT    // Type of the unit conversion
+        , typename ST >  // Type of the operation setup
+void calibrateThreshold( size_t& threshold, size_t first, size_t last, UT unit, ST setup )
+{
+   const size_t previous( threshold );
+
+   for( size_t n=first; n<=last; n*=2UL )
+   {
+      auto op( setup( n ) );
+
+      threshold = std::numeric_limits<size_t>::max();
+      const double lower( calibrationTime( op ) );
+
+      threshold = 1UL;
+      const double upper( calibrationTime( op ) );
+
+      if( upper < 0.95 * lower ) {
+         threshold = unit( n );
+         return;
+      }
+   }
+
+   threshold = max( previous, 2UL*unit( last ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calibrates the thresholds on the current machine.
+// \ingroup math
+//
+// \return void
+//
+// This function measures the crossover points between the kernels for small and large operands
+// and, in case more than one thread is available, between serial and parallel execution for
+// the most common dense vector and dense matrix operations on the current machine and updates
+// the runtime thresholds accordingly. All other thresholds keep their current values. The
+// results can be persisted via saveThresholds() and restored via loadThresholds() or the
+// \c BLAZE_THRESHOLDS environment variable:
+
+   \code
+   blaze::calibrateThresholds();
+   blaze::saveThresholds( "blaze.thresholds" );
+   \endcode
+
+// Note that this function is not included via <tt><blaze/Math.h></tt>, but requires the explicit
+// inclusion of <tt><blaze/math/Calibration.h></tt>. Also note that the calibration takes several
+// seconds and that the results for the SMP thresholds depend on the number of threads at the
+// time of the calibration. Furthermore, the calibration is not thread-safe: No Blaze operation
+// must be executed concurrently to the call of this function.
+*/
+inline void calibrateThresholds()
+{
+   using VT  = DynamicVector<double,columnVector>;
+   using MT  = DynamicMatrix<double,rowMajor>;
+   using TMT = DynamicMatrix<double,columnMajor>;
+
+   double sink( 0.0 );
+
+   const auto linear    = []( size_t n ) { return n; };
+   const auto quadratic = []( size_t n ) { return n*n; };
+
+
+   // Calibration of the kernel thresholds
+   calibrateThreshold( DMATDVECMULT_THRESHOLD, 16UL, 2048UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), x=VT( n, 1.0 ), y=VT( n )]() mutable { y = serial( A * x ); };
+   } );
+
+   calibrateThreshold( TDMATDVECMULT_THRESHOLD, 16UL, 2048UL, quadratic, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), x=VT( n, 1.0 ), y=VT( n )]() mutable { y = serial( A * x ); };
+   } );
+
+   calibrateThreshold( DMATDMATMULT_THRESHOLD, 8UL, 512UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n, 1.0 ), C=MT( n, n )]() mutable { C = serial( A * B ); };
+   } );
+
+   calibrateThreshold( TDMATTDMATMULT_THRESHOLD, 8UL, 512UL, quadratic, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), B=TMT( n, n, 1.0 ), C=TMT( n, n )]() mutable { C = serial( A * B ); };
+   } );
+
+   if( getNumThreads() < 2UL )
+      return;
+
+
+   // Calibration of the dense vector SMP thresholds
+   calibrateThreshold( SMP_DVECASSIGN_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n )]() mutable { b = a; };
+   } );
+
+   calibrateThreshold( SMP_DVECSCALARMULT_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n )]() mutable { b = a * 2.0; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECADD_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a + b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECSUB_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a - b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECMULT_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a * b; };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECDIV_THRESHOLD, 1024UL, 2097152UL, linear, []( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), c=VT( n )]() mutable { c = a / b; };
+   } );
+
+   calibrateThreshold( SMP_DVECREDUCE_THRESHOLD, 1024UL, 2097152UL, linear, [&sink]( size_t n ) {
+      return [a=VT( n, 1.0 ), &sink]() { sink += sum( a ); };
+   } );
+
+   calibrateThreshold( SMP_DVECDVECINNER_THRESHOLD, 1024UL, 2097152UL, linear, [&sink]( size_t n ) {
+      return [a=VT( n, 1.0 ), b=VT( n, 2.0 ), &sink]() { sink += dot( a, b ); };
+   } );
+
+
+   // Calibration of the dense matrix SMP thresholds
+   calibrateThreshold( SMP_DMATASSIGN_THRESHOLD, 32UL, 1024UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n )]() mutable { B = A; };
+   } );
+
+   calibrateThreshold( SMP_DMATSCALARMULT_THRESHOLD, 32UL, 1024UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n )]() mutable { B = A * 2.0; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATADD_THRESHOLD, 32UL, 1024UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n, 2.0 ), C=MT( n, n )]() mutable { C = A + B; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATSUB_THRESHOLD, 32UL, 1024UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n, 2.0 ), C=MT( n, n )]() mutable { C = A - B; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATSCHUR_THRESHOLD, 32UL, 1024UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n, 2.0 ), C=MT( n, n )]() mutable { C = A % B; };
+   } );
+
+   calibrateThreshold( SMP_DMATDVECMULT_THRESHOLD, 16UL, 2048UL, linear, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), x=VT( n, 1.0 ), y=VT( n )]() mutable { y = A * x; };
+   } );
+
+   calibrateThreshold( SMP_TDMATDVECMULT_THRESHOLD, 16UL, 2048UL, linear, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), x=VT( n, 1.0 ), y=VT( n )]() mutable { y = A * x; };
+   } );
+
+   calibrateThreshold( SMP_DMATDMATMULT_THRESHOLD, 8UL, 512UL, quadratic, []( size_t n ) {
+      return [A=MT( n, n, 1.0 ), B=MT( n, n, 1.0 ), C=MT( n, n )]() mutable { C = A * B; };
+   } );
+
+   calibrateThreshold( SMP_TDMATTDMATMULT_THRESHOLD, 8UL, 512UL, quadratic, []( size_t n ) {
+      return [A=TMT( n, n, 1.0 ), B=TMT( n, n, 1.0 ), C=TMT( n, n )]() mutable { C = A * B; };
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,6 +43,7 @@
 #include <cmath>
 #include <vector>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/CompressedMatrixBuilder.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/IdentityMatrix.h>
@@ -69,40 +70,41 @@ namespace blaze {
 // This specialization of the Rand class creates random instances of CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-class Rand< CompressedMatrix<Type,SO> >
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+class Rand< CompressedMatrix<Type,SO,IT> >
 {
  public:
    //**Generate functions**************************************************************************
    /*!\name Generate functions */
    //@{
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n ) const;
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline const CompressedMatrix<Type,SO> generate( size_t m, size_t n, size_t nonzeros,
-                                                    const Arg& min, const Arg& max ) const;
+   inline const CompressedMatrix<Type,SO,IT> generate( size_t m, size_t n, size_t nonzeros,
+                                                       const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
 
    //**Randomize functions*************************************************************************
    /*!\name Randomize functions */
    //@{
-   inline void randomize( CompressedMatrix<Type,SO>& matrix ) const;
-   inline void randomize( CompressedMatrix<Type,false>& matrix, size_t nonzeros ) const;
-   inline void randomize( CompressedMatrix<Type,true>& matrix, size_t nonzeros ) const;
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix ) const;
+   inline void randomize( CompressedMatrix<Type,false,IT>& matrix, size_t nonzeros ) const;
+   inline void randomize( CompressedMatrix<Type,true,IT>& matrix, size_t nonzeros ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,SO>& matrix, const Arg& min, const Arg& max ) const;
+   inline void randomize( CompressedMatrix<Type,SO,IT>& matrix, const Arg& min, const Arg& max ) const;
 
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,false>& matrix, size_t nonzeros,
+   inline void randomize( CompressedMatrix<Type,false,IT>& matrix, size_t nonzeros,
                           const Arg& min, const Arg& max ) const;
    template< typename Arg >
-   inline void randomize( CompressedMatrix<Type,true>& matrix, size_t nonzeros,
+   inline void randomize( CompressedMatrix<Type,true,IT>& matrix, size_t nonzeros,
                           const Arg& min, const Arg& max ) const;
    //@}
    //**********************************************************************************************
@@ -120,11 +122,12 @@ class Rand< CompressedMatrix<Type,SO> >
 // \return The generated random matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix );
 
    return matrix;
@@ -144,15 +147,16 @@ inline const CompressedMatrix<Type,SO>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, size_t nonzeros ) const
 {
    if( nonzeros > m*n ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of non-zero elements" );
    }
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, nonzeros );
 
    return matrix;
@@ -172,12 +176,13 @@ inline const CompressedMatrix<Type,SO>
 // \param max The largest possible value for a matrix element.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, const Arg& min, const Arg& max ) const
 {
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, min, max );
 
    return matrix;
@@ -199,17 +204,18 @@ inline const CompressedMatrix<Type,SO>
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline const CompressedMatrix<Type,SO>
-   Rand< CompressedMatrix<Type,SO> >::generate( size_t m, size_t n, size_t nonzeros,
-                                                const Arg& min, const Arg& max ) const
+inline const CompressedMatrix<Type,SO,IT>
+   Rand< CompressedMatrix<Type,SO,IT> >::generate( size_t m, size_t n, size_t nonzeros,
+                                                   const Arg& min, const Arg& max ) const
 {
    if( nonzeros > m*n ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of non-zero elements" );
    }
 
-   CompressedMatrix<Type,SO> matrix( m, n );
+   CompressedMatrix<Type,SO,IT> matrix( m, n );
    randomize( matrix, nonzeros, min, max );
 
    return matrix;
@@ -226,8 +232,9 @@ inline const CompressedMatrix<Type,SO>
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -252,8 +259,9 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,false>& matrix, size_t nonzeros ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,false,IT>& matrix, size_t nonzeros ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -298,8 +306,9 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,true>& matrix, size_t nonzeros ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,true,IT>& matrix, size_t nonzeros ) const
 {
    const size_t m( matrix.rows()    );
    const size_t n( matrix.columns() );
@@ -344,9 +353,10 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \return void
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,SO>& matrix,
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,SO,IT>& matrix,
                                                           const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
@@ -374,9 +384,10 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,false>& matrix,
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,false,IT>& matrix,
                                                           size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
@@ -424,9 +435,10 @@ inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,
 // \exception std::invalid_argument Invalid number of non-zero elements.
 */
 template< typename Type   // Data type of the matrix
-        , bool SO >       // Storage order
+        , bool SO         // Storage order
+        , typename IT >   // Index type
 template< typename Arg >  // Min/max argument type
-inline void Rand< CompressedMatrix<Type,SO> >::randomize( CompressedMatrix<Type,true>& matrix,
+inline void Rand< CompressedMatrix<Type,SO,IT> >::randomize( CompressedMatrix<Type,true,IT>& matrix,
                                                           size_t nonzeros, const Arg& min, const Arg& max ) const
 {
    const size_t m( matrix.rows()    );
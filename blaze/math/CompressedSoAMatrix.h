@@ -0,0 +1,515 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/CompressedSoAMatrix.h
+//  \brief Header file for the complete CompressedSoAMatrix implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/CompressedSoAMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/typetraits/HasLoad.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for CompressedSoAMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of CompressedSoAMatrix. The
+// random matrices are generated via the Rand specialization for CompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+class Rand< CompressedSoAMatrix<Type,SO,IT> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   template< typename... Args >
+   inline const CompressedSoAMatrix<Type,SO,IT> generate( size_t m, size_t n, const Args&... args ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   template< typename... Args >
+   inline void randomize( CompressedSoAMatrix<Type,SO,IT>& matrix, const Args&... args ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random CompressedSoAMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param args The optional number of non-zero elements and min/max arguments.
+// \return The generated random matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , typename IT >        // Index type
+template< typename... Args >   // Types of the optional arguments
+inline const CompressedSoAMatrix<Type,SO,IT>
+   Rand< CompressedSoAMatrix<Type,SO,IT> >::generate( size_t m, size_t n, const Args&... args ) const
+{
+   return CompressedSoAMatrix<Type,SO,IT>(
+      Rand< CompressedMatrix<Type,SO,IT> >().generate( m, n, args... ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a CompressedSoAMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param args The optional number of non-zero elements and min/max arguments.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , typename IT >        // Index type
+template< typename... Args >   // Types of the optional arguments
+inline void Rand< CompressedSoAMatrix<Type,SO,IT> >::randomize( CompressedSoAMatrix<Type,SO,IT>& matrix,
+                                                               const Args&... args ) const
+{
+   CompressedMatrix<Type,SO,IT> tmp( matrix.rows(), matrix.columns() );
+   Rand< CompressedMatrix<Type,SO,IT> >().randomize( tmp, args... );
+   matrix = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE ROW/DENSE VECTOR INNER PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the CompressedSoAMatrix row/dense vector inner product.
+// \ingroup compressed_soa_matrix
+//
+// This helper evaluates whether the inner product between a row of a CompressedSoAMatrix and
+// the dense vector \a VT can be computed by means of SIMD loads of the values and AVX2 or
+// AVX-512 gather operations on the dense vector.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+struct SoAInnerHelper
+{
+   //**Type definitions****************************************************************************
+   //! Element type of the dense vector.
+   using ET = ElementType_t<VT>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( ( bool( BLAZE_AVX2_MODE ) || bool( BLAZE_AVX512F_MODE ) ) &&
+        useOptimizedKernels &&
+        IsContiguous_v<VT> &&
+        IsSame_v< Type, RemoveCV_t<ET> > &&
+        ( IsFloat_v<Type> || IsDouble_v<Type> ) &&
+        ( sizeof(IT) == 4UL || sizeof(IT) == 8UL ) );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the inner product of a CompressedSoAMatrix row and
+//        a dense vector.
+// \ingroup compressed_soa_matrix
+//
+// \param values Pointer to the values of the row.
+// \param indices Pointer to the column indices of the row.
+// \param nonzeros The number of non-zero elements of the row.
+// \param x The dense vector operand.
+// \return The result of the inner product.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+inline auto soaInner( const Type* values, const IT* indices, size_t nonzeros, const VT& x )
+   -> DisableIf_t< SoAInnerHelper<Type,IT,VT>::value, MultTrait_t< Type, ElementType_t<VT> > >
+{
+   using MultType = MultTrait_t< Type, ElementType_t<VT> >;
+
+   if( nonzeros == 0UL ) return MultType{};
+
+   MultType sp( values[0UL] * x[indices[0UL]] );
+
+   for( size_t k=1UL; k<nonzeros; ++k ) {
+      sp += values[k] * x[indices[k]];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the inner product of a CompressedSoAMatrix
+//        row and a dense vector.
+// \ingroup compressed_soa_matrix
+//
+// \param values Pointer to the values of the row.
+// \param indices Pointer to the column indices of the row.
+// \param nonzeros The number of non-zero elements of the row.
+// \param x The dense vector operand.
+// \return The result of the inner product.
+//
+// This kernel loads the values of the row via unaligned SIMD loads and gathers the matching
+// elements of the dense vector via the AVX2 or AVX-512 gather instructions. Two independent
+// accumulators are used to hide the latency of the gather operations.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+inline auto soaInner( const Type* values, const IT* indices, size_t nonzeros, const VT& x )
+   -> EnableIf_t< SoAInnerHelper<Type,IT,VT>::value, MultTrait_t< Type, ElementType_t<VT> > >
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   const Type* const data( x.data() );
+
+   SIMDTrait_t<Type> xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+SIMDSIZE*2UL) <= nonzeros; k+=SIMDSIZE*2UL ) {
+      xmm1 += loadu( values+k          ) * gather( data, indices+k          );
+      xmm2 += loadu( values+k+SIMDSIZE ) * gather( data, indices+k+SIMDSIZE );
+   }
+   for( ; (k+SIMDSIZE) <= nonzeros; k+=SIMDSIZE ) {
+      xmm1 += loadu( values+k ) * gather( data, indices+k );
+   }
+
+   Type sp( sum( xmm1 + xmm2 ) );
+
+   for( ; k<nonzeros; ++k ) {
+      sp += values[k] * data[indices[k]];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a row of a row-major CompressedSoAMatrix and a dense vector
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup compressed_soa_matrix
+//
+// \param lhs The left-hand side row of a CompressedSoAMatrix.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This overload of the inner product operator accesses the value and index arrays of the
+// underlying CompressedSoAMatrix directly. Since it is selected for each row of a sparse
+// matrix/dense vector multiplication, the complete multiplication of a row-major
+// CompressedSoAMatrix with a dense vector is computed by the optimized kernels.
+*/
+template< typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CRAs      // Compile time row arguments
+        , typename VT >       // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const Row< const CompressedSoAMatrix<Type,false,IT>, true, false, false, CRAs... >& lhs
+            , const DenseVector<VT,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( lhs.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const CompressedSoAMatrix<Type,false,IT>& A( lhs.operand() );
+   const size_t i( lhs.row() );
+
+   CT x( ~rhs );
+
+   return soaInner<Type,IT,XT>( A.values(i), A.indices(i), A.nonZeros(i), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a row of a row-major CompressedSoAMatrix and a dense vector
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup compressed_soa_matrix
+//
+// \param lhs The left-hand side row of a CompressedSoAMatrix.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CRAs      // Compile time row arguments
+        , typename VT >       // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const Row< CompressedSoAMatrix<Type,false,IT>, true, false, false, CRAs... >& lhs
+            , const DenseVector<VT,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( lhs.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const CompressedSoAMatrix<Type,false,IT>& A( lhs.operand() );
+   const size_t i( lhs.row() );
+
+   CT x( ~rhs );
+
+   return soaInner<Type,IT,XT>( A.values(i), A.indices(i), A.nonZeros(i), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  REDUCTION OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the reduction of a CompressedSoAMatrix.
+// \ingroup compressed_soa_matrix
+//
+// This helper evaluates whether the reduction of the elements of a CompressedSoAMatrix with
+// element type \a Type by means of the reduction operation \a OP can be vectorized.
+*/
+template< typename Type  // Data type of the matrix
+        , typename OP >  // Type of the reduction operation
+struct SoAReduceHelper
+{
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( useOptimizedKernels &&
+        IsVectorizable_v<Type> &&
+        If_t< HasSIMDEnabled_v<OP>, GetSIMDEnabled<OP,Type,Type>, HasLoad<OP> >::value );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the reduction of a single row/column of a
+//        CompressedSoAMatrix.
+// \ingroup compressed_soa_matrix
+//
+// \param values Pointer to the values of the row/column.
+// \param nonzeros The number of non-zero elements of the row/column (at least 1).
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+*/
+template< typename Type  // Data type of the matrix
+        , typename OP >  // Type of the reduction operation
+inline auto soaReduce( const Type* values, size_t nonzeros, OP op )
+   -> DisableIf_t< SoAReduceHelper<Type,OP>::value, Type >
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros > 0UL, "Invalid number of non-zero elements" );
+
+   Type redux( values[0UL] );
+
+   for( size_t k=1UL; k<nonzeros; ++k ) {
+      redux = op( redux, values[k] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the reduction of a single row/column of a
+//        CompressedSoAMatrix.
+// \ingroup compressed_soa_matrix
+//
+// \param values Pointer to the values of the row/column.
+// \param nonzeros The number of non-zero elements of the row/column (at least 1).
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+*/
+template< typename Type  // Data type of the matrix
+        , typename OP >  // Type of the reduction operation
+inline auto soaReduce( const Type* values, size_t nonzeros, OP op )
+   -> EnableIf_t< SoAReduceHelper<Type,OP>::value, Type >
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros > 0UL, "Invalid number of non-zero elements" );
+
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   if( nonzeros < SIMDSIZE ) {
+      Type redux( values[0UL] );
+      for( size_t k=1UL; k<nonzeros; ++k ) {
+         redux = op( redux, values[k] );
+      }
+      return redux;
+   }
+
+   SIMDTrait_t<Type> xmm( loadu( values ) );
+   size_t k( SIMDSIZE );
+
+   for( ; (k+SIMDSIZE) <= nonzeros; k+=SIMDSIZE ) {
+      xmm = op( xmm, loadu( values+k ) );
+   }
+
+   Type redux( reduce( xmm, op ) );
+
+   for( ; k<nonzeros; ++k ) {
+      redux = op( redux, values[k] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Performs a custom reduction operation on the given CompressedSoAMatrix.
+// \ingroup compressed_soa_matrix
+//
+// \param sm The given compressed matrix for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This overload of the reduce() function reduces the non-zero elements of a CompressedSoAMatrix
+// directly on the value array. In case the reduction operation is vectorizable, the values of
+// each row/column are reduced by means of SIMD operations. Analogous to the reduction of other
+// sparse matrices, the evaluation order of the reduction operation is unspecified.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT    // Index type
+        , typename OP >  // Type of the reduction operation
+inline Type reduce( const CompressedSoAMatrix<Type,SO,IT>& sm, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t iend( SO ? sm.columns() : sm.rows() );
+
+   if( sm.rows() == 0UL || sm.columns() == 0UL ) return Type{};
+
+   Type redux0{};
+
+   for( size_t i=0UL; i<iend; ++i )
+   {
+      const size_t nonzeros( sm.nonZeros(i) );
+
+      if( nonzeros == 0UL ) continue;
+
+      const Type redux1( soaReduce( sm.values(i), nonzeros, op ) );
+
+      if( i == 0UL ) redux0 = redux1;
+      else           redux0 = op( redux0, redux1 );
+   }
+
+   return redux0;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -87,6 +87,8 @@
 #include <blaze/math/functors/Log.h>
 #include <blaze/math/functors/Log2.h>
 #include <blaze/math/functors/Log10.h>
+#include <blaze/math/functors/LogicalAnd.h>
+#include <blaze/math/functors/LogicalOr.h>
 #include <blaze/math/functors/LpNorm.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
@@ -0,0 +1,446 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/PatternMatrix.h
+//  \brief Header file for the complete PatternMatrix implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_PATTERNMATRIX_H_
+#define _BLAZE_MATH_PATTERNMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/sparse/PatternMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/SparseMatrix.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsSame.h>
+#include <blaze/util/typetraits/RemoveCV.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  RAND SPECIALIZATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the Rand class template for PatternMatrix.
+// \ingroup random
+//
+// This specialization of the Rand class creates random instances of PatternMatrix. The
+// random patterns are generated via the Rand specialization for CompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+class Rand< PatternMatrix<Type,SO,IT> >
+{
+ public:
+   //**Generate functions**************************************************************************
+   /*!\name Generate functions */
+   //@{
+   template< typename... Args >
+   inline const PatternMatrix<Type,SO,IT> generate( size_t m, size_t n, const Args&... args ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Randomize functions*************************************************************************
+   /*!\name Randomize functions */
+   //@{
+   template< typename... Args >
+   inline void randomize( PatternMatrix<Type,SO,IT>& matrix, const Args&... args ) const;
+   //@}
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Generation of a random PatternMatrix.
+//
+// \param m The number of rows of the random matrix.
+// \param n The number of columns of the random matrix.
+// \param args The optional number of non-zero elements and min/max arguments.
+// \return The generated random matrix.
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , typename IT >        // Index type
+template< typename... Args >   // Types of the optional arguments
+inline const PatternMatrix<Type,SO,IT>
+   Rand< PatternMatrix<Type,SO,IT> >::generate( size_t m, size_t n, const Args&... args ) const
+{
+   return PatternMatrix<Type,SO,IT>(
+      Rand< CompressedMatrix<Type,SO,IT> >().generate( m, n, args... ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Randomization of a PatternMatrix.
+//
+// \param matrix The matrix to be randomized.
+// \param args The optional number of non-zero elements and min/max arguments.
+// \return void
+*/
+template< typename Type        // Data type of the matrix
+        , bool SO              // Storage order
+        , typename IT >        // Index type
+template< typename... Args >   // Types of the optional arguments
+inline void Rand< PatternMatrix<Type,SO,IT> >::randomize( PatternMatrix<Type,SO,IT>& matrix,
+                                                               const Args&... args ) const
+{
+   CompressedMatrix<Type,SO,IT> tmp( matrix.rows(), matrix.columns() );
+   Rand< CompressedMatrix<Type,SO,IT> >().randomize( tmp, args... );
+   matrix = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE ROW/COLUMN AND DENSE VECTOR INNER PRODUCT KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the PatternMatrix row/column and dense vector inner product.
+// \ingroup pattern_matrix
+//
+// This helper evaluates whether the inner product between a row or column of a PatternMatrix
+// and the dense vector \a VT can be computed by means of AVX2 or AVX-512 gather operations on the
+// dense vector.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+struct PatternInnerHelper
+{
+   //**Type definitions****************************************************************************
+   //! Element type of the dense vector.
+   using ET = ElementType_t<VT>;
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   static constexpr bool value =
+      ( ( bool( BLAZE_AVX2_MODE ) || bool( BLAZE_AVX512F_MODE ) ) &&
+        useOptimizedKernels &&
+        IsContiguous_v<VT> &&
+        IsSame_v< Type, RemoveCV_t<ET> > &&
+        ( IsFloat_v<Type> || IsDouble_v<Type> ) &&
+        ( sizeof(IT) == 4UL || sizeof(IT) == 8UL ) );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default backend implementation of the inner product of a PatternMatrix row or column
+//        and a dense vector.
+// \ingroup pattern_matrix
+//
+// \param indices Pointer to the indices of the row or column.
+// \param nonzeros The number of non-zero elements of the row or column.
+// \param x The dense vector operand.
+// \return The result of the inner product.
+//
+// Since all elements of a PatternMatrix have the value 1, the inner product reduces to the sum
+// of the selected elements of the dense vector.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+inline auto patternInner( const IT* indices, size_t nonzeros, const VT& x )
+   -> DisableIf_t< PatternInnerHelper<Type,IT,VT>::value, MultTrait_t< Type, ElementType_t<VT> > >
+{
+   using MultType = MultTrait_t< Type, ElementType_t<VT> >;
+
+   if( nonzeros == 0UL ) return MultType{};
+
+   MultType sp( x[indices[0UL]] );
+
+   for( size_t k=1UL; k<nonzeros; ++k ) {
+      sp += x[indices[k]];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized backend implementation of the inner product of a PatternMatrix row
+//        or column and a dense vector.
+// \ingroup pattern_matrix
+//
+// \param indices Pointer to the indices of the row or column.
+// \param nonzeros The number of non-zero elements of the row or column.
+// \param x The dense vector operand.
+// \return The result of the inner product.
+//
+// This kernel gathers the selected elements of the dense vector via the AVX2 or AVX-512 gather
+// instructions and accumulates them in two independent accumulators.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT    // Index type
+        , typename VT >  // Type of the dense vector
+inline auto patternInner( const IT* indices, size_t nonzeros, const VT& x )
+   -> EnableIf_t< PatternInnerHelper<Type,IT,VT>::value, MultTrait_t< Type, ElementType_t<VT> > >
+{
+   constexpr size_t SIMDSIZE = SIMDTrait<Type>::size;
+
+   const Type* const data( x.data() );
+
+   SIMDTrait_t<Type> xmm1, xmm2;
+   size_t k( 0UL );
+
+   for( ; (k+SIMDSIZE*2UL) <= nonzeros; k+=SIMDSIZE*2UL ) {
+      xmm1 += gather( data, indices+k          );
+      xmm2 += gather( data, indices+k+SIMDSIZE );
+   }
+   for( ; (k+SIMDSIZE) <= nonzeros; k+=SIMDSIZE ) {
+      xmm1 += gather( data, indices+k );
+   }
+
+   Type sp( sum( xmm1 + xmm2 ) );
+
+   for( ; k<nonzeros; ++k ) {
+      sp += data[indices[k]];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a row of a row-major PatternMatrix and a dense vector
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup pattern_matrix
+//
+// \param lhs The left-hand side row of a PatternMatrix.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This overload of the inner product operator accesses the index array of the underlying
+// PatternMatrix directly and never loads any values. Since it is selected for each row of a
+// sparse matrix/dense vector multiplication, the complete multiplication of a row-major
+// PatternMatrix with a dense vector is computed by the value-free kernels.
+*/
+template< typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CRAs      // Compile time row arguments
+        , typename VT >       // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const Row< const PatternMatrix<Type,false,IT>, true, false, false, CRAs... >& lhs
+            , const DenseVector<VT,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( lhs.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const PatternMatrix<Type,false,IT>& A( lhs.operand() );
+   const size_t i( lhs.row() );
+
+   CT x( ~rhs );
+
+   return patternInner<Type,IT,XT>( A.indices(i), A.nonZeros(i), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a row of a row-major PatternMatrix and a dense vector
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup pattern_matrix
+//
+// \param lhs The left-hand side row of a PatternMatrix.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CRAs      // Compile time row arguments
+        , typename VT >       // Type of the right-hand side dense vector
+inline decltype(auto)
+   operator*( const Row< PatternMatrix<Type,false,IT>, true, false, false, CRAs... >& lhs
+            , const DenseVector<VT,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( lhs.size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const PatternMatrix<Type,false,IT>& A( lhs.operand() );
+   const size_t i( lhs.row() );
+
+   CT x( ~rhs );
+
+   return patternInner<Type,IT,XT>( A.indices(i), A.nonZeros(i), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a dense vector and a column of a column-major PatternMatrix
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup pattern_matrix
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side column of a PatternMatrix.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This overload of the inner product operator accesses the index array of the underlying
+// PatternMatrix directly and never loads any values. Since it is selected for each column of a
+// dense vector/sparse matrix multiplication, the complete multiplication of a dense vector with
+// a column-major PatternMatrix is computed by the value-free kernels.
+*/
+template< typename VT         // Type of the left-hand side dense vector
+        , typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CCAs >    // Compile time column arguments
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& lhs
+            , const Column< const PatternMatrix<Type,true,IT>, true, false, false, CCAs... >& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( (~lhs).size() != rhs.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const PatternMatrix<Type,true,IT>& A( rhs.operand() );
+   const size_t j( rhs.column() );
+
+   CT x( ~lhs );
+
+   return patternInner<Type,IT,XT>( A.indices(j), A.nonZeros(j), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inner product of a dense vector and a column of a column-major PatternMatrix
+//        (\f$ s=\vec{a}^T*\vec{b} \f$).
+// \ingroup pattern_matrix
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side column of a PatternMatrix.
+// \return The scalar product.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename VT         // Type of the left-hand side dense vector
+        , typename Type       // Data type of the matrix
+        , typename IT         // Index type
+        , size_t... CCAs >    // Compile time column arguments
+inline decltype(auto)
+   operator*( const DenseVector<VT,true>& lhs
+            , const Column< PatternMatrix<Type,true,IT>, true, false, false, CCAs... >& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<VT>;
+   using XT = RemoveReference_t<CT>;
+
+   if( (~lhs).size() != rhs.size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   const PatternMatrix<Type,true,IT>& A( rhs.operand() );
+   const size_t j( rhs.column() );
+
+   CT x( ~lhs );
+
+   return patternInner<Type,IT,XT>( A.indices(j), A.nonZeros(j), x );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
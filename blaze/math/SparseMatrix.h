@@ -95,7 +95,12 @@
 #include <blaze/math/Matrix.h>
 #include <blaze/math/smp/DenseMatrix.h>
 #include <blaze/math/smp/SparseMatrix.h>
+#include <blaze/math/sparse/LDLT.h>
+#include <blaze/math/sparse/Ordering.h>
+#include <blaze/math/sparse/Semiring.h>
 #include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/sparse/SymmetricMult.h>
+#include <blaze/math/sparse/TriangularSolve.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
 #include <blaze/math/views/Submatrix.h>
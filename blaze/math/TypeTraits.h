@@ -185,6 +185,7 @@
 #include <blaze/math/typetraits/IsOpposedView.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsPaddingEnabled.h>
+#include <blaze/math/typetraits/IsPattern.h>
 #include <blaze/math/typetraits/IsProxy.h>
 #include <blaze/math/typetraits/IsReduceExpr.h>
 #include <blaze/math/typetraits/IsResizable.h>
@@ -244,6 +245,7 @@
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/typetraits/Size.h>
+#include <blaze/math/typetraits/StorageIndex.h>
 #include <blaze/math/typetraits/StorageOrder.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
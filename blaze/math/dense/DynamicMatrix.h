@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/UniformMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -102,6 +103,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -122,6 +124,7 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
@@ -358,6 +361,7 @@ class DynamicMatrix
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
+   inline void   numaDistribute();
    inline void   swap( DynamicMatrix& m ) noexcept;
    //@}
    //**********************************************************************************************
@@ -373,6 +377,14 @@ class DynamicMatrix
    //**********************************************************************************************
 
  private:
+   //**Private class Uninitialized*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary helper class for the construction of dynamic matrices.
+   */
+   struct Uninitialized {};
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -496,6 +508,13 @@ class DynamicMatrix
    //**********************************************************************************************
 
  private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DynamicMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -570,13 +589,14 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , n_       ( n )                            // The current number of columns of the matrix
-   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
-   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> )
+   {
+      if( smpFirstTouch && IsBuiltin_v<Type> && canSMPAssign() ) {
+         smpAssign( *this, UniformMatrix<Type,SO>( m_, n_, Type() ) );
+      }
+
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -601,11 +621,24 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
+   if( smpFirstTouch && IsBuiltin_v<Type> && canSMPAssign() ) {
+      smpAssign( *this, UniformMatrix<Type,SO>( m_, n_, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
+      }
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
       }
    }
 
@@ -742,12 +775,20 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Other (&array)[Rows][Cols] )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+   : DynamicMatrix( m.m_, m.n_, Uninitialized() )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
    smpAssign( *this, m );
 
+   if( IsVectorizable_v<Type> ) {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=n_; j<nn_; ++j ) {
+            v_[i*nn_+j] = Type();
+         }
+      }
+   }
+
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 //*************************************************************************************************
@@ -801,6 +842,31 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( const Matrix<MT,SO2>& m )
 
 
 
+//*************************************************************************************************
+/*!\brief Constructor for an uninitialized matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor only allocates the required dynamic memory. In contrast to the public
+// constructor for a matrix of size \f$ m \times n \f$ it neither initializes the matrix elements
+// nor the padding elements, i.e. for built-in element types it does not touch the allocated
+// memory at all. Elements of any other type are default constructed by allocate().
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                            // The current number of rows of the matrix
+   , n_       ( n )                            // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  DESTRUCTOR
@@ -1706,10 +1772,8 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
       capacity_ = m*nn;
    }
    else if( m*nn > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
-      swap( v_, v );
-      deallocate( v );
-      capacity_ = m*nn;
+      DynamicMatrix( m, n ).swap( *this );
+      return;
    }
 
    if( IsVectorizable_v<Type> ) {
@@ -1806,6 +1870,34 @@ inline void DynamicMatrix<Type,SO>::shrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Redistributes the memory of the matrix according to the SMP partitioning.
+//
+// \return void
+//
+// This function moves the elements of the matrix to newly allocated memory, which is first written
+// in parallel by the threads of the thread pool, with the same partitioning as any subsequent
+// thread parallel operation on the matrix (first-touch placement). On NUMA systems the operating
+// system places each memory page on the NUMA node of the thread that first writes to it.
+// Therefore, after this function, the pages of the matrix are distributed among the NUMA nodes of
+// all threads, even if the matrix has been initialized serially. Note however that the thread pool
+// assigns the same part of the matrix to the same thread on a best-effort basis only, i.e.
+// subsequent operations are not guaranteed to work on memory local to the executing thread. Note
+// that the function does not have any effect on the placement in case the size of the matrix is
+// below the SMP threshold or in case the function is called within a serial section, and in case
+// the element type is not a built-in data type (since allocate() default constructs these elements
+// on the calling thread). Also note that all iterators (including end() iterators), all pointers
+// and references to elements of this matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void DynamicMatrix<Type,SO>::numaDistribute()
+{
+   DynamicMatrix( *this ).swap( *this );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Swapping the contents of two matrices.
 //
@@ -3314,6 +3406,7 @@ class DynamicMatrix<Type,true>
    inline void   extend ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t elements );
    inline void   shrinkToFit();
+   inline void   numaDistribute();
    inline void   swap( DynamicMatrix& m ) noexcept;
    //@}
    //**********************************************************************************************
@@ -3329,6 +3422,12 @@ class DynamicMatrix<Type,true>
    //**********************************************************************************************
 
  private:
+   //**Private class Uninitialized*****************************************************************
+   /*!\brief Auxiliary helper class for the construction of dynamic matrices.
+   */
+   struct Uninitialized {};
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT >
@@ -3444,6 +3543,13 @@ class DynamicMatrix<Type,true>
    //**********************************************************************************************
 
  private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline DynamicMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
@@ -3511,13 +3617,14 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
-   : m_       ( m )                            // The current number of rows of the matrix
-   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
-   , n_       ( n )                            // The current number of columns of the matrix
-   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
-   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   if( IsVectorizable_v<Type> ) {
+   if( IsVectorizable_v<Type> )
+   {
+      if( smpFirstTouch && IsBuiltin_v<Type> && canSMPAssign() ) {
+         smpAssign( *this, UniformMatrix<Type,true>( m_, n_, Type() ) );
+      }
+
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3543,11 +3650,24 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : DynamicMatrix( m, n, Uninitialized() )
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
+   if( smpFirstTouch && IsBuiltin_v<Type> && canSMPAssign() ) {
+      smpAssign( *this, UniformMatrix<Type,true>( m_, n_, init ) );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
+      }
+   }
+
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
       }
    }
 
@@ -3696,12 +3816,20 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Other (&array)[Rows][Cols]
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( const DynamicMatrix& m )
-   : DynamicMatrix( m.m_, m.n_ )
+   : DynamicMatrix( m.m_, m.n_, Uninitialized() )
 {
    BLAZE_INTERNAL_ASSERT( capacity_ <= m.capacity_, "Invalid capacity estimation" );
 
    smpAssign( *this, m );
 
+   if( IsVectorizable_v<Type> ) {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=m_; i<mm_; ++i ) {
+            v_[i+j*mm_] = Type();
+         }
+      }
+   }
+
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
 /*! \endcond */
@@ -3758,6 +3886,32 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( const Matrix<MT,SO>& m )
 
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for an uninitialized matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+//
+// This constructor only allocates the required dynamic memory. In contrast to the public
+// constructor for a matrix of size \f$ m \times n \f$ it neither initializes the matrix elements
+// nor the padding elements, i.e. for built-in element types it does not touch the allocated
+// memory at all. Elements of any other type are default constructed by allocate().
+*/
+template< typename Type >  // Data type of the matrix
+inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                            // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
+   , n_       ( n )                            // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  DESTRUCTOR
@@ -4658,10 +4812,8 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
       capacity_ = mm*n;
    }
    else if( mm*n > capacity_ ) {
-      Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
-      swap( v_, v );
-      deallocate( v );
-      capacity_ = mm*n;
+      DynamicMatrix( m, n ).swap( *this );
+      return;
    }
 
    if( IsVectorizable_v<Type> ) {
@@ -4762,6 +4914,27 @@ inline void DynamicMatrix<Type,true>::shrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Redistributes the memory of the matrix according to the SMP partitioning.
+//
+// \return void
+//
+// This function moves the elements of the matrix to newly allocated memory, which is first written
+// in parallel by the threads of the thread pool, with the same partitioning as any subsequent
+// thread parallel operation on the matrix (first-touch placement). Note that all iterators
+// (including end() iterators), all pointers and references to elements of this matrix are
+// invalidated.
+*/
+template< typename Type >  // Data type of the matrix
+inline void DynamicMatrix<Type,true>::numaDistribute()
+{
+   DynamicMatrix( *this ).swap( *this );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Swapping the contents of two matrices.
@@ -6171,6 +6344,9 @@ bool isIntact( const DynamicMatrix<Type,SO>& m ) noexcept;
 
 template< typename Type, bool SO >
 void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcept;
+
+template< typename Type, bool SO >
+void numaDistribute( DynamicMatrix<Type,SO>& m );
 //@}
 //*************************************************************************************************
 
@@ -6308,6 +6484,39 @@ inline void swap( DynamicMatrix<Type,SO>& a, DynamicMatrix<Type,SO>& b ) noexcep
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Redistributes the memory of the given dynamic matrix according to the SMP partitioning.
+// \ingroup dynamic_matrix
+//
+// \param m The matrix to be redistributed.
+// \return void
+//
+// This function moves the elements of the given matrix to newly allocated memory, which is first
+// written in parallel by the threads of the thread pool, with the same partitioning as any
+// subsequent thread parallel operation on the matrix. On NUMA systems this distributes the pages
+// of the matrix among the NUMA nodes of all threads (first-touch placement):
+
+   \code
+   blaze::DynamicMatrix<double> A( 10000UL, 10000UL );
+   // ... Serial initialization of A, e.g. by reading from a file
+
+   numaDistribute( A );  // Distributes the pages of A among the NUMA nodes of the threads
+   \endcode
+
+// Note that the function does not have any effect on the placement in case the size of the
+// matrix is below the SMP threshold or in case the function is called within a serial section.
+// Also note that all iterators (including end() iterators), all pointers and references to
+// elements of the matrix are invalidated.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void numaDistribute( DynamicMatrix<Type,SO>& m )
+{
+   m.numaDistribute();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/UniformVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -99,6 +100,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Transfer.h>
@@ -115,6 +117,7 @@
 #include <blaze/util/Memory.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
@@ -329,6 +332,7 @@ class DynamicVector
    inline void   extend( size_t n, bool preserve=true );
    inline void   reserve( size_t n );
    inline void   shrinkToFit();
+   inline void   numaDistribute();
    inline void   swap( DynamicVector& v ) noexcept;
    //@}
    //**********************************************************************************************
@@ -564,8 +568,13 @@ template< typename Type  // Data type of the vector
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
    : DynamicVector( n )
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( smpFirstTouch && IsBuiltin_v<Type> && canSMPAssign() ) {
+      smpAssign( *this, UniformVector<Type,TF>( size_, init ) );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -1463,7 +1472,8 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       }
 
       if( IsVectorizable_v<Type> ) {
-         for( size_t i=size_; i<newCapacity; ++i )
+         const size_t begin( ( smpFirstTouch && IsBuiltin_v<Type> && !preserve )?( n ):( size_ ) );
+         for( size_t i=begin; i<newCapacity; ++i )
             tmp[i] = Type();
       }
 
@@ -1563,6 +1573,34 @@ inline void DynamicVector<Type,TF>::shrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Redistributes the memory of the vector according to the SMP partitioning.
+//
+// \return void
+//
+// This function moves the elements of the vector to newly allocated memory, which is first written
+// in parallel by the threads of the thread pool, with the same partitioning as any subsequent
+// thread parallel operation on the vector (first-touch placement). On NUMA systems the operating
+// system places each memory page on the NUMA node of the thread that first writes to it.
+// Therefore, after this function, the pages of the vector are distributed among the NUMA nodes of
+// all threads, even if the vector has been initialized serially. Note however that the thread pool
+// assigns the same part of the vector to the same thread on a best-effort basis only, i.e.
+// subsequent operations are not guaranteed to work on memory local to the executing thread. Note
+// that the function does not have any effect on the placement in case the size of the vector is
+// below the SMP threshold or in case the function is called within a serial section, and in case
+// the element type is not a built-in data type (since allocate() default constructs these elements
+// on the calling thread). Also note that all iterators (including end() iterators), all pointers
+// and references to elements of this vector are invalidated.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void DynamicVector<Type,TF>::numaDistribute()
+{
+   DynamicVector( *this ).swap( *this );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Swapping the contents of two vectors.
 //
@@ -2487,6 +2525,9 @@ bool isIntact( const DynamicVector<Type,TF>& v ) noexcept;
 
 template< typename Type, bool TF >
 void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcept;
+
+template< typename Type, bool TF >
+void numaDistribute( DynamicVector<Type,TF>& v );
 //@}
 //*************************************************************************************************
 
@@ -2601,6 +2642,39 @@ inline void swap( DynamicVector<Type,TF>& a, DynamicVector<Type,TF>& b ) noexcep
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Redistributes the memory of the given dynamic vector according to the SMP partitioning.
+// \ingroup dynamic_vector
+//
+// \param v The vector to be redistributed.
+// \return void
+//
+// This function moves the elements of the given vector to newly allocated memory, which is first
+// written in parallel by the threads of the thread pool, with the same partitioning as any
+// subsequent thread parallel operation on the vector. On NUMA systems this distributes the pages
+// of the vector among the NUMA nodes of all threads (first-touch placement):
+
+   \code
+   blaze::DynamicVector<double> v( 100000000UL );
+   // ... Serial initialization of v, e.g. by reading from a file
+
+   numaDistribute( v );  // Distributes the pages of v among the NUMA nodes of the threads
+   \endcode
+
+// Note that the function does not have any effect on the placement in case the size of the
+// vector is below the SMP threshold or in case the function is called within a serial section.
+// Also note that all iterators (including end() iterators), all pointers and references to
+// elements of the vector are invalidated.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF >      // Transpose flag
+inline void numaDistribute( DynamicVector<Type,TF>& v )
+{
+   v.numaDistribute();
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <iterator>
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/ColumnVector.h>
@@ -62,15 +64,19 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -148,14 +154,29 @@ class DMatReduceExpr<MT,OP,columnwise>
 
  public:
    //**Type definitions****************************************************************************
-   using This          = DMatReduceExpr<MT,OP,columnwise>;  //!< Type of this DMatReduceExpr instance.
-   using BaseType      = DenseVector<This,true>;            //!< Base type of this DMatReduceExpr instance.
-   using ResultType    = ReduceTrait_t<RT,OP,columnwise>;   //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;       //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;         //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;          //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;                 //!< Return type for expression template evaluations.
-   using CompositeType = const ResultType;                  //!< Data type for composite expression templates.
+   //! Type of this DMatReduceExpr instance.
+   using This          = DMatReduceExpr<MT,OP,columnwise>;
+
+   //! Base type of this DMatReduceExpr instance.
+   using BaseType      = DenseVector<This,true>;
+
+   //! Result type for expression template evaluations.
+   using ResultType    = ReduceTrait_t<RT,OP,columnwise>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;
+
+   //! Resulting element type.
+   using ElementType   = ElementType_t<ResultType>;
+
+   //! Resulting SIMD element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;
+
+   //! Return type for expression template evaluations.
+   using ReturnType    = const ElementType;
+
+   //! Data type for composite expression templates.
+   using CompositeType = const ResultType;
 
    //! Composite type of the left-hand side dense matrix expression.
    using Operand = If_t< IsExpression_v<MT>, const MT, const MT& >;
@@ -293,7 +314,8 @@ class DMatReduceExpr<MT,OP,columnwise>
 
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a column-wise row-major dense matrix reduction operation to a dense vector.
+   /*!\brief Assignment of a column-wise row-major dense matrix reduction operation to a dense
+   //        vector.
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side dense vector.
@@ -329,7 +351,8 @@ class DMatReduceExpr<MT,OP,columnwise>
 
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Assignment of a column-wise row-major dense matrix reduction operation to a dense vector.
+   /*!\brief Assignment of a column-wise row-major dense matrix reduction operation to a dense
+   //        vector.
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side dense vector.
@@ -618,6 +641,92 @@ class DMatReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a column-wise row-major dense matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a column-wise row-major
+   // dense matrix reduction expression to a dense vector. In contrast to the default strategy,
+   // which reduces every single column separately, every thread accumulates complete rows of a
+   // block of the matrix and with that keeps the vectorized evaluation of the serial kernel. In
+   // case the matrix provides enough columns, it is split into blocks of columns that are reduced
+   // straight into the according parts of the target vector. Otherwise it is split into blocks
+   // of rows, whose partial results are combined afterwards. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the dense
+   // matrix operand does not have to be evaluated by the expression itself.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+      -> EnableIf_t< !UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const size_t M( rhs.dm_.rows() );
+      const size_t N( rhs.size() );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() || M == 0UL || N == 0UL ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      CT tmp( rhs.dm_ );  // Evaluation of the dense matrix operand
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      const size_t threads( getNumThreads() );
+
+      if( N >= threads*SIMDSIZE )
+      {
+         const size_t addon      ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+         const size_t equalShare ( N / threads + addon );
+         const size_t rest       ( equalShare & ( SIMDSIZE - 1UL ) );
+         const size_t colsPerTask( ( rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+         const size_t tasks      ( ( N - 1UL ) / colsPerTask + 1UL );
+
+         smpFor( tasks, [&]( size_t t )
+         {
+            const size_t j( t*colsPerTask );
+            const size_t n( min( colsPerTask, N - j ) );
+
+            auto       target( subvector<unaligned>( ~lhs, j, n, unchecked ) );
+            const auto block ( submatrix<unaligned>( tmp, 0UL, j, M, n, unchecked ) );
+            assign( target, reduce<columnwise>( block, rhs.op_ ) );
+         } );
+      }
+      else
+      {
+         const size_t rowsPerTask( ( M - 1UL ) / min( threads, M ) + 1UL );
+         const size_t tasks      ( ( M - 1UL ) / rowsPerTask + 1UL );
+
+         std::vector<ResultType> partials( tasks );
+
+         smpFor( tasks, [&]( size_t t )
+         {
+            const size_t i( t*rowsPerTask );
+            const size_t m( min( rowsPerTask, M - i ) );
+
+            const auto block( submatrix<unaligned>( tmp, i, 0UL, m, N, unchecked ) );
+            resize( partials[t], N, false );
+            assign( partials[t], reduce<columnwise>( block, rhs.op_ ) );
+         } );
+
+         assign( ~lhs, partials[0] );
+         for( size_t t=1UL; t<tasks; ++t ) {
+            assign( ~lhs, map( ~lhs, partials[t], rhs.op_ ) );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to vectors**********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a column-wise row-major dense matrix reduction operation
@@ -647,6 +756,38 @@ class DMatReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a column-wise row-major dense matrix reduction operation
+   //        to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a
+   // column-wise row-major dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAddAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+      -> EnableIf_t< !UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, rhs );
+         return;
+      }
+
+      const ResultType tmp( rhs );
+      smpAddAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to vectors*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP subtraction assignment of a column-wise row-major dense matrix reduction operation
@@ -676,10 +817,42 @@ class DMatReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a column-wise row-major dense matrix reduction operation
+   //        to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a
+   // column-wise row-major dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpSubAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+      -> EnableIf_t< !UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, rhs );
+         return;
+      }
+
+      const ResultType tmp( rhs );
+      smpSubAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP multiplication assignment to vectors****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP multiplication assignment of a column-wise row-major dense matrix reduction operation
-   //        to a vector.
+   /*!\brief SMP multiplication assignment of a column-wise row-major dense matrix reduction
+   //        operation to a vector.
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side vector.
@@ -705,6 +878,38 @@ class DMatReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP multiplication assignment to dense vectors**********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP multiplication assignment of a column-wise row-major dense matrix reduction
+   //        operation to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be multiplied.
+   // \return void
+   //
+   // This function implements the performance optimized SMP multiplication assignment of a
+   // column-wise row-major dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpMultAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+      -> EnableIf_t< !UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() ) {
+         multAssign( ~lhs, rhs );
+         return;
+      }
+
+      const ResultType tmp( rhs );
+      smpMultAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP division assignment to vectors**********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP division assignment of a column-wise row-major dense matrix reduction operation
@@ -734,6 +939,38 @@ class DMatReduceExpr<MT,OP,columnwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP division assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP division assignment of a column-wise row-major dense matrix reduction operation
+   //        to a dense vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression divisor.
+   // \return void
+   //
+   // This function implements the performance optimized SMP division assignment of a
+   // column-wise row-major dense matrix reduction expression to a dense vector.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpDivAssign( DenseVector<VT1,true>& lhs, const DMatReduceExpr& rhs )
+      -> EnableIf_t< !UseSMPAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() ) {
+         divAssign( ~lhs, rhs );
+         return;
+      }
+
+      const ResultType tmp( rhs );
+      smpDivAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Compile time checks*************************************************************************
    /*! \cond BLAZE_INTERNAL */
    BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE( MT );
@@ -802,13 +1039,26 @@ class DMatReduceExpr<MT,OP,rowwise>
 
  public:
    //**Type definitions****************************************************************************
-   using This          = DMatReduceExpr<MT,OP,rowwise>;  //!< Type of this DMatReduceExpr instance.
-   using BaseType      = DenseVector<This,false>;        //!< Base type of this DMatReduceExpr instance.
-   using ResultType    = ReduceTrait_t<RT,OP,rowwise>;   //!< Result type for expression template evaluations.
-   using TransposeType = TransposeType_t<ResultType>;    //!< Transpose type for expression template evaluations.
-   using ElementType   = ElementType_t<ResultType>;      //!< Resulting element type.
-   using SIMDType      = SIMDTrait_t<ElementType>;       //!< Resulting SIMD element type.
-   using ReturnType    = const ElementType;              //!< Return type for expression template evaluations.
+   //! Type of this DMatReduceExpr instance.
+   using This          = DMatReduceExpr<MT,OP,rowwise>;
+
+   //! Base type of this DMatReduceExpr instance.
+   using BaseType      = DenseVector<This,false>;
+
+   //! Result type for expression template evaluations.
+   using ResultType    = ReduceTrait_t<RT,OP,rowwise>;
+
+   //! Transpose type for expression template evaluations.
+   using TransposeType = TransposeType_t<ResultType>;
+
+   //! Resulting element type.
+   using ElementType   = ElementType_t<ResultType>;
+
+   //! Resulting SIMD element type.
+   using SIMDType      = SIMDTrait_t<ElementType>;
+
+   //! Return type for expression template evaluations.
+   using ReturnType    = const ElementType;
 
    //! Data type for composite expression templates.
    using CompositeType = If_t< useAssign, const ResultType, const DMatReduceExpr& >;
@@ -827,11 +1077,20 @@ class DMatReduceExpr<MT,OP,rowwise>
    {
     public:
       //**Type definitions*************************************************************************
-      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
-      using ValueType        = ElementType;                      //!< Type of the underlying elements.
-      using PointerType      = ElementType*;                     //!< Pointer return type.
-      using ReferenceType    = ElementType&;                     //!< Reference return type.
-      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+      //! The iterator category.
+      using IteratorCategory = std::random_access_iterator_tag;
+
+      //! Type of the underlying elements.
+      using ValueType        = ElementType;
+
+      //! Pointer return type.
+      using PointerType      = ElementType*;
+
+      //! Reference return type.
+      using ReferenceType    = ElementType&;
+
+      //! Difference between two iterators.
+      using DifferenceType   = ptrdiff_t;
 
       // STL iterator requirements
       using iterator_category = IteratorCategory;  //!< The iterator category.
@@ -1230,7 +1489,8 @@ class DMatReduceExpr<MT,OP,rowwise>
 
    //**Addition assignment to vectors**************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Addition assignment of a row-wise row-major dense matrix reduction operation to a vector.
+   /*!\brief Addition assignment of a row-wise row-major dense matrix reduction operation to a
+   //        vector.
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side vector.
@@ -1316,7 +1576,8 @@ class DMatReduceExpr<MT,OP,rowwise>
 
    //**Division assignment to vectors**************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief Division assignment of a row-wise row-major dense matrix reduction operation to a vector.
+   /*!\brief Division assignment of a row-wise row-major dense matrix reduction operation to a
+   //        vector.
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side vector.
@@ -1834,7 +2095,8 @@ inline auto dmatreduce( const DenseMatrix<MT,false>& dm, Add /*op*/ )
    if( !remainder || N >= SIMDSIZE )
    {
       const size_t jpos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
-      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos,
+                             "Invalid end calculation" );
 
       SIMDTrait_t<ET> xmm1;
       size_t i( 0UL );
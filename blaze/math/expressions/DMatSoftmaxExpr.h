@@ -41,10 +41,18 @@
 //*************************************************************************************************
 
 #include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DMatReduceExpr.h>
 #include <blaze/math/ReductionFlag.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/Column.h>
 #include <blaze/math/views/Row.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -138,7 +146,65 @@ auto softmax( const DenseMatrix<MT,SO>& dm )
 {
    auto tmp( evaluate( exp( ~dm ) ) );
 
-   if( RF == rowwise ) {
+   using RT = decltype( tmp );
+
+   const size_t lines( IsRowMajorMatrix_v<RT> ? tmp.rows() : tmp.columns() );
+   const size_t reductions( RF == rowwise ? tmp.rows() : tmp.columns() );
+
+   const size_t tasks( ( IsSMPAssignable_v<RT> && !IsRestricted_v<RT> &&
+                         ( tmp.rows()*tmp.columns() >= SMP_DMATASSIGN_THRESHOLD ||
+                           reductions > SMP_DMATREDUCE_THRESHOLD ) )
+                       ? min( getNumThreads(), lines )
+                       : 1UL );
+
+   if( tasks > 1UL )
+   {
+      const size_t linesPerTask( ( lines - 1UL ) / tasks + 1UL );
+
+      // Normalization of the contiguous rows/columns of the matrix, which are either reduced
+      // individually or divided by the previously computed column/row sums
+      if( IsRowMajorMatrix_v<RT> == ( RF == rowwise ) ) {
+         smpFor( tasks, [&]( size_t t )
+         {
+            const size_t end( min( (t+1UL)*linesPerTask, lines ) );
+            for( size_t i=t*linesPerTask; i<end; ++i ) {
+               if( IsRowMajorMatrix_v<RT> ) {
+                  auto r = row( tmp, i, unchecked );
+                  const auto scalar( sum( r ) );
+                  assign( r, r / scalar );
+               }
+               else {
+                  auto c = column( tmp, i, unchecked );
+                  const auto scalar( sum( c ) );
+                  assign( c, c / scalar );
+               }
+            }
+         } );
+      }
+      else if( IsRowMajorMatrix_v<RT> ) {
+         const auto scalars( evaluate( sum<columnwise>( tmp ) ) );
+         smpFor( tasks, [&]( size_t t )
+         {
+            const size_t end( min( (t+1UL)*linesPerTask, lines ) );
+            for( size_t i=t*linesPerTask; i<end; ++i ) {
+               auto r = row( tmp, i, unchecked );
+               assign( r, r / scalars );
+            }
+         } );
+      }
+      else {
+         const auto scalars( evaluate( sum<rowwise>( tmp ) ) );
+         smpFor( tasks, [&]( size_t t )
+         {
+            const size_t end( min( (t+1UL)*linesPerTask, lines ) );
+            for( size_t j=t*linesPerTask; j<end; ++j ) {
+               auto c = column( tmp, j, unchecked );
+               assign( c, c / scalars );
+            }
+         } );
+      }
+   }
+   else if( RF == rowwise ) {
       for( size_t i=0UL; i<tmp.rows(); ++i ) {
          auto r = row( tmp, i, unchecked );
          const auto scalar( sum( r ) );
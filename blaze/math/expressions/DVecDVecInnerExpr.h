@@ -40,16 +40,24 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -121,7 +129,7 @@ struct DVecDVecInnerExprHelper
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+inline auto dvecdvecinner_backend( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
    -> DisableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
                  , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
@@ -177,7 +185,7 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
-inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+inline auto dvecdvecinner_backend( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
    -> EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
                 , const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> > >
 {
@@ -233,6 +241,89 @@ inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the scalar product (inner product) of two dense vectors
+//        (\f$ s=\vec{a}*\vec{b} \f$).
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector for the inner product.
+// \param rhs The right-hand side dense vector for the inner product.
+// \return The scalar product.
+//
+// This function splits the two given dense vectors into SIMD-aligned blocks of equal size, one
+// per available thread, in case their size is equal or higher than the SMP_DVECDVECINNER_THRESHOLD.
+// Every thread computes the scalar product of its pair of blocks by means of the serial (and if
+// possible vectorized) kernel and the partial results are summed up afterwards. The scalar
+// product of smaller vectors is computed by a single thread.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+inline auto dvecdvecinner( const DenseVector<VT1,true>& lhs, const DenseVector<VT2,false>& rhs )
+   -> const MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >
+{
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using ET1      = ElementType_t<VT1>;
+   using ET2      = ElementType_t<VT2>;
+   using MultType = MultTrait_t<ET1,ET2>;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
+
+   constexpr bool simdEnabled( DVecDVecInnerExprHelper<VT1,VT2>::value );
+   constexpr size_t SIMDSIZE( SIMDTrait<MultType>::size );
+
+   const size_t N( (~lhs).size() );
+
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t threads( ( !IsSMPAssignable_v<MultType> && N >= SMP_DVECDVECINNER_THRESHOLD )
+                         ? min( getNumThreads(), N )
+                         : 1UL );
+
+   if( threads < 2UL ) {
+      return dvecdvecinner_backend( ~lhs, ~rhs );
+   }
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   const bool vectorsAligned( simdEnabled && left.isAligned() && right.isAligned() );
+
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t tasks        ( ( N - 1UL ) / sizePerThread + 1UL );
+
+   std::vector<MultType> partials( tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t index( t*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+
+      if( vectorsAligned ) {
+         partials[t] = dvecdvecinner_backend( subvector<aligned>( left , index, size, unchecked ),
+                                              subvector<aligned>( right, index, size, unchecked ) );
+      }
+      else {
+         partials[t] = dvecdvecinner_backend( subvector<unaligned>( left , index, size, unchecked ),
+                                              subvector<unaligned>( right, index, size, unchecked ) );
+      }
+   } );
+
+   MultType sp( partials[0] );
+
+   for( size_t t=1UL; t<tasks; ++t ) {
+      sp += partials[t];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the scalar product (inner product) of two dense vectors
 //        (\f$ s=\vec{a}*\vec{b} \f$).
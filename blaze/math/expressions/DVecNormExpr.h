@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <utility>
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
@@ -61,13 +63,18 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FalseType.h>
@@ -279,7 +286,58 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dv, abs, power, root, Bool< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   constexpr bool simdEnabled( DVecNormHelper<VT,Abs,Power>::value );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t N( (~dv).size() );
+
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t threads( ( !IsSMPAssignable_v<ET> && N >= SMP_DVECREDUCE_THRESHOLD )
+                         ? min( getNumThreads(), N )
+                         : 1UL );
+
+   if( threads < 2UL ) {
+      return norm_backend( ~dv, abs, power, root, Bool< simdEnabled >() );
+   }
+
+   CT tmp( ~dv );
+
+   const bool vectorAligned( simdEnabled && tmp.isAligned() );
+
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t tasks        ( ( N - 1UL ) / sizePerThread + 1UL );
+
+   std::vector<ET> partials( tasks );
+
+   // Every thread accumulates the powers of its block; the root is applied to the total only
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t index( t*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+
+      if( vectorAligned ) {
+         partials[t] = norm_backend( subvector<aligned>( tmp, index, size, unchecked ),
+                                     abs, power, Noop(), Bool< simdEnabled >() );
+      }
+      else {
+         partials[t] = norm_backend( subvector<unaligned>( tmp, index, size, unchecked ),
+                                     abs, power, Noop(), Bool< simdEnabled >() );
+      }
+   } );
+
+   ET norm( partials[0] );
+
+   for( size_t t=1UL; t<tasks; ++t ) {
+      norm += partials[t];
+   }
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -40,6 +40,8 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
+#include <blaze/math/AlignmentFlag.h>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
@@ -47,11 +49,17 @@
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/typetraits/HasLoad.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDEnabled.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsUniform.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Forward.h>
 #include <blaze/system/Compiler.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -120,7 +128,7 @@ struct DVecReduceExprHelper
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, OP op )
    -> DisableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
@@ -173,7 +181,7 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 template< typename VT    // Type of the dense vector
         , bool TF        // Transpose flag
         , typename OP >  // Type of the reduction operation
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, OP op )
    -> EnableIf_t< DVecReduceExprHelper<VT,OP>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
@@ -247,7 +255,7 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op )
 */
 template< typename VT  // Type of the dense vector
         , bool TF >    // Transpose flag
-inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
+inline auto dvecreduce_backend( const DenseVector<VT,TF>& dv, Add /*op*/ )
    -> EnableIf_t< DVecReduceExprHelper<VT,Add>::value, ElementType_t<VT> >
 {
    using CT = CompositeType_t<VT>;
@@ -323,6 +331,81 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function splits the given dense vector into SIMD-aligned blocks of equal size, one per
+// available thread, in case its size is equal or higher than the SMP_DVECREDUCE_THRESHOLD. Every
+// block is reduced by the serial (and if possible vectorized) kernel and the partial results are
+// combined afterwards. Smaller vectors are reduced by a single thread.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline auto dvecreduce( const DenseVector<VT,TF>& dv, OP op ) -> ElementType_t<VT>
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   constexpr bool simdEnabled( DVecReduceExprHelper<VT,OP>::value );
+   constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+   const size_t N( (~dv).size() );
+
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t threads( ( !IsSMPAssignable_v<ET> && N >= SMP_DVECREDUCE_THRESHOLD )
+                         ? min( getNumThreads(), N )
+                         : 1UL );
+
+   if( threads < 2UL ) {
+      return dvecreduce_backend( ~dv, op );
+   }
+
+   CT tmp( ~dv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == N, "Invalid vector size" );
+
+   const bool vectorAligned( simdEnabled && tmp.isAligned() );
+
+   const size_t addon        ( ( ( N % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( N / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+   const size_t tasks        ( ( N - 1UL ) / sizePerThread + 1UL );
+
+   std::vector<ET> partials( tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t index( t*sizePerThread );
+      const size_t size ( min( sizePerThread, N - index ) );
+
+      if( vectorAligned ) {
+         partials[t] = dvecreduce_backend( subvector<aligned>( tmp, index, size, unchecked ), op );
+      }
+      else {
+         partials[t] = dvecreduce_backend( subvector<unaligned>( tmp, index, size, unchecked ), op );
+      }
+   } );
+
+   ET redux( partials[0] );
+
+   for( size_t t=1UL; t<tasks; ++t ) {
+      redux = op( redux, partials[t] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Optimized backend implementation of the minimum evaluation of a uniform dense vector.
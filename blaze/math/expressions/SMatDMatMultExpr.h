@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -64,6 +65,8 @@
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/Partition.h>
 #include <blaze/math/traits/DeclDiagTrait.h>
 #include <blaze/math/traits/DeclHermTrait.h>
 #include <blaze/math/traits/DeclLowTrait.h>
@@ -79,9 +82,11 @@
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/math/typetraits/IsPattern.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsTriangular.h>
@@ -215,6 +220,21 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the multiplication is a general product that can be computed by the register
+       blocked kernel without an intermediate evaluation of the operands, the variable will be
+       set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseBlockedKernel_v =
+      ( !IsEvaluationRequired_v<T1,T2,T3> &&
+        !SYM && !HERM && !LOW && !UPP &&
+        !IsTriangular_v<T3> &&
+        UseVectorizedKernel_v<T1,T2,T3> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -736,6 +756,11 @@ class SMatDMatMultExpr
    static inline auto selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
       -> EnableIf_t< UseVectorizedKernel_v<MT3,MT4,MT5> >
    {
+      if( !SYM && !HERM && !LOW && !UPP && !IsTriangular_v<MT5> ) {
+         selectBlockedAssignKernel( C, A, B, 0UL, A.rows() );
+         return;
+      }
+
       constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
 
       reset( C );
@@ -840,6 +865,175 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Register blocked assignment to dense matrices***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register blocked assignment of a range of rows of a sparse matrix-dense matrix
+   //        multiplication to dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param ibegin The first row of the range.
+   // \param iend The end of the range of rows.
+   // \return void
+   //
+   // This function implements the register blocked assignment kernel for the rows
+   // \f$[ibegin..iend)\f$ of a general sparse matrix-dense matrix multiplication. For every
+   // block of up to four SIMD vectors of columns the complete row of the sparse matrix is
+   // accumulated in registers, i.e. every non-zero element is reused across the entire block
+   // of columns and every element of the target matrix is written exactly once.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectBlockedAssignKernel( MT3& C, const MT4& A, const MT5& B,
+                                                 size_t ibegin, size_t iend )
+      -> DisableIf_t< IsPattern_v<MT4> >
+   {
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
+
+      const size_t N( B.columns() );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const auto begin( A.begin(i) );
+         const auto end  ( A.end(i) );
+
+         size_t j( 0UL );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+         {
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+
+            for( auto element=begin; element!=end; ++element ) {
+               const size_t   i1( element->index() );
+               const SIMDType a1( set( element->value() ) );
+               xmm1 += a1 * B.load(i1,j             );
+               xmm2 += a1 * B.load(i1,j+SIMDSIZE    );
+               xmm3 += a1 * B.load(i1,j+SIMDSIZE*2UL);
+               xmm4 += a1 * B.load(i1,j+SIMDSIZE*3UL);
+            }
+
+            C.store( i, j             , xmm1 );
+            C.store( i, j+SIMDSIZE    , xmm2 );
+            C.store( i, j+SIMDSIZE*2UL, xmm3 );
+            C.store( i, j+SIMDSIZE*3UL, xmm4 );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE )
+         {
+            SIMDType xmm1;
+
+            for( auto element=begin; element!=end; ++element ) {
+               xmm1 += set( element->value() ) * B.load(element->index(),j);
+            }
+
+            C.store( i, j, xmm1 );
+         }
+
+         for( ; remainder && j<N; ++j )
+         {
+            ElementType value{};
+
+            for( auto element=begin; element!=end; ++element ) {
+               value += element->value() * B(element->index(),j);
+            }
+
+            C(i,j) = value;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Register blocked pattern assignment to dense matrices***************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Register blocked assignment of a range of rows of a PatternMatrix-dense matrix
+   //        multiplication to dense matrices (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side PatternMatrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param ibegin The first row of the range.
+   // \param iend The end of the range of rows.
+   // \return void
+   //
+   // This function implements the register blocked assignment kernel for the rows
+   // \f$[ibegin..iend)\f$ of a PatternMatrix-dense matrix multiplication. Since all non-zero
+   // elements of a PatternMatrix have the value 1, each row of the result is the sum of the
+   // selected rows of the dense matrix. Thus the kernel only traverses the stored indices and
+   // neither broadcasts nor multiplies any matrix values.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline auto selectBlockedAssignKernel( MT3& C, const MT4& A, const MT5& B,
+                                                 size_t ibegin, size_t iend )
+      -> EnableIf_t< IsPattern_v<MT4> >
+   {
+      constexpr bool remainder( !IsPadded_v<MT3> || !IsPadded_v<MT5> );
+
+      const size_t N( B.columns() );
+
+      const size_t jpos( remainder ? ( N & size_t(-SIMDSIZE) ) : N );
+      BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+      for( size_t i=ibegin; i<iend; ++i )
+      {
+         const auto indices( A.indices(i) );
+         const size_t nonzeros( A.nonZeros(i) );
+
+         size_t j( 0UL );
+
+         for( ; (j+SIMDSIZE*3UL) < jpos; j+=SIMDSIZE*4UL )
+         {
+            SIMDType xmm1, xmm2, xmm3, xmm4;
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               const size_t i1( indices[k] );
+               xmm1 += B.load(i1,j             );
+               xmm2 += B.load(i1,j+SIMDSIZE    );
+               xmm3 += B.load(i1,j+SIMDSIZE*2UL);
+               xmm4 += B.load(i1,j+SIMDSIZE*3UL);
+            }
+
+            C.store( i, j             , xmm1 );
+            C.store( i, j+SIMDSIZE    , xmm2 );
+            C.store( i, j+SIMDSIZE*2UL, xmm3 );
+            C.store( i, j+SIMDSIZE*3UL, xmm4 );
+         }
+
+         for( ; j<jpos; j+=SIMDSIZE )
+         {
+            SIMDType xmm1;
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               xmm1 += B.load(indices[k],j);
+            }
+
+            C.store( i, j, xmm1 );
+         }
+
+         for( ; remainder && j<N; ++j )
+         {
+            ElementType value{};
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               value += B(indices[k],j);
+            }
+
+            C(i,j) = value;
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1677,6 +1871,55 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense matrices************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a general sparse matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a general sparse
+   // matrix-dense matrix multiplication expression to a row-major dense matrix. The rows of the
+   // sparse matrix are split into contiguous ranges with approximately the same number of
+   // non-zero elements, which are computed in parallel by the register blocked kernel. Due to
+   // the explicit application of the SFINAE principle this function can only be selected by the
+   // compiler in case the register blocked kernel is applicable.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline auto smpAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+      -> EnableIf_t< UseBlockedKernel_v<MT,MT1,MT2> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      if( !IsSMPAssignable_v<MT> || !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      LT A( serial( rhs.lhs_ ) );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( serial( rhs.rhs_ ) );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns(), "Invalid number of columns" );
+
+      const size_t tasks( min( getNumThreads(), A.rows() ) );
+      const std::vector<size_t> bounds( partitionNonZeros( A, tasks ) );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         selectBlockedAssignKernel( ~lhs, A, B, bounds[t], bounds[t+1UL] );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
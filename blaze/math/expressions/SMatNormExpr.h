@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <utility>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/functors/Abs.h>
@@ -61,10 +62,15 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/Partition.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
@@ -91,9 +97,10 @@ namespace blaze {
 // \param root The functor for the root operation.
 // \return The norm of the given matrix.
 //
-// This function implements the performance optimized norm of a sparse matrix. Due to the
-// explicit application of the SFINAE principle, this function can only be selected by the
-// compiler in case vectorization cannot be applied.
+// This function implements the performance optimized norm of a sparse matrix. In case the
+// number of non-zero elements is equal or higher than the \c BLAZE_SMP_SPARSEREDUCE_THRESHOLD,
+// the rows (or columns) are split into ranges with approximately the same number of non-zero
+// elements, whose partial results are computed in parallel.
 */
 template< typename MT      // Type of the sparse matrix
         , bool SO          // Storage order
@@ -112,17 +119,38 @@ inline decltype(auto) norm_backend( const SparseMatrix<MT,SO>& sm, Abs abs, Powe
 
    const size_t N( IsRowMajorMatrix_v<MT> ? tmp.rows(): tmp.columns() );
 
-   ET norm{};
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t tasks( ( !IsSMPAssignable_v<ET> &&
+                         tmp.nonZeros() >= SMP_SPARSEREDUCE_THRESHOLD && N > 1UL )
+                       ? min( getNumThreads(), N )
+                       : 1UL );
+   const std::vector<size_t> bounds( partitionNonZeros( tmp, tasks ) );
+
+   std::vector<ET> partials( tasks );
 
-   for( size_t i=0UL; i<N; ++i )
+   smpFor( tasks, [&]( size_t t )
    {
-      const auto end( tmp.end(i) );
-      for( auto element=tmp.begin(i); element!=end; ++element ) {
-         if( IsResizable_v<ET> && isDefault( norm ) )
-            norm = power( abs( element->value() ) );
-         else
-            norm += power( abs( element->value() ) );
+      ET& norm( partials[t] );
+
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i )
+      {
+         const auto end( tmp.end(i) );
+         for( auto element=tmp.begin(i); element!=end; ++element ) {
+            if( IsResizable_v<ET> && isDefault( norm ) )
+               norm = power( abs( element->value() ) );
+            else
+               norm += power( abs( element->value() ) );
+         }
       }
+   } );
+
+   ET norm{};
+
+   for( const ET& partial : partials ) {
+      if( IsResizable_v<ET> && isDefault( norm ) )
+         norm = partial;
+      else if( !IsResizable_v<ET> || !isDefault( partial ) )
+         norm += partial;
    }
 
    return evaluate( root( norm ) );
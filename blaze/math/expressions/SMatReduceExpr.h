@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <iterator>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/ColumnVector.h>
@@ -61,11 +62,15 @@
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/Partition.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
@@ -1363,6 +1368,50 @@ struct SMatReduceExpr<MT,OP,rowwise>
    /*! \endcond */
    //**********************************************************************************************
 
+   //**SMP assignment to dense vectors*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a row-wise row-major sparse matrix reduction operation to a dense
+   //        vector.
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side reduction expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a row-wise row-major
+   // sparse matrix reduction expression to a dense vector. In contrast to the default strategy,
+   // which splits the target vector into equally sized blocks, the rows of the sparse matrix are
+   // distributed among the threads such that every thread processes approximately the same number
+   // of non-zero elements. Due to the explicit application of the SFINAE principle, this function
+   // can only be selected by the compiler in case the sparse matrix operand can be accessed
+   // directly.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline auto smpAssign( DenseVector<VT1,false>& lhs, const SMatReduceExpr& rhs )
+      -> EnableIf_t< !UseAssign_v<VT1> >
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( !IsSMPAssignable_v<VT1> || !rhs.canSMPAssign() ) {
+         assign( ~lhs, rhs );
+         return;
+      }
+
+      const size_t tasks( min( getNumThreads(), rhs.size() ) );
+      const std::vector<size_t> bounds( partitionNonZeros( rhs.sm_, tasks ) );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+            (~lhs)[i] = rhs[i];
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to vectors**********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP addition assignment of a row-wise row-major sparse matrix reduction operation
@@ -1520,6 +1569,10 @@ struct SMatReduceExpr<MT,OP,rowwise>
 // operation. See \ref custom_operations for a detailed overview of the possibilities of custom
 // operations.
 
+// In case the number of non-zero elements of the matrix is equal or higher than the
+// \c BLAZE_SMP_SPARSEREDUCE_THRESHOLD, the rows (or columns) are split into ranges with
+// approximately the same number of non-zero elements, which are reduced in parallel.
+
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -1546,24 +1599,57 @@ inline decltype(auto) reduce( const SparseMatrix<MT,SO>& sm, OP op )
    BLAZE_INTERNAL_ASSERT( tmp.rows()    == M, "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( tmp.columns() == N, "Invalid number of columns" );
 
-   ET redux0{};
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t tasks( ( !IsSMPAssignable_v<ET> &&
+                         tmp.nonZeros() >= SMP_SPARSEREDUCE_THRESHOLD && iend > 1UL )
+                       ? min( getNumThreads(), iend )
+                       : 1UL );
+   const std::vector<size_t> bounds( partitionNonZeros( tmp, tasks ) );
+
+   std::vector<ET> partials( tasks );
+   std::vector<unsigned char> found( tasks, 0U );
 
-   for( size_t i=0UL; i<iend; ++i )
+   smpFor( tasks, [&]( size_t t )
    {
-      const auto end( tmp.end(i) );
-      auto element( tmp.begin(i) );
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i )
+      {
+         const auto end( tmp.end(i) );
+         auto element( tmp.begin(i) );
+
+         if( element == end ) continue;
+
+         ET redux1( element->value() );
+         ++element;
+
+         for( ; element!=end; ++element ) {
+            redux1 = op( redux1, element->value() );
+         }
+
+         if( found[t] ) {
+            partials[t] = op( partials[t], redux1 );
+         }
+         else {
+            partials[t] = redux1;
+            found[t] = 1U;
+         }
+      }
+   } );
 
-      if( element == end ) continue;
+   // In case the first row/column is empty, the default value is part of the reduction
+   bool initialized( tmp.begin(0UL) == tmp.end(0UL) );
+   ET redux0{};
 
-      ET redux1( element->value() );
-      ++element;
+   for( size_t t=0UL; t<tasks; ++t )
+   {
+      if( !found[t] ) continue;
 
-      for( ; element!=end; ++element ) {
-         redux1 = op( redux1, element->value() );
+      if( initialized ) {
+         redux0 = op( redux0, partials[t] );
+      }
+      else {
+         redux0 = partials[t];
+         initialized = true;
       }
-
-      if( i == 0UL ) redux0 = redux1;
-      else           redux0 = op( redux0, redux1 );
    }
 
    return redux0;
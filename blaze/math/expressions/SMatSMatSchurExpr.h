@@ -55,6 +55,7 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
 #include <blaze/math/typetraits/IsComputation.h>
@@ -343,13 +344,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) = l->value() * r->value();
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            (~lhs)(i,l->index()) = l->value() * r->value();
+            ++l;
+            ++r;
          }
       }
    }
@@ -398,13 +396,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            (~lhs).append( i, l->index(), l->value() * r->value() );
+            ++l;
+            ++r;
          }
 
          (~lhs).finalize( i );
@@ -460,13 +455,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               ++nonzeros[l->index()];
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            ++nonzeros[l->index()];
+            ++l;
+            ++r;
          }
       }
 
@@ -484,13 +476,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs).append( i, l->index(), l->value() * r->value() );
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            (~lhs).append( i, l->index(), l->value() * r->value() );
+            ++l;
+            ++r;
          }
       }
    }
@@ -566,13 +555,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) += l->value() * r->value();
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            (~lhs)(i,l->index()) += l->value() * r->value();
+            ++l;
+            ++r;
          }
       }
    }
@@ -653,13 +639,10 @@ class SMatSMatSchurExpr
          auto l( A.begin(i) );
          auto r( B.begin(i) );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               (~lhs)(i,l->index()) -= l->value() * r->value();
-               ++r;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            (~lhs)(i,l->index()) -= l->value() * r->value();
+            ++l;
+            ++r;
          }
       }
    }
@@ -742,16 +725,13 @@ class SMatSMatSchurExpr
 
          size_t j( 0 );
 
-         for( ; l!=lend; ++l ) {
-            while( r!=rend && r->index() < l->index() ) ++r;
-            if( r==rend ) break;
-            if( l->index() == r->index() ) {
-               for( ; j<l->index(); ++j )
-                  reset( (~lhs)(i,j) );
-               (~lhs)(i,l->index()) *= l->value() * r->value();
-               ++r;
-               ++j;
-            }
+         while( nextCommonIndex( l, lend, r, rend ) ) {
+            for( ; j<l->index(); ++j )
+               reset( (~lhs)(i,j) );
+            (~lhs)(i,l->index()) *= l->value() * r->value();
+            ++j;
+            ++l;
+            ++r;
          }
 
          for( ; j<(~lhs).columns(); ++j )
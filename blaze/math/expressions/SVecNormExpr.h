@@ -40,7 +40,9 @@
 // Includes
 //*************************************************************************************************
 
+#include <iterator>
 #include <utility>
+#include <vector>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/functors/Abs.h>
@@ -60,12 +62,18 @@
 #include <blaze/math/shims/Evaluate.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/TypeList.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsBaseOf.h>
 
 
 namespace blaze {
@@ -112,16 +120,53 @@ decltype(auto) norm_backend( const SparseVector<VT,TF>& sv, Abs abs, Power power
 
    CT tmp( ~sv );
 
-   const auto end( tmp.end() );
-   auto element( tmp.begin() );
+   using Iterator = decltype( tmp.begin() );
+   using IteratorCategory = typename std::iterator_traits<Iterator>::iterator_category;
 
-   if( element == end ) return RT();
+   const Iterator begin( tmp.begin() );
+   const Iterator end  ( tmp.end() );
 
-   ET norm( power( abs( element->value() ) ) );
-   ++element;
+   if( begin == end ) return RT();
 
-   for( ; element!=end; ++element ) {
-      norm += power( abs( element->value() ) );
+   // Only random access iterators allow the direct access to the partial ranges
+   const size_t nonzeros( IsBaseOf_v< std::random_access_iterator_tag, IteratorCategory >
+                          ? static_cast<size_t>( std::distance( begin, end ) )
+                          : 0UL );
+
+   // Elements that are SMP assignable themselves would require nested parallel sections
+   const size_t threads( ( !IsSMPAssignable_v<ET> && nonzeros >= SMP_SPARSEREDUCE_THRESHOLD )
+                         ? min( getNumThreads(), nonzeros )
+                         : 1UL );
+   const size_t blockSize( nonzeros / threads + ( nonzeros % threads != 0UL ? 1UL : 0UL ) );
+   const size_t tasks( threads > 1UL ? ( nonzeros - 1UL ) / blockSize + 1UL : 1UL );
+
+   std::vector<ET> partials( tasks );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      Iterator element( begin );
+      Iterator last( end );
+
+      if( tasks > 1UL ) {
+         std::advance( element, min( t*blockSize, nonzeros ) );
+         last = begin;
+         std::advance( last, min( (t+1UL)*blockSize, nonzeros ) );
+      }
+
+      ET norm( power( abs( element->value() ) ) );
+      ++element;
+
+      for( ; element!=last; ++element ) {
+         norm += power( abs( element->value() ) );
+      }
+
+      partials[t] = norm;
+   } );
+
+   ET norm( partials[0] );
+
+   for( size_t t=1UL; t<tasks; ++t ) {
+      norm += partials[t];
    }
 
    return evaluate( root( norm ) );
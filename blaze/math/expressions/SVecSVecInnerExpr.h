@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/SparseVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsOpposedView.h>
 #include <blaze/util/FunctionTrace.h>
@@ -85,7 +86,10 @@ namespace blaze {
 // The operator returns a scalar value of the higher-order element type of the two involved
 // vector element types \a VT1::ElementType and \a VT2::ElementType. Both vector types \a VT1
 // and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
-// have to be supported by the MultTrait class template.\n
+// have to be supported by the MultTrait class template. The common non-zero elements of the
+// two vectors are determined adaptively: In case one vector is considerably sparser than the
+// other, the denser vector is searched via galloping search instead of being traversed element
+// by element.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
 // is thrown.
 */
@@ -163,44 +167,16 @@ inline decltype(auto)
       auto l( left.begin()  );
       auto r( right.begin() );
 
-      if( l == lend || r == rend ) return sp;
-
-      while( true ) {
-         if( l->index() < r->index() ) {
-            ++l;
-            if( l == lend ) break;
-         }
-         else if( r->index() < l->index() ) {
-            ++r;
-            if( r == rend ) break;
-         }
-         else {
-            sp = l->value() * r->value();
-            ++l;
-            ++r;
-            break;
-         }
-      }
+      if( !nextCommonIndex( l, lend, r, rend ) ) return sp;
+
+      sp = l->value() * r->value();
+      ++l;
+      ++r;
 
-      if( l != lend && r != rend )
-      {
-         while( true ) {
-            if( l->index() < r->index() ) {
-               ++l;
-               if( l == lend ) break;
-            }
-            else if( r->index() < l->index() ) {
-               ++r;
-               if( r == rend ) break;
-            }
-            else {
-               sp += l->value() * r->value();
-               ++l;
-               if( l == lend ) break;
-               ++r;
-               if( r == rend ) break;
-            }
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         sp += l->value() * r->value();
+         ++l;
+         ++r;
       }
    }
 
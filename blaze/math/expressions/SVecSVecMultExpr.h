@@ -53,6 +53,7 @@
 #include <blaze/math/expressions/VecVecMultExpr.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/Intersection.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -279,13 +280,10 @@ class SVecSVecMultExpr
       auto l( x.begin()  );
       auto r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] = l->value() * r->value();
-            ++r;
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         (~lhs)[l->index()] = l->value() * r->value();
+         ++l;
+         ++r;
       }
    }
    /*! \endcond */
@@ -327,13 +325,10 @@ class SVecSVecMultExpr
       auto l( x.begin()  );
       auto r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs).append( l->index(), l->value() * r->value() );
-            ++r;
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         (~lhs).append( l->index(), l->value() * r->value() );
+         ++l;
+         ++r;
       }
    }
    /*! \endcond */
@@ -371,13 +366,10 @@ class SVecSVecMultExpr
       auto l( x.begin() );
       auto r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] += l->value() * r->value();
-            ++r;
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         (~lhs)[l->index()] += l->value() * r->value();
+         ++l;
+         ++r;
       }
    }
    /*! \endcond */
@@ -419,13 +411,10 @@ class SVecSVecMultExpr
       auto l( x.begin()  );
       auto r( y.begin() );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            (~lhs)[l->index()] -= l->value() * r->value();
-            ++r;
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         (~lhs)[l->index()] -= l->value() * r->value();
+         ++l;
+         ++r;
       }
    }
    /*! \endcond */
@@ -469,16 +458,13 @@ class SVecSVecMultExpr
 
       size_t i( 0 );
 
-      for( ; l!=lend; ++l ) {
-         while( r!=rend && r->index() < l->index() ) ++r;
-         if( r==rend ) break;
-         if( l->index() == r->index() ) {
-            for( ; i<r->index(); ++i )
-               reset( (~lhs)[i] );
-            (~lhs)[l->index()] *= l->value() * r->value();
-            ++r;
-            ++i;
-         }
+      while( nextCommonIndex( l, lend, r, rend ) ) {
+         for( ; i<r->index(); ++i )
+            reset( (~lhs)[i] );
+         (~lhs)[l->index()] *= l->value() * r->value();
+         ++i;
+         ++l;
+         ++r;
       }
 
       for( ; i<rhs.size(); ++i )
@@ -65,6 +65,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPattern.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
@@ -356,7 +357,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -375,6 +377,45 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial assignment kernel for the transpose dense vector-sparse
+   // matrix multiplication with a PatternMatrix operand. Since all non-zero elements of a
+   // PatternMatrix have the value 1, the kernel only traverses the stored indices and never loads
+   // or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const auto indices( A.indices(i) );
+         const size_t nonzeros( A.nonZeros(i) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            if( IsResizable_v< ElementType_t<VT1> > &&
+                isDefault( y[indices[k]] ) )
+               y[indices[k]] = x[i];
+            else
+               y[indices[k]] += x[i];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*!\brief Assignment of a transpose dense vector-sparse matrix multiplication to a sparse
    //        vector (\f$ \vec{y}^T=\vec{x}^T*A \f$).
@@ -455,7 +496,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -470,6 +512,41 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T+=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial addition assignment kernel for the transpose dense vector-
+   // sparse matrix multiplication with a PatternMatrix operand. Since all non-zero elements of a
+   // PatternMatrix have the value 1, the kernel only traverses the stored indices and never loads
+   // or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectAddAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const auto indices( A.indices(i) );
+         const size_t nonzeros( A.nonZeros(i) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            y[indices[k]] += x[i];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -526,7 +603,8 @@ class TDVecSMatMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename VT2    // Type of the left-hand side vector operand
            , typename MT1 >  // Type of the right-hand side matrix operand
-   static inline void selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t i=0UL; i<x.size(); ++i )
       {
@@ -541,6 +619,41 @@ class TDVecSMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose dense vector-sparse matrix multiplication
+   //        (\f$ \vec{y}^T-=\vec{x}^T*A \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param x The left-hand side dense vector operand.
+   // \param A The right-hand side sparse matrix operand.
+   // \return void
+   //
+   // This function implements the serial subtraction assignment kernel for the transpose dense
+   // vector-sparse matrix multiplication with a PatternMatrix operand. Since all non-zero elements
+   // of a PatternMatrix have the value 1, the kernel only traverses the stored indices and never
+   // loads or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename VT2    // Type of the left-hand side vector operand
+           , typename MT1 >  // Type of the right-hand side matrix operand
+   static inline auto selectSubAssignKernel( VT1& y, const VT2& x, const MT1& A )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t i=0UL; i<x.size(); ++i )
+      {
+         const auto indices( A.indices(i) );
+         const size_t nonzeros( A.nonZeros(i) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            y[indices[k]] -= x[i];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
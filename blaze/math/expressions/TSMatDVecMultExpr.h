@@ -66,6 +66,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsIdentity.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPattern.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
@@ -362,7 +363,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -381,6 +383,45 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern assignment to dense vectors*********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial assignment kernel for the transpose sparse matrix-dense
+   // vector multiplication with a PatternMatrix operand. Since all non-zero elements of a
+   // PatternMatrix have the value 1, the kernel only traverses the stored indices and never loads
+   // or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const auto indices( A.indices(j) );
+         const size_t nonzeros( A.nonZeros(j) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            if( IsResizable_v< ElementType_t<VT1> > &&
+                isDefault( y[indices[k]] ) )
+               y[indices[k]] = x[j];
+            else
+               y[indices[k]] += x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse vectors****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -463,7 +504,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -478,6 +520,41 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern addition assignment to dense vectors************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial addition assignment kernel for the transpose sparse
+   // matrix-dense vector multiplication with a PatternMatrix operand. Since all non-zero elements
+   // of a PatternMatrix have the value 1, the kernel only traverses the stored indices and never
+   // loads or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const auto indices( A.indices(j) );
+         const size_t nonzeros( A.nonZeros(j) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            y[indices[k]] += x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse vectors*******************************************************
    // No special implementation for the addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -534,7 +611,8 @@ class TSMatDVecMultExpr
    template< typename VT1    // Type of the left-hand side target vector
            , typename MT1    // Type of the left-hand side matrix operand
            , typename VT2 >  // Type of the right-hand side vector operand
-   static inline void selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> DisableIf_t< IsPattern_v<MT1> >
    {
       for( size_t j=0UL; j<A.columns(); ++j )
       {
@@ -549,6 +627,41 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Pattern subtraction assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a transpose sparse matrix-dense vector multiplication
+   //        (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \return void
+   //
+   // This function implements the serial subtraction assignment kernel for the transpose sparse
+   // matrix-dense vector multiplication with a PatternMatrix operand. Since all non-zero elements
+   // of a PatternMatrix have the value 1, the kernel only traverses the stored indices and never
+   // loads or multiplies any matrix values.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2 >  // Type of the right-hand side vector operand
+   static inline auto selectSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
+      -> EnableIf_t< IsPattern_v<MT1> >
+   {
+      for( size_t j=0UL; j<A.columns(); ++j )
+      {
+         const auto indices( A.indices(j) );
+         const size_t nonzeros( A.nonZeros(j) );
+
+         for( size_t k=0UL; k<nonzeros; ++k ) {
+            y[indices[k]] -= x[j];
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse vectors****************************************************
    // No special implementation for the subtraction assignment to sparse vectors.
    //**********************************************************************************************
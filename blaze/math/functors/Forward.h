@@ -98,6 +98,8 @@ struct L4Norm;
 struct Log;
 struct Log2;
 struct Log10;
+struct LogicalAnd;
+struct LogicalOr;
 template< size_t... > struct LpNorm;
 struct Max;
 struct Min;
@@ -63,6 +63,7 @@
 #include <blaze/math/simd/Exp10.h>
 #include <blaze/math/simd/Floor.h>
 #include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Gather.h>
 #include <blaze/math/simd/Hypot.h>
 #include <blaze/math/simd/InvCbrt.h>
 #include <blaze/math/simd/InvSqrt.h>
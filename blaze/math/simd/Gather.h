@@ -0,0 +1,263 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loada.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERIC GATHER BACKEND
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar backend for the gather of a SIMD vector.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The SIMD vector of gathered values.
+//
+// This function gathers the values element by element into an aligned temporary and loads
+// the complete vector at once. It is used for all instruction sets that do not provide a
+// native gather instruction.
+*/
+template< typename SIMDType  // Type of the resulting SIMD vector
+        , typename T         // Type of the gathered values
+        , typename IT >      // Type of the indices
+BLAZE_ALWAYS_INLINE const SIMDType gatherBackend( const T* address, const IT* indices ) noexcept
+{
+   alignas( AlignmentOf_v<T> ) T array[SIMDType::size];
+
+   for( size_t k=0UL; k<SIMDType::size; ++k ) {
+      array[k] = address[indices[k]];
+   }
+
+   return loada( array );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 32-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]]. In AVX2 and AVX-512 mode the native
+// gather instructions are used. Note that these instructions interpret the indices as signed
+// integers, i.e. all indices are required to be smaller than \f$ 2^{31} \f$.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && sizeof(IT) == 4UL, SIMDfloat >
+   gather( const float* address, const IT* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i32gather_ps( _mm512_loadu_si512( indices ), address, 4 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 4 );
+#else
+   return gatherBackend<SIMDfloat>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 64-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]]. In AVX2 and AVX-512 mode the native
+// gather instructions are used.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && sizeof(IT) == 8UL, SIMDfloat >
+   gather( const float* address, const IT* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m256 lo( _mm512_i64gather_ps( _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256 hi( _mm512_i64gather_ps( _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   return _mm512_castpd_ps(
+      _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( lo ) ), _mm256_castps_pd( hi ), 1 ) );
+#elif BLAZE_AVX2_MODE
+   const __m128 lo( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ), 4 ) );
+   const __m128 hi( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ), 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( lo ), hi, 1 );
+#else
+   return gatherBackend<SIMDfloat>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 8-bit or 16-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]].
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && ( sizeof(IT) < 4UL ), SIMDfloat >
+   gather( const float* address, const IT* indices ) noexcept
+{
+   return gatherBackend<SIMDfloat>( address, indices );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 32-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]]. In AVX2 and AVX-512 mode the native
+// gather instructions are used. Note that these instructions interpret the indices as signed
+// integers, i.e. all indices are required to be smaller than \f$ 2^{31} \f$.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && sizeof(IT) == 4UL, SIMDdouble >
+   gather( const double* address, const IT* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i32gather_pd( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i32gather_pd( address, _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ), 8 );
+#else
+   return gatherBackend<SIMDdouble>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 64-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]]. In AVX2 and AVX-512 mode the native
+// gather instructions are used.
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && sizeof(IT) == 8UL, SIMDdouble >
+   gather( const double* address, const IT* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i64gather_pd( _mm512_loadu_si512( indices ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i64gather_pd( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 8 );
+#else
+   return gatherBackend<SIMDdouble>( address, indices );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 8-bit or 16-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the gathered values.
+// \param indices The first of the indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address, where the
+// \a k-th element is loaded from \c address[indices[k]].
+*/
+template< typename IT >  // Type of the indices
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<IT> && ( sizeof(IT) < 4UL ), SIMDdouble >
+   gather( const double* address, const IT* indices ) noexcept
+{
+   return gatherBackend<SIMDdouble>( address, indices );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
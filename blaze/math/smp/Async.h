@@ -0,0 +1,464 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/Async.h
+//  \brief Header file for the asynchronous evaluation of vector and matrix expressions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_ASYNC_H_
+#define _BLAZE_MATH_SMP_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <future>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/mpl/If.h>
+
+#if !BLAZE_HPX_PARALLEL_MODE && ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#include <blaze/math/smp/threads/Async.h>
+#else
+#include <blaze/math/smp/default/Async.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS ASYNCASSIGNER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the asynchronous assignment of a vector or matrix operand.
+// \ingroup smp
+//
+// The AsyncAssigner class template stores a reference to the target of an asynchronous
+// assignment and the right-hand side operand, which is stored by value in case it is an
+// expression or a temporary (\a Copy set to \a true) and by reference otherwise.
+*/
+template< typename T1            // Type of the target
+        , typename T2            // Type of the right-hand side operand
+        , bool Copy = false >    // Flag for the copy of a non-expression operand
+class AsyncAssigner
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side operand.
+   using Operand = If_t< Copy || IsExpression_v<T2>, const T2, const T2& >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncAssigner class template.
+   //
+   // \param target The target of the assignment.
+   // \param operand The right-hand side operand to be assigned.
+   */
+   explicit inline AsyncAssigner( T1& target, const T2& operand )
+      : target_ ( target  )  // The target of the assignment
+      , operand_( operand )  // The right-hand side operand
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the assignment.
+   //
+   // \return void
+   */
+   inline void operator()() const {
+      target_ = operand_;
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   T1&     target_;   //!< The target of the assignment.
+   Operand operand_;  //!< The right-hand side operand.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ASYNCEVALUATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Functor for the asynchronous evaluation of a vector or matrix operand.
+// \ingroup smp
+//
+// The AsyncEvaluator class template stores the operand of an asynchronous evaluation, which
+// is stored by value in case it is an expression or a temporary (\a Copy set to \a true) and
+// by reference otherwise.
+*/
+template< typename T             // Type of the operand
+        , bool Copy = false >    // Flag for the copy of a non-expression operand
+class AsyncEvaluator
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Composite type of the operand.
+   using Operand = If_t< Copy || IsExpression_v<T>, const T, const T& >;
+
+   using ResultType = ResultType_t<T>;  //!< Result type of the evaluation.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the AsyncEvaluator class template.
+   //
+   // \param operand The operand to be evaluated.
+   */
+   explicit inline AsyncEvaluator( const T& operand )
+      : operand_( operand )  // The operand to be evaluated
+   {}
+   //**********************************************************************************************
+
+   //**Function call operator**********************************************************************
+   /*!\brief Performs the evaluation.
+   //
+   // \return The result of the evaluation.
+   */
+   inline ResultType operator()() const {
+      return ResultType( operand_ );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand operand_;  //!< The operand to be evaluated.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Asynchronous evaluation functions */
+//@{
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+std::future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+template< typename VT1, bool TF1, typename VT2, bool TF2 >
+std::future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2 >
+std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs );
+
+template< typename VT, bool TF >
+std::future< ResultType_t<VT> > evaluateAsync( const Vector<VT,TF>& vec );
+
+template< typename VT, bool TF >
+std::future< ResultType_t<VT> > evaluateAsync( const Vector<VT,TF>&& vec );
+
+template< typename MT, bool SO >
+std::future< ResultType_t<MT> > evaluateAsync( const Matrix<MT,SO>& mat );
+
+template< typename MT, bool SO >
+std::future< ResultType_t<MT> > evaluateAsync( const Matrix<MT,SO>&& mat );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a vector to another vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return The future for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side vector to the given target
+// vector and returns without waiting for its completion. The assignment is performed exactly
+// as the according assignment operation, including the parallel evaluation via the thread
+// pool, while the calling thread can continue with other work. The returned future becomes
+// ready as soon as the assignment has been completed:
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   std::future<void> result( asyncAssign( y, A * x ) );
+   // ... Work independent of y
+   result.get();  // Waiting for the assignment to complete
+   \endcode
+
+// Any exception thrown during the assignment (as for instance a \a std::invalid_argument in
+// case the sizes of the two vectors don't match) is rethrown by the \c get() function of the
+// future. Note that the target vector and all vectors and matrices referenced by the given
+// right-hand side expression must neither be accessed nor destroyed before the assignment has
+// been completed.
+//
+// The asynchronous evaluation requires the C++11 or Boost thread parallelization. In case of
+// the OpenMP or HPX parallelization or if no parallelization is active, the assignment is
+// performed immediately and the returned future is ready on return.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline std::future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   return launchAsync( AsyncAssigner<VT1,VT2>( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary vector to another vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The temporary right-hand side vector to be assigned.
+// \return The future for the completion of the assignment.
+//
+// This overload of the asyncAssign() function handles temporary right-hand side vectors (as
+// for instance the result of the evaluate() function). Since the temporary is destroyed at
+// the end of the calling full-expression, the asynchronous assignment works on a copy of the
+// given vector. Note that this does not apply to temporaries referenced by a right-hand side
+// expression, which must still outlive the assignment.
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline std::future<void> asyncAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>&& rhs )
+{
+   return launchAsync( AsyncAssigner<VT1,VT2,true>( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a matrix to another matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return The future for the completion of the assignment.
+//
+// This function starts the assignment of the given right-hand side matrix to the given target
+// matrix and returns without waiting for its completion. The assignment is performed exactly
+// as the according assignment operation, including the parallel evaluation via the thread
+// pool, while the calling thread can continue with other work. The returned future becomes
+// ready as soon as the assignment has been completed:
+
+   \code
+   blaze::DynamicMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   std::future<void> result( asyncAssign( C, A * B ) );
+   // ... Work independent of C
+   result.get();  // Waiting for the assignment to complete
+   \endcode
+
+// Any exception thrown during the assignment (as for instance a \a std::invalid_argument in
+// case the sizes of the two matrices don't match) is rethrown by the \c get() function of the
+// future. Note that the target matrix and all vectors and matrices referenced by the given
+// right-hand side expression must neither be accessed nor destroyed before the assignment has
+// been completed.
+//
+// The asynchronous evaluation requires the C++11 or Boost thread parallelization. In case of
+// the OpenMP or HPX parallelization or if no parallelization is active, the assignment is
+// performed immediately and the returned future is ready on return.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   return launchAsync( AsyncAssigner<MT1,MT2>( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous assignment of a temporary matrix to another matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The temporary right-hand side matrix to be assigned.
+// \return The future for the completion of the assignment.
+//
+// This overload of the asyncAssign() function handles temporary right-hand side matrices (as
+// for instance the result of the evaluate() function). Since the temporary is destroyed at
+// the end of the calling full-expression, the asynchronous assignment works on a copy of the
+// given matrix. Note that this does not apply to temporaries referenced by a right-hand side
+// expression, which must still outlive the assignment.
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline std::future<void> asyncAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>&& rhs )
+{
+   return launchAsync( AsyncAssigner<MT1,MT2,true>( ~lhs, ~rhs ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given vector expression.
+// \ingroup smp
+//
+// \param vec The vector to be evaluated.
+// \return The future for the result of the evaluation.
+//
+// This function starts the evaluation of the given vector (expression) into a vector of its
+// result type and returns without waiting for the completion of the evaluation (see also the
+// evaluate() function):
+
+   \code
+   blaze::DynamicMatrix<double> A;
+   blaze::DynamicVector<double> x;
+   // ... Resizing and initialization
+
+   auto result( evaluateAsync( A * x ) );
+   // ... Other work
+   blaze::DynamicVector<double> y( result.get() );
+   \endcode
+
+// Note that all vectors and matrices referenced by the given expression must neither be
+// modified nor destroyed before the evaluation has been completed. In case of the OpenMP or
+// HPX parallelization or if no parallelization is active, the evaluation is performed
+// immediately.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag of the vector
+inline std::future< ResultType_t<VT> > evaluateAsync( const Vector<VT,TF>& vec )
+{
+   return launchAsync( AsyncEvaluator<VT>( ~vec ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given temporary vector.
+// \ingroup smp
+//
+// \param vec The temporary vector to be evaluated.
+// \return The future for the result of the evaluation.
+//
+// This overload of the evaluateAsync() function handles temporary vectors. Since the temporary
+// is destroyed at the end of the calling full-expression, the asynchronous evaluation works on
+// a copy of the given vector.
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag of the vector
+inline std::future< ResultType_t<VT> > evaluateAsync( const Vector<VT,TF>&& vec )
+{
+   return launchAsync( AsyncEvaluator<VT,true>( ~vec ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given matrix expression.
+// \ingroup smp
+//
+// \param mat The matrix to be evaluated.
+// \return The future for the result of the evaluation.
+//
+// This function starts the evaluation of the given matrix (expression) into a matrix of its
+// result type and returns without waiting for the completion of the evaluation (see also the
+// evaluate() function):
+
+   \code
+   blaze::DynamicMatrix<double> A, B;
+   // ... Resizing and initialization
+
+   auto result( evaluateAsync( A * B ) );
+   // ... Other work
+   blaze::DynamicMatrix<double> C( result.get() );
+   \endcode
+
+// Note that all vectors and matrices referenced by the given expression must neither be
+// modified nor destroyed before the evaluation has been completed. In case of the OpenMP or
+// HPX parallelization or if no parallelization is active, the evaluation is performed
+// immediately.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline std::future< ResultType_t<MT> > evaluateAsync( const Matrix<MT,SO>& mat )
+{
+   return launchAsync( AsyncEvaluator<MT>( ~mat ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Asynchronous evaluation of the given temporary matrix.
+// \ingroup smp
+//
+// \param mat The temporary matrix to be evaluated.
+// \return The future for the result of the evaluation.
+//
+// This overload of the evaluateAsync() function handles temporary matrices. Since the temporary
+// is destroyed at the end of the calling full-expression, the asynchronous evaluation works on
+// a copy of the given matrix.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+inline std::future< ResultType_t<MT> > evaluateAsync( const Matrix<MT,SO>&& mat )
+{
+   return launchAsync( AsyncEvaluator<MT,true>( ~mat ) );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
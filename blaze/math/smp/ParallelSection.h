@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -97,10 +98,11 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_SMP_SECTION_STORAGE bool active_;  //!< Activity flag for the parallel section.
+                                                   /*!< In case a parallel section is active (i.e.
+                                                        the currently executed code is inside a
+                                                        parallel section), the flag is set to
+                                                        \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -124,7 +126,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+BLAZE_SMP_SECTION_STORAGE bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -89,10 +90,11 @@ class SerialSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the serial section.
-                         /*!< In case a serial section is active (i.e. the currently executed
-                              code is inside a serial section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   static BLAZE_SMP_SECTION_STORAGE bool active_;  //!< Activity flag for the serial section.
+                                                   /*!< In case a serial section is active (i.e.
+                                                        the currently executed code is inside a
+                                                        serial section), the flag is set to
+                                                        \a true, otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -116,7 +118,7 @@ class SerialSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool SerialSection<T>::active_ = false;
+BLAZE_SMP_SECTION_STORAGE bool SerialSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -0,0 +1,896 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/TaskGraph.h
+//  \brief Header file for the TaskGraph class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <exception>
+#include <future>
+#include <memory>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Forward.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/SubAssign.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/Async.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsView.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+#if !BLAZE_HPX_PARALLEL_MODE && ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#include <blaze/math/smp/threads/TaskGraph.h>
+#else
+#include <blaze/math/smp/default/TaskGraph.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE ISPIPELINABLE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary type trait for the pipelined execution of task graphs.
+// \ingroup smp
+//
+// This type trait tests whether the given type is a dense vector, which is neither a view nor
+// an expression, or an element-wise dense vector expression whose operands are again pipelinable.
+// Element \a i of a pipelinable expression only depends on element \a i of its vector operands.
+// Thus a chunk of an assignment of a pipelinable expression can be computed as soon as the same
+// chunk of all preceding assignments has been computed. In case the given type is pipelinable,
+// the \a value member constant is set to \a true, the nested type definition \a Type is
+// \a TrueType, and the class derives from \a TrueType. Otherwise \a value is set to \a false,
+// \a Type is \a FalseType, and the class derives from \a FalseType.
+*/
+template< typename T >
+struct IsPipelinable
+   : public BoolConstant< IsDenseVector_v<T> && !IsExpression_v<T> && !IsView_v<T> >
+{};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsPipelinable< DVecDVecAddExpr<VT1,VT2,TF> >
+   : public BoolConstant< IsPipelinable<VT1>::value && IsPipelinable<VT2>::value >
+{};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsPipelinable< DVecDVecSubExpr<VT1,VT2,TF> >
+   : public BoolConstant< IsPipelinable<VT1>::value && IsPipelinable<VT2>::value >
+{};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsPipelinable< DVecDVecMultExpr<VT1,VT2,TF> >
+   : public BoolConstant< IsPipelinable<VT1>::value && IsPipelinable<VT2>::value >
+{};
+
+template< typename VT1, typename VT2, bool TF >
+struct IsPipelinable< DVecDVecDivExpr<VT1,VT2,TF> >
+   : public BoolConstant< IsPipelinable<VT1>::value && IsPipelinable<VT2>::value >
+{};
+
+template< typename VT1, typename VT2, typename OP, bool TF >
+struct IsPipelinable< DVecDVecMapExpr<VT1,VT2,OP,TF> >
+   : public BoolConstant< IsPipelinable<VT1>::value && IsPipelinable<VT2>::value >
+{};
+
+template< typename VT, typename OP, bool TF >
+struct IsPipelinable< DVecMapExpr<VT,OP,TF> >
+   : public IsPipelinable<VT>
+{};
+
+template< typename VT, typename ST, bool TF >
+struct IsPipelinable< DVecScalarMultExpr<VT,ST,TF> >
+   : public IsPipelinable<VT>
+{};
+
+template< typename VT, typename ST, bool TF >
+struct IsPipelinable< DVecScalarDivExpr<VT,ST,TF> >
+   : public IsPipelinable<VT>
+{};
+
+template< typename VT, bool TF >
+struct IsPipelinable< DVecSerialExpr<VT,TF> >
+   : public IsPipelinable<VT>
+{};
+
+template< typename VT, bool TF >
+struct IsPipelinable< DVecTransExpr<VT,TF> >
+   : public IsPipelinable<VT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dependency-aware execution of a sequence of vector and matrix assignments.
+// \ingroup smp
+//
+// The TaskGraph class records a sequence of (compound) assignments and executes them such that
+// independent assignments are executed concurrently. For that purpose, every recorded assignment
+// writes its target and reads all vectors and matrices of its right-hand side expression (as
+// determined via the \a isAliased() function of the expression). Two assignments depend on each
+// other in case one of them writes a vector or matrix that the other one reads or writes. All
+// assignments are executed in stages: an assignment is executed in the first stage after all
+// stages containing assignments it depends on. The assignments of a stage are executed
+// concurrently, every single assignment again being executed in parallel:
+
+   \code
+   blaze::DynamicMatrix<double> A, M;
+   blaze::DynamicVector<double> b, x, r, z, p, t, u;
+   // ... Resizing and initialization (including the size of r)
+
+   blaze::TaskGraph graph;
+
+   graph.assign( r, b - A*x );  // Stage 1
+   graph.assign( t, p * 2.0 );  // Stage 1: Independent of the first assignment
+   graph.assign( z, M*r );      // Stage 2: Reads r
+   graph.assign( u, z + t );    // Stage 3: Reads z and t
+   graph.addAssign( u, z );     // Stage 3: Pipelined with the previous assignment
+
+   graph.run();
+   \endcode
+
+// In case an assignment only depends on the assignments of a single element-wise chain of
+// dense vector assignments (as for instance the last two assignments in the example), the
+// assignment is appended to this chain. With the C++11 and Boost thread parallelizations, the
+// assignments of such a chain are pipelined chunk by chunk: every thread computes a chunk of all
+// assignments of the chain in order, without a barrier between the assignments. Pipelining
+// requires that all dense vector operands of a chain are neither views nor expressions other than
+// element-wise operations (additions, subtractions, componentwise multiplications and divisions,
+// scalings, transpositions, and unary and binary custom operations), and that the sizes of all
+// targets match the sizes of the according right-hand side expressions. Otherwise the chain is
+// executed assignment by assignment. With the OpenMP and HPX parallelizations all assignments
+// are executed one after another in a valid order, every assignment being executed in parallel.
+//
+// Note that the right-hand side expressions are recorded, not evaluated: every call to run()
+// executes all assignments with the current values of their operands. However, all scalar
+// factors and all scalar reductions (as for instance \a dot() or \a norm()) are evaluated at the
+// time of recording. Since the sizes of the operands of an expression are checked when creating
+// the expression, all vectors and matrices computed by a previous assignment of the task graph
+// must already have their final size when used as operand. Also note that all targets and
+// operands of the recorded assignments must neither be destroyed nor accessed by other threads
+// while the task graph is executed.
+*/
+class TaskGraph
+   : private NonCopyable
+{
+ private:
+   //**Private class Statement*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Base class for all recorded assignments.
+   */
+   class Statement
+   {
+    public:
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor of the Statement class.
+      */
+      virtual ~Statement() = default;
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      virtual const void* target       () const noexcept = 0;
+      virtual bool        reads        ( const void* alias ) const noexcept = 0;
+      virtual bool        isPipelinable() const noexcept = 0;
+      virtual size_t      pipelineSize () const noexcept = 0;
+      virtual size_t      granularity  () const noexcept = 0;
+      virtual void        run          () = 0;
+      virtual void        run          ( size_t index, size_t size ) = 0;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class StatementImpl*****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Implementation of a recorded assignment.
+   //
+   // The StatementImpl class template stores the target of an assignment and its right-hand side
+   // operand. Views are stored by value, all other targets by reference. Expressions are stored
+   // by value, all other operands by reference.
+   */
+   template< typename T1    // Type of the target
+           , typename T2    // Type of the right-hand side operand
+           , typename OP >  // Type of the assignment operation
+   class StatementImpl
+      : public Statement
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using Target  = If_t< IsView_v<T1>, T1, T1& >;                    //!< Type of the target.
+      using Operand = If_t< IsExpression_v<T2>, const T2, const T2& >;  //!< Type of the operand.
+      //*******************************************************************************************
+
+      //**Compilation flags************************************************************************
+      //! Compilation flag for the pipelined execution of the assignment.
+      static constexpr bool pipelinable = ( IsPipelinable<T1>::value && IsPipelinable<T2>::value );
+      //*******************************************************************************************
+
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the StatementImpl class template.
+      //
+      // \param target The target of the assignment.
+      // \param operand The right-hand side operand of the assignment.
+      */
+      explicit inline StatementImpl( T1& target, const T2& operand )
+         : target_ ( target  )  // The target of the assignment
+         , operand_( operand )  // The right-hand side operand
+      {}
+      //*******************************************************************************************
+
+      //**Utility functions************************************************************************
+      /*!\brief Returns the address of the vector or matrix written by the assignment.
+      //
+      // \return The address of the target (or the underlying operand in case of a view).
+      */
+      const void* target() const noexcept override {
+         return address( target_ );
+      }
+
+      /*!\brief Returns whether the assignment reads the given vector or matrix.
+      //
+      // \param alias The address of the vector or matrix.
+      // \return \a true in case the given vector or matrix is read, \a false if not.
+      */
+      bool reads( const void* alias ) const noexcept override {
+         return operand_.isAliased( alias );
+      }
+
+      /*!\brief Returns whether the assignment can be pipelined.
+      //
+      // \return \a true in case the assignment can be pipelined, \a false if not.
+      */
+      bool isPipelinable() const noexcept override {
+         return pipelinable;
+      }
+
+      /*!\brief Returns the number of elements for the pipelined execution of the assignment.
+      //
+      // \return The size of the target, 0 in case the assignment cannot be pipelined.
+      */
+      size_t pipelineSize() const noexcept override {
+         return pipelineSize( BoolConstant<pipelinable>() );
+      }
+
+      /*!\brief Returns the granularity of the chunks for the pipelined execution.
+      //
+      // \return The number of elements per SIMD vector of the target.
+      */
+      size_t granularity() const noexcept override {
+         return SIMDTrait< ElementType_t<T1> >::size;
+      }
+
+      /*!\brief Executes the assignment.
+      //
+      // \return void
+      */
+      void run() override {
+         run( OP() );
+      }
+
+      /*!\brief Executes the assignment for the given chunk of elements.
+      //
+      // \param index The index of the first element of the chunk.
+      // \param size The number of elements of the chunk.
+      // \return void
+      */
+      void run( size_t index, size_t size ) override {
+         run( index, size, BoolConstant<pipelinable>() );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Utility functions************************************************************************
+      /*! \cond BLAZE_INTERNAL */
+      size_t pipelineSize( TrueType ) const noexcept {
+         return ( target_.size() == operand_.size() )?( target_.size() ):( 0UL );
+      }
+
+      size_t pipelineSize( FalseType ) const noexcept {
+         return 0UL;
+      }
+
+      void run( Assign    ) { target_  = operand_; }
+      void run( AddAssign ) { target_ += operand_; }
+      void run( SubAssign ) { target_ -= operand_; }
+
+      void run( size_t index, size_t size, TrueType ) {
+         auto       target ( subvector( target_ , index, size, unchecked ) );
+         const auto operand( subvector( operand_, index, size, unchecked ) );
+         OP()( target, operand );
+      }
+
+      void run( size_t, size_t, FalseType ) {
+         BLAZE_INTERNAL_ASSERT( false, "Invalid pipelined execution" );
+      }
+      /*! \endcond */
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      Target  target_;   //!< The target of the assignment.
+      Operand operand_;  //!< The right-hand side operand of the assignment.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private struct Unit*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief A sequence of dependent assignments executed by the same stage.
+   */
+   struct Unit
+   {
+      size_t stage;                     //!< The stage executing the unit.
+      bool pipelinable;                 //!< Flag for pipelinable units.
+      std::vector<size_t> statements;  //!< The indices of the assignments of the unit.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGraph();
+   //@}
+   //**********************************************************************************************
+
+   //**Recording functions*************************************************************************
+   /*!\name Recording functions */
+   //@{
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline void assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline void addAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+   template< typename VT1, bool TF1, typename VT2, bool TF2 >
+   inline void subAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+
+   template< typename MT1, bool SO1, typename MT2, bool SO2 >
+   inline void subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size   () const noexcept;
+   inline size_t stages () const noexcept;
+   inline bool   isEmpty() const noexcept;
+   inline void   run    ();
+   inline void   clear  () noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename OP, typename T1, typename T2 >
+   inline void record( T1& target, const T2& operand );
+
+   inline void runUnit( const Unit& unit );
+
+   template< typename T >
+   static inline auto address( const T& operand ) noexcept -> EnableIf_t< IsView_v<T>, const void* >;
+
+   template< typename T >
+   static inline auto address( const T& operand ) noexcept -> EnableIf_t< !IsView_v<T>, const void* >;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector< std::unique_ptr<Statement> > statements_;  //!< The recorded assignments.
+   std::vector<size_t> units_;                              //!< The unit of each assignment.
+   std::vector<Unit> graph_;                                //!< The units of the task graph.
+   std::vector< std::vector<size_t> > stages_;              //!< The units of each stage.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for TaskGraph.
+*/
+inline TaskGraph::TaskGraph()
+   : statements_()  // The recorded assignments
+   , units_     ()  // The unit of each assignment
+   , graph_     ()  // The units of the task graph
+   , stages_    ()  // The units of each stage
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RECORDING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a vector to another vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be assigned.
+// \return void
+//
+// This function records the assignment of the given right-hand side vector to the given target
+// vector. The assignment is not executed before the next call to run(). Note that in case the
+// sizes of the two vectors don't match, a \a std::invalid_argument exception is thrown by run().
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void TaskGraph::assign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a vector to another vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be added.
+// \return void
+//
+// This function records the addition assignment of the given right-hand side vector to the
+// given target vector. The assignment is not executed before the next call to run(). Note that
+// in case the sizes of the two vectors don't match, a \a std::invalid_argument exception is
+// thrown by run().
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void TaskGraph::addAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a vector to another vector.
+//
+// \param lhs The target left-hand side vector.
+// \param rhs The right-hand side vector to be subtracted.
+// \return void
+//
+// This function records the subtraction assignment of the given right-hand side vector to the
+// given target vector. The assignment is not executed before the next call to run(). Note that
+// in case the sizes of the two vectors don't match, a \a std::invalid_argument exception is
+// thrown by run().
+*/
+template< typename VT1  // Type of the left-hand side vector
+        , bool TF1      // Transpose flag of the left-hand side vector
+        , typename VT2  // Type of the right-hand side vector
+        , bool TF2 >    // Transpose flag of the right-hand side vector
+inline void TaskGraph::subAssign( Vector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs )
+{
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the assignment of a matrix to another matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \return void
+//
+// This function records the assignment of the given right-hand side matrix to the given target
+// matrix. The assignment is not executed before the next call to run(). Note that in case the
+// sizes of the two matrices don't match, a \a std::invalid_argument exception is thrown by run().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::assign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<Assign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the addition assignment of a matrix to another matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be added.
+// \return void
+//
+// This function records the addition assignment of the given right-hand side matrix to the
+// given target matrix. The assignment is not executed before the next call to run(). Note that
+// in case the sizes of the two matrices don't match, a \a std::invalid_argument exception is
+// thrown by run().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::addAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<AddAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Records the subtraction assignment of a matrix to another matrix.
+//
+// \param lhs The target left-hand side matrix.
+// \param rhs The right-hand side matrix to be subtracted.
+// \return void
+//
+// This function records the subtraction assignment of the given right-hand side matrix to the
+// given target matrix. The assignment is not executed before the next call to run(). Note that
+// in case the sizes of the two matrices don't match, a \a std::invalid_argument exception is
+// thrown by run().
+*/
+template< typename MT1  // Type of the left-hand side matrix
+        , bool SO1      // Storage order of the left-hand side matrix
+        , typename MT2  // Type of the right-hand side matrix
+        , bool SO2 >    // Storage order of the right-hand side matrix
+inline void TaskGraph::subAssign( Matrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs )
+{
+   record<SubAssign>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of recorded assignments.
+//
+// \return The number of recorded assignments.
+*/
+inline size_t TaskGraph::size() const noexcept
+{
+   return statements_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stages of the task graph.
+//
+// \return The number of stages.
+//
+// This function returns the number of stages the recorded assignments are executed in, i.e.
+// the length of the longest chain of dependent assignments that cannot be pipelined.
+*/
+inline size_t TaskGraph::stages() const noexcept
+{
+   return stages_.size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether no assignment has been recorded.
+//
+// \return \a true in case no assignment has been recorded, \a false if not.
+*/
+inline bool TaskGraph::isEmpty() const noexcept
+{
+   return statements_.empty();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes all recorded assignments.
+//
+// \return void
+// \exception std::invalid_argument Invalid vector/matrix sizes.
+//
+// This function executes all recorded assignments stage by stage. All units of a stage are
+// executed concurrently (in case of the C++11 and Boost thread parallelizations): the first
+// unit is executed by the calling thread, all other units are launched as independent callers
+// of the thread pool. In case any assignment throws an exception, the function waits for the
+// completion of the current stage, skips all remaining stages and rethrows the first exception.
+// The recorded assignments are not removed from the task graph and can be executed repeatedly.
+*/
+inline void TaskGraph::run()
+{
+   for( const std::vector<size_t>& stage : stages_ )
+   {
+      BLAZE_INTERNAL_ASSERT( !stage.empty(), "Invalid empty stage detected" );
+
+      std::vector< std::future<void> > futures;
+      futures.reserve( stage.size() - 1UL );
+
+      for( size_t i=1UL; i<stage.size(); ++i ) {
+         const Unit& unit( graph_[stage[i]] );
+         futures.push_back( launchAsync( [this,&unit]() { runUnit( unit ); } ) );
+      }
+
+      std::exception_ptr error;
+
+      try {
+         runUnit( graph_[stage.front()] );
+      }
+      catch( ... ) {
+         error = std::current_exception();
+      }
+
+      for( std::future<void>& future : futures ) {
+         try {
+            future.get();
+         }
+         catch( ... ) {
+            if( !error ) error = std::current_exception();
+         }
+      }
+
+      if( error ) {
+         std::rethrow_exception( error );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all recorded assignments.
+//
+// \return void
+*/
+inline void TaskGraph::clear() noexcept
+{
+   statements_.clear();
+   units_.clear();
+   graph_.clear();
+   stages_.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Records the given assignment and determines its dependencies.
+//
+// \param target The target of the assignment.
+// \param operand The right-hand side operand of the assignment.
+// \return void
+//
+// This function records the given assignment and determines all previously recorded assignments
+// it depends on. The assignment is appended to an existing unit in case both the unit and the
+// assignment can be pipelined and all assignments it depends on are either contained in this
+// unit or executed by a previous stage. Otherwise a new unit is created, which is executed by
+// the first stage after all stages of the assignments it depends on.
+*/
+template< typename OP    // Type of the assignment operation
+        , typename T1    // Type of the target
+        , typename T2 >  // Type of the right-hand side operand
+inline void TaskGraph::record( T1& target, const T2& operand )
+{
+   std::unique_ptr<Statement> statement( new StatementImpl<T1,T2,OP>( target, operand ) );
+
+   const void* const alias( statement->target() );
+
+   // Determining the dependencies of the assignment
+   std::vector<size_t> dependencies;
+   size_t stage( 0UL );
+
+   for( size_t i=0UL; i<statements_.size(); ++i )
+   {
+      const Statement& other( *statements_[i] );
+
+      if( other.target() == alias || statement->reads( other.target() ) || other.reads( alias ) ) {
+         dependencies.push_back( units_[i] );
+         stage = max( stage, graph_[units_[i]].stage + 1UL );
+      }
+   }
+
+   // Appending the assignment to a pipelinable unit of the last stage it depends on
+   if( statement->isPipelinable() && stage > 0UL )
+   {
+      size_t unit( graph_.size() );
+
+      for( size_t dependency : dependencies ) {
+         if( graph_[dependency].stage + 1UL < stage )
+            continue;
+         else if( unit == graph_.size() )
+            unit = dependency;
+         else if( unit != dependency )
+            unit = graph_.size() + 1UL;
+      }
+
+      if( unit < graph_.size() && graph_[unit].pipelinable ) {
+         graph_[unit].statements.push_back( statements_.size() );
+         units_.push_back( unit );
+         statements_.push_back( std::move( statement ) );
+         return;
+      }
+   }
+
+   // Creating a new unit
+   if( stages_.size() <= stage ) {
+      stages_.resize( stage + 1UL );
+   }
+
+   stages_[stage].push_back( graph_.size() );
+   units_.push_back( graph_.size() );
+   graph_.push_back( Unit{ stage, statement->isPipelinable(), { statements_.size() } } );
+   statements_.push_back( std::move( statement ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given unit of assignments.
+//
+// \param unit The unit to be executed.
+// \return void
+//
+// This function executes all assignments of the given unit in order. In case the unit consists
+// of several assignments and all targets have the same size as the according right-hand side
+// operands, the assignments are pipelined chunk by chunk. Otherwise, or in case the backend
+// does not support pipelining, the assignments are executed one after another.
+*/
+inline void TaskGraph::runUnit( const Unit& unit )
+{
+   const std::vector<size_t>& statements( unit.statements );
+
+   if( statements.size() > 1UL )
+   {
+      const size_t n( statements_[statements.front()]->pipelineSize() );
+
+      bool pipelinable( n > 0UL );
+      size_t granularity( 1UL );
+
+      for( size_t i : statements ) {
+         pipelinable = pipelinable && ( statements_[i]->pipelineSize() == n );
+         granularity = max( granularity, statements_[i]->granularity() );
+      }
+
+      if( pipelinable &&
+          pipelineExecute( n, granularity, [this,&statements]( size_t index, size_t size ) {
+             for( size_t i : statements ) {
+                statements_[i]->run( index, size );
+             }
+          } ) )
+         return;
+   }
+
+   for( size_t i : statements ) {
+      statements_[i]->run();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the address of the vector or matrix underlying the given view.
+//
+// \param operand The given view.
+// \return The address of the underlying vector or matrix.
+*/
+template< typename T >  // Type of the operand
+inline auto TaskGraph::address( const T& operand ) noexcept
+   -> EnableIf_t< IsView_v<T>, const void* >
+{
+   return address( operand.operand() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the address of the given vector or matrix.
+//
+// \param operand The given vector or matrix.
+// \return The address of the given vector or matrix.
+*/
+template< typename T >  // Type of the operand
+inline auto TaskGraph::address( const T& operand ) noexcept
+   -> EnableIf_t< !IsView_v<T>, const void* >
+{
+   return &operand;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
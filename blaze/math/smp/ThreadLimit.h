@@ -0,0 +1,292 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/ThreadLimit.h
+//  \brief Header file for the thread limit implementation
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADLIMIT_H_
+#define _BLAZE_MATH_SMP_THREADLIMIT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <limits>
+#include <blaze/math/Exception.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Suffix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to limit the number of threads used by parallel operations.
+// \ingroup smp
+//
+// The ThreadLimit class is an auxiliary helper class for the \a BLAZE_THREAD_LIMIT macro. It
+// provides the functionality to limit the number of threads used by the parallel operations
+// executed by the current thread (see the \a BLAZE_THREAD_LIMIT macro).
+*/
+template< typename T >
+class ThreadLimit
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline ThreadLimit( size_t n );
+   ThreadLimit( const ThreadLimit& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~ThreadLimit();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   ThreadLimit& operator=( const ThreadLimit& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator bool() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t previous_;  //!< The thread limit before the start of the section.
+
+   static BLAZE_SMP_SECTION_STORAGE size_t limit_;  //!< The current thread limit.
+                                                    /*!< The maximum number of threads the
+                                                         parallel operations of the current
+                                                         thread may use. */
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   friend size_t getThreadLimit();
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+BLAZE_SMP_SECTION_STORAGE size_t ThreadLimit<T>::limit_ = std::numeric_limits<size_t>::max();
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadLimit class.
+//
+// \param n The maximum number of threads \f$[1..\infty)\f$.
+// \exception std::invalid_argument Invalid number of threads.
+//
+// The new thread limit is the minimum of the given number of threads and the currently active
+// thread limit, i.e. a nested section can only further reduce the number of threads.
+*/
+template< typename T >
+inline ThreadLimit<T>::ThreadLimit( size_t n )
+   : previous_( limit_ )  // The thread limit before the start of the section
+{
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   limit_ = min( limit_, n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor of the ThreadLimit class.
+*/
+template< typename T >
+inline ThreadLimit<T>::~ThreadLimit()
+{
+   limit_ = previous_;  // Restoring the previous thread limit
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion operator to \a bool.
+//
+// The conversion operator always returns \a true.
+*/
+template< typename T >
+inline ThreadLimit<T>::operator bool() const
+{
+   return true;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name ThreadLimit functions */
+//@{
+inline size_t getThreadLimit();
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the currently active thread limit.
+// \ingroup smp
+//
+// \return The maximum number of threads the parallel operations of the current thread may use.
+//
+// In case no thread limit is active, the function returns the maximum value of \c size_t.
+*/
+inline size_t getThreadLimit()
+{
+   return ThreadLimit<int>::limit_;
+}
+//*************************************************************************************************
+
+
+
+
+
+
+
+
+//=================================================================================================
+//
+//  THREAD LIMIT MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Section to limit the number of threads used by parallel operations.
+// \ingroup smp
+//
+// This macro provides the option to start a section in which all parallel operations executed
+// by the current thread use at most the given number of threads of the thread pool. The
+// following example demonstrates how a thread limit is used in a service that concurrently
+// evaluates requests on several threads:
+
+   \code
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   void handleRequest( const blaze::DynamicMatrix<double,rowMajor>& A,
+                       const blaze::DynamicVector<double,columnVector>& b )
+   {
+      blaze::DynamicVector<double,columnVector> x;
+
+      // Start of a thread limit section
+      // The matrix/vector multiplication uses at most 4 threads of the thread pool, even
+      // if more threads are available. The threads of the pool remain available for the
+      // concurrent requests.
+      BLAZE_THREAD_LIMIT( 4 ) {
+         x = A * b;
+      }
+   }
+   \endcode
+
+// The limit only affects the thread that has started the section. Nested sections can further
+// reduce, but not increase the number of threads. In case the given number of threads is 0,
+// a \a std::invalid_argument exception is thrown. Note that the thread limit is only supported
+// by the C++11 and Boost thread parallelizations. For the OpenMP parallelization, the number of
+// threads of the calling thread can be adapted via \c omp_set_num_threads().
+*/
+#define BLAZE_THREAD_LIMIT( N ) \
+   if( blaze::ThreadLimit<int> BLAZE_JOIN( threadLimit, __LINE__ ) = ( N ) )
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/MaybeUnused.h>
@@ -58,9 +59,13 @@ namespace blaze {
 //*************************************************************************************************
 /*!\name SMP utility functions */
 //@{
-BLAZE_ALWAYS_INLINE size_t getNumThreads  ();
-BLAZE_ALWAYS_INLINE void   setNumThreads  ( size_t number );
-BLAZE_ALWAYS_INLINE void   shutDownThreads();
+BLAZE_ALWAYS_INLINE size_t getNumThreads    ();
+BLAZE_ALWAYS_INLINE void   setNumThreads    ( size_t number );
+BLAZE_ALWAYS_INLINE void   setThreadAffinity( const std::string& affinity );
+BLAZE_ALWAYS_INLINE void   shutDownThreads  ();
+
+template< typename Func >
+inline void smpFor( size_t tasks, Func func );
 //@}
 //*************************************************************************************************
 
@@ -101,6 +106,24 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Sets the thread affinity for thread parallel operations.
+// \ingroup smp
+//
+// \param affinity The thread affinity specification.
+// \return void
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs (see the \c BLAZE_THREAD_AFFINITY environment variable). Note that in case no
+// parallelization is active, the function has no effect and the given affinity is not checked.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
 // \ingroup smp
@@ -130,6 +153,32 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given number of independent tasks.
+// \ingroup smp
+//
+// \param tasks The total number of tasks.
+// \param func The function to be called for each task index \f$[0..tasks)\f$.
+// \return void
+//
+// This function calls the given function for every task index in the range \f$[0..tasks)\f$.
+// Since no parallelization is active, all tasks are executed in order by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of compute kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename Func >  // Type of the task function
+inline void smpFor( size_t tasks, Func func )
+{
+   for( size_t i=0UL; i<tasks; ++i ) {
+      func( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,86 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/TaskGraph.h
+//  \brief Header file for the default pipelined execution of task graphs
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PIPELINED EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default pipelined execution of a sequence of element-wise operations.
+// \ingroup smp
+//
+// \param size The number of elements of all operations.
+// \param granularity The granularity of the chunk sizes (a power of 2).
+// \param func The function/functor performing all operations on a single chunk.
+// \return \a false since the default backend does not support pipelined execution.
+//
+// This function is the default backend for the pipelined execution of task graphs, which is
+// selected in case no thread-based parallelization is active. Since the OpenMP and HPX based
+// parallelizations execute every single operation in parallel, the function does not execute
+// the operations but returns \a false, i.e. the operations are executed one after another.\n
+// This function must \b NOT be called explicitly! It is used internally for the execution of
+// task graphs. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Callable >  // Type of the function/functor
+inline bool pipelineExecute( size_t size, size_t granularity, Callable func )
+{
+   MAYBE_UNUSED( size, granularity, func );
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,9 +40,11 @@
 // Includes
 //*************************************************************************************************
 
+#include <hpx/include/parallel_for_loop.hpp>
 #include <hpx/runtime/get_os_thread_count.hpp>
 
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
@@ -107,6 +109,41 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given number of independent tasks in parallel via HPX.
+// \ingroup smp
+//
+// \param tasks The total number of tasks.
+// \param func The function to be called for each task index \f$[0..tasks)\f$.
+// \return void
+//
+// This function calls the given function for every task index in the range \f$[0..tasks)\f$.
+// The tasks are executed by means of an HPX parallel loop. In case a serial section is active
+// or in case there is only a single task, all tasks are executed by the calling thread.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of compute kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename Func >  // Type of the task function
+void smpFor( size_t tasks, Func func )
+{
+   using hpx::parallel::for_loop;
+   using hpx::parallel::execution::par;
+
+   if( tasks < 2UL || isSerialSectionActive() ) {
+      for( size_t i=0UL; i<tasks; ++i ) {
+         func( i );
+      }
+      return;
+   }
+
+   for_loop( par, size_t(0), tasks, [&func]( size_t i ) { func( i ); } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -40,10 +40,14 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
 #include <omp.h>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
+#include <blaze/util/MaybeUnused.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -100,6 +104,26 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity for OpenMP parallel operations.
+// \ingroup smp
+//
+// \param affinity The thread affinity specification.
+// \return void
+//
+// In case of the OpenMP-based parallelization the thread affinity is controlled by the OpenMP
+// runtime, i.e. via the \c OMP_PROC_BIND and \c OMP_PLACES environment variables. Therefore
+// this function has no effect.
+*/
+BLAZE_ALWAYS_INLINE void setThreadAffinity( const std::string& affinity )
+{
+   MAYBE_UNUSED( affinity );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -131,6 +155,45 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given number of independent tasks in parallel via OpenMP.
+// \ingroup smp
+//
+// \param tasks The total number of tasks.
+// \param func The function to be called for each task index \f$[0..tasks)\f$.
+// \return void
+//
+// This function calls the given function for every task index in the range \f$[0..tasks)\f$.
+// The tasks are distributed among the available OpenMP threads. In case a serial section or
+// another parallel section is active or in case there is only a single task, all tasks are
+// executed by the calling thread. Note that the given function must not throw.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of compute kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename Func >  // Type of the task function
+void smpFor( size_t tasks, Func func )
+{
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t i=0UL; i<tasks; ++i ) {
+         func( i );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel for schedule(dynamic,1) shared( func )
+      for( int i=0; i<static_cast<int>( tasks ); ++i ) {
+         func( static_cast<size_t>( i ) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,114 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/Async.h
+//  \brief Header file for the C++11/Boost thread-based asynchronous launch functionality
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+#define _BLAZE_MATH_SMP_THREADS_ASYNC_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <future>
+#include <memory>
+#include <utility>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/ThreadLimit.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ASYNCHRONOUS LAUNCH FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based launch of the given function/functor for asynchronous execution.
+// \ingroup smp
+//
+// \param func The given function/functor.
+// \return The future for the result of the function/functor.
+//
+// This function launches the given function or functor via the C++11/Boost thread backend and
+// immediately returns a future for its result. The function is executed by an independent
+// caller of the thread pool, i.e. all operations performed by the function are again executed
+// in parallel by the threads of the thread pool. The thread limit and the serial section of
+// the calling thread (see \a BLAZE_THREAD_LIMIT and \a BLAZE_SERIAL_SECTION) also apply to the
+// launched function. In case this function is called from within a launched function, the
+// launcher pool is grown by one thread for the execution of the given function (see
+// ThreadBackend::launch()). Any exception thrown by the function is stored in the future.\n
+// This function must \b NOT be called explicitly! It is used internally for the asynchronous
+// evaluation of expressions. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename Callable >  // Type of the function/functor
+inline auto launchAsync( Callable func ) -> std::future< decltype( func() ) >
+{
+   using Task = std::packaged_task< decltype( func() )() >;
+
+   const auto task( std::make_shared<Task>( std::move( func ) ) );
+   auto future( task->get_future() );
+
+   const size_t limit ( getThreadLimit() );
+   const bool   serial( isSerialSectionActive() );
+
+   TheThreadBackend::launch( [task,limit,serial]()
+   {
+      BLAZE_THREAD_LIMIT( limit )
+      {
+         if( serial ) {
+            BLAZE_SERIAL_SECTION {
+               (*task)();
+            }
+         }
+         else {
+            (*task)();
+         }
+      }
+   } );
+
+   return future;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -113,7 +113,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1     ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t equalShare1( (~rhs).rows() / threads.first + addon1 );
@@ -200,7 +200,7 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const ThreadMapping threads( createThreadMapping( TheThreadBackend::size(), ~rhs ) );
+   const ThreadMapping threads( createThreadMapping( TheThreadBackend::tasks(), ~rhs ) );
 
    const size_t addon1       ( ( ( (~rhs).rows() % threads.first ) != 0UL )? 1UL : 0UL );
    const size_t rowsPerThread( (~rhs).rows() / threads.first + addon1 );
@@ -112,7 +112,7 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const bool lhsAligned( (~lhs).isAligned() );
    const bool rhsAligned( (~rhs).isAligned() );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t equalShare   ( (~lhs).size() / threads + addon );
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
@@ -184,7 +184,7 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
 
    BLAZE_INTERNAL_ASSERT( isParallelSectionActive(), "Invalid call outside a parallel section" );
 
-   const size_t threads      ( TheThreadBackend::size() );
+   const size_t threads      ( TheThreadBackend::tasks() );
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
@@ -40,11 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <string>
 #include <blaze/math/Exception.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/ThreadLimit.h>
 #include <blaze/system/Inline.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/Types.h>
 
 
@@ -64,10 +70,12 @@ namespace blaze {
 // \return The number of threads used for thread parallel operations.
 //
 // Via this function the number of threads used for thread parallel operations can be queried.
+// In case a thread limit is active for the calling thread (see the \a BLAZE_THREAD_LIMIT macro),
+// the function returns the minimum of the size of the thread pool and the thread limit.
 */
 BLAZE_ALWAYS_INLINE size_t getNumThreads()
 {
-   return TheThreadBackend::size();
+   return min( TheThreadBackend::size(), getThreadLimit() );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -98,6 +106,32 @@ BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sets the thread affinity for thread parallel operations.
+// \ingroup smp
+//
+// \param affinity The thread affinity specification.
+// \return void
+// \exception std::invalid_argument Invalid thread affinity.
+//
+// Via this function the threads used for thread parallel operations can be pinned to specific
+// CPUs. The function accepts the same values as the \c BLAZE_THREAD_AFFINITY environment
+// variable: \c "none" releases all threads, \c "compact" pins the threads to consecutive CPUs
+// (filling one socket before using the next one), \c "scatter" distributes the threads among
+// the sockets and an explicit list of CPUs (as for instance \c "0,2,4-7") pins the \f$ i \f$-th
+// thread to the \f$ i \f$-th CPU of the list. In case an invalid thread affinity is specified,
+// a \a std::invalid_argument exception is thrown. Note that pinning is currently only supported
+// on Linux.
+*/
+inline void setThreadAffinity( const std::string& affinity )
+{
+   TheThreadBackend::setAffinity( threadpool::parseAffinity( affinity ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Provides a reliable shutdown of C++11 threads for Visual Studio compilers.
@@ -133,6 +167,47 @@ BLAZE_ALWAYS_INLINE void shutDownThreads()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given number of independent tasks in parallel via the thread backend.
+// \ingroup smp
+//
+// \param tasks The total number of tasks.
+// \param func The function to be called for each task index \f$[0..tasks)\f$.
+// \return void
+//
+// This function calls the given function for every task index in the range \f$[0..tasks)\f$.
+// All tasks are scheduled for execution by the C++11/Boost thread backend and the function
+// blocks until all tasks have been completed. In case a serial section or another parallel
+// section is active or in case there is only a single task, all tasks are executed by the
+// calling thread. Note that the given function must not throw.\n
+// This function must \b NOT be called explicitly! It is used internally for the parallel
+// execution of compute kernels. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename Func >  // Type of the task function
+void smpFor( size_t tasks, Func func )
+{
+   if( tasks < 2UL || isSerialSectionActive() || isParallelSectionActive() ) {
+      for( size_t i=0UL; i<tasks; ++i ) {
+         func( i );
+      }
+      return;
+   }
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<tasks; ++i ) {
+         TheThreadBackend::schedule( [&func,i]() { func( i ); } );
+      }
+
+      TheThreadBackend::wait();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,126 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/TaskGraph.h
+//  \brief Header file for the C++11/Boost thread-based pipelined execution of task graphs
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+#define _BLAZE_MATH_SMP_THREADS_TASKGRAPH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PIPELINED EXECUTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief C++11/Boost thread-based pipelined execution of a sequence of element-wise operations.
+// \ingroup smp
+//
+// \param size The number of elements of all operations.
+// \param granularity The granularity of the chunk sizes (a power of 2).
+// \param func The function/functor performing all operations on a single chunk.
+// \return \a true in case the operations have been executed, \a false if not.
+//
+// This function splits the index range [0..size) into one chunk per task of the thread backend
+// and schedules the given function or functor for each chunk. The function is called with the
+// first index and the size of the chunk and is expected to perform all operations on the chunk
+// in order. Thus a chunk of a subsequent operation is computed directly after the according
+// chunk of the preceding operation, without a barrier between the operations. The function
+// returns \a false without executing the operations in case parallel execution is not possible
+// or not beneficial, i.e. in case a serial or parallel section is active, the size is below the
+// SMP dense vector assignment threshold, or only a single thread is available.\n
+// This function must \b NOT be called explicitly! It is used internally for the execution of
+// task graphs. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename Callable >  // Type of the function/functor
+inline bool pipelineExecute( size_t size, size_t granularity, Callable func )
+{
+   BLAZE_INTERNAL_ASSERT( granularity > 0UL && ( granularity & ( granularity - 1UL ) ) == 0UL,
+                          "Invalid chunk granularity" );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || size < SMP_DVECASSIGN_THRESHOLD )
+      return false;
+
+   const size_t threads( TheThreadBackend::tasks() );
+
+   if( threads < 2UL )
+      return false;
+
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare & ( granularity - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + granularity ):( equalShare ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      for( size_t i=0UL; i<threads; ++i )
+      {
+         const size_t index( i*sizePerThread );
+
+         if( index >= size )
+            continue;
+
+         const size_t n( min( sizePerThread, size - index ) );
+
+         TheThreadBackend::schedule( [func,index,n]() { func( index, n ); } );
+      }
+
+      TheThreadBackend::wait();
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
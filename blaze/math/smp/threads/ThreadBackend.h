@@ -51,11 +51,17 @@
 #endif
 
 #include <cstdlib>
+#include <stdexcept>
+#include <vector>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/ThreadLimit.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/threadpool/TaskGroup.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Types.h>
 
@@ -75,7 +81,9 @@ namespace blaze {
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
 // thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// threads and to schedule (compound) assignment tasks for execution. Every calling thread
+// schedules its tasks as part of its own task group and only waits for its own tasks, i.e.
+// several threads can concurrently execute parallel operations via the same thread pool.\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -89,9 +97,11 @@ class ThreadBackend
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   static inline size_t size  ();
-   static inline void   resize( size_t n, bool block=false );
-   static inline void   wait  ();
+   static inline size_t size       ();
+   static inline size_t tasks      ();
+   static inline void   resize     ( size_t n, bool block=false );
+   static inline void   setAffinity( const std::vector<size_t>& cpus );
+   static inline void   wait       ();
    //@}
    //**********************************************************************************************
 
@@ -100,6 +110,12 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void schedule( Callable func );
+
+   template< typename Callable >
+   static inline void launch( Callable func );
    //@}
    //**********************************************************************************************
 
@@ -149,22 +165,74 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Private class Launcher**********************************************************************
+   /*!\brief Pool of threads for the execution of launched functions.
+   //
+   // The launcher pool consists of one thread per thread of the thread pool plus one additional
+   // thread per currently running nested launch. On destruction it waits for the completion of
+   // all launched functions before its threads are joined.
+   */
+   struct Launcher
+   {
+      //**Constructor******************************************************************************
+      /*!\brief Constructor for the Launcher class.
+      */
+      explicit inline Launcher()
+         : mutex_    ()                      // Synchronization mutex
+         , completed_()                      // Wait condition for the completion of all launches
+         , pending_  ( 0UL )                 // Number of launched functions not yet completed
+         , nested_   ( 0UL )                 // Number of nested launches not yet completed
+         , pool_     ( threadpool_.size() )  // The threads executing the launched functions
+      {}
+      //*******************************************************************************************
+
+      //**Destructor*******************************************************************************
+      /*!\brief Destructor for the Launcher class.
+      //
+      // The destructor blocks until all launched functions, including all nested launches, have
+      // been completed. Afterwards the destructor of the pool joins all threads.
+      */
+      inline ~Launcher() {
+         LT lock( mutex_ );
+         while( pending_ > 0UL ) {
+            completed_.wait( lock );
+         }
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      MT mutex_;                      //!< Synchronization mutex.
+      CT completed_;                  //!< Wait condition for the completion of all launches.
+      size_t pending_;                //!< Number of launched functions not yet completed.
+      size_t nested_;                 //!< Number of nested launches not yet completed.
+      ThreadPool<TT,MT,LT,CT> pool_;  //!< The threads executing the launched functions.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
-   static inline size_t initPool();
+   static inline size_t              initPool();
+   static inline std::vector<size_t> initAffinity();
+   static inline Launcher&           launcher();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
+   static thread_local threadpool::TaskGroup group_;  //!< The task group of the calling thread.
+   static thread_local bool launching_;               //!< Flag for launcher pool threads.
+
    static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
                                                 /*!< It is initialized with the number of threads
                                                      specified via the environment variable
                                                      \c BLAZE_NUM_THREADS. However, it can be
                                                      explicitly resized to arbitrary numbers of
-                                                     threads. */
+                                                     threads. The threads are pinned according
+                                                     to the environment variable
+                                                     \c BLAZE_THREAD_AFFINITY. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +251,13 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+thread_local threadpool::TaskGroup ThreadBackend<TT,MT,LT,CT>::group_;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local bool ThreadBackend<TT,MT,LT,CT>::launching_ = false;
+
+template< typename TT, typename MT, typename LT, typename CT >
+ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool(), smpSpinCount, initAffinity() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -214,6 +288,38 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of tasks for a single parallel operation.
+//
+// \return The number of tasks for a single parallel operation.
+//
+// This function returns the number of tasks a parallel (compound) assignment should be split
+// into. Since idle threads steal tasks from the work queues of busy threads, splitting the
+// operation into several tasks per thread (see the \c BLAZE_SMP_TASKS_PER_THREAD configuration
+// switch) balances the work in case the individual tasks differ in cost. In case a thread limit
+// smaller than the size of the thread pool is active (see the \a BLAZE_THREAD_LIMIT macro), the
+// operation is split into exactly one task per permitted thread, such that no more than the
+// permitted number of threads can work on the operation at the same time.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t ThreadBackend<TT,MT,LT,CT>::tasks()
+{
+   const size_t threads( threadpool_.size() );
+   const size_t limit  ( getThreadLimit() );
+
+   if( limit < threads )
+      return limit;
+
+   return ( threads > 1UL )?( threads * smpTasksPerThread ):( 1UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Changes the total number of threads managed by the thread backend system.
@@ -244,11 +350,35 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Waiting for all scheduled tasks to be completed.
+/*!\brief Pins the threads managed by the thread backend system to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to (empty: no pinning).
+// \return void
+//
+// This function pins the \f$ i \f$-th thread of the thread backend system to the CPU
+// \a cpus[i % cpus.size()]. In case the given list of CPUs is empty, the threads are released
+// again and may run on any CPU.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void ThreadBackend<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   threadpool_.setAffinity( cpus );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks scheduled by the calling thread have been completed.
+// Tasks scheduled by other threads are not waited for.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -256,7 +386,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   threadpool_.wait( group_ );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -279,7 +409,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 // \param op The (compound) assignment operation.
 // \return void
 //
-// This function schedules a (compound) assignment of the two given operands for execution.
+// This function schedules a (compound) assignment of the two given operands for execution as
+// part of the task group of the calling thread.
 */
 template< typename TT      // Type of the encapsulated thread
         , typename MT      // Type of the synchronization mutex
@@ -291,7 +422,103 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+   schedule( Assigner<Target,Source,OP>( target, source, op ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The function/functor to be executed.
+// \return void
+//
+// This function schedules the given function or functor without arguments for execution as
+// part of the task group of the calling thread. The function is executed inside a parallel
+// section, i.e. all operations of the function are executed by the executing thread of the
+// pool.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable func )
+{
+   threadpool_.schedule( group_, [func]() mutable {
+      BLAZE_PARALLEL_SECTION {
+         func();
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Launching the given function/functor as an independent caller of the thread pool.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function launches the given function or functor without arguments for asynchronous
+// execution. In contrast to the schedule() functions, the function is not executed by a
+// thread of the thread pool, but by a thread of a separate launcher pool, which acts as an
+// independent caller of the thread pool. Therefore all operations of the function are again
+// executed in parallel by the threads of the thread pool, and the launching thread can continue
+// its work without waiting. The launcher pool is adapted to the current size of the thread
+// pool, i.e. it follows any call to setNumThreads(). In case the function is launched from
+// within a launched function or from within a parallel section (i.e. by a thread that might
+// itself be waited for), the launcher pool is grown by one thread for the duration of the
+// function. This prevents a deadlock in case all threads of the launcher pool wait for the
+// completion of nested launches. The function cannot be executed immediately by the calling
+// thread, since the calling thread is usually inside a parallel section. All launched functions
+// are completed before the launcher pool is destroyed at the end of the program. The function
+// must handle all of its exceptions.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::launch( Callable func )
+{
+   Launcher& launcher( ThreadBackend::launcher() );
+   const bool nested( launching_ || isParallelSectionActive() );
+
+   {
+      LT lock( launcher.mutex_ );
+
+      ++launcher.pending_;
+      if( nested ) ++launcher.nested_;
+
+      const size_t threads( threadpool_.size() + launcher.nested_ );
+
+      if( launcher.pool_.size() != threads ) {
+         launcher.pool_.resize( threads );
+      }
+   }
+
+   launcher.pool_.schedule( [&launcher,func,nested]() mutable
+   {
+      launching_ = true;
+      func();
+
+      LT lock( launcher.mutex_ );
+
+      // Removing the additional thread of a nested launch
+      if( nested ) {
+         --launcher.nested_;
+         launcher.pool_.resize( threadpool_.size() + launcher.nested_ );
+      }
+
+      if( --launcher.pending_ == 0UL ) {
+         launcher.completed_.notify_all();
+      }
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -338,6 +565,80 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the initial CPUs the threads of the thread pool are pinned to.
+//
+// \return The list of CPUs the threads are pinned to (empty: no pinning).
+//
+// This function determines the initial thread affinity based on the \c BLAZE_THREAD_AFFINITY
+// environment variable, which accepts the values \c "none", \c "compact", \c "scatter" or an
+// explicit list of CPUs as for instance \c "0,2,4-7" (see threadpool::parseAffinity()). In case
+// the environment variable is not defined, the function returns an empty list, i.e. the threads
+// are not pinned.
+//
+// \warning This function swallows all errors! Since it is called during the dynamic
+// initialization of the program, an invalid value of the environment variable is silently
+// ignored and the threads are not pinned either (analogous to the handling of invalid
+// thresholds, see initThresholds()). An invalid affinity can be detected explicitly via the
+// setThreadAffinity() function, which throws a \a std::invalid_argument exception.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline std::vector<size_t> ThreadBackend<TT,MT,LT,CT>::initAffinity()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_AFFINITY" );
+
+   if( env == nullptr )
+      return std::vector<size_t>();
+
+   try {
+      return threadpool::parseAffinity( env );
+   }
+   catch( ... ) {
+      return std::vector<size_t>();
+   }
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the launcher pool for asynchronously launched functions.
+//
+// \return Reference to the launcher pool.
+//
+// This function returns the pool of threads executing the functions launched via the launch()
+// function. The launcher pool is created on first use with the current number of threads of
+// the thread pool and is resized by the launch() function whenever the size of the thread pool
+// or the number of running nested launches has changed. Since its threads mainly wait for the
+// completion of the tasks they schedule to the thread pool, they neither spin nor are pinned to
+// any CPU. Since the launcher pool is created after the thread pool, it is destroyed before the
+// thread pool, i.e. all launched functions are completed while the thread pool is still alive.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename ThreadBackend<TT,MT,LT,CT>::Launcher& ThreadBackend<TT,MT,LT,CT>::launcher()
+{
+   static Launcher instance;
+   return instance;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,1132 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedIndexStorage.h
+//  \brief Header file for the index storage of the compressed sparse matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDINDEXSTORAGE_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDINDEXSTORAGE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Row/column offsets and index array of a compressed sparse matrix.
+// \ingroup sparse_matrix
+//
+// The CompressedIndexStorage class template manages the part of the compressed storage format
+// that does not depend on the element type: The number of rows and columns, the capacity, the
+// offsets of the first and one past the last non-zero element of each row (\a SO = rowMajor)
+// or column (\a SO = columnMajor), and the array of the column/row indices of type \a IT. It
+// is the common base of the CompressedSoAMatrix and the PatternMatrix class templates, which
+// differ only in the number of element arrays kept in parallel to the index array. Therefore
+// all functions that move elements within the storage accept an arbitrary number of parallel
+// arrays, which are reallocated, shifted, and compacted together with the index array.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+class CompressedIndexStorage
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t    rows() const noexcept;
+   inline size_t    columns() const noexcept;
+   inline size_t    capacity() const noexcept;
+   inline size_t    capacity( size_t i ) const noexcept;
+   inline size_t    nonZeros() const;
+   inline size_t    nonZeros( size_t i ) const;
+   inline const IT* indices( size_t i ) const noexcept;
+   inline void      reset();
+   inline void      reset( size_t i );
+   inline void      clear();
+          void      resize( size_t m, size_t n, bool preserve=true );
+   inline void      finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+ protected:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedIndexStorage();
+   explicit inline CompressedIndexStorage( size_t m, size_t n );
+   explicit inline CompressedIndexStorage( size_t m, size_t n, size_t nonzeros );
+   explicit        CompressedIndexStorage( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+
+   inline CompressedIndexStorage( const CompressedIndexStorage& s );
+   inline CompressedIndexStorage( CompressedIndexStorage&& s ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedIndexStorage();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   CompressedIndexStorage& operator=( const CompressedIndexStorage& ) = delete;
+   inline CompressedIndexStorage& operator=( CompressedIndexStorage&& rhs ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void   swap( CompressedIndexStorage& s ) noexcept;
+   inline size_t majorSize() const noexcept;
+   inline size_t minorSize() const noexcept;
+   inline size_t extendCapacity() const noexcept;
+   inline size_t lowerOffset( size_t k, size_t l ) const noexcept;
+   inline size_t upperOffset( size_t k, size_t l ) const noexcept;
+
+   static inline size_t checkIndexRange( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Storage functions***************************************************************************
+   /*!\name Storage functions */
+   //@{
+   template< typename... Ts >
+   void reserveElements( size_t nonzeros, Ts*&... values );
+
+   template< typename... Ts >
+   void reserveElements( size_t i, size_t nonzeros, Ts*&... values );
+
+   template< typename... Ts >
+   inline void trimElements( size_t i, Ts*&... values );
+
+   template< typename... Ts >
+   void insertElement( size_t pos, size_t k, size_t l, Ts*&... values );
+
+   template< typename... Ts >
+   inline void eraseElements( size_t i, size_t first, size_t last, Ts*&... values );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the matrix.
+   size_t  n_;         //!< The current number of columns of the matrix.
+   size_t  capacity_;  //!< The current capacity of the index and element arrays.
+   IT*     indices_;   //!< The column/row indices of all non-zero elements.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row/column.
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename F >
+   static inline void forEach( const F& f ) noexcept;
+
+   template< typename F, typename T, typename... Ts >
+   static inline void forEach( const F& f, T*& array, Ts*&... arrays );
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE( IT );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for CompressedIndexStorage.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::CompressedIndexStorage()
+   : m_       ( 0UL )              // The current number of rows of the matrix
+   , n_       ( 0UL )              // The current number of columns of the matrix
+   , capacity_( 0UL )              // The current capacity of the index and element arrays
+   , indices_ ( nullptr )          // The column/row indices of all non-zero elements
+   , begin_   ( new size_t[2UL] )  // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+1UL )       // Offsets one past the last non-zero element of each row/column
+{
+   begin_[0UL] = end_[0UL] = 0UL;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the storage of a \f$ m \times n \f$ matrix without capacity.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::CompressedIndexStorage( size_t m, size_t n )
+   : m_       ( SO ? checkIndexRange( m ) : m )       // The current number of rows of the matrix
+   , n_       ( SO ? n : checkIndexRange( n ) )       // The current number of columns of the matrix
+   , capacity_( 0UL )                                 // The current capacity of the index and element arrays
+   , indices_ ( nullptr )                             // The column/row indices of all non-zero elements
+   , begin_   ( new size_t[2UL*( SO ? n : m )+2UL] )  // Offsets of the first non-zero element of each row/column
+   , end_     ( begin_+( SO ? n : m )+1UL )           // Offsets one past the last non-zero element of each row/column
+{
+   std::fill( begin_, end_+majorSize()+1UL, 0UL );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the storage of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// Only the index array is allocated. The element arrays of the derived class have to be
+// allocated with the same capacity.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::CompressedIndexStorage( size_t m, size_t n, size_t nonzeros )
+   : CompressedIndexStorage( m, n )
+{
+   indices_  = allocate<IT>( nonzeros );
+   capacity_ = nonzeros;
+
+   end_[majorSize()] = nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for the storage of a \f$ m \times n \f$ matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// Only the index array is allocated. The element arrays of the derived class have to be
+// allocated with the resulting capacity.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedIndexStorage<SO,IT>::CompressedIndexStorage( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : CompressedIndexStorage( m, n )
+{
+   const size_t M( majorSize() );
+
+   BLAZE_USER_ASSERT( nonzeros.size() == M, "Size of capacity vector and matrix dimension don't match" );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      end_[k] = begin_[k];
+      begin_[k+1UL] = begin_[k] + nonzeros[k];
+   }
+
+   capacity_ = begin_[M];
+   indices_  = allocate<IT>( capacity_ );
+
+   end_[M] = capacity_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for CompressedIndexStorage.
+//
+// \param s The storage to be copied.
+//
+// The copy has no free capacity. The element arrays of the derived class have to be copied
+// according to the offsets of both storages.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::CompressedIndexStorage( const CompressedIndexStorage& s )
+   : CompressedIndexStorage( s.m_, s.n_, s.nonZeros() )
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      std::copy( s.indices_+s.begin_[k], s.indices_+s.end_[k], indices_+begin_[k] );
+      end_[k] = begin_[k+1UL] = begin_[k] + ( s.end_[k] - s.begin_[k] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for CompressedIndexStorage.
+//
+// \param s The storage to be moved into this instance.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::CompressedIndexStorage( CompressedIndexStorage&& s ) noexcept
+   : m_       ( s.m_ )         // The current number of rows of the matrix
+   , n_       ( s.n_ )         // The current number of columns of the matrix
+   , capacity_( s.capacity_ )  // The current capacity of the index and element arrays
+   , indices_ ( s.indices_ )   // The column/row indices of all non-zero elements
+   , begin_   ( s.begin_ )     // Offsets of the first non-zero element of each row/column
+   , end_     ( s.end_ )       // Offsets one past the last non-zero element of each row/column
+{
+   s.m_        = 0UL;
+   s.n_        = 0UL;
+   s.capacity_ = 0UL;
+   s.indices_  = nullptr;
+   s.begin_    = nullptr;
+   s.end_      = nullptr;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The destructor for CompressedIndexStorage.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>::~CompressedIndexStorage()
+{
+   deallocate( indices_ );
+   delete[] begin_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for CompressedIndexStorage.
+//
+// \param rhs The storage to be moved into this instance.
+// \return Reference to the assigned storage.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedIndexStorage<SO,IT>&
+   CompressedIndexStorage<SO,IT>::operator=( CompressedIndexStorage&& rhs ) noexcept
+{
+   deallocate( indices_ );
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   indices_  = rhs.indices_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.indices_  = nullptr;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the matrix.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::capacity() const noexcept
+{
+   return capacity_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of non-zero elements in the matrix.
+//
+// \return The number of non-zero elements in the matrix.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::nonZeros() const
+{
+   const size_t M( majorSize() );
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<M; ++k )
+      nonzeros += nonZeros( k );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the column/row indices of the specified row/column.
+//
+// \param i The row/column index.
+// \return Pointer to the index of the first non-zero element of row/column \a i.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline const IT* CompressedIndexStorage<SO,IT>::indices( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   return indices_+begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all non-zero elements from the matrix.
+//
+// \return void
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedIndexStorage<SO,IT>::reset()
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k )
+      end_[k] = begin_[k];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all non-zero elements from the specified row/column.
+//
+// \param i The index of the row/column.
+// \return void
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedIndexStorage<SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the matrix is 0.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedIndexStorage<SO,IT>::clear()
+{
+   resize( 0UL, 0UL, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the matrix.
+//
+// \param m The new number of rows of the matrix.
+// \param n The new number of columns of the matrix.
+// \param preserve \a true if the old elements of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. Only the
+// row/column offsets are reallocated, the index and element arrays keep their capacity. New
+// elements are not stored, i.e. they are zero.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedIndexStorage<SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   if( m == m_ && n == n_ ) return;
+
+   checkIndexRange( SO ? m : n );
+
+   const size_t M   ( majorSize() );
+   const size_t newM( SO ? n : m );
+   const size_t newN( SO ? m : n );
+   const size_t kend( min( M, newM ) );
+
+   size_t* newBegin( new size_t[2UL*newM+2UL] );
+   size_t* newEnd  ( newBegin+newM+1UL );
+
+   newBegin[0UL] = 0UL;
+
+   for( size_t k=0UL; k<kend; ++k ) {
+      newEnd  [k]     = ( preserve ? lowerOffset( k, newN ) : begin_[k] );
+      newBegin[k+1UL] = begin_[k+1UL];
+   }
+   for( size_t k=kend; k<newM; ++k ) {
+      newBegin[k+1UL] = newEnd[k] = newBegin[k];
+   }
+
+   newEnd[newM] = capacity_;
+
+   swap( newBegin, begin_ );
+   delete[] newBegin;
+   end_ = newEnd;
+   m_ = m;
+   n_ = n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called
+// to finalize row/column \a i and prepare the next row/column for insertion process via
+// append().
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedIndexStorage<SO,IT>::finalize( size_t i )
+{
+   const size_t M( majorSize() );
+
+   BLAZE_USER_ASSERT( i < M, "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != M-1UL )
+      end_[i+1UL] = end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two storages.
+//
+// \param s The storage to be swapped.
+// \return void
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedIndexStorage<SO,IT>::swap( CompressedIndexStorage& s ) noexcept
+{
+   using std::swap;
+
+   swap( m_, s.m_ );
+   swap( n_, s.n_ );
+   swap( capacity_, s.capacity_ );
+   swap( indices_ , s.indices_  );
+   swap( begin_   , s.begin_    );
+   swap( end_     , s.end_      );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of rows (row-major) or columns (column-major) of the matrix.
+//
+// \return The number of rows (row-major) or columns (column-major).
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::majorSize() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of columns (row-major) or rows (column-major) of the matrix.
+//
+// \return The number of columns (row-major) or rows (column-major).
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::minorSize() const noexcept
+{
+   return ( SO ? m_ : n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new matrix capacity.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = blaze::max( nonzeros, 7UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset of the first element of row/column \a k with index not less than \a l.
+//
+// \param k The row/column index.
+// \param l The column/row index.
+// \return The offset of the first element with index not less than \a l.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::lowerOffset( size_t k, size_t l ) const noexcept
+{
+   return std::lower_bound( indices_+begin_[k], indices_+end_[k], l,
+                            []( IT index, size_t value ) { return index < value; } ) - indices_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the offset of the first element of row/column \a k with index greater than \a l.
+//
+// \param k The row/column index.
+// \param l The column/row index.
+// \return The offset of the first element with index greater than \a l.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::upperOffset( size_t k, size_t l ) const noexcept
+{
+   return std::upper_bound( indices_+begin_[k], indices_+end_[k], l,
+                            []( size_t value, IT index ) { return value < index; } ) - indices_;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checking whether the given number of columns/rows can be represented by the index type.
+//
+// \param n The number of columns (row-major) or rows (column-major) of the matrix.
+// \return The given number of columns/rows.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// This function checks whether all column/row indices of a matrix with \a n columns/rows can
+// be stored in the index type \a IT of the matrix. In case they cannot, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedIndexStorage<SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( SO ? "Number of rows exceeds the index type"
+                                       : "Number of columns exceeds the index type" );
+   }
+
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Terminates the recursive application of a function to the element arrays.
+//
+// \return void
+*/
+template< bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename F >   // Type of the function
+inline void CompressedIndexStorage<SO,IT>::forEach( const F& ) noexcept
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given function to each of the given arrays.
+//
+// \param f The function to be applied.
+// \param array The first array.
+// \param arrays The remaining arrays.
+// \return void
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename F        // Type of the function
+        , typename T        // Element type of the first array
+        , typename... Ts >  // Element types of the remaining arrays
+inline void CompressedIndexStorage<SO,IT>::forEach( const F& f, T*& array, Ts*&... arrays )
+{
+   f( array );
+   forEach( f, arrays... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STORAGE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reserving the specified number of matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \param values The element arrays kept in parallel to the index array.
+// \return void
+//
+// This function reallocates the index array and all given element arrays with a capacity of
+// \a nonzeros elements. The row/column offsets are preserved.
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename... Ts >  // Element types of the parallel arrays
+void CompressedIndexStorage<SO,IT>::reserveElements( size_t nonzeros, Ts*&... values )
+{
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   const size_t M( majorSize() );
+
+   forEach( [this,nonzeros,M]( auto*& array )
+   {
+      using T = RemoveReference_t< decltype( *array ) >;
+
+      T* newArray( allocate<T>( nonzeros ) );
+
+      for( size_t k=0UL; k<M; ++k ) {
+         BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+         std::move( array+begin_[k], array+end_[k], newArray+begin_[k] );
+      }
+
+      std::swap( array, newArray );
+      deallocate( newArray );
+   }, indices_, values... );
+
+   capacity_ = nonzeros;
+   end_[M]   = nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of a specific row/column.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \param values The element arrays kept in parallel to the index array.
+// \return void
+//
+// This function increases the capacity of row/column \a i to at least \a nonzeros elements
+// by shifting all subsequent rows/columns of the index array and all given element arrays.
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename... Ts >  // Element types of the parallel arrays
+void CompressedIndexStorage<SO,IT>::reserveElements( size_t i, size_t nonzeros, Ts*&... values )
+{
+   const size_t M( majorSize() );
+
+   BLAZE_USER_ASSERT( i < M, "Invalid row/column access index" );
+
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[M] - begin_[M] < additional )
+   {
+      const size_t newCapacity( begin_[M] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      forEach( [this,i,M,additional,newCapacity]( auto*& array )
+      {
+         using T = RemoveReference_t< decltype( *array ) >;
+
+         T* newArray( allocate<T>( newCapacity ) );
+
+         for( size_t k=0UL; k<M; ++k ) {
+            const size_t offset( k > i ? additional : 0UL );
+            std::move( array+begin_[k], array+end_[k], newArray+begin_[k]+offset );
+         }
+
+         std::swap( array, newArray );
+         deallocate( newArray );
+      }, indices_, values... );
+
+      capacity_ = newCapacity;
+      end_[M]   = newCapacity;
+   }
+   else
+   {
+      forEach( [this,i,M,additional]( auto*& array )
+      {
+         for( size_t k=M-1UL; k>i; --k ) {
+            std::move_backward( array+begin_[k], array+end_[k], array+end_[k]+additional );
+         }
+      }, indices_, values... );
+   }
+
+   for( size_t k=i+1UL; k<M; ++k ) {
+      begin_[k] += additional;
+      end_  [k] += additional;
+   }
+
+   begin_[M] += additional;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Removing all excessive capacity of a specific row/column.
+//
+// \param i The index of the row/column to be trimmed \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param values The element arrays kept in parallel to the index array.
+// \return void
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename... Ts >  // Element types of the parallel arrays
+inline void CompressedIndexStorage<SO,IT>::trimElements( size_t i, Ts*&... values )
+{
+   const size_t M( majorSize() );
+
+   BLAZE_USER_ASSERT( i < M, "Invalid row/column access index" );
+
+   if( i < ( M - 1UL ) ) {
+      forEach( [this,i]( auto*& array ) {
+         std::move( array+begin_[i+1UL], array+end_[i+1UL], array+end_[i] );
+      }, indices_, values... );
+      end_[i+1UL] = end_[i] + nonZeros( i+1UL );
+   }
+
+   begin_[i+1UL] = end_[i];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Inserting an element into the storage.
+//
+// \param pos The offset of the new element.
+// \param k The row/column index of the new element.
+// \param l The column/row index of the new element.
+// \param values The element arrays kept in parallel to the index array.
+// \return void
+//
+// This function opens a gap at offset \a pos of row/column \a k and stores the index \a l at
+// the resulting position, which is still \a pos after the function returns. Depending on the
+// free capacity, the gap is created within the row/column, by shifting all subsequent
+// rows/columns, or by reallocating the index array and all given element arrays. The element
+// at position \a pos of the given element arrays is left for the derived class to assign.
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename... Ts >  // Element types of the parallel arrays
+void CompressedIndexStorage<SO,IT>::insertElement( size_t pos, size_t k, size_t l, Ts*&... values )
+{
+   const size_t M( majorSize() );
+
+   if( begin_[k+1UL] != end_[k] ) {
+      forEach( [this,pos,k]( auto*& array ) {
+         std::move_backward( array+pos, array+end_[k], array+end_[k]+1UL );
+      }, indices_, values... );
+      ++end_[k];
+   }
+   else if( end_[M] != begin_[M] ) {
+      forEach( [this,pos,M]( auto*& array ) {
+         std::move_backward( array+pos, array+end_[M-1UL], array+end_[M-1UL]+1UL );
+      }, indices_, values... );
+
+      for( size_t r=k+1UL; r<M+1UL; ++r ) {
+         ++begin_[r];
+         ++end_[r-1UL];
+      }
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      forEach( [this,pos,M,newCapacity]( auto*& array )
+      {
+         using T = RemoveReference_t< decltype( *array ) >;
+
+         T* newArray( allocate<T>( newCapacity ) );
+
+         std::move( array, array+pos, newArray );
+         std::move( array+pos, array+end_[M-1UL], newArray+pos+1UL );
+
+         std::swap( array, newArray );
+         deallocate( newArray );
+      }, indices_, values... );
+
+      for( size_t r=k+1UL; r<M+1UL; ++r ) {
+         ++begin_[r];
+         ++end_[r-1UL];
+      }
+
+      capacity_ = newCapacity;
+      end_[M]   = newCapacity;
+   }
+
+   indices_[pos] = l;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Erasing a range of elements from a specific row/column.
+//
+// \param i The row/column index of the elements to be erased.
+// \param first The offset of the first element to be erased.
+// \param last The offset one past the last element to be erased.
+// \param values The element arrays kept in parallel to the index array.
+// \return void
+*/
+template< bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename... Ts >  // Element types of the parallel arrays
+inline void CompressedIndexStorage<SO,IT>::eraseElements( size_t i, size_t first, size_t last,
+                                                          Ts*&... values )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( begin_[i] <= first && first <= last && last <= end_[i], "Invalid offset range" );
+
+   if( first != last ) {
+      forEach( [this,i,first,last]( auto*& array ) {
+         std::move( array+last, array+end_[i], array+first );
+      }, indices_, values... );
+      end_[i] -= ( last - first );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
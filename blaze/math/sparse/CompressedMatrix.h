@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <vector>
 #include <blaze/math/Aliases.h>
@@ -49,10 +50,12 @@
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/Forward.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/InitializerList.h>
 #include <blaze/math/RelaxationFlag.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
 #include <blaze/math/sparse/MatrixAccessProxy.h>
 #include <blaze/math/sparse/ValueIndexPair.h>
 #include <blaze/math/traits/AddTrait.h>
@@ -80,6 +83,7 @@
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/LowType.h>
+#include <blaze/math/typetraits/StorageIndex.h>
 #include <blaze/math/typetraits/StorageOrder.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
@@ -95,6 +99,7 @@
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsNumeric.h>
@@ -118,11 +123,11 @@ namespace blaze {
 //
 // The CompressedMatrix class template is the representation of an arbitrary sized sparse
 // matrix with \f$ M \cdot N \f$ dynamically allocated elements of arbitrary type. The type
-// of the elements and the storage order of the matrix can be specified via the two template
-// parameters:
+// of the elements, the storage order of the matrix, and the type of the stored indices can be
+// specified via the three template parameters:
 
    \code
-   template< typename Type, bool SO >
+   template< typename Type, bool SO, typename IT >
    class CompressedMatrix;
    \endcode
 
@@ -130,6 +135,12 @@ namespace blaze {
 //          any non-cv-qualified, non-reference, non-pointer element type.
 //  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
 //          The default value is blaze::rowMajor.
+//  - IT  : specifies the unsigned integral type used to store the row/column indices of the
+//          non-zero elements. The default value is \c size_t. A smaller index type (as for
+//          instance \c uint32_t) reduces the memory footprint and bandwidth requirements of
+//          the matrix, but limits the number of rows/columns to the range of the index type.
+//          Any attempt to create or resize a matrix beyond this range results in a
+//          \a std::invalid_argument exception.
 //
 // Inserting/accessing elements in a compressed matrix can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -220,14 +231,15 @@ namespace blaze {
    \endcode
 */
 template< typename Type                    // Data type of the matrix
-        , bool SO = defaultStorageOrder >  // Storage order
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
 class CompressedMatrix
-   : public SparseMatrix< CompressedMatrix<Type,SO>, SO >
+   : public SparseMatrix< CompressedMatrix<Type,SO,IT>, SO >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed matrix element.
+   using IteratorBase = ElementBase*;             //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -311,18 +323,18 @@ class CompressedMatrix
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,SO>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,SO>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                        //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,!SO>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,!SO>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                        //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                 //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;     //!< Reference to a compressed matrix value.
-   using ConstReference = const Type&;                 //!< Reference to a constant compressed matrix value.
-   using Iterator       = Element*;                    //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;              //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,SO,IT>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;          //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                           //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                    //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;        //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                    //!< Reference to a constant compressed matrix value.
+   using Iterator       = Element*;                       //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                 //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -330,7 +342,7 @@ class CompressedMatrix
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<NewType,SO,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -340,7 +352,7 @@ class CompressedMatrix
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,SO>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,SO,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -507,6 +519,8 @@ class CompressedMatrix
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   static inline size_t checkIndexRange( size_t n );
+
    inline size_t extendCapacity() const noexcept;
           void   reserveElements( size_t nonzeros );
 
@@ -556,8 +570,8 @@ class CompressedMatrix
 //
 //=================================================================================================
 
-template< typename Type, bool SO >
-const Type CompressedMatrix<Type,SO>::zero_{};
+template< typename Type, bool SO, typename IT >
+const Type CompressedMatrix<Type,SO,IT>::zero_{};
 
 
 
@@ -572,8 +586,9 @@ const Type CompressedMatrix<Type,SO>::zero_{};
 /*!\brief The default constructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix()
    : m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
@@ -592,8 +607,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix()
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    for( size_t i=1UL; i<2UL*m_+2UL; ++i )
@@ -612,8 +628,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n )
 // The matrix is initialized to the zero matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -636,8 +653,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, size_t n
 // \a m elements, in case of a column-major matrix at least \a n elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    BLAZE_USER_ASSERT( nonzeros.size() == m, "Size of capacity vector and number of rows don't match" );
@@ -675,8 +693,9 @@ CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, const std::vect
 // be default values.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    size_t i( 0UL );
@@ -704,8 +723,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( initializer_list< initialize
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
    const size_t nonzeros( sm.nonZeros() );
@@ -726,8 +746,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const CompressedMatrix& sm )
 // \param sm The compressed matrix to be moved into this instance.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
    : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
    , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
@@ -749,10 +770,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( CompressedMatrix&& sm ) noex
 // \param dm Dense matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign dense matrix
         , bool SO2 >     // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
    using blaze::assign;
@@ -768,10 +790,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& d
 // \param sm Sparse matrix to be copied.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the foreign compressed matrix
         , bool SO2 >     // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
    using blaze::assign;
@@ -788,10 +811,11 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>&
 // \param n The number of columns of the matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitialized )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::CompressedMatrix( size_t m, size_t n, Uninitialized )
    : m_       ( m )                     // The current number of rows of the compressed matrix
-   , n_       ( n )                     // The current number of columns of the compressed matrix
+   , n_       ( checkIndexRange( n ) )  // The current number of columns of the compressed matrix
    , capacity_( m )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*m+2UL] )  // Pointers to the first non-zero element of each row
    , end_  ( begin_+(m+1UL) )           // Pointers one past the last non-zero element of each row
@@ -813,8 +837,9 @@ inline CompressedMatrix<Type,SO>::CompressedMatrix( size_t m, size_t n, Uninitia
 /*!\brief The destructor for CompressedMatrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>::~CompressedMatrix()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -846,9 +871,10 @@ inline CompressedMatrix<Type,SO>::~CompressedMatrix()
 // check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -869,9 +895,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // the at() function is guaranteed to perform a check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::operator()( size_t i, size_t j ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -900,9 +927,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // always performs a check of the given access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Reference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Reference
+   CompressedMatrix<Type,SO,IT>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -927,9 +955,10 @@ inline typename CompressedMatrix<Type,SO>::Reference
 // access indices.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstReference
-   CompressedMatrix<Type,SO>::at( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstReference
+   CompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -954,9 +983,10 @@ inline typename CompressedMatrix<Type,SO>::ConstReference
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -976,9 +1006,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::begin( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -998,9 +1029,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // returns an iterator to the first non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cbegin( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return begin_[i];
@@ -1020,9 +1052,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::end( size_t i ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1042,9 +1075,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::end( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::end( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1064,9 +1098,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the function returns an iterator just past the last non-zero element of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::cend( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid compressed matrix row access index" );
    return end_[i];
@@ -1104,9 +1139,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // be default values.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( initializer_list< initializer_list<Type> > list )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -1144,9 +1180,10 @@ inline CompressedMatrix<Type,SO>&
 // as a copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const CompressedMatrix& rhs )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const CompressedMatrix& rhs )
 {
    using std::swap;
 
@@ -1197,9 +1234,10 @@ inline CompressedMatrix<Type,SO>&
 // \return Reference to the assigned compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( CompressedMatrix&& rhs ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -1233,11 +1271,12 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
@@ -1265,11 +1304,12 @@ inline CompressedMatrix<Type,SO>&
 // copy of this matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
    using blaze::assign;
 
@@ -1301,11 +1341,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::addAssign;
 
@@ -1330,10 +1371,11 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
 {
    using blaze::subAssign;
 
@@ -1359,11 +1401,12 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const M
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
 {
    using blaze::schurAssign;
 
@@ -1397,11 +1440,12 @@ inline CompressedMatrix<Type,SO>&
 // is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side sparse matrix
         , bool SO2 >     // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,SO>&
-   CompressedMatrix<Type,SO>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+inline CompressedMatrix<Type,SO,IT>&
+   CompressedMatrix<Type,SO,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -1429,8 +1473,9 @@ inline CompressedMatrix<Type,SO>&
 // \return The number of rows of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::rows() const noexcept
 {
    return m_;
 }
@@ -1443,8 +1488,9 @@ inline size_t CompressedMatrix<Type,SO>::rows() const noexcept
 // \return The number of columns of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::columns() const noexcept
 {
    return n_;
 }
@@ -1457,8 +1503,9 @@ inline size_t CompressedMatrix<Type,SO>::columns() const noexcept
 // \return The capacity of the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[m_] - begin_[0UL];
@@ -1479,8 +1526,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity() const noexcept
 // of column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return begin_[i+1UL] - begin_[i];
@@ -1494,8 +1542,9 @@ inline size_t CompressedMatrix<Type,SO>::capacity( size_t i ) const noexcept
 // \return The number of non-zero elements in the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros() const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -1519,8 +1568,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros() const
 // the number of non-zero elements in column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return end_[i] - begin_[i];
@@ -1534,8 +1584,9 @@ inline size_t CompressedMatrix<Type,SO>::nonZeros( size_t i ) const
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset()
 {
    for( size_t i=0UL; i<m_; ++i )
       end_[i] = begin_[i];
@@ -1555,8 +1606,9 @@ inline void CompressedMatrix<Type,SO>::reset()
 // Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reset( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reset( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    end_[i] = begin_[i];
@@ -1572,8 +1624,9 @@ inline void CompressedMatrix<Type,SO>::reset( size_t i )
 // After the clear() function, the size of the compressed matrix is 0.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::clear()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[m_];
@@ -1599,16 +1652,18 @@ inline void CompressedMatrix<Type,SO>::clear()
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
-
    if( m == m_ && n == n_ ) return;
 
+   checkIndexRange( n );
+
    if( begin_ == nullptr )
    {
       begin_ = new Iterator[2UL*m+2UL];
@@ -1696,8 +1751,9 @@ void CompressedMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
 // are preserved.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -1720,8 +1776,9 @@ inline void CompressedMatrix<Type,SO>::reserve( size_t nonzeros )
 // \a i and the index has to be in the range \f$[0..N-1]\f$.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
 {
    using std::swap;
 
@@ -1792,8 +1849,9 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 // remove the overall capacity but only reduces the capacity per row/column.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim()
 {
    for( size_t i=0UL; i<m_; ++i )
       trim( i );
@@ -1813,8 +1871,9 @@ inline void CompressedMatrix<Type,SO>::trim()
 // subsequent row/column.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::trim( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::trim( size_t i )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
 
@@ -1835,8 +1894,9 @@ inline void CompressedMatrix<Type,SO>::trim( size_t i )
 // and references to elements of this matrix are invalidated.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::shrinkToFit()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -1852,8 +1912,9 @@ inline void CompressedMatrix<Type,SO>::shrinkToFit()
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
@@ -1866,6 +1927,31 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking whether the given number of columns can be represented by the index type.
+//
+// \param n The number of columns of the matrix.
+// \return The given number of columns.
+// \exception std::invalid_argument Number of columns exceeds the index type.
+//
+// This function checks whether all column indices of a matrix with \a n columns can be stored
+// in the index type \a IT of the matrix. In case they cannot, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::checkIndexRange( size_t n )
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of columns exceeds the index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Calculating a new matrix capacity.
 //
@@ -1875,8 +1961,9 @@ inline void CompressedMatrix<Type,SO>::swap( CompressedMatrix& sm ) noexcept
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,SO,IT>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL   );
@@ -1895,8 +1982,9 @@ inline size_t CompressedMatrix<Type,SO>::extendCapacity() const noexcept
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+void CompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
 {
    using std::swap;
 
@@ -1933,9 +2021,10 @@ void CompressedMatrix<Type,SO>::reserveElements( size_t nonzeros )
 // derived elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::castDown( IteratorBase it ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -1951,9 +2040,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // to base elements.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::IteratorBase
-   CompressedMatrix<Type,SO>::castUp( Iterator it ) const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::IteratorBase
+   CompressedMatrix<Type,SO,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -1981,9 +2071,10 @@ inline typename CompressedMatrix<Type,SO>::IteratorBase
 // modified, else a new element with the given \a value is inserted.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::set( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2013,9 +2104,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2042,9 +2134,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    using std::swap;
 
@@ -2164,8 +2257,9 @@ typename CompressedMatrix<Type,SO>::Iterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& value, bool check )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -2196,8 +2290,9 @@ inline void CompressedMatrix<Type,SO>::append( size_t i, size_t j, const Type& v
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::finalize( size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::finalize( size_t i )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index" );
 
@@ -2226,8 +2321,9 @@ inline void CompressedMatrix<Type,SO>::finalize( size_t i )
 // This function erases an element from the compressed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -2251,9 +2347,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, size_t j )
 // to \a columnMajor the function erases an element from column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator pos )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    BLAZE_USER_ASSERT( pos >= begin_[i] && pos <= end_[i], "Invalid compressed matrix iterator" );
@@ -2279,9 +2376,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // flag is set to \a columnMajor the function erases a range of elements from column \a i.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2318,9 +2416,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
+        , bool SO          // Storage order
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
+inline void CompressedMatrix<Type,SO,IT>::erase( Pred predicate )
 {
    for( size_t i=0UL; i<m_; ++i ) {
       end_[i] = castDown( std::remove_if( castUp( begin_[i] ), castUp( end_[i] ),
@@ -2360,9 +2459,10 @@ inline void CompressedMatrix<Type,SO>::erase( Pred predicate )
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the matrix
-        , bool SO >        // Storage order
+        , bool SO          // Storage order
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+inline void CompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -2403,9 +2503,10 @@ inline void CompressedMatrix<Type,SO>::erase( size_t i, Iterator first, Iterator
 // function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -2428,9 +2529,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::find( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[i] && pos->index_ == j )
@@ -2456,9 +2558,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -2481,9 +2584,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::lowerBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::lower_bound( begin_[i], end_[i], j,
@@ -2511,9 +2615,10 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // the set() function or or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::Iterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::Iterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -2536,9 +2641,10 @@ inline typename CompressedMatrix<Type,SO>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline typename CompressedMatrix<Type,SO>::ConstIterator
-   CompressedMatrix<Type,SO>::upperBound( size_t i, size_t j ) const
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,SO,IT>::ConstIterator
+   CompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
    return std::upper_bound( begin_[i], end_[i], j,
@@ -2564,8 +2670,9 @@ inline typename CompressedMatrix<Type,SO>::ConstIterator
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -2580,8 +2687,9 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::transpose()
 // \return Reference to the transposed matrix.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::ctranspose()
 {
    CompressedMatrix tmp( ctrans( *this ) );
    swap( tmp );
@@ -2608,9 +2716,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::ctranspose()
    \endcode
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other& scalar )
+inline CompressedMatrix<Type,SO,IT>& CompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
 {
    for( size_t i=0UL; i<m_; ++i )
       for( auto element=begin_[i]; element!=end_[i]; ++element )
@@ -2640,9 +2749,10 @@ inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::scale( const Other&
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2660,9 +2770,10 @@ inline bool CompressedMatrix<Type,SO>::canAlias( const Other* alias ) const noex
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the matrix
-        , bool SO >         // Storage order
+        , bool SO           // Storage order
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2680,8 +2791,9 @@ inline bool CompressedMatrix<Type,SO>::isAliased( const Other* alias ) const noe
 // rows and/or columns of the matrix).
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -2700,10 +2812,11 @@ inline bool CompressedMatrix<Type,SO>::canSMPAssign() const noexcept
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2762,9 +2875,10 @@ inline void CompressedMatrix<Type,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2794,9 +2908,10 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT >  // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2805,23 +2920,51 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   // Counting the number of elements per row
-   std::vector<size_t> rowLengths( m_, 0UL );
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         ++rowLengths[element->index()];
-   }
+   if( m_ == 0UL || begin_[0] == nullptr )
+      return;
+
+   const size_t tasks( ( (~rhs).nonZeros() >= SMP_SMATTRANSPOSE_THRESHOLD && n_ > 1UL )
+                       ? min( getNumThreads(), n_ )
+                       : 1UL );
+   const size_t blockSize( n_ / tasks + ( n_ % tasks != 0UL ? 1UL : 0UL ) );
 
-   // Resizing the compressed matrix
+   // Counting the number of elements per row for each block of columns
+   std::vector<size_t> positions( tasks*m_, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      size_t* const count( positions.data() + t*m_ );
+      const size_t jend( min( (t+1UL)*blockSize, n_ ) );
+      for( size_t j=t*blockSize; j<jend; ++j ) {
+         for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
+            ++count[element->index()];
+      }
+   } );
+
+   // Resizing the compressed matrix and computing the first position of each block of columns
+   size_t offset( 0UL );
    for( size_t i=0UL; i<m_; ++i ) {
-      begin_[i+1UL] = end_[i+1UL] = begin_[i] + rowLengths[i];
+      for( size_t t=0UL; t<tasks; ++t ) {
+         const size_t tmp( positions[t*m_+i] );
+         positions[t*m_+i] = offset;
+         offset += tmp;
+      }
+      begin_[i+1UL] = end_[i] = begin_[0UL] + offset;
    }
 
-   // Appending the elements to the rows of the compressed matrix
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element )
-         append( element->index(), j, element->value() );
-   }
+   // Scattering the elements into the rows of the compressed matrix
+   smpFor( tasks, [&]( size_t t )
+   {
+      size_t* const position( positions.data() + t*m_ );
+      const size_t jend( min( (t+1UL)*blockSize, n_ ) );
+      for( size_t j=t*blockSize; j<jend; ++j ) {
+         for( auto element=(~rhs).begin(j); element!=(~rhs).end(j); ++element ) {
+            const Iterator pos( begin_[0UL] + position[element->index()]++ );
+            pos->value_ = element->value();
+            pos->index_ = j;
+         }
+      }
+   } );
 }
 //*************************************************************************************************
 
@@ -2838,10 +2981,11 @@ inline void CompressedMatrix<Type,SO>::assign( const SparseMatrix<MT,!SO>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2864,10 +3008,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2890,10 +3035,11 @@ inline void CompressedMatrix<Type,SO>::addAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2916,10 +3062,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const DenseMatrix<MT,SO2>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side compressed matrix
         , bool SO2 >     // Storage order of the right-hand compressed matrix
-inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2942,10 +3089,11 @@ inline void CompressedMatrix<Type,SO>::subAssign( const SparseMatrix<MT,SO2>& rh
 // assignment operator.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
+        , bool SO        // Storage order
+        , typename IT >  // Index type
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+inline void CompressedMatrix<Type,SO,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -2981,14 +3129,15 @@ inline void CompressedMatrix<Type,SO>::schurAssign( const DenseMatrix<MT,SO2>& r
 // This specialization of CompressedMatrix adapts the class template to the requirements of
 // column-major matrices.
 */
-template< typename Type >  // Data type of the matrix
-class CompressedMatrix<Type,true>
-   : public SparseMatrix< CompressedMatrix<Type,true>, true >
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+class CompressedMatrix<Type,true,IT>
+   : public SparseMatrix< CompressedMatrix<Type,true,IT>, true >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed matrix element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed matrix element.
+   using IteratorBase = ElementBase*;             //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -3072,18 +3221,18 @@ class CompressedMatrix<Type,true>
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedMatrix<Type,true>;   //!< Type of this CompressedMatrix instance.
-   using BaseType       = SparseMatrix<This,true>;       //!< Base type of this CompressedMatrix instance.
-   using ResultType     = This;                          //!< Result type for expression template evaluations.
-   using OppositeType   = CompressedMatrix<Type,false>;  //!< Result type with opposite storage order for expression template evaluations.
-   using TransposeType  = CompressedMatrix<Type,false>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                          //!< Type of the compressed matrix elements.
-   using ReturnType     = const Type&;                   //!< Return type for expression template evaluations.
-   using CompositeType  = const This&;                   //!< Data type for composite expression templates.
-   using Reference      = MatrixAccessProxy<This>;       //!< Reference to a non-constant matrix value.
-   using ConstReference = const Type&;                   //!< Reference to a constant matrix value.
-   using Iterator       = Element*;                      //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;                //!< Iterator over constant elements.
+   using This           = CompressedMatrix<Type,true,IT>;   //!< Type of this CompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,true>;          //!< Base type of this CompressedMatrix instance.
+   using ResultType     = This;                             //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,false,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,false,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                             //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                      //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                      //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;          //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type&;                      //!< Reference to a constant matrix value.
+   using Iterator       = Element*;                         //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                   //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -3091,7 +3240,7 @@ class CompressedMatrix<Type,true>
    */
    template< typename NewType >  // Data type of the other matrix
    struct Rebind {
-      using Other = CompressedMatrix<NewType,true>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<NewType,true,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3101,7 +3250,7 @@ class CompressedMatrix<Type,true>
    template< size_t NewM    // Number of rows of the other matrix
            , size_t NewN >  // Number of columns of the other matrix
    struct Resize {
-      using Other = CompressedMatrix<Type,true>;  //!< The type of the other CompressedMatrix.
+      using Other = CompressedMatrix<Type,true,IT>;  //!< The type of the other CompressedMatrix.
    };
    //**********************************************************************************************
 
@@ -3268,6 +3417,8 @@ class CompressedMatrix<Type,true>
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   static inline size_t checkIndexRange( size_t n );
+
    inline size_t extendCapacity() const noexcept;
           void   reserveElements( size_t nonzeros );
 
@@ -3318,8 +3469,8 @@ class CompressedMatrix<Type,true>
 //
 //=================================================================================================
 
-template< typename Type >
-const Type CompressedMatrix<Type,true>::zero_{};
+template< typename Type, typename IT >
+const Type CompressedMatrix<Type,true,IT>::zero_{};
 
 
 
@@ -3334,8 +3485,9 @@ const Type CompressedMatrix<Type,true>::zero_{};
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The default constructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix()
    : m_       ( 0UL )      // The current number of rows of the compressed matrix
    , n_       ( 0UL )      // The current number of columns of the compressed matrix
    , capacity_( 0UL )      // The current capacity of the pointer array
@@ -3355,8 +3507,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix()
 //
 // The matrix is initialized to the zero matrix and has no free capacity.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    for( size_t j=1UL; j<2UL*n_+2UL; ++j )
@@ -3376,8 +3529,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n )
 //
 // The matrix is initialized to the zero matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, size_t nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    begin_[0UL] = allocate<Element>( nonzeros );
@@ -3400,8 +3554,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, size_t
 // The matrix is initialized to the zero matrix and will have the specified capacity in each
 // column. Note that the given vector must have at least \a n elements.
 */
-template< typename Type >  // Data type of the matrix
-CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
    : CompressedMatrix( m, n, Uninitialized() )
 {
    BLAZE_USER_ASSERT( nonzeros.size() == n, "Size of capacity vector and number of columns don't match" );
@@ -3440,8 +3595,9 @@ CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, const std::ve
 // initialized by the values of the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( initializer_list< initializer_list<Type> > list )
    : CompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
 {
    for( size_t j=0UL; j<n_; ++j )
@@ -3475,8 +3631,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( initializer_list< initiali
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const CompressedMatrix& sm )
    : CompressedMatrix( sm.m_, sm.n_, Uninitialized() )
 {
    const size_t nonzeros( sm.nonZeros() );
@@ -3498,8 +3655,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const CompressedMatrix& sm
 //
 // \param sm The compressed matrix to be moved into this instance.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( CompressedMatrix&& sm ) noexcept
    : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
    , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
    , capacity_( sm.capacity_ )  // The current capacity of the pointer array
@@ -3522,10 +3680,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( CompressedMatrix&& sm ) no
 //
 // \param dm Dense matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign dense matrix
         , bool SO >        // Storage order of the foreign dense matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
    using blaze::assign;
@@ -3542,10 +3701,11 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>&
 //
 // \param sm Sparse matrix to be copied.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the foreign compressed matrix
         , bool SO >        // Storage order of the foreign compressed matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
    using blaze::assign;
@@ -3563,9 +3723,10 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>&
 // \param m The number of rows of the matrix.
 // \param n The number of columns of the matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninitialized )
-   : m_       ( m )                     // The current number of rows of the compressed matrix
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::CompressedMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( checkIndexRange( m ) )  // The current number of rows of the compressed matrix
    , n_       ( n )                     // The current number of columns of the compressed matrix
    , capacity_( n )                     // The current capacity of the pointer array
    , begin_( new Iterator[2UL*n+2UL] )  // Pointers to the first non-zero element of each column
@@ -3589,8 +3750,9 @@ inline CompressedMatrix<Type,true>::CompressedMatrix( size_t m, size_t n, Uninit
 /*! \cond BLAZE_INTERNAL */
 /*!\brief The destructor for CompressedMatrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>::~CompressedMatrix()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>::~CompressedMatrix()
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -3623,9 +3785,10 @@ inline CompressedMatrix<Type,true>::~CompressedMatrix()
 // case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
 // check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3647,9 +3810,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
 // the at() function is guaranteed to perform a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::operator()( size_t i, size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::operator()( size_t i, size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -3679,9 +3843,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // inserted into the compressed matrix. In contrast to the subscript operator this function
 // always performs a check of the given access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Reference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Reference
+   CompressedMatrix<Type,true,IT>::at( size_t i, size_t j )
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3707,9 +3872,10 @@ inline typename CompressedMatrix<Type,true>::Reference
 // In contrast to the subscript operator this function always performs a check of the given
 // access indices.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstReference
-   CompressedMatrix<Type,true>::at( size_t i, size_t j ) const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstReference
+   CompressedMatrix<Type,true,IT>::at( size_t i, size_t j ) const
 {
    if( i >= m_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
@@ -3730,9 +3896,10 @@ inline typename CompressedMatrix<Type,true>::ConstReference
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::begin( size_t j ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3748,9 +3915,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::begin( size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::begin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3766,9 +3934,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator to the first non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cbegin( size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cbegin( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return begin_[j];
@@ -3784,9 +3953,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::end( size_t j ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3802,9 +3972,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::end( size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::end( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3820,9 +3991,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // \param j The column index.
 // \return Iterator just past the last non-zero element of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::cend( size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::cend( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid compressed matrix column access index" );
    return end_[j];
@@ -3861,9 +4033,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // assigned the values from the given initializer list. Missing values are considered to
 // be default values.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( initializer_list< initializer_list<Type> > list )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( initializer_list< initializer_list<Type> > list )
 {
    using blaze::nonZeros;
 
@@ -3907,9 +4080,10 @@ inline CompressedMatrix<Type,true>&
 // The compressed matrix is resized according to the given compressed matrix and initialized
 // as a copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const CompressedMatrix& rhs )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const CompressedMatrix& rhs )
 {
    using std::swap;
 
@@ -3961,9 +4135,10 @@ inline CompressedMatrix<Type,true>&
 // \param rhs The compressed matrix to be moved into this instance.
 // \return Reference to the assigned compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( CompressedMatrix&& rhs ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( CompressedMatrix&& rhs ) noexcept
 {
    if( begin_ != nullptr ) {
       deallocate( begin_[0UL] );
@@ -3998,11 +4173,12 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
@@ -4031,11 +4207,12 @@ inline CompressedMatrix<Type,true>&
 // The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
 // copy of this matrix.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
    using blaze::assign;
 
@@ -4068,10 +4245,11 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator+=( const Matrix<MT,SO>& rhs )
 {
    using blaze::addAssign;
 
@@ -4097,10 +4275,11 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::operator-=( const Matrix<MT,SO>& rhs )
 {
    using blaze::subAssign;
 
@@ -4127,11 +4306,12 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( con
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const DenseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator%=( const DenseMatrix<MT,SO>& rhs )
 {
    using blaze::schurAssign;
 
@@ -4166,11 +4346,12 @@ inline CompressedMatrix<Type,true>&
 // In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
 // is thrown.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side sparse matrix
         , bool SO >        // Storage order of the right-hand side sparse matrix
-inline CompressedMatrix<Type,true>&
-   CompressedMatrix<Type,true>::operator%=( const SparseMatrix<MT,SO>& rhs )
+inline CompressedMatrix<Type,true,IT>&
+   CompressedMatrix<Type,true,IT>::operator%=( const SparseMatrix<MT,SO>& rhs )
 {
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
@@ -4199,8 +4380,9 @@ inline CompressedMatrix<Type,true>&
 //
 // \return The number of rows of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::rows() const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::rows() const noexcept
 {
    return m_;
 }
@@ -4214,8 +4396,9 @@ inline size_t CompressedMatrix<Type,true>::rows() const noexcept
 //
 // \return The number of columns of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::columns() const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::columns() const noexcept
 {
    return n_;
 }
@@ -4229,8 +4412,9 @@ inline size_t CompressedMatrix<Type,true>::columns() const noexcept
 //
 // \return The capacity of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity() const noexcept
 {
    if( begin_ != nullptr )
       return end_[n_] - begin_[0UL];
@@ -4247,8 +4431,9 @@ inline size_t CompressedMatrix<Type,true>::capacity() const noexcept
 // \param j The index of the column.
 // \return The current capacity of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::capacity( size_t j ) const noexcept
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return begin_[j+1UL] - begin_[j];
@@ -4263,8 +4448,9 @@ inline size_t CompressedMatrix<Type,true>::capacity( size_t j ) const noexcept
 //
 // \return The number of non-zero elements in the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros() const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros() const
 {
    size_t nonzeros( 0UL );
 
@@ -4284,8 +4470,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros() const
 // \param j The index of the column.
 // \return The number of non-zero elements of column \a j.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::nonZeros( size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return end_[j] - begin_[j];
@@ -4300,8 +4487,9 @@ inline size_t CompressedMatrix<Type,true>::nonZeros( size_t j ) const
 //
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reset()
 {
    for( size_t j=0UL; j<n_; ++j )
       end_[j] = begin_[j];
@@ -4320,8 +4508,9 @@ inline void CompressedMatrix<Type,true>::reset()
 // This function reset the values in the specified column to their default value. Note that
 // the capacity of the column remains unchanged.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reset( size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reset( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    end_[j] = begin_[j];
@@ -4338,8 +4527,9 @@ inline void CompressedMatrix<Type,true>::reset( size_t j )
 //
 // After the clear() function, the size of the compressed matrix is 0.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::clear()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::clear()
 {
    if( end_ != nullptr )
       end_[0UL] = end_[n_];
@@ -4366,16 +4556,18 @@ inline void CompressedMatrix<Type,true>::clear()
 // potentially changes all matrix elements. In order to preserve the old matrix values, the
 // \a preserve flag can be set to \a true.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::resize( size_t m, size_t n, bool preserve )
 {
    using std::swap;
 
    BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
    BLAZE_INTERNAL_ASSERT( begin_ == nullptr || size_t( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
-
    if( m == m_ && n == n_ ) return;
 
+   checkIndexRange( m );
+
    if( begin_ == nullptr )
    {
       begin_ = new Iterator[2UL*n+2UL];
@@ -4464,8 +4656,9 @@ void CompressedMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
 // The current values of the matrix elements and the individual capacities of the matrix rows
 // are preserved.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::reserve( size_t nonzeros )
 {
    if( nonzeros > capacity() )
       reserveElements( nonzeros );
@@ -4486,8 +4679,9 @@ inline void CompressedMatrix<Type,true>::reserve( size_t nonzeros )
 // \a nonzeros elements. The current values of the compressed matrix and all other individual
 // column capacities are preserved.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::reserve( size_t j, size_t nonzeros )
 {
    using std::swap;
 
@@ -4558,8 +4752,9 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 // It removes all excessive capacity from all columns. Note that this function does not remove
 // the overall capacity but only reduces the capacity per column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::trim()
 {
    for( size_t j=0UL; j<n_; ++j )
       trim( j );
@@ -4579,8 +4774,9 @@ void CompressedMatrix<Type,true>::trim()
 // removes all excessive capacity from the specified column. The excessive capacity is assigned
 // to the subsequent column.
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::trim( size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::trim( size_t j )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
 
@@ -4602,8 +4798,9 @@ void CompressedMatrix<Type,true>::trim( size_t j )
 // that in case a reallocation occurs, all iterators (including end() iterators), all pointers
 // and references to elements of this matrix are invalidated.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::shrinkToFit()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity() ) {
       CompressedMatrix( *this ).swap( *this );
@@ -4620,8 +4817,9 @@ inline void CompressedMatrix<Type,true>::shrinkToFit()
 // \param sm The compressed matrix to be swapped.
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::swap( CompressedMatrix& sm ) noexcept
 {
    using std::swap;
 
@@ -4635,6 +4833,32 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checking whether the given number of rows can be represented by the index type.
+//
+// \param n The number of rows of the matrix.
+// \return The given number of rows.
+// \exception std::invalid_argument Number of rows exceeds the index type.
+//
+// This function checks whether all row indices of a matrix with \a n rows can be stored
+// in the index type \a IT of the matrix. In case they cannot, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::checkIndexRange( size_t n )
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Number of rows exceeds the index type" );
+   }
+
+   return n;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Calculating a new matrix capacity.
@@ -4644,8 +4868,9 @@ inline void CompressedMatrix<Type,true>::swap( CompressedMatrix& sm ) noexcept
 // This function calculates a new matrix capacity based on the current capacity of the sparse
 // matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
 */
-template< typename Type >  // Data type of the matrix
-inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline size_t CompressedMatrix<Type,true,IT>::extendCapacity() const noexcept
 {
    size_t nonzeros( 2UL*capacity()+1UL );
    nonzeros = blaze::max( nonzeros, 7UL );
@@ -4665,8 +4890,9 @@ inline size_t CompressedMatrix<Type,true>::extendCapacity() const noexcept
 // \param nonzeros The number of matrix elements to be reserved.
 // \return void
 */
-template< typename Type >  // Data type of the matrix
-void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+void CompressedMatrix<Type,true,IT>::reserveElements( size_t nonzeros )
 {
    using std::swap;
 
@@ -4703,9 +4929,10 @@ void CompressedMatrix<Type,true>::reserveElements( size_t nonzeros )
 // This function performs a down-cast of the given iterator to base elements to an iterator to
 // derived elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::castDown( IteratorBase it ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -4720,9 +4947,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // This function performs an up-cast of the given iterator to derived elements to an iterator
 // to base elements.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::IteratorBase
-   CompressedMatrix<Type,true>::castUp( Iterator it ) const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::IteratorBase
+   CompressedMatrix<Type,true,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -4750,9 +4978,10 @@ inline typename CompressedMatrix<Type,true>::IteratorBase
 // matrix already contains an element with row index \a i and column index \a j its value is
 // modified, else a new element with the given \a value is inserted.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::set( size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::set( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4783,9 +5012,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // are not allowed. In case the compressed matrix already contains an element with row index \a i
 // and column index \a j, a \a std::invalid_argument exception is thrown.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( size_t i, size_t j, const Type& value )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -4813,9 +5043,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \return Iterator to the newly inserted element.
 // \exception std::invalid_argument Invalid compressed matrix access index.
 */
-template< typename Type >  // Data type of the matrix
-typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
 {
    using std::swap;
 
@@ -4935,8 +5166,9 @@ typename CompressedMatrix<Type,true>::Iterator
 // \note Although append() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type& value, bool check )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::append( size_t i, size_t j, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
@@ -4968,8 +5200,9 @@ inline void CompressedMatrix<Type,true>::append( size_t i, size_t j, const Type&
 // \note Although finalize() does not allocate new memory, it still invalidates all iterators
 // returned by the end() functions!
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::finalize( size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::finalize( size_t j )
 {
    BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
 
@@ -4999,8 +5232,9 @@ inline void CompressedMatrix<Type,true>::finalize( size_t j )
 //
 // This function erases an element from the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline void CompressedMatrix<Type,true,IT>::erase( size_t i, size_t j )
 {
    BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
@@ -5023,9 +5257,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t i, size_t j )
 //
 // This function erases an element from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator pos )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator pos )
 {
    BLAZE_USER_ASSERT( j < columns()   , "Invalid column access index"    );
    BLAZE_USER_ASSERT( pos >= begin_[j] && pos <= end_[j], "Invalid compressed matrix iterator" );
@@ -5050,9 +5285,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 //
 // This function erases a range of elements from column \a j of the compressed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5090,9 +5326,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( Pred predicate )
+inline void CompressedMatrix<Type,true,IT>::erase( Pred predicate )
 {
    for( size_t j=0UL; j<n_; ++j ) {
       end_[j] = castDown( std::remove_if( castUp( begin_[j] ), castUp( end_[j] ),
@@ -5130,9 +5367,10 @@ inline void CompressedMatrix<Type,true>::erase( Pred predicate )
 // \note The predicate is required to be pure, i.e. to produce deterministic results for elements
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
+inline void CompressedMatrix<Type,true,IT>::erase( size_t j, Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
@@ -5173,9 +5411,10 @@ inline void CompressedMatrix<Type,true>::erase( size_t j, Iterator first, Iterat
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( i, j ) );
 }
@@ -5198,9 +5437,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // Note that the returned compressed matrix iterator is subject to invalidation due to inserting
 // operations via the subscript operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::find( size_t i, size_t j ) const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::find( size_t i, size_t j ) const
 {
    const ConstIterator pos( lowerBound( i, j ) );
    if( pos != end_[j] && pos->index_ == i )
@@ -5225,9 +5465,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( i, j ) );
 }
@@ -5249,9 +5490,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::lowerBound( size_t i, size_t j ) const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::lowerBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::lower_bound( begin_[j], end_[j], i,
@@ -5278,9 +5520,10 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::Iterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j )
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::Iterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( i, j ) );
 }
@@ -5302,9 +5545,10 @@ inline typename CompressedMatrix<Type,true>::Iterator
 // matrix iterator is subject to invalidation due to inserting operations via the function call
 // operator, the set() function or the insert() function!
 */
-template< typename Type >  // Data type of the matrix
-inline typename CompressedMatrix<Type,true>::ConstIterator
-   CompressedMatrix<Type,true>::upperBound( size_t i, size_t j ) const
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline typename CompressedMatrix<Type,true,IT>::ConstIterator
+   CompressedMatrix<Type,true,IT>::upperBound( size_t i, size_t j ) const
 {
    BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
    return std::upper_bound( begin_[j], end_[j], i,
@@ -5331,8 +5575,9 @@ inline typename CompressedMatrix<Type,true>::ConstIterator
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::transpose()
 {
    CompressedMatrix tmp( trans( *this ) );
    swap( tmp );
@@ -5348,8 +5593,9 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::transpose()
 //
 // \return Reference to the transposed matrix.
 */
-template< typename Type >  // Data type of the matrix
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::ctranspose()
 {
    CompressedMatrix tmp( ctrans( *this ) );
    swap( tmp );
@@ -5377,9 +5623,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::ctranspose()
    A.scale( 4 );  // Same effect as above
    \endcode
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Other& scalar )
+inline CompressedMatrix<Type,true,IT>& CompressedMatrix<Type,true,IT>::scale( const Other& scalar )
 {
    for( size_t j=0UL; j<n_; ++j )
       for( auto element=begin_[j]; element!=end_[j]; ++element )
@@ -5410,9 +5657,10 @@ inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::scale( const Ot
 // to the isAliased() function this function is allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5431,9 +5679,10 @@ inline bool CompressedMatrix<Type,true>::canAlias( const Other* alias ) const no
 // to the canAlias() function this function is not allowed to use compile time expressions
 // to optimize the evaluation.
 */
-template< typename Type >   // Data type of the matrix
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedMatrix<Type,true,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -5452,8 +5701,9 @@ inline bool CompressedMatrix<Type,true>::isAliased( const Other* alias ) const n
 // function additionally provides runtime information (as for instance the current number of
 // rows and/or columns of the matrix).
 */
-template< typename Type >  // Data type of the matrix
-inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Index type
+inline bool CompressedMatrix<Type,true,IT>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -5473,10 +5723,11 @@ inline bool CompressedMatrix<Type,true>::canSMPAssign() const noexcept
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5536,9 +5787,10 @@ inline void CompressedMatrix<Type,true>::assign( const DenseMatrix<MT,SO>& rhs )
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,true>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5569,9 +5821,10 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,true>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT >    // Type of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& rhs )
+inline void CompressedMatrix<Type,true,IT>::assign( const SparseMatrix<MT,false>& rhs )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5580,23 +5833,51 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
    BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
 
-   // Counting the number of elements per column
-   std::vector<size_t> columnLengths( n_, 0UL );
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         ++columnLengths[element->index()];
-   }
+   if( n_ == 0UL || begin_[0] == nullptr )
+      return;
+
+   const size_t tasks( ( (~rhs).nonZeros() >= SMP_SMATTRANSPOSE_THRESHOLD && m_ > 1UL )
+                       ? min( getNumThreads(), m_ )
+                       : 1UL );
+   const size_t blockSize( m_ / tasks + ( m_ % tasks != 0UL ? 1UL : 0UL ) );
 
-   // Resizing the compressed matrix
+   // Counting the number of elements per column for each block of rows
+   std::vector<size_t> positions( tasks*n_, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      size_t* const count( positions.data() + t*n_ );
+      const size_t iend( min( (t+1UL)*blockSize, m_ ) );
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
+            ++count[element->index()];
+      }
+   } );
+
+   // Resizing the compressed matrix and computing the first position of each block of rows
+   size_t offset( 0UL );
    for( size_t j=0UL; j<n_; ++j ) {
-      begin_[j+1UL] = end_[j+1UL] = begin_[j] + columnLengths[j];
+      for( size_t t=0UL; t<tasks; ++t ) {
+         const size_t tmp( positions[t*n_+j] );
+         positions[t*n_+j] = offset;
+         offset += tmp;
+      }
+      begin_[j+1UL] = end_[j] = begin_[0UL] + offset;
    }
 
-   // Appending the elements to the columns of the compressed matrix
-   for( size_t i=0UL; i<m_; ++i ) {
-      for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element )
-         append( i, element->index(), element->value() );
-   }
+   // Scattering the elements into the columns of the compressed matrix
+   smpFor( tasks, [&]( size_t t )
+   {
+      size_t* const position( positions.data() + t*n_ );
+      const size_t iend( min( (t+1UL)*blockSize, m_ ) );
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         for( auto element=(~rhs).begin(i); element!=(~rhs).end(i); ++element ) {
+            const Iterator pos( begin_[0UL] + position[element->index()]++ );
+            pos->value_ = element->value();
+            pos->index_ = i;
+         }
+      }
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -5614,10 +5895,11 @@ inline void CompressedMatrix<Type,true>::assign( const SparseMatrix<MT,false>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5641,10 +5923,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::addAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5668,10 +5951,11 @@ inline void CompressedMatrix<Type,true>::addAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5695,10 +5979,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const DenseMatrix<MT,SO>& rh
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side compressed matrix
         , bool SO >        // Storage order of the right-hand side compressed matrix
-inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::subAssign( const SparseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5722,10 +6007,11 @@ inline void CompressedMatrix<Type,true>::subAssign( const SparseMatrix<MT,SO>& r
 // in erroneous results and/or in compilation errors. Instead of using this function use the
 // assignment operator.
 */
-template< typename Type >  // Data type of the matrix
+template< typename Type    // Data type of the matrix
+        , typename IT >    // Index type
 template< typename MT      // Type of the right-hand side dense matrix
         , bool SO >        // Storage order of the right-hand side dense matrix
-inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>& rhs )
+inline void CompressedMatrix<Type,true,IT>::schurAssign( const DenseMatrix<MT,SO>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
@@ -5757,23 +6043,31 @@ inline void CompressedMatrix<Type,true>::schurAssign( const DenseMatrix<MT,SO>&
 //*************************************************************************************************
 /*!\name CompressedMatrix operators */
 //@{
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+void reset( CompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void reset( CompressedMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+void clear( CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-void reset( CompressedMatrix<Type,SO>& m, size_t i );
+template< bool RF, typename Type, bool SO, typename IT >
+bool isDefault( const CompressedMatrix<Type,SO,IT>& m );
 
-template< typename Type, bool SO >
-void clear( CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+bool isIntact( const CompressedMatrix<Type,SO,IT>& m );
 
-template< bool RF, typename Type, bool SO >
-bool isDefault( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT >
+void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) noexcept;
 
-template< typename Type, bool SO >
-bool isIntact( const CompressedMatrix<Type,SO>& m );
+template< typename Type, bool SO, typename IT, typename RowIt, typename ColIt, typename ValIt, typename OP >
+void fromTriplets( CompressedMatrix<Type,SO,IT>& sm, RowIt rows, ColIt columns, ValIt values,
+                   size_t nonzeros, OP op );
 
-template< typename Type, bool SO >
-void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept;
+template< typename Type, bool SO, typename IT, typename RowIt, typename ColIt, typename ValIt >
+void fromTriplets( CompressedMatrix<Type,SO,IT>& sm, RowIt rows, ColIt columns, ValIt values,
+                   size_t nonzeros );
 //@}
 //*************************************************************************************************
 
@@ -5786,8 +6080,9 @@ void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m )
 {
    m.reset();
 }
@@ -5808,8 +6103,9 @@ inline void reset( CompressedMatrix<Type,SO>& m )
 // \a i. Note that the capacity of the row/column remains unchanged.
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedMatrix<Type,SO,IT>& m, size_t i )
 {
    m.reset( i );
 }
@@ -5824,8 +6120,9 @@ inline void reset( CompressedMatrix<Type,SO>& m, size_t i )
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void clear( CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedMatrix<Type,SO,IT>& m )
 {
    m.clear();
 }
@@ -5859,8 +6156,9 @@ inline void clear( CompressedMatrix<Type,SO>& m )
 */
 template< bool RF        // Relaxation flag
         , typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isDefault( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.rows() == 0UL && m.columns() == 0UL );
 }
@@ -5886,8 +6184,9 @@ inline bool isDefault( const CompressedMatrix<Type,SO>& m )
    \endcode
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline bool isIntact( const CompressedMatrix<Type,SO>& m )
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const CompressedMatrix<Type,SO,IT>& m )
 {
    return ( m.nonZeros() <= m.capacity() );
 }
@@ -5903,14 +6202,246 @@ inline bool isIntact( const CompressedMatrix<Type,SO>& m )
 // \return void
 */
 template< typename Type  // Data type of the matrix
-        , bool SO >      // Storage order
-inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) noexcept
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedMatrix<Type,SO,IT>& a, CompressedMatrix<Type,SO,IT>& b ) noexcept
 {
    a.swap( b );
 }
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Assembles the given compressed matrix from a list of (row,column,value) triplets.
+// \ingroup compressed_matrix
+//
+// \param sm The compressed matrix to be assembled.
+// \param rows Random access iterator to the row indices of the triplets.
+// \param columns Random access iterator to the column indices of the triplets.
+// \param values Random access iterator to the values of the triplets.
+// \param nonzeros The total number of triplets.
+// \param op The binary operation for the combination of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid row or column index detected.
+//
+// This function replaces the contents of the given compressed matrix by the given, possibly
+// unsorted list of (row,column,value) triplets, i.e. a sparse matrix in coordinate format. The
+// dimensions of the matrix remain unchanged. Triplets referring to the same element of the
+// matrix are combined via the given binary operation in the order in which they are given:
+
+   \code
+   std::vector<size_t> rows   { 2, 0, 2, 1, 0 };
+   std::vector<size_t> columns{ 1, 3, 1, 0, 0 };
+   std::vector<double> values { 1.0, 2.0, 3.0, 4.0, 5.0 };
+
+   blaze::CompressedMatrix<double,rowMajor> A( 3UL, 4UL );
+
+   // Results in ( ( 5 0 0 2 )
+   //              ( 4 0 0 0 )
+   //              ( 0 4 0 0 ) )
+   fromTriplets( A, rows.begin(), columns.begin(), values.begin(), values.size(), blaze::Add() );
+
+   // Results in ( ( 5 0 0 2 )
+   //              ( 4 0 0 0 )
+   //              ( 0 3 0 0 ) )
+   fromTriplets( A, rows.begin(), columns.begin(), values.begin(), values.size(),
+                 []( double, double b ){ return b; } );
+   \endcode
+
+// The triplets are sorted by means of two stable counting sorts (first with respect to their
+// column/row index, then with respect to their row/column index), and the final compressed
+// rows/columns are written in a single pass without any reallocation. Apart from the result,
+// the additional memory is linear in the number of triplets and rows/columns. In case the
+// number of triplets exceeds the BLAZE_SMP_SMATASSEMBLE_THRESHOLD and shared memory
+// parallelization is active, both the sort and the combination of the triplets are executed
+// in parallel. Note that the given operation must not throw. In case any row index is not
+// smaller than the number of rows or any column index is not smaller than the number of
+// columns, a \a std::invalid_argument exception is thrown and the matrix remains unchanged.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT      // Index type
+        , typename RowIt   // Type of the row index iterator
+        , typename ColIt   // Type of the column index iterator
+        , typename ValIt   // Type of the value iterator
+        , typename OP >    // Type of the combination operation
+void fromTriplets( CompressedMatrix<Type,SO,IT>& sm, RowIt rows, ColIt columns, ValIt values,
+                   size_t nonzeros, OP op )
+{
+   // Major and minor dimension of the matrix (rows/columns for row-major matrices)
+   const size_t M( SO ? sm.columns() : sm.rows()    );
+   const size_t N( SO ? sm.rows()    : sm.columns() );
+
+   const auto majorIndex = [&]( size_t k ) -> size_t {
+      return static_cast<size_t>( SO ? columns[k] : rows[k] );
+   };
+
+   const auto minorIndex = [&]( size_t k ) -> size_t {
+      return static_cast<size_t>( SO ? rows[k] : columns[k] );
+   };
+
+   const size_t tasks( ( nonzeros >= SMP_SMATASSEMBLE_THRESHOLD )
+                       ? min( getNumThreads(), max( nonzeros / 1024UL, 1UL ) )
+                       : 1UL );
+   const size_t blockSize( nonzeros / tasks + ( nonzeros % tasks != 0UL ? 1UL : 0UL ) );
+
+   // Checking the row and column indices of all triplets
+   std::vector<char> invalid( tasks, 0 );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t kend( min( (t+1UL)*blockSize, nonzeros ) );
+      for( size_t k=t*blockSize; k<kend; ++k ) {
+         if( majorIndex( k ) >= M || minorIndex( k ) >= N ) {
+            invalid[t] = 1;
+            break;
+         }
+      }
+   } );
+
+   if( std::find( invalid.begin(), invalid.end(), 1 ) != invalid.end() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid triplet index detected" );
+   }
+
+   // Stable, parallel counting sort of the given sequence of triplets with respect to the given
+   // key. Each task counts the keys of its contiguous block of the sequence. The prefix sum over
+   // all (key,block) pairs in key-major order determines the first position of each block within
+   // each key, and each task finally scatters its own block. Thus every triplet is read once per
+   // pass and the relative order of the triplets of each key is preserved.
+   const auto distribute = [&]( size_t K, auto key, auto input, std::vector<size_t>& output,
+                                std::vector<size_t>& first, std::vector<size_t>& bounds )
+   {
+      // Counting the triplets of each key for each block of the sequence
+      std::vector<size_t> positions( tasks*K, 0UL );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         size_t* const count( positions.data() + t*K );
+         const size_t kend( min( (t+1UL)*blockSize, nonzeros ) );
+         for( size_t k=t*blockSize; k<kend; ++k )
+            ++count[ key( input( k ) ) ];
+      } );
+
+      // Determining the first triplet of each key and the first position of each block
+      first.assign( K+1UL, 0UL );
+
+      size_t offset( 0UL );
+
+      for( size_t i=0UL; i<K; ++i ) {
+         for( size_t t=0UL; t<tasks; ++t ) {
+            const size_t count( positions[t*K+i] );
+            positions[t*K+i] = offset;
+            offset += count;
+         }
+         first[i+1UL] = offset;
+      }
+
+      // Determining the keys of each task based on the number of triplets
+      bounds.assign( tasks+1UL, K );
+
+      for( size_t t=0UL; t<tasks; ++t ) {
+         bounds[t] = std::lower_bound( first.begin(), first.begin()+K, t*blockSize ) - first.begin();
+      }
+
+      // Scattering the triplets of each block to their keys in sequence order
+      output.resize( nonzeros );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         size_t* const position( positions.data() + t*K );
+         const size_t kend( min( (t+1UL)*blockSize, nonzeros ) );
+         for( size_t k=t*blockSize; k<kend; ++k ) {
+            const size_t j( input( k ) );
+            output[ position[ key( j ) ]++ ] = j;
+         }
+      } );
+   };
+
+   // Sorting the triplets with respect to the minor index (and their position) ...
+   std::vector<size_t> perm, first, bounds;
+
+   distribute( N, minorIndex, []( size_t k ) { return k; }, perm, first, bounds );
+
+   // ... and distributing them to their rows/columns with respect to the major index
+   {
+      const std::vector<size_t> byMinor( std::move( perm ) );
+
+      distribute( M, majorIndex, [&byMinor]( size_t k ) { return byMinor[k]; }, perm, first, bounds );
+   }
+
+   // Counting the number of unique elements of each row/column
+   std::vector<size_t> unique( M, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+         for( size_t k=first[i]; k<first[i+1UL]; ++k ) {
+            if( k == first[i] || minorIndex( perm[k] ) != minorIndex( perm[k-1UL] ) )
+               ++unique[i];
+         }
+      }
+   } );
+
+   // Writing the final compressed rows/columns
+   CompressedMatrix<Type,SO,IT> tmp( sm.rows(), sm.columns(), unique );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i )
+      {
+         size_t k( first[i] );
+
+         while( k < first[i+1UL] )
+         {
+            const size_t j( minorIndex( perm[k] ) );
+            Type value( values[ perm[k] ] );
+
+            for( ++k; k<first[i+1UL] && minorIndex( perm[k] ) == j; ++k ) {
+               value = op( value, values[ perm[k] ] );
+            }
+
+            if( SO ) tmp.append( j, i, value );
+            else     tmp.append( i, j, value );
+         }
+      }
+   } );
+
+   sm.swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembles the given compressed matrix from a list of (row,column,value) triplets.
+// \ingroup compressed_matrix
+//
+// \param sm The compressed matrix to be assembled.
+// \param rows Random access iterator to the row indices of the triplets.
+// \param columns Random access iterator to the column indices of the triplets.
+// \param values Random access iterator to the values of the triplets.
+// \param nonzeros The total number of triplets.
+// \return void
+// \exception std::invalid_argument Invalid row or column index detected.
+//
+// This function replaces the contents of the given compressed matrix by the given, possibly
+// unsorted list of (row,column,value) triplets. Triplets referring to the same element of the
+// matrix are summed up. For more details see the fromTriplets() function with an explicitly
+// specified combination operation.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT      // Index type
+        , typename RowIt   // Type of the row index iterator
+        , typename ColIt   // Type of the column index iterator
+        , typename ValIt > // Type of the value iterator
+inline void fromTriplets( CompressedMatrix<Type,SO,IT>& sm, RowIt rows, ColIt columns, ValIt values,
+                          size_t nonzeros )
+{
+   fromTriplets( sm, rows, columns, values, nonzeros, Add() );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -5921,8 +6452,8 @@ inline void swap( CompressedMatrix<Type,SO>& a, CompressedMatrix<Type,SO>& b ) n
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsResizable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedMatrix<T,SO,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -5939,8 +6470,8 @@ struct IsResizable< CompressedMatrix<T,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool SO >
-struct IsShrinkable< CompressedMatrix<T,SO> >
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< CompressedMatrix<T,SO,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -5949,6 +6480,25 @@ struct IsShrinkable< CompressedMatrix<T,SO> >
 
 
 
+//=================================================================================================
+//
+//  STORAGEINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct StorageIndex< CompressedMatrix<T,SO,IT> >
+{
+   using Type = IT;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -5966,7 +6516,7 @@ struct AddTraitEval2< T1, T2
 
    static constexpr bool SO = ( StorageOrder_v<T1> && StorageOrder_v<T2> );
 
-   using Type = CompressedMatrix< AddTrait_t<ET1,ET2>, SO >;
+   using Type = CompressedMatrix< AddTrait_t<ET1,ET2>, SO, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -5991,7 +6541,7 @@ struct SubTraitEval2< T1, T2
 
    static constexpr bool SO = ( StorageOrder_v<T1> && StorageOrder_v<T2> );
 
-   using Type = CompressedMatrix< SubTrait_t<ET1,ET2>, SO >;
+   using Type = CompressedMatrix< SubTrait_t<ET1,ET2>, SO, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6023,7 +6573,10 @@ struct SchurTraitEval2< T1, T2
                                     ? StorageOrder_v<T1>
                                     : StorageOrder_v<T2> ) );
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using IT = StorageIndex_t< If_t< IsSparseMatrix_v<T1>, T1, T2 >
+                            , If_t< IsSparseMatrix_v<T2>, T2, T1 > >;
+
+   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6045,7 +6598,7 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< MultTrait_t<ET1,T2>, StorageOrder_v<T1>, StorageIndex_t<T1> >;
 };
 
 template< typename T1, typename T2 >
@@ -6054,7 +6607,7 @@ struct MultTraitEval2< T1, T2
 {
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedMatrix< MultTrait_t<T1,ET2>, StorageOrder_v<T2> >;
+   using Type = CompressedMatrix< MultTrait_t<T1,ET2>, StorageOrder_v<T2>, StorageIndex_t<T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -6069,7 +6622,9 @@ struct MultTraitEval2< T1, T2
 
    static constexpr bool SO = ( IsSparseVector_v<T2> ? rowMajor : columnMajor );
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO >;
+   using IT = StorageIndex_t< If_t< IsSparseVector_v<T2>, T2, T1 > >;
+
+   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, SO, IT >;
 };
 
 template< typename T1, typename T2 >
@@ -6081,7 +6636,7 @@ struct MultTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< MultTrait_t<ET1,ET2>, StorageOrder_v<T1>, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6103,7 +6658,7 @@ struct DivTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
 
-   using Type = CompressedMatrix< DivTrait_t<ET1,T2>, StorageOrder_v<T1> >;
+   using Type = CompressedMatrix< DivTrait_t<ET1,T2>, StorageOrder_v<T1>, StorageIndex_t<T1> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6125,7 +6680,7 @@ struct UnaryMapTraitEval2< T, OP
 {
    using ET = ElementType_t<T>;
 
-   using Type = CompressedMatrix< MapTrait_t<ET,OP>, StorageOrder_v<T> >;
+   using Type = CompressedMatrix< MapTrait_t<ET,OP>, StorageOrder_v<T>, StorageIndex_t<T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6148,7 +6703,7 @@ struct ExpandTraitEval2< T, E
 {
    static constexpr bool TF = ( IsColumnVector_v<T> ? columnMajor : rowMajor );
 
-   using Type = CompressedMatrix< ElementType_t<T>, TF >;
+   using Type = CompressedMatrix< ElementType_t<T>, TF, StorageIndex_t<T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6164,10 +6719,10 @@ struct ExpandTraitEval2< T, E
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename IT, typename T2 >
+struct HighType< CompressedMatrix<T1,SO,IT>, CompressedMatrix<T2,SO,IT> >
 {
-   using Type = CompressedMatrix< typename HighType<T1,T2>::Type, SO >;
+   using Type = CompressedMatrix< typename HighType<T1,T2>::Type, SO, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6183,10 +6738,10 @@ struct HighType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool SO, typename T2 >
-struct LowType< CompressedMatrix<T1,SO>, CompressedMatrix<T2,SO> >
+template< typename T1, bool SO, typename IT, typename T2 >
+struct LowType< CompressedMatrix<T1,SO,IT>, CompressedMatrix<T2,SO,IT> >
 {
-   using Type = CompressedMatrix< typename LowType<T1,T2>::Type, SO >;
+   using Type = CompressedMatrix< typename LowType<T1,T2>::Type, SO, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6206,7 +6761,9 @@ template< typename MT, size_t I, size_t J, size_t M, size_t N >
 struct SubmatrixTraitEval2< MT, I, J, M, N
                           , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, StorageOrder_v<MT> >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, StorageOrder_v<MT>, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6226,7 +6783,9 @@ template< typename MT, size_t M >
 struct RowsTraitEval2< MT, M
                      , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, false >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, false, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -6246,7 +6805,9 @@ template< typename MT, size_t N >
 struct ColumnsTraitEval2< MT, N
                         , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedMatrix< RemoveConst_t< ElementType_t<MT> >, true >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedMatrix< ET, true, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,495 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedMatrixBuilder.h
+//  \brief Implementation of an incremental builder for compressed matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDMATRIXBUILDER_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDMATRIXBUILDER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Partition.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_matrix_builder CompressedMatrixBuilder
+// \ingroup sparse_matrix
+*/
+/*!\brief Incremental builder for compressed matrices.
+// \ingroup compressed_matrix_builder
+//
+// The CompressedMatrixBuilder class template assembles a sparse matrix from elements that are
+// added in arbitrary order. In contrast to the CompressedMatrix, which stores all elements in a
+// single contiguous array and therefore has to shift all trailing elements in case an element
+// is inserted into a row (or column) without spare capacity, every row (or column) of the builder
+// owns a separate, growable array. Adding an element therefore takes amortized constant time,
+// independent of the order of the insertions and without any prior call to reserve(). The type
+// of the elements and the storage order of the resulting matrix can be specified via the two
+// template parameters:
+
+   \code
+   template< typename Type, bool SO >
+   class CompressedMatrixBuilder;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the resulting
+//          matrix. The default value is blaze::defaultStorageOrder.
+//
+// Elements are added via the add() function. In case an element is added several times, all
+// values are accumulated, which corresponds to the assembly of finite element matrices. The
+// compact() function finally sorts and merges the elements of all rows (or columns) and converts
+// them into a CompressedMatrix. In case the builder contains at least as many elements as the
+// \c BLAZE_SMP_SMATCOMPACT_THRESHOLD, the conversion is executed in parallel:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::CompressedMatrixBuilder;
+
+   CompressedMatrixBuilder<double> builder( 1000UL, 1000UL );
+
+   for( const auto& element : elements ) {
+      builder.add( element.i, element.j, element.value );
+   }
+
+   const CompressedMatrix<double> A( builder.compact() );
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder >  // Storage order
+class CompressedMatrixBuilder
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;                         //!< Type of the matrix elements.
+   using ResultType  = CompressedMatrix<Type,SO>;    //!< Result type of the compaction.
+   using Element     = ValueIndexPair<Type>;         //!< Value-index-pair of the builder.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedMatrixBuilder();
+   explicit inline CompressedMatrixBuilder( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   reserve( size_t i, size_t nonzeros );
+   inline void   clear();
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline void add( size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Compaction functions************************************************************************
+   /*!\name Compaction functions */
+   //@{
+   ResultType compact();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t merge( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t m_;         //!< The current number of rows of the matrix.
+   size_t n_;         //!< The current number of columns of the matrix.
+   size_t nonzeros_;  //!< The total number of added elements.
+   std::vector< std::vector<Element> > elements_;  //!< The elements of the rows (or columns).
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedMatrixBuilder.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompressedMatrixBuilder<Type,SO>::CompressedMatrixBuilder()
+   : m_       ( 0UL )  // The current number of rows of the matrix
+   , n_       ( 0UL )  // The current number of columns of the matrix
+   , nonzeros_( 0UL )  // The total number of added elements
+   , elements_()       // The elements of the rows (or columns)
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a builder of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline CompressedMatrixBuilder<Type,SO>::CompressedMatrixBuilder( size_t m, size_t n )
+   : m_       ( m )                        // The current number of rows of the matrix
+   , n_       ( n )                        // The current number of columns of the matrix
+   , nonzeros_( 0UL )                      // The total number of added elements
+   , elements_( SO == rowMajor ? m : n )  // The elements of the rows (or columns)
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrixBuilder<Type,SO>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrixBuilder<Type,SO>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of added elements.
+//
+// \return The total number of added elements.
+//
+// Note that the returned number includes elements that have been added several times. After
+// a call to compact() it corresponds to the number of distinct elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrixBuilder<Type,SO>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of added elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of added elements of row/column \a i.
+//
+// This function returns the number of added elements in the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the number of elements in row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the number of elements
+// in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrixBuilder<Type,SO>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < elements_.size(), "Invalid row/column access index" );
+
+   return elements_[i].size();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the builder.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the builder to at least \a nonzeros
+// elements. In contrast to the CompressedMatrix, the capacity of a row/column does not affect any
+// other row/column, i.e. the call to reserve() is an optional optimization.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrixBuilder<Type,SO>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < elements_.size(), "Invalid row/column access index" );
+
+   elements_[i].reserve( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes all added elements from the builder.
+//
+// \return void
+//
+// This function removes all elements from the builder. The size of the matrix is preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrixBuilder<Type,SO>::clear()
+{
+   for( std::vector<Element>& elements : elements_ ) {
+      elements.clear();
+   }
+
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sorting and merging of the elements of a specific row/column.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \return The number of distinct elements of the row/column.
+//
+// This function sorts the elements of row/column \a i by index and accumulates all elements
+// with the same index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline size_t CompressedMatrixBuilder<Type,SO>::merge( size_t i )
+{
+   std::vector<Element>& elements( elements_[i] );
+
+   if( elements.empty() ) return 0UL;
+
+   std::stable_sort( elements.begin(), elements.end(),
+                     []( const Element& a, const Element& b ){ return a.index() < b.index(); } );
+
+   auto last( elements.begin() );
+
+   for( auto element=elements.begin()+1UL; element!=elements.end(); ++element ) {
+      if( element->index() == last->index() ) {
+         last->value() += element->value();
+      }
+      else {
+         *(++last) = std::move( *element );
+      }
+   }
+
+   elements.erase( last+1UL, elements.end() );
+
+   return elements.size();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a value to an element of the matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value to be added to element \f$ (i,j) \f$.
+// \return void
+// \exception std::out_of_range Invalid matrix access index.
+//
+// This function adds the given value to element \f$ (i,j) \f$ of the matrix. The element is
+// appended to the end of the according row/column in amortized constant time. In case the
+// element has already been added before, the values are accumulated during compact().
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+inline void CompressedMatrixBuilder<Type,SO>::add( size_t i, size_t j, const Type& value )
+{
+   if( i >= m_ || j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid matrix access index" );
+   }
+
+   if( SO == rowMajor )
+      elements_[i].emplace_back( value, j );
+   else
+      elements_[j].emplace_back( value, i );
+
+   ++nonzeros_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPACTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion of the builder into a contiguous compressed matrix.
+//
+// \return The resulting compressed matrix.
+//
+// This function sorts the elements of all rows (or columns) by index, accumulates all elements
+// that have been added several times and copies the elements into a CompressedMatrix whose rows
+// (or columns) are preallocated to their exact size. In case the builder contains at least as
+// many elements as the \c BLAZE_SMP_SMATCOMPACT_THRESHOLD, both steps are executed in parallel,
+// where the rows (or columns) are distributed among the threads based on their number of
+// elements.
+//
+// The builder keeps the merged elements, i.e. further elements may be added afterwards.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+typename CompressedMatrixBuilder<Type,SO>::ResultType CompressedMatrixBuilder<Type,SO>::compact()
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t N( elements_.size() );
+
+   const size_t tasks( ( nonzeros_ >= SMP_SMATCOMPACT_THRESHOLD && N > 1UL )
+                       ? min( getNumThreads(), N )
+                       : 1UL );
+
+   const std::vector<size_t> bounds( partitionNonZeros( N, [this]( size_t i ) {
+      return elements_[i].size();
+   }, tasks ) );
+
+   std::vector<size_t> nonzeros( N, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+         nonzeros[i] = merge( i );
+      }
+   } );
+
+   nonzeros_ = 0UL;
+   for( size_t nonzero : nonzeros ) {
+      nonzeros_ += nonzero;
+   }
+
+   ResultType result( m_, n_, nonzeros );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+         for( const Element& element : elements_[i] ) {
+            if( SO == rowMajor )
+               result.append( i, element.index(), element.value() );
+            else
+               result.append( element.index(), i, element.value() );
+         }
+      }
+   } );
+
+   return result;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2520 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/CompressedSoAMatrix.h
+//  \brief Implementation of a structure-of-arrays compressed MxN matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+#define _BLAZE_MATH_SPARSE_COMPRESSEDSOAMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/CompressedIndexStorage.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/math/typetraits/StorageIndex.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsRValueReference.h>
+#include <blaze/util/typetraits/RemoveReference.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup compressed_soa_matrix CompressedSoAMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Structure-of-arrays implementation of a \f$ M \times N \f$ compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// The CompressedSoAMatrix class template is a variant of the CompressedMatrix class template
+// that stores the non-zero elements in the classic compressed row storage (CRS) respectively
+// compressed column storage (CCS) layout: Instead of an array of value-index-pairs it manages
+// one contiguous array of values and one contiguous array of indices. The type of the elements,
+// the storage order of the matrix, and the type of the stored indices can be specified via
+// the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class CompressedSoAMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. CompressedSoAMatrix can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default value is
+//          \c size_t.
+//
+// The separate value and index arrays allow the computational kernels to load a run of
+// values or indices of a single row/column by means of a single SIMD load. Therefore the
+// multiplication of a row-major CompressedSoAMatrix with a dense vector and the reduction
+// operations (see for instance the reduce() and sum() functions) are vectorized by means of
+// SIMD loads and, in AVX2 and AVX-512 mode, gather instructions for the dense operand. In case
+// of a 32-bit index type, the search for common indices of two rows/columns (as for instance
+// required by the Schur product) compares blocks of four indices at once.
+//
+// From the user's point of view the CompressedSoAMatrix provides the same interface as the
+// CompressedMatrix and can be used as a drop-in replacement in all sparse matrix expressions.
+// The only difference is that the iterators don't refer to value-index-pairs in memory, but
+// act as proxies that combine the value and the index of the current element:
+
+   \code
+   using blaze::CompressedSoAMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   CompressedSoAMatrix<double,rowMajor> A( 3UL, 3UL, 4UL );
+   A(0,0) = 1.0;
+   A(1,1) = 2.0;
+   A(2,0) = 3.0;
+   A(2,2) = 4.0;
+
+   DynamicVector<double,columnVector> x{ 1.0, 2.0, 3.0 };
+   DynamicVector<double,columnVector> y( A * x );  // Vectorized sparse matrix/vector product
+
+   const double* values ( A.values( 2UL ) );   // Direct access to the values of row 2
+   const size_t* indices( A.indices( 2UL ) );  // Direct access to the column indices of row 2
+
+   for( auto it=A.begin(2UL); it!=A.end(2UL); ++it ) {
+      it->value() *= 2.0;  // Access to the value of the non-zero element
+      it->index();         // Access to the index of the non-zero element
+   }
+   \endcode
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
+class CompressedSoAMatrix
+   : public SparseMatrix< CompressedSoAMatrix<Type,SO,IT>, SO >
+   , private CompressedIndexStorage<SO,IT>
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Storage = CompressedIndexStorage<SO,IT>;  //!< Type of the offset and index storage.
+   //**********************************************************************************************
+
+   //**Private class SoAElement********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Proxy for a single element of the CompressedSoAMatrix class.
+   //
+   // This proxy combines a value and an index, which are stored in separate arrays, into a
+   // single sparse element. Assignments to the proxy only modify the value.
+   */
+   template< typename VT >  // Type of the value (either Type or const Type)
+   class SoAElement
+      : private SparseElement
+   {
+    public:
+      //**Constructor******************************************************************************
+      inline SoAElement( VT* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the value of the element
+         , index_( index )  // Pointer to the index of the element
+      {}
+      //*******************************************************************************************
+
+      //**Assignment operators*********************************************************************
+      inline SoAElement& operator=( const SoAElement& rhs ) {
+         *value_ = rhs.value();
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( const Other& rhs ) -> EnableIf_t< IsSparseElement_v<Other>, SoAElement& > {
+         *value_ = rhs.value();
+         return *this;
+      }
+
+      template< typename Other >
+      inline auto operator=( const Other& v ) -> EnableIf_t< !IsSparseElement_v<Other>, SoAElement& > {
+         *value_ = v;
+         return *this;
+      }
+
+      template< typename Other > inline SoAElement& operator+=( const Other& v ) { *value_ += v; return *this; }
+      template< typename Other > inline SoAElement& operator-=( const Other& v ) { *value_ -= v; return *this; }
+      template< typename Other > inline SoAElement& operator*=( const Other& v ) { *value_ *= v; return *this; }
+      template< typename Other > inline SoAElement& operator/=( const Other& v ) { *value_ /= v; return *this; }
+      //*******************************************************************************************
+
+      //**Access functions*************************************************************************
+      inline VT&    value() const noexcept { return *value_; }
+      inline size_t index() const noexcept { return *index_; }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the value of the element.
+      const IT* index_;  //!< Pointer to the index of the element.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class SoAIterator*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Iterator over the elements of a row/column of the CompressedSoAMatrix class.
+   //
+   // The iterator advances a pointer into the value array and a pointer into the index array
+   // in lockstep. In contrast to the iterators of the CompressedMatrix the element access via
+   // the arrow operator provides the value() and index() functions of the iterator itself.
+   */
+   template< typename VT >  // Type of the value (either Type or const Type)
+   class SoAIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = SoAElement<VT>;                   //!< Type of the underlying elements.
+      using PointerType      = const SoAIterator*;               //!< Pointer return type.
+      using ReferenceType    = SoAElement<VT>;                   //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      inline SoAIterator() noexcept
+         : value_( nullptr )  // Pointer to the current value
+         , index_( nullptr )  // Pointer to the current index
+      {}
+
+      inline SoAIterator( VT* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the current value
+         , index_( index )  // Pointer to the current index
+      {}
+
+      template< typename VT2 >
+      inline SoAIterator( const SoAIterator<VT2>& it ) noexcept
+         : value_( it.value_ )  // Pointer to the current value
+         , index_( it.index_ )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Increment/decrement operators************************************************************
+      inline SoAIterator& operator++() noexcept { ++value_; ++index_; return *this; }
+      inline SoAIterator& operator--() noexcept { --value_; --index_; return *this; }
+
+      inline const SoAIterator operator++( int ) noexcept { SoAIterator tmp( *this ); ++(*this); return tmp; }
+      inline const SoAIterator operator--( int ) noexcept { SoAIterator tmp( *this ); --(*this); return tmp; }
+
+      inline SoAIterator& operator+=( ptrdiff_t inc ) noexcept { value_ += inc; index_ += inc; return *this; }
+      inline SoAIterator& operator-=( ptrdiff_t dec ) noexcept { value_ -= dec; index_ -= dec; return *this; }
+
+      inline const SoAIterator operator+( ptrdiff_t inc ) const noexcept { return SoAIterator( value_+inc, index_+inc ); }
+      inline const SoAIterator operator-( ptrdiff_t dec ) const noexcept { return SoAIterator( value_-dec, index_-dec ); }
+
+      friend inline const SoAIterator operator+( ptrdiff_t inc, const SoAIterator& it ) noexcept {
+         return it + inc;
+      }
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      inline ReferenceType operator*() const noexcept { return ReferenceType( value_, index_ ); }
+      inline PointerType   operator->() const noexcept { return this; }
+
+      inline ReferenceType operator[]( ptrdiff_t n ) const noexcept {
+         return ReferenceType( value_+n, index_+n );
+      }
+      //*******************************************************************************************
+
+      //**Access functions*************************************************************************
+      inline VT&       value  () const noexcept { return *value_; }
+      inline size_t    index  () const noexcept { return *index_; }
+      inline const IT* indices() const noexcept { return index_; }
+      //*******************************************************************************************
+
+      //**Comparison operators*********************************************************************
+      template< typename VT2 >
+      inline bool operator==( const SoAIterator<VT2>& rhs ) const noexcept { return index_ == rhs.index_; }
+
+      template< typename VT2 >
+      inline bool operator!=( const SoAIterator<VT2>& rhs ) const noexcept { return index_ != rhs.index_; }
+
+      template< typename VT2 >
+      inline bool operator<( const SoAIterator<VT2>& rhs ) const noexcept { return index_ < rhs.index_; }
+
+      template< typename VT2 >
+      inline bool operator>( const SoAIterator<VT2>& rhs ) const noexcept { return index_ > rhs.index_; }
+
+      template< typename VT2 >
+      inline bool operator<=( const SoAIterator<VT2>& rhs ) const noexcept { return index_ <= rhs.index_; }
+
+      template< typename VT2 >
+      inline bool operator>=( const SoAIterator<VT2>& rhs ) const noexcept { return index_ >= rhs.index_; }
+
+      template< typename VT2 >
+      inline DifferenceType operator-( const SoAIterator<VT2>& rhs ) const noexcept { return index_ - rhs.index_; }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      VT*       value_;  //!< Pointer to the current value.
+      const IT* index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      template< typename VT2 > friend class SoAIterator;
+      friend class CompressedSoAMatrix;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = CompressedSoAMatrix<Type,SO,IT>;   //!< Type of this CompressedSoAMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;             //!< Base type of this CompressedSoAMatrix instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedSoAMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedSoAMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the compressed matrix elements.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;           //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                       //!< Reference to a constant compressed matrix value.
+   using Iterator       = SoAIterator<Type>;                 //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type>;           //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a CompressedSoAMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedSoAMatrix<NewType,SO,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a CompressedSoAMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = CompressedSoAMatrix<Type,SO,IT>;  //!< The type of the other CompressedSoAMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline CompressedSoAMatrix();
+   explicit inline CompressedSoAMatrix( size_t m, size_t n );
+   explicit inline CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros );
+   explicit        CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   explicit inline CompressedSoAMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline CompressedSoAMatrix( const CompressedSoAMatrix& sm );
+   inline CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~CompressedSoAMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   inline Type*          values ( size_t i ) noexcept;
+   inline const Type*    values ( size_t i ) const noexcept;
+
+   using Storage::indices;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline CompressedSoAMatrix& operator=( initializer_list< initializer_list<Type> > list );
+   inline CompressedSoAMatrix& operator=( const CompressedSoAMatrix& rhs );
+   inline CompressedSoAMatrix& operator=( CompressedSoAMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline CompressedSoAMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using Storage::rows;
+   using Storage::columns;
+   using Storage::capacity;
+   using Storage::nonZeros;
+   using Storage::reset;
+   using Storage::clear;
+   using Storage::resize;
+
+   inline void reserve( size_t nonzeros );
+   inline void reserve( size_t i, size_t nonzeros );
+   inline void trim   ();
+   inline void trim   ( size_t i );
+   inline void shrinkToFit();
+   inline void swap( CompressedSoAMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j, const Type& value );
+   inline Iterator insert( size_t i, size_t j, const Type& value );
+   inline void     append( size_t i, size_t j, const Type& value, bool check=false );
+
+   using Storage::finalize;
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t i, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline CompressedSoAMatrix& transpose();
+   inline CompressedSoAMatrix& ctranspose();
+
+   template< typename Other > inline CompressedSoAMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using Storage::majorSize;
+   using Storage::minorSize;
+   using Storage::extendCapacity;
+   using Storage::lowerOffset;
+   using Storage::upperOffset;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t k, size_t l, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   using Storage::m_;
+   using Storage::n_;
+   using Storage::capacity_;
+   using Storage::indices_;
+   using Storage::begin_;
+   using Storage::end_;
+
+   Type* values_;  //!< The values of all non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type CompressedSoAMatrix<Type,SO,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix()
+   : Storage()           // The row/column offsets and the index array
+   , values_( nullptr )  // The values of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n )
+   : Storage( m, n )     // The row/column offsets and the index array
+   , values_( nullptr )  // The values of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and will have at least the capacity for
+// \a nonzeros non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, size_t nonzeros )
+   : Storage( m, n, nonzeros )               // The row/column offsets and the index array
+   , values_( allocate<Type>( capacity_ ) )  // The values of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : Storage( m, n, nonzeros )               // The row/column offsets and the index array
+   , values_( allocate<Type>( capacity_ ) )  // The values of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list. The matrix is sized according to the size of the initializer
+// list and all its elements are initialized by the non-zero values of the given initializer
+// list. Missing values are initialized as default (as e.g. the value 6 in the example).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( initializer_list< initializer_list<Type> > list )
+   : CompressedSoAMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
+{
+   if( !SO )
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : list )
+      {
+         size_t j( 0UL );
+
+         for( const Type& element : rowList ) {
+            if( !isDefault<strict>( element ) )
+               append( i, j, element );
+            ++j;
+         }
+
+         finalize( i );
+         ++i;
+      }
+   }
+   else
+   {
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         size_t i( 0UL );
+
+         for( const auto& rowList : list ) {
+            if( j < rowList.size() && !isDefault<strict>( rowList.begin()[j] ) )
+               append( i, j, rowList.begin()[j] );
+            ++i;
+         }
+
+         finalize( j );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for CompressedSoAMatrix.
+//
+// \param sm Compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const CompressedSoAMatrix& sm )
+   : Storage( sm )                           // The row/column offsets and the index array
+   , values_( allocate<Type>( capacity_ ) )  // The values of all non-zero elements
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      std::copy( sm.values_+sm.begin_[k], sm.values_+sm.end_[k], values_+begin_[k] );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for CompressedSoAMatrix.
+//
+// \param sm The compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( CompressedSoAMatrix&& sm ) noexcept
+   : Storage( std::move( sm ) )  // The row/column offsets and the index array
+   , values_( sm.values_ )       // The values of all non-zero elements
+{
+   sm.values_ = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const DenseMatrix<MT,SO2>& dm )
+   : CompressedSoAMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>::CompressedSoAMatrix( const SparseMatrix<MT,SO2>& sm )
+   : CompressedSoAMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   using blaze::assign;
+
+   assign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for CompressedSoAMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>::~CompressedSoAMatrix()
+{
+   deallocate( values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case
+// the compressed matrix does not yet store an element at position (\a i,\a j) , a new element
+// is inserted into the compressed matrix. Note that this function only performs an index check
+// in case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to
+// perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Reference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos == end_[k] || indices_[pos] != l )
+      return zero_;
+   else
+      return values_[pos];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Reference
+   CompressedSoAMatrix<Type,SO,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstReference
+   CompressedSoAMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return Iterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return Iterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function provides direct access to the contiguously stored values of the non-zero
+// elements of row/column \a i. The number of accessible values is given by nonZeros(i).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline Type* CompressedSoAMatrix<Type,SO,IT>::values( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return values_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline const Type* CompressedSoAMatrix<Type,SO,IT>::values( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid compressed matrix row/column access index" );
+   return values_ + begin_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+//
+// The matrix is resized according to the given initializer list and all its elements are
+// assigned the values from the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   CompressedSoAMatrix tmp( list );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for CompressedSoAMatrix.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const CompressedSoAMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   CompressedSoAMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for CompressedSoAMatrix.
+//
+// \param rhs The compressed matrix to be moved into this instance.
+// \return Reference to the assigned compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( CompressedSoAMatrix&& rhs ) noexcept
+{
+   deallocate( values_ );
+
+   Storage::operator=( std::move( rhs ) );
+   values_ = rhs.values_;
+
+   rhs.values_ = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity() ) {
+      CompressedSoAMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      assign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   addAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the matrix.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO2 >     // Storage order of the right-hand side matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   subAssign( *this, ~rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::schurAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      CompressedSoAMatrix tmp( *this % (~rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<MT> tmp( ~rhs );
+      schurAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline CompressedSoAMatrix<Type,SO,IT>&
+   CompressedSoAMatrix<Type,SO,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompressedSoAMatrix tmp( *this % (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed matrix.
+//
+// \param nonzeros The new minimum capacity of the compressed matrix.
+// \return void
+//
+// This function increases the capacity of the compressed matrix to at least \a nonzeros
+// elements. The current values of the matrix elements and the individual capacities of the
+// matrix rows/columns are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity_ )
+      Storage::reserveElements( nonzeros, values_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the compressed matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the compressed matrix to at least
+// \a nonzeros elements. The current values of the compressed matrix and all other individual
+// row/column capacities are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   Storage::reserveElements( i, nonzeros, values_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::trim()
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k )
+      trim( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the compressed matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::trim( size_t i )
+{
+   Storage::trimElements( i, values_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      CompressedSoAMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sparse matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::swap( CompressedSoAMatrix& sm ) noexcept
+{
+   using std::swap;
+
+   Storage::swap( sm );
+   swap( values_, sm.values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      values_[pos] = value;
+      return Iterator( values_+pos, indices_+pos );
+   }
+   else return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the compressed matrix already contains an element with row index
+// \a i and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, k, l, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The offset of the new element.
+// \param k The index of the row/column of the new element.
+// \param l The index of the new element within row/column \a k.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::insert( size_t pos, size_t k, size_t l, const Type& value )
+{
+   Storage::insertElement( pos, k, l, values_ );
+
+   values_[pos] = value;
+
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the compressed matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[k] < end_[majorSize()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[k]] = value;
+
+   if( !check || !isDefault<strict>( values_[end_[k]] ) ) {
+      indices_[end_[k]] = l;
+      ++end_[k];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end( SO ? j : i ) )
+      erase( SO ? j : i, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid compressed matrix iterator" );
+
+   if( pos != end(i) ) {
+      const size_t offset( pos.index_ - indices_ );
+      Storage::eraseElements( i, offset, offset+1UL, values_ );
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t ofirst( first.index_ - indices_ );
+      const size_t olast ( last.index_  - indices_ );
+      Storage::eraseElements( i, ofirst, olast, values_ );
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( Pred predicate )
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      erase( k, begin(k), end(k), predicate );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed matrix.
+//
+// \param i The row/column index of the elements to be erased.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed matrix.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure.
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Index type
+template< typename Pred >  // Type of the unary predicate
+inline void CompressedSoAMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid compressed matrix iterator" );
+
+   const size_t ofirst( first.index_ - indices_ );
+   const size_t olast ( last.index_  - indices_ );
+
+   size_t pos( ofirst );
+
+   for( size_t k=ofirst; k<olast; ++k ) {
+      if( !predicate( const_cast<const Type&>( values_[k] ) ) ) {
+         if( pos != k ) {
+            values_ [pos] = std::move( values_[k] );
+            indices_[pos] = indices_[k];
+         }
+         ++pos;
+      }
+   }
+
+   Storage::eraseElements( i, pos, olast, values_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the compressed
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return Iterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return ConstIterator( values_+pos, indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   const size_t pos( SO ? lowerOffset( j, i ) : lowerOffset( i, j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t pos( SO ? lowerOffset( j, i ) : lowerOffset( i, j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::Iterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const size_t pos( SO ? upperOffset( j, i ) : upperOffset( i, j ) );
+   return Iterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename CompressedSoAMatrix<Type,SO,IT>::ConstIterator
+   CompressedSoAMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t pos( SO ? upperOffset( j, i ) : upperOffset( i, j ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::transpose()
+{
+   CompressedSoAMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::ctranspose()
+{
+   CompressedSoAMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the compressed matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the scalar value
+inline CompressedSoAMatrix<Type,SO,IT>& CompressedSoAMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k )
+      for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+         values_[pos] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool CompressedSoAMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool CompressedSoAMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( majorSize() );
+   const size_t N( minorSize() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   for( size_t k=0UL; k<M; ++k )
+      begin_[k+1UL] = end_[k] = 0UL;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<M; ++k )
+   {
+      begin_[k] = end_[k] = nonzeros;
+
+      for( size_t l=0UL; l<N; ++l )
+      {
+         if( nonzeros == capacity_ ) {
+            Storage::reserveElements( extendCapacity(), values_ );
+         }
+
+         values_[nonzeros] = ( SO ? (~rhs)(l,k) : (~rhs)(k,l) );
+
+         if( !isDefault<strict>( values_[nonzeros] ) ) {
+            indices_[nonzeros] = l;
+            ++end_[k];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[M] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t M( majorSize() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<M; ++k )
+   {
+      begin_[k] = nonzeros;
+
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         values_ [nonzeros] = element->value();
+         indices_[nonzeros] = element->index();
+         ++nonzeros;
+      }
+
+      end_[k] = nonzeros;
+   }
+
+   begin_[M] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t M( majorSize() );
+   const size_t N( minorSize() );
+
+   if( M == 0UL )
+      return;
+
+   std::fill( end_, end_+M, 0UL );
+
+   // Counting the number of elements per row/column
+   for( size_t l=0UL; l<N; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element )
+         ++end_[element->index()];
+   }
+
+   // Calculating the row/column offsets
+   begin_[0UL] = 0UL;
+   for( size_t k=0UL; k<M; ++k ) {
+      begin_[k+1UL] = begin_[k] + end_[k];
+      end_[k] = begin_[k];
+   }
+
+   // Scattering the elements
+   for( size_t l=0UL; l<N; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element ) {
+         const size_t pos( end_[element->index()]++ );
+         values_ [pos] = element->value();
+         indices_[pos] = l;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   CompressedSoAMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void CompressedSoAMatrix<Type,SO,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( MT );
+
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k )
+      for( size_t pos=begin_[k]; pos<end_[k]; ++pos )
+         values_[pos] *= ( SO ? (~rhs)(indices_[pos],k) : (~rhs)(k,indices_[pos]) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPRESSEDSOAMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name CompressedSoAMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+void reset( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+void clear( CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< bool RF, typename Type, bool SO, typename IT >
+bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+bool isIntact( const CompressedSoAMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( CompressedSoAMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup compressed_soa_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed matrix are intact.
+// \ingroup compressed_soa_matrix
+//
+// \param m The compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const CompressedSoAMatrix<Type,SO,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup compressed_soa_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( CompressedSoAMatrix<Type,SO,IT>& a, CompressedSoAMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< CompressedSoAMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< CompressedSoAMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STORAGEINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct StorageIndex< CompressedSoAMatrix<T,SO,IT> >
+{
+   using Type = IT;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/DenseVector.h>
@@ -77,6 +78,7 @@
 #include <blaze/math/typetraits/IsSparseMatrix.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/math/typetraits/LowType.h>
+#include <blaze/math/typetraits/StorageIndex.h>
 #include <blaze/math/typetraits/TransposeFlag.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -92,6 +94,7 @@
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsFloatingPoint.h>
 #include <blaze/util/typetraits/IsIntegral.h>
@@ -115,11 +118,12 @@ namespace blaze {
 // \ingroup compressed_vector
 //
 // The CompressedVector class is the representation of an arbitrarily sized sparse vector,
-// which stores only non-zero elements of arbitrary type. The type of the elements and the
-// transpose flag of the vector can be specified via the two template parameters:
+// which stores only non-zero elements of arbitrary type. The type of the elements, the
+// transpose flag of the vector, and the type of the stored indices can be specified via the
+// three template parameters:
 
    \code
-   template< typename Type, bool TF >
+   template< typename Type, bool TF, typename IT >
    class CompressedVector;
    \endcode
 
@@ -127,6 +131,11 @@ namespace blaze {
 //          non-cv-qualified, non-reference, non-pointer element type.
 //  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
 //          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - IT  : specifies the unsigned integral type used to store the indices of the non-zero
+//          elements. The default value is \c size_t. A smaller index type (as for instance
+//          \c uint32_t) reduces the memory footprint of the vector, but limits its size to
+//          the range of the index type. Any attempt to create or resize a vector beyond this
+//          range results in a \a std::invalid_argument exception.
 //
 // Inserting/accessing elements in a compressed vector can be done by several alternative
 // functions. The following example demonstrates all options:
@@ -202,14 +211,15 @@ namespace blaze {
    \endcode
 */
 template< typename Type                     // Data type of the vector
-        , bool TF = defaultTransposeFlag >  // Transpose flag
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT = size_t >            // Index type
 class CompressedVector
-   : public SparseVector< CompressedVector<Type,TF>, TF >
+   : public SparseVector< CompressedVector<Type,TF,IT>, TF >
 {
  private:
    //**Type definitions****************************************************************************
-   using ElementBase  = ValueIndexPair<Type>;  //!< Base class for the compressed vector element.
-   using IteratorBase = ElementBase*;          //!< Iterator over non-constant base elements.
+   using ElementBase  = ValueIndexPair<Type,IT>;  //!< Base class for the compressed vector element.
+   using IteratorBase = ElementBase*;             //!< Iterator over non-constant base elements.
    //**********************************************************************************************
 
    //**Private class Element***********************************************************************
@@ -285,17 +295,17 @@ class CompressedVector
 
  public:
    //**Type definitions****************************************************************************
-   using This           = CompressedVector<Type,TF>;   //!< Type of this CompressedVector instance.
-   using BaseType       = SparseVector<This,TF>;       //!< Base type of this CompressedVector instance.
-   using ResultType     = This;                        //!< Result type for expression template evaluations.
-   using TransposeType  = CompressedVector<Type,!TF>;  //!< Transpose type for expression template evaluations.
-   using ElementType    = Type;                        //!< Type of the compressed vector elements.
-   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
-   using CompositeType  = const CompressedVector&;     //!< Data type for composite expression templates.
-   using Reference      = VectorAccessProxy<This>;     //!< Reference to a non-constant vector value.
-   using ConstReference = const Type&;                 //!< Reference to a constant vector value.
-   using Iterator       = Element*;                    //!< Iterator over non-constant elements.
-   using ConstIterator  = const Element*;              //!< Iterator over constant elements.
+   using This           = CompressedVector<Type,TF,IT>;   //!< Type of this CompressedVector instance.
+   using BaseType       = SparseVector<This,TF>;          //!< Base type of this CompressedVector instance.
+   using ResultType     = This;                           //!< Result type for expression template evaluations.
+   using TransposeType  = CompressedVector<Type,!TF,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the compressed vector elements.
+   using ReturnType     = const Type&;                    //!< Return type for expression template evaluations.
+   using CompositeType  = const CompressedVector&;        //!< Data type for composite expression templates.
+   using Reference      = VectorAccessProxy<This>;        //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                    //!< Reference to a constant vector value.
+   using Iterator       = Element*;                       //!< Iterator over non-constant elements.
+   using ConstIterator  = const Element*;                 //!< Iterator over constant elements.
    //**********************************************************************************************
 
    //**Rebind struct definition********************************************************************
@@ -303,7 +313,7 @@ class CompressedVector
    */
    template< typename NewType >  // Data type of the other vector
    struct Rebind {
-      using Other = CompressedVector<NewType,TF>;  //!< The type of the other CompressedVector.
+      using Other = CompressedVector<NewType,TF,IT>;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -312,7 +322,7 @@ class CompressedVector
    */
    template< size_t NewN >  // Number of elements of the other vector
    struct Resize {
-      using Other = CompressedVector<Type,TF>;  //!< The type of the other CompressedVector.
+      using Other = CompressedVector<Type,TF,IT>;  //!< The type of the other CompressedVector.
    };
    //**********************************************************************************************
 
@@ -328,7 +338,7 @@ class CompressedVector
    /*!\name Constructors */
    //@{
    explicit inline CompressedVector() noexcept;
-   explicit inline CompressedVector( size_t size ) noexcept;
+   explicit inline CompressedVector( size_t size );
    explicit inline CompressedVector( size_t size, size_t nonzeros );
    explicit inline CompressedVector( initializer_list<Type> list );
 
@@ -462,6 +472,8 @@ class CompressedVector
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
+   static inline size_t checkIndexRange( size_t n );
+
    inline size_t       extendCapacity() const noexcept;
    inline Iterator     castDown( IteratorBase it ) const noexcept;
    inline IteratorBase castUp  ( Iterator     it ) const noexcept;
@@ -509,8 +521,9 @@ class CompressedVector
 //=================================================================================================
 
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-const Type CompressedVector<Type,TF>::zero_{};
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+const Type CompressedVector<Type,TF,IT>::zero_{};
 
 
 
@@ -525,8 +538,9 @@ const Type CompressedVector<Type,TF>::zero_{};
 /*!\brief The default constructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector() noexcept
    : size_    ( 0UL )      // The current size/dimension of the compressed vector
    , capacity_( 0UL )      // The maximum capacity of the compressed vector
    , begin_   ( nullptr )  // Pointer to the first non-zero element of the compressed vector
@@ -541,12 +555,13 @@ inline CompressedVector<Type,TF>::CompressedVector() noexcept
 // \param n The size of the vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
-   : size_    ( n   )      // The current size/dimension of the compressed vector
-   , capacity_( 0UL )      // The maximum capacity of the compressed vector
-   , begin_   ( nullptr )  // Pointer to the first non-zero element of the compressed vector
-   , end_     ( nullptr )  // Pointer to the last non-zero element of the compressed vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n )
+   : size_    ( checkIndexRange( n ) )  // The current size/dimension of the compressed vector
+   , capacity_( 0UL )                   // The maximum capacity of the compressed vector
+   , begin_   ( nullptr )               // Pointer to the first non-zero element of the compressed vector
+   , end_     ( nullptr )               // Pointer to the last non-zero element of the compressed vector
 {}
 //*************************************************************************************************
 
@@ -558,9 +573,10 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n ) noexcept
 // \param nonzeros The number of expected non-zero elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
-   : size_    ( n )                               // The current size/dimension of the compressed vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( size_t n, size_t nonzeros )
+   : size_    ( checkIndexRange( n ) )            // The current size/dimension of the compressed vector
    , capacity_( nonzeros )                        // The maximum capacity of the compressed vector
    , begin_   ( allocate<Element>( capacity_ ) )  // Pointer to the first non-zero element of the compressed vector
    , end_     ( begin_ )                          // Pointer to the last non-zero element of the compressed vector
@@ -584,8 +600,9 @@ inline CompressedVector<Type,TF>::CompressedVector( size_t n, size_t nonzeros )
 // initialized by the non-zero elements of the given initializer list.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( initializer_list<Type> list )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( initializer_list<Type> list )
    : CompressedVector( list.size(), blaze::nonZeros( list ) )
 {
    size_t i( 0UL );
@@ -608,8 +625,9 @@ inline CompressedVector<Type,TF>::CompressedVector( initializer_list<Type> list
 // and in order to enable/facilitate NRV optimization.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( const CompressedVector& sv )
    : CompressedVector( sv.size_, sv.nonZeros() )
 {
    end_ = begin_ + capacity_;
@@ -624,8 +642,9 @@ inline CompressedVector<Type,TF>::CompressedVector( const CompressedVector& sv )
 // \param sv The compressed vector to be moved into this instance.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::CompressedVector( CompressedVector&& sv ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::CompressedVector( CompressedVector&& sv ) noexcept
    : size_    ( sv.size_ )      // The current size/dimension of the compressed vector
    , capacity_( sv.capacity_ )  // The maximum capacity of the compressed vector
    , begin_   ( sv.begin_ )     // Pointer to the first non-zero element of the compressed vector
@@ -645,9 +664,10 @@ inline CompressedVector<Type,TF>::CompressedVector( CompressedVector&& sv ) noex
 // \param dv Dense vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign dense vector
-inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
+inline CompressedVector<Type,TF,IT>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (~dv).size() )
 {
    using blaze::assign;
@@ -663,9 +683,10 @@ inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv
 // \param sv Sparse vector to be copied.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the foreign sparse vector
-inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
+inline CompressedVector<Type,TF,IT>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (~sv).size(), (~sv).nonZeros() )
 {
    using blaze::assign;
@@ -687,8 +708,9 @@ inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& s
 /*!\brief The destructor for CompressedVector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>::~CompressedVector()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>::~CompressedVector()
 {
    deallocate( begin_ );
 }
@@ -715,9 +737,10 @@ inline CompressedVector<Type,TF>::~CompressedVector()
 // vector are the begin() and end() functions.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::operator[]( size_t index ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Reference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index ) noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -733,9 +756,10 @@ inline typename CompressedVector<Type,TF>::Reference
 // \return Reference to the accessed value.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::operator[]( size_t index ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstReference
+   CompressedVector<Type,TF,IT>::operator[]( size_t index ) const noexcept
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -762,9 +786,10 @@ inline typename CompressedVector<Type,TF>::ConstReference
 // performs a check of the given access index.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Reference
-   CompressedVector<Type,TF>::at( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Reference
+   CompressedVector<Type,TF,IT>::at( size_t index )
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
@@ -785,9 +810,10 @@ inline typename CompressedVector<Type,TF>::Reference
 // access indices.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstReference
-   CompressedVector<Type,TF>::at( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstReference
+   CompressedVector<Type,TF,IT>::at( size_t index ) const
 {
    if( index >= size_ ) {
       BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
@@ -803,8 +829,9 @@ inline typename CompressedVector<Type,TF>::ConstReference
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::begin() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::begin() noexcept
 {
    return Iterator( begin_ );
 }
@@ -817,9 +844,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::b
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::begin() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::begin() const noexcept
 {
    return ConstIterator( begin_ );
 }
@@ -832,9 +860,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator to the first non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::cbegin() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::cbegin() const noexcept
 {
    return ConstIterator( begin_ );
 }
@@ -847,8 +876,9 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::end() noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::end() noexcept
 {
    return Iterator( end_ );
 }
@@ -861,9 +891,10 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::e
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::end() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::end() const noexcept
 {
    return ConstIterator( end_ );
 }
@@ -876,9 +907,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // \return Iterator just past the last non-zero element of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::cend() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::cend() const noexcept
 {
    return ConstIterator( end_ );
 }
@@ -910,9 +942,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // assigned the non-zero values from the given initializer list.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( initializer_list<Type> list )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( initializer_list<Type> list )
 {
    using blaze::nonZeros;
 
@@ -942,9 +975,10 @@ inline CompressedVector<Type,TF>&
 // as a copy of this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const CompressedVector& rhs )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const CompressedVector& rhs )
 {
    using std::swap;
 
@@ -978,9 +1012,10 @@ inline CompressedVector<Type,TF>&
 // \return Reference to the assigned compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( CompressedVector&& rhs ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( CompressedVector&& rhs ) noexcept
 {
    deallocate( begin_ );
 
@@ -1009,10 +1044,11 @@ inline CompressedVector<Type,TF>&
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1021,7 +1057,7 @@ inline CompressedVector<Type,TF>&
       swap( tmp );
    }
    else {
-      size_ = (~rhs).size();
+      size_ = checkIndexRange( (~rhs).size() );
       end_  = begin_;
       assign( *this, ~rhs );
    }
@@ -1041,10 +1077,11 @@ inline CompressedVector<Type,TF>&
 // this vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator=( const SparseVector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1053,7 +1090,7 @@ inline CompressedVector<Type,TF>&
       swap( tmp );
    }
    else {
-      size_ = (~rhs).size();
+      size_ = checkIndexRange( (~rhs).size() );
       end_  = begin_;
       assign( *this, ~rhs );
    }
@@ -1074,9 +1111,10 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator+=( const Vector<VT,TF>& rhs )
 {
    using blaze::addAssign;
 
@@ -1102,9 +1140,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator-=( const Vector<VT,TF>& rhs )
 {
    using blaze::subAssign;
 
@@ -1131,10 +1170,11 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const V
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator*=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator*=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::multAssign;
 
@@ -1168,10 +1208,11 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>&
-   CompressedVector<Type,TF>::operator*=( const SparseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>&
+   CompressedVector<Type,TF,IT>::operator*=( const SparseVector<VT,TF>& rhs )
 {
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
@@ -1196,9 +1237,10 @@ inline CompressedVector<Type,TF>&
 // is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator/=( const DenseVector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator/=( const DenseVector<VT,TF>& rhs )
 {
    using blaze::divAssign;
 
@@ -1232,9 +1274,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator/=( const D
 // exception is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side vector
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator%=( const Vector<VT,TF>& rhs )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::operator%=( const Vector<VT,TF>& rhs )
 {
    using blaze::assign;
 
@@ -1274,8 +1317,9 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator%=( const V
 // \return The size of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::size() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::size() const noexcept
 {
    return size_;
 }
@@ -1288,8 +1332,9 @@ inline size_t CompressedVector<Type,TF>::size() const noexcept
 // \return The capacity of the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::capacity() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::capacity() const noexcept
 {
    return capacity_;
 }
@@ -1305,8 +1350,9 @@ inline size_t CompressedVector<Type,TF>::capacity() const noexcept
 // compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::nonZeros() const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::nonZeros() const
 {
    return end_ - begin_;
 }
@@ -1319,8 +1365,9 @@ inline size_t CompressedVector<Type,TF>::nonZeros() const
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::reset()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::reset()
 {
    end_ = begin_;
 }
@@ -1335,8 +1382,9 @@ inline void CompressedVector<Type,TF>::reset()
 // After the clear() function, the size of the compressed vector is 0.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::clear()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::clear()
 {
    size_ = 0UL;
    end_  = begin_;
@@ -1359,9 +1407,12 @@ inline void CompressedVector<Type,TF>::clear()
 // \a preserve flag can be set to \a true.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::resize( size_t n, bool preserve )
 {
+   checkIndexRange( n );
+
    if( preserve ) {
       end_ = lowerBound( n );
    }
@@ -1384,8 +1435,9 @@ inline void CompressedVector<Type,TF>::resize( size_t n, bool preserve )
 // current values of the vector elements are preserved.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-void CompressedVector<Type,TF>::reserve( size_t n )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+void CompressedVector<Type,TF,IT>::reserve( size_t n )
 {
    using std::swap;
 
@@ -1415,8 +1467,9 @@ void CompressedVector<Type,TF>::reserve( size_t n )
 // and references to elements of this vector are invalidated.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::shrinkToFit()
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::shrinkToFit()
 {
    if( nonZeros() < capacity_ ) {
       CompressedVector( *this ).swap( *this );
@@ -1432,8 +1485,9 @@ inline void CompressedVector<Type,TF>::shrinkToFit()
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::swap( CompressedVector& sv ) noexcept
 {
    using std::swap;
 
@@ -1445,6 +1499,30 @@ inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Checking whether the given size can be represented by the index type.
+//
+// \param n The size of the vector.
+// \return The given size.
+// \exception std::invalid_argument Size exceeds the index type.
+//
+// This function checks whether all indices of a vector of size \a n can be stored in the index
+// type \a IT of the vector. In case they cannot, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::checkIndexRange( size_t n )
+{
+   if( n > std::numeric_limits<IT>::max() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Size exceeds the index type" );
+   }
+
+   return n;
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Calculating a new vector capacity.
 //
@@ -1454,8 +1532,9 @@ inline void CompressedVector<Type,TF>::swap( CompressedVector& sv ) noexcept
 // vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline size_t CompressedVector<Type,TF>::extendCapacity() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline size_t CompressedVector<Type,TF,IT>::extendCapacity() const noexcept
 {
    using blaze::max;
    using blaze::min;
@@ -1480,9 +1559,10 @@ inline size_t CompressedVector<Type,TF>::extendCapacity() const noexcept
 // derived elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::castDown( IteratorBase it ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::castDown( IteratorBase it ) const noexcept
 {
    return static_cast<Iterator>( it );
 }
@@ -1498,9 +1578,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // to base elements.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::IteratorBase
-   CompressedVector<Type,TF>::castUp( Iterator it ) const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::IteratorBase
+   CompressedVector<Type,TF,IT>::castUp( Iterator it ) const noexcept
 {
    return static_cast<IteratorBase>( it );
 }
@@ -1527,9 +1608,10 @@ inline typename CompressedVector<Type,TF>::IteratorBase
 // the given \a value is inserted.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::set( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::set( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1557,9 +1639,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // a \a std::invalid_argument exception is thrown.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( size_t index, const Type& value )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1584,9 +1667,10 @@ typename CompressedVector<Type,TF>::Iterator
 // \exception std::invalid_argument Invalid compressed vector access index.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::insert( Iterator pos, size_t index, const Type& value )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::insert( Iterator pos, size_t index, const Type& value )
 {
    using std::swap;
 
@@ -1642,8 +1726,9 @@ typename CompressedVector<Type,TF>::Iterator
 // returned by the end() functions!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::append( size_t index, const Type& value, bool check )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::append( size_t index, const Type& value, bool check )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
    BLAZE_USER_ASSERT( nonZeros() < capacity(), "Not enough reserved capacity" );
@@ -1676,8 +1761,9 @@ inline void CompressedVector<Type,TF>::append( size_t index, const Type& value,
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void CompressedVector<Type,TF>::erase( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void CompressedVector<Type,TF,IT>::erase( size_t index )
 {
    BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
 
@@ -1697,9 +1783,10 @@ inline void CompressedVector<Type,TF>::erase( size_t index )
 // This function erases an element from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator pos )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::erase( Iterator pos )
 {
    BLAZE_USER_ASSERT( pos >= begin_ && pos <= end_, "Invalid compressed vector iterator" );
 
@@ -1720,9 +1807,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // This function erases a range of elements from the compressed vector.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::erase( Iterator first, Iterator last )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1757,10 +1845,11 @@ inline typename CompressedVector<Type,TF>::Iterator
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename Pred  // Type of the unary predicate
         , typename >     // Type restriction on the unary predicate
-inline void CompressedVector<Type,TF>::erase( Pred predicate )
+inline void CompressedVector<Type,TF,IT>::erase( Pred predicate )
 {
    end_ = castDown( std::remove_if( castUp( begin_ ), castUp( end_ ),
                                     [predicate=predicate]( const ElementBase& element ) {
@@ -1794,9 +1883,10 @@ inline void CompressedVector<Type,TF>::erase( Pred predicate )
 // with the same value. The attempt to use an impure predicate leads to undefined behavior!
 */
 template< typename Type    // Data type of the vector
-        , bool TF >        // Transpose flag
+        , bool TF          // Transpose flag
+        , typename IT >    // Index type
 template< typename Pred >  // Type of the unary predicate
-inline void CompressedVector<Type,TF>::erase( Iterator first, Iterator last, Pred predicate )
+inline void CompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last, Pred predicate )
 {
    BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
    BLAZE_USER_ASSERT( first >= begin_ && first <= end_, "Invalid compressed vector iterator" );
@@ -1834,8 +1924,9 @@ inline void CompressedVector<Type,TF>::erase( Iterator first, Iterator last, Pre
 // operations via the subscript operator, the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::find( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator CompressedVector<Type,TF,IT>::find( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).find( index ) );
 }
@@ -1856,8 +1947,9 @@ inline typename CompressedVector<Type,TF>::Iterator CompressedVector<Type,TF>::f
 // operations via the subscript operator, the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,TF>::find( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator CompressedVector<Type,TF,IT>::find( size_t index ) const
 {
    const ConstIterator pos( lowerBound( index ) );
    if( pos != end_ && pos->index_ == index )
@@ -1880,9 +1972,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator CompressedVector<Type,T
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::lowerBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).lowerBound( index ) );
 }
@@ -1902,9 +1995,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::lowerBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
 {
    return std::lower_bound( begin_, end_, index,
                             []( const Element& element, size_t i )
@@ -1928,9 +2022,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::Iterator
-   CompressedVector<Type,TF>::upperBound( size_t index )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::Iterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index )
 {
    return const_cast<Iterator>( const_cast<const This&>( *this ).upperBound( index ) );
 }
@@ -1950,9 +2045,10 @@ inline typename CompressedVector<Type,TF>::Iterator
 // the set() function or the insert() function!
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline typename CompressedVector<Type,TF>::ConstIterator
-   CompressedVector<Type,TF>::upperBound( size_t index ) const
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline typename CompressedVector<Type,TF,IT>::ConstIterator
+   CompressedVector<Type,TF,IT>::upperBound( size_t index ) const
 {
    return std::upper_bound( begin_, end_, index,
                             []( size_t i, const Element& element )
@@ -1989,9 +2085,10 @@ inline typename CompressedVector<Type,TF>::ConstIterator
    \endcode
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the scalar value
-inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other& scalar )
+inline CompressedVector<Type,TF,IT>& CompressedVector<Type,TF,IT>::scale( const Other& scalar )
 {
    for( auto element=begin_; element!=end_; ++element )
       element->value_ *= scalar;
@@ -2019,9 +2116,10 @@ inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::scale( const Other&
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const noexcept
+inline bool CompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2039,9 +2137,10 @@ inline bool CompressedVector<Type,TF>::canAlias( const Other* alias ) const noex
 // to optimize the evaluation.
 */
 template< typename Type     // Data type of the vector
-        , bool TF >         // Transpose flag
+        , bool TF           // Transpose flag
+        , typename IT >     // Index type
 template< typename Other >  // Data type of the foreign expression
-inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const noexcept
+inline bool CompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const noexcept
 {
    return static_cast<const void*>( this ) == static_cast<const void*>( alias );
 }
@@ -2059,8 +2158,9 @@ inline bool CompressedVector<Type,TF>::isAliased( const Other* alias ) const noe
 // vector).
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool CompressedVector<Type,TF>::canSMPAssign() const noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool CompressedVector<Type,TF,IT>::canSMPAssign() const noexcept
 {
    return false;
 }
@@ -2079,9 +2179,10 @@ inline bool CompressedVector<Type,TF>::canSMPAssign() const noexcept
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -2117,9 +2218,10 @@ inline void CompressedVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::assign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
    BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
@@ -2148,9 +2250,10 @@ inline void CompressedVector<Type,TF>::assign( const SparseVector<VT,TF>& rhs )
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const DenseVector<VT,TF>& rhs )
 {
    using AddType = AddTrait_t< This, ResultType_t<VT> >;
 
@@ -2179,9 +2282,10 @@ inline void CompressedVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::addAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2203,9 +2307,10 @@ inline void CompressedVector<Type,TF>::addAssign( const SparseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const DenseVector<VT,TF>& rhs )
 {
    using SubType = SubTrait_t< This, ResultType_t<VT> >;
 
@@ -2234,9 +2339,10 @@ inline void CompressedVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side sparse vector
-inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::subAssign( const SparseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2258,9 +2364,10 @@ inline void CompressedVector<Type,TF>::subAssign( const SparseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::multAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2285,9 +2392,10 @@ inline void CompressedVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs
 // assignment operator.
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
 template< typename VT >  // Type of the right-hand side dense vector
-inline void CompressedVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs )
+inline void CompressedVector<Type,TF,IT>::divAssign( const DenseVector<VT,TF>& rhs )
 {
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
@@ -2311,20 +2419,20 @@ inline void CompressedVector<Type,TF>::divAssign( const DenseVector<VT,TF>& rhs
 //*************************************************************************************************
 /*!\name CompressedVector operators */
 //@{
-template< typename Type, bool TF >
-void reset( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+void reset( CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-void clear( CompressedVector<Type,TF>& v );
+template< typename Type, bool TF, typename IT >
+void clear( CompressedVector<Type,TF,IT>& v );
 
-template< bool RF, typename Type, bool TF >
-bool isDefault( const CompressedVector<Type,TF>& v );
+template< bool RF, typename Type, bool TF, typename IT >
+bool isDefault( const CompressedVector<Type,TF,IT>& v );
 
-template< typename Type, bool TF >
-bool isIntact( const CompressedVector<Type,TF>& v ) noexcept;
+template< typename Type, bool TF, typename IT >
+bool isIntact( const CompressedVector<Type,TF,IT>& v ) noexcept;
 
-template< typename Type, bool TF >
-void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept;
+template< typename Type, bool TF, typename IT >
+void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) noexcept;
 //@}
 //*************************************************************************************************
 
@@ -2337,8 +2445,9 @@ void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void reset( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void reset( CompressedVector<Type,TF,IT>& v )
 {
    v.reset();
 }
@@ -2353,8 +2462,9 @@ inline void reset( CompressedVector<Type,TF>& v )
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void clear( CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void clear( CompressedVector<Type,TF,IT>& v )
 {
    v.clear();
 }
@@ -2387,8 +2497,9 @@ inline void clear( CompressedVector<Type,TF>& v )
 */
 template< bool RF        // Relaxation flag
         , typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isDefault( const CompressedVector<Type,TF>& v )
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isDefault( const CompressedVector<Type,TF,IT>& v )
 {
    return ( v.size() == 0UL );
 }
@@ -2414,8 +2525,9 @@ inline bool isDefault( const CompressedVector<Type,TF>& v )
    \endcode
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline bool isIntact( const CompressedVector<Type,TF>& v ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline bool isIntact( const CompressedVector<Type,TF,IT>& v ) noexcept
 {
    return ( v.nonZeros() <= v.capacity() );
 }
@@ -2431,8 +2543,9 @@ inline bool isIntact( const CompressedVector<Type,TF>& v ) noexcept
 // \return void
 */
 template< typename Type  // Data type of the vector
-        , bool TF >      // Transpose flag
-inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) noexcept
+        , bool TF        // Transpose flag
+        , typename IT >  // Index type
+inline void swap( CompressedVector<Type,TF,IT>& a, CompressedVector<Type,TF,IT>& b ) noexcept
 {
    a.swap( b );
 }
@@ -2449,8 +2562,8 @@ inline void swap( CompressedVector<Type,TF>& a, CompressedVector<Type,TF>& b ) n
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsResizable< CompressedVector<T,TF> >
+template< typename T, bool TF, typename IT >
+struct IsResizable< CompressedVector<T,TF,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2467,8 +2580,8 @@ struct IsResizable< CompressedVector<T,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T, bool TF >
-struct IsShrinkable< CompressedVector<T,TF> >
+template< typename T, bool TF, typename IT >
+struct IsShrinkable< CompressedVector<T,TF,IT> >
    : public TrueType
 {};
 /*! \endcond */
@@ -2477,6 +2590,25 @@ struct IsShrinkable< CompressedVector<T,TF> >
 
 
 
+//=================================================================================================
+//
+//  STORAGEINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct StorageIndex< CompressedVector<T,TF,IT> >
+{
+   using Type = IT;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ADDTRAIT SPECIALIZATIONS
@@ -2492,7 +2624,7 @@ struct AddTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< AddTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = CompressedVector< AddTrait_t<ET1,ET2>, TransposeFlag_v<T1>, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2515,7 +2647,7 @@ struct SubTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< SubTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = CompressedVector< SubTrait_t<ET1,ET2>, TransposeFlag_v<T1>, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2537,7 +2669,7 @@ struct MultTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
 
-   using Type = CompressedVector< MultTrait_t<ET1,T2>, TransposeFlag_v<T1> >;
+   using Type = CompressedVector< MultTrait_t<ET1,T2>, TransposeFlag_v<T1>, StorageIndex_t<T1> >;
 };
 
 template< typename T1, typename T2 >
@@ -2546,7 +2678,7 @@ struct MultTraitEval2< T1, T2
 {
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< MultTrait_t<T1,ET2>, TransposeFlag_v<T2> >;
+   using Type = CompressedVector< MultTrait_t<T1,ET2>, TransposeFlag_v<T2>, StorageIndex_t<T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -2558,7 +2690,10 @@ struct MultTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< MultTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using IT = StorageIndex_t< If_t< IsSparseVector_v<T1>, T1, T2 >
+                            , If_t< IsSparseVector_v<T2>, T2, T1 > >;
+
+   using Type = CompressedVector< MultTrait_t<ET1,ET2>, TransposeFlag_v<T1>, IT >;
 };
 
 template< typename T1, typename T2 >
@@ -2570,7 +2705,7 @@ struct MultTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< MultTrait_t<ET1,ET2>, false >;
+   using Type = CompressedVector< MultTrait_t<ET1,ET2>, false, StorageIndex_t<T1,T2> >;
 };
 
 template< typename T1, typename T2 >
@@ -2582,7 +2717,7 @@ struct MultTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< MultTrait_t<ET1,ET2>, true >;
+   using Type = CompressedVector< MultTrait_t<ET1,ET2>, true, StorageIndex_t<T1,T2> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2604,7 +2739,7 @@ struct DivTraitEval2< T1, T2
 {
    using ET1 = ElementType_t<T1>;
 
-   using Type = CompressedVector< DivTrait_t<ET1,T2>, TransposeFlag_v<T1> >;
+   using Type = CompressedVector< DivTrait_t<ET1,T2>, TransposeFlag_v<T1>, StorageIndex_t<T1> >;
 };
 
 template< typename T1, typename T2 >
@@ -2614,7 +2749,7 @@ struct DivTraitEval2< T1, T2
    using ET1 = ElementType_t<T1>;
    using ET2 = ElementType_t<T2>;
 
-   using Type = CompressedVector< DivTrait_t<ET1,ET2>, TransposeFlag_v<T1> >;
+   using Type = CompressedVector< DivTrait_t<ET1,ET2>, TransposeFlag_v<T1>, StorageIndex_t<T1> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2636,7 +2771,7 @@ struct UnaryMapTraitEval2< T, OP
 {
    using ET = ElementType_t<T>;
 
-   using Type = CompressedVector< MapTrait_t<ET,OP>, TransposeFlag_v<T> >;
+   using Type = CompressedVector< MapTrait_t<ET,OP>, TransposeFlag_v<T>, StorageIndex_t<T> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2652,10 +2787,10 @@ struct UnaryMapTraitEval2< T, OP
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct HighType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename IT, typename T2 >
+struct HighType< CompressedVector<T1,TF,IT>, CompressedVector<T2,TF,IT> >
 {
-   using Type = CompressedVector< typename HighType<T1,T2>::Type, TF >;
+   using Type = CompressedVector< typename HighType<T1,T2>::Type, TF, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2671,10 +2806,10 @@ struct HighType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-template< typename T1, bool TF, typename T2 >
-struct LowType< CompressedVector<T1,TF>, CompressedVector<T2,TF> >
+template< typename T1, bool TF, typename IT, typename T2 >
+struct LowType< CompressedVector<T1,TF,IT>, CompressedVector<T2,TF,IT> >
 {
-   using Type = CompressedVector< typename LowType<T1,T2>::Type, TF >;
+   using Type = CompressedVector< typename LowType<T1,T2>::Type, TF, IT >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2694,7 +2829,9 @@ template< typename VT, size_t I, size_t N >
 struct SubvectorTraitEval2< VT, I, N
                           , EnableIf_t< IsSparseVector_v<VT> > >
 {
-   using Type = CompressedVector< RemoveConst_t< ElementType_t<VT> >, TransposeFlag_v<VT> >;
+   using ET = RemoveConst_t< ElementType_t<VT> >;
+
+   using Type = CompressedVector< ET, TransposeFlag_v<VT>, StorageIndex_t<VT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2714,7 +2851,9 @@ template< typename VT, size_t N >
 struct ElementsTraitEval2< VT, N
                          , EnableIf_t< IsSparseVector_v<VT> > >
 {
-   using Type = CompressedVector< RemoveConst_t< ElementType_t<VT> >, TransposeFlag_v<VT> >;
+   using ET = RemoveConst_t< ElementType_t<VT> >;
+
+   using Type = CompressedVector< ET, TransposeFlag_v<VT>, StorageIndex_t<VT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2734,7 +2873,9 @@ template< typename MT, size_t I >
 struct RowTraitEval2< MT, I
                     , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedVector< RemoveConst_t< ElementType_t<MT> >, true >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedVector< ET, true, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2754,7 +2895,9 @@ template< typename MT, size_t I >
 struct ColumnTraitEval2< MT, I
                        , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedVector< RemoveConst_t< ElementType_t<MT> >, false >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedVector< ET, false, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -2774,7 +2917,9 @@ template< typename MT, ptrdiff_t I >
 struct BandTraitEval2< MT, I
                      , EnableIf_t< IsSparseMatrix_v<MT> > >
 {
-   using Type = CompressedVector< RemoveConst_t< ElementType_t<MT> >, defaultTransposeFlag >;
+   using ET = RemoveConst_t< ElementType_t<MT> >;
+
+   using Type = CompressedVector< ET, defaultTransposeFlag, StorageIndex_t<MT> >;
 };
 /*! \endcond */
 //*************************************************************************************************
@@ -44,9 +44,11 @@ namespace blaze {
 //
 //=================================================================================================
 
-template< typename, bool > class CompressedMatrix;
-template< typename, bool > class CompressedVector;
+template< typename, bool, typename > class CompressedMatrix;
+template< typename, bool, typename > class CompressedSoAMatrix;
+template< typename, bool, typename > class CompressedVector;
 template< typename, bool > class IdentityMatrix;
+template< typename, bool, typename > class PatternMatrix;
 template< typename, bool > class ZeroMatrix;
 template< typename, bool > class ZeroVector;
 
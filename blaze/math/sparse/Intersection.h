@@ -0,0 +1,390 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Intersection.h
+//  \brief Header file for the adaptive index intersection of sparse vectors and matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_INTERSECTION_H_
+#define _BLAZE_MATH_SPARSE_INTERSECTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INTERSECTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Ratio of the remaining non-zero elements of two sparse operands from which on the
+//        denser operand is searched via galloping.
+// \ingroup sparse
+*/
+constexpr ptrdiff_t gallopingRatio = 8L;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary helper struct for the detection of iterators over contiguous 32-bit indices.
+// \ingroup sparse
+//
+// This helper struct derives from TrueType in case the given iterator type provides direct
+// access to the contiguously stored 32-bit indices of the sparse range via an \a indices()
+// member function (as for instance the iterators of CompressedSoAMatrix and PatternMatrix with
+// a 32-bit index type). Otherwise it derives from FalseType.
+*/
+template< typename IteratorType, typename = void >
+struct HasSIMDIndices
+   : public FalseType
+{};
+
+template< typename IteratorType >
+struct HasSIMDIndices< IteratorType
+                     , EnableIf_t< IsSame_v< decltype( std::declval<IteratorType>().indices() )
+                                           , const uint32_t* > > >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Galloping (exponential) search for the first element with an index not smaller than
+//        the given index.
+// \ingroup sparse
+//
+// \param first Iterator to the first element of the sorted range (with an index smaller than
+//              \a index).
+// \param last Iterator one past the last element of the sorted range.
+// \param index The index to be searched for.
+// \return Iterator to the first element with an index not smaller than \a index.
+//
+// This function first determines a bracket of exponentially growing size that contains the
+// searched element and afterwards performs a binary search within this bracket. The search
+// requires \f$ O(\log d) \f$ steps, where \f$ d \f$ is the distance to the searched element.
+*/
+template< typename IteratorType >  // Type of the random access iterator
+inline IteratorType gallop( IteratorType first, IteratorType last, size_t index )
+{
+   const ptrdiff_t size( last - first );
+
+   ptrdiff_t low ( 0L );
+   ptrdiff_t high( 1L );
+
+   while( high < size && (first+high)->index() < index ) {
+      low  = high;
+      high = 2L*high;
+   }
+
+   if( high > size )
+      high = size;
+
+   while( high - low > 1L ) {
+      const ptrdiff_t mid( low + ( high - low ) / 2L );
+      if( (first+mid)->index() < index )
+         low = mid;
+      else
+         high = mid;
+   }
+
+   return first + high;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the search for the next common index of two sorted sparse
+//        ranges with random access iterators.
+// \ingroup sparse
+//
+// \param l Iterator into the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator into the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return \a true in case a common index has been found, \a false if one range is exhausted.
+//
+// In case one range is at least \a gallopingRatio times larger than the other one, the larger
+// range is searched via galloping search. Otherwise the two ranges are merged element by element.
+*/
+template< typename IteratorType1    // Type of the left-hand side iterator
+        , typename IteratorType2 >  // Type of the right-hand side iterator
+inline bool nextCommonIndexBackend( IteratorType1& l, IteratorType1 lend,
+                                    IteratorType2& r, IteratorType2 rend,
+                                    std::random_access_iterator_tag,
+                                    std::random_access_iterator_tag )
+{
+   IteratorType1 lit( l );
+   IteratorType2 rit( r );
+
+   const ptrdiff_t lsize( lend - lit );
+   const ptrdiff_t rsize( rend - rit );
+
+   bool found( false );
+
+   if( lsize > gallopingRatio * rsize )
+   {
+      while( lit != lend && rit != rend ) {
+         const size_t lindex( lit->index() );
+         const size_t rindex( rit->index() );
+         if( lindex < rindex ) lit = gallop( lit, lend, rindex );
+         else if( rindex < lindex ) ++rit;
+         else { found = true; break; }
+      }
+   }
+   else if( rsize > gallopingRatio * lsize )
+   {
+      while( lit != lend && rit != rend ) {
+         const size_t lindex( lit->index() );
+         const size_t rindex( rit->index() );
+         if( rindex < lindex ) rit = gallop( rit, rend, lindex );
+         else if( lindex < rindex ) ++lit;
+         else { found = true; break; }
+      }
+   }
+   else
+   {
+      for( ; lit!=lend; ++lit ) {
+         while( rit != rend && rit->index() < lit->index() ) ++rit;
+         if( rit == rend ) break;
+         if( rit->index() == lit->index() ) { found = true; break; }
+      }
+   }
+
+   l = lit;
+   r = rit;
+
+   return found;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the search for the next common index of two sorted sparse
+//        ranges with forward iterators.
+// \ingroup sparse
+//
+// \param l Iterator into the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator into the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return \a true in case a common index has been found, \a false if one range is exhausted.
+//
+// Forward iterators can only be moved element by element, therefore the two ranges are merged.
+*/
+template< typename IteratorType1    // Type of the left-hand side iterator
+        , typename IteratorType2    // Type of the right-hand side iterator
+        , typename Category1        // Iterator category of the left-hand side iterator
+        , typename Category2 >      // Iterator category of the right-hand side iterator
+inline bool nextCommonIndexBackend( IteratorType1& l, IteratorType1 lend,
+                                    IteratorType2& r, IteratorType2 rend,
+                                    Category1, Category2 )
+{
+   while( l != lend && r != rend ) {
+      if( l->index() < r->index() ) ++l;
+      else if( r->index() < l->index() ) ++r;
+      else return true;
+   }
+
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the search for the next common index of two sorted sparse
+//        ranges with contiguous 32-bit indices.
+// \ingroup sparse
+//
+// \param l Iterator into the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator into the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return \a true in case a common index has been found, \a false if one range is exhausted.
+//
+// In case both ranges contain a comparable number of elements, this function compares blocks of
+// four indices of both ranges at once by means of SSE2 instructions: each index of the left-hand
+// side block is compared to all four indices of the right-hand side block, which requires four
+// vector comparisons. In case no common index is found, the block with the smaller last index is
+// skipped. The remaining elements and skewed ranges are handled by the scalar backend.
+*/
+template< typename IteratorType1    // Type of the left-hand side iterator
+        , typename IteratorType2 >  // Type of the right-hand side iterator
+inline bool nextCommonIndexSIMD( IteratorType1& l, IteratorType1 lend,
+                                 IteratorType2& r, IteratorType2 rend )
+{
+#if BLAZE_SSE2_MODE
+   const ptrdiff_t lsize( lend - l );
+   const ptrdiff_t rsize( rend - r );
+
+   if( lsize <= gallopingRatio * rsize && rsize <= gallopingRatio * lsize )
+   {
+      const uint32_t* lit ( l.indices() );
+      const uint32_t* rit ( r.indices() );
+      const uint32_t* lstop( lend.indices() );
+      const uint32_t* rstop( rend.indices() );
+
+      while( lstop - lit >= 4L && rstop - rit >= 4L )
+      {
+         const __m128i a( _mm_loadu_si128( reinterpret_cast<const __m128i*>( lit ) ) );
+         const __m128i b( _mm_loadu_si128( reinterpret_cast<const __m128i*>( rit ) ) );
+
+         const __m128i b1( _mm_shuffle_epi32( b, _MM_SHUFFLE(0,3,2,1) ) );
+         const __m128i b2( _mm_shuffle_epi32( b, _MM_SHUFFLE(1,0,3,2) ) );
+         const __m128i b3( _mm_shuffle_epi32( b, _MM_SHUFFLE(2,1,0,3) ) );
+
+         const __m128i c0( _mm_or_si128( _mm_cmpeq_epi32( a, b  ), _mm_cmpeq_epi32( a, b1 ) ) );
+         const __m128i c1( _mm_or_si128( _mm_cmpeq_epi32( a, b2 ), _mm_cmpeq_epi32( a, b3 ) ) );
+         const __m128i cmp( _mm_or_si128( c0, c1 ) );
+
+         const int mask( _mm_movemask_ps( _mm_castsi128_ps( cmp ) ) );
+
+         if( mask != 0 ) {
+            ptrdiff_t k( 0L );
+            while( ( mask & ( 1 << k ) ) == 0 ) ++k;
+            l += ( lit - l.indices() ) + k;
+            r += ( rit - r.indices() );
+            while( r->index() < l->index() ) ++r;
+            return true;
+         }
+
+         if( lit[3] < rit[3] ) lit += 4L;
+         else rit += 4L;
+      }
+
+      l += ( lit - l.indices() );
+      r += ( rit - r.indices() );
+   }
+#endif
+
+   return nextCommonIndexBackend( l, lend, r, rend,
+                                  std::random_access_iterator_tag{},
+                                  std::random_access_iterator_tag{} );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves the two given iterators to the next common index of two sorted sparse ranges.
+// \ingroup sparse
+//
+// \param l Iterator into the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator into the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return \a true in case a common index has been found, \a false if one range is exhausted.
+//
+// This function adaptively intersects the indices of two sorted sparse ranges (as for instance
+// given by two sparse vectors or two rows of sparse matrices). In case both operands contain a
+// comparable number of non-zero elements, the two ranges are merged element by element. In
+// case one operand is considerably sparser than the other one and the denser operand provides
+// random access iterators, the denser operand is searched by means of galloping search, which
+// reduces the work from \f$ O(n_1+n_2) \f$ to \f$ O(n_1 \log(n_2/n_1)) \f$. In case both
+// operands provide contiguously stored 32-bit indices (as for instance CompressedSoAMatrix and
+// PatternMatrix with a 32-bit index type), the merge of the two ranges is vectorized by means
+// of SSE2 block comparisons. The typical use looks as follows:
+
+   \code
+   while( nextCommonIndex( l, lend, r, rend ) ) {
+      // ... Processing l->value() and r->value() at index l->index()
+      ++l;
+      ++r;
+   }
+   \endcode
+*/
+template< typename IteratorType1    // Type of the left-hand side iterator
+        , typename IteratorType2 >  // Type of the right-hand side iterator
+inline EnableIf_t< !HasSIMDIndices<IteratorType1>::value ||
+                   !HasSIMDIndices<IteratorType2>::value, bool >
+   nextCommonIndex( IteratorType1& l, IteratorType1 lend, IteratorType2& r, IteratorType2 rend )
+{
+   using Category1 = typename std::iterator_traits<IteratorType1>::iterator_category;
+   using Category2 = typename std::iterator_traits<IteratorType2>::iterator_category;
+
+   return nextCommonIndexBackend( l, lend, r, rend, Category1{}, Category2{} );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Moves the two given iterators to the next common index of two sorted sparse ranges
+//        with contiguous 32-bit indices.
+// \ingroup sparse
+//
+// \param l Iterator into the left-hand side range.
+// \param lend Iterator one past the last element of the left-hand side range.
+// \param r Iterator into the right-hand side range.
+// \param rend Iterator one past the last element of the right-hand side range.
+// \return \a true in case a common index has been found, \a false if one range is exhausted.
+*/
+template< typename IteratorType1    // Type of the left-hand side iterator
+        , typename IteratorType2 >  // Type of the right-hand side iterator
+inline EnableIf_t< HasSIMDIndices<IteratorType1>::value &&
+                   HasSIMDIndices<IteratorType2>::value, bool >
+   nextCommonIndex( IteratorType1& l, IteratorType1 lend, IteratorType2& r, IteratorType2 rend )
+{
+   return nextCommonIndexSIMD( l, lend, r, rend );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
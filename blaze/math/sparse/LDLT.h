@@ -0,0 +1,895 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/LDLT.h
+//  \brief Header file for the sparse LDLT decomposition
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_LDLT_H_
+#define _BLAZE_MATH_SPARSE_LDLT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/Ordering.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/StorageOrder.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Supernodal \f$ LDL^T \f$ decomposition of sparse symmetric matrices.
+// \ingroup sparse_matrix
+//
+// The SparseLDLT class template represents the \f$ LDL^T \f$ decomposition of a sparse symmetric
+// matrix \f$ A \f$. The decomposition is computed for the symmetrically permuted matrix
+
+                          \f[ P A P^T = L D L^T, \f]
+
+// where \f$ P \f$ is a fill-reducing permutation, \f$ L \f$ is a unit lower triangular matrix
+// and \f$ D \f$ is a diagonal matrix. The decomposition is computed in three phases:
+//
+//  - the minimum degree ordering of the sparsity pattern (see the minimumDegree() function),
+//  - the symbolic analysis, which computes the elimination tree, the structure of \f$ L \f$ and
+//    its partition into supernodes, i.e. groups of consecutive columns with identical structure,
+//  - the numeric factorization, which stores every supernode as dense panel and computes all
+//    updates between supernodes as well as the blocked factorization of each panel by means of
+//    dense vector and matrix operations.
+//
+// The first two phases only depend on the sparsity pattern of the matrix and are performed by
+// the analyze() function. Therefore they can be reused for any number of numeric factorizations
+// of matrices with the same pattern:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::SymmetricMatrix;
+
+   SymmetricMatrix< CompressedMatrix<double> > A;
+   DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   blaze::SparseLDLT<double> ldlt;
+   ldlt.analyze( A );  // Ordering and symbolic analysis
+
+   for( ... ) {
+      // ... Updating the values of A
+      ldlt.factorize( A );  // Numeric factorization
+      ldlt.solve( x, b );   // Solution of the linear system A*x=b
+   }
+   \endcode
+
+// The decomposition does not perform any pivoting. Therefore it is applicable to symmetric
+// positive definite and symmetric quasi-definite matrices. In case a zero pivot is encountered
+// during the numeric factorization, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+class SparseLDLT
+{
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = Type;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline SparseLDLT();
+
+   template< typename MT, bool SO >
+   explicit inline SparseLDLT( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Decomposition functions*********************************************************************
+   /*!\name Decomposition functions */
+   //@{
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A );
+
+   template< typename MT, bool SO >
+   void analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+   template< typename MT, bool SO >
+   void factorize( const SparseMatrix<MT,SO>& A );
+
+   template< typename VT1, typename VT2 >
+   void solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t                     size()         const noexcept;
+   inline size_t                     nonZeros()     const noexcept;
+   inline size_t                     supernodes()   const noexcept;
+   inline bool                       isFactorized() const noexcept;
+   inline const std::vector<size_t>& permutation()  const noexcept;
+   inline const DynamicVector<Type>& diagonal()     const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void lowerPattern( const SparseMatrix<MT,SO>& A, std::vector<size_t>& ptr,
+                      std::vector<size_t>& idx ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                  //!< The number of rows and columns of the analyzed matrix.
+   size_t nonzeros_;           //!< The number of non-zero elements of \f$ L \f$.
+   bool factorized_;           //!< \a true in case the numeric factorization has been computed.
+   std::vector<size_t> perm_;  //!< The fill-reducing permutation.
+   std::vector<size_t> pinv_;  //!< The inverse of the fill-reducing permutation.
+   std::vector<size_t> sptr_;  //!< The first column of each supernode.
+   std::vector<size_t> rptr_;  //!< Offsets of the row structure of each supernode.
+   std::vector<size_t> ridx_;  //!< The row structure of all supernodes.
+   std::vector<size_t> uptr_;  //!< Offsets of the updating supernodes of each supernode.
+   std::vector<size_t> uidx_;  //!< The updating supernodes of all supernodes.
+
+   std::vector< DynamicMatrix<Type,columnMajor> > panels_;  //!< The dense supernode panels of L.
+   DynamicVector<Type> diag_;                               //!< The diagonal matrix D.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SparseLDLT.
+//
+// The default constructor creates the decomposition of a \f$ 0 \times 0 \f$ matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline SparseLDLT<Type>::SparseLDLT()
+   : n_         ( 0UL )       // The number of rows and columns of the analyzed matrix
+   , nonzeros_  ( 0UL )       // The number of non-zero elements of L
+   , factorized_( false )     // Flag for the numeric factorization
+   , perm_      ()            // The fill-reducing permutation
+   , pinv_      ()            // The inverse of the fill-reducing permutation
+   , sptr_      ( 1UL, 0UL )  // The first column of each supernode
+   , rptr_      ( 1UL, 0UL )  // Offsets of the row structure of each supernode
+   , ridx_      ()            // The row structure of all supernodes
+   , uptr_      ( 1UL, 0UL )  // Offsets of the updating supernodes of each supernode
+   , uidx_      ()            // The updating supernodes of all supernodes
+   , panels_    ()            // The dense supernode panels of L
+   , diag_      ()            // The diagonal matrix D
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Analysis and factorization of the given sparse symmetric matrix.
+//
+// \param A The given sparse symmetric matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-symmetric matrix provided.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This constructor performs both the symbolic analysis and the numeric factorization of the
+// given sparse symmetric matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+inline SparseLDLT<Type>::SparseLDLT( const SparseMatrix<MT,SO>& A )
+   : SparseLDLT()
+{
+   analyze( ~A );
+   factorize( ~A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse symmetric matrix.
+//
+// \param A The given sparse symmetric matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-symmetric matrix provided.
+//
+// This function computes a minimum degree ordering of the given sparse symmetric matrix and
+// performs the symbolic analysis for the resulting permutation. The symmetry of the matrix is
+// checked at compile time in case of a symmetric adaptor and at runtime in case of any other
+// sparse matrix. In case the given matrix is not symmetric, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLDLT<Type>::analyze( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !IsSymmetric_v<MT> && !isSymmetric( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-symmetric matrix provided" );
+   }
+
+   analyze( ~A, minimumDegree( ~A ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symbolic analysis of the given sparse symmetric matrix for a given ordering.
+//
+// \param A The given sparse symmetric matrix.
+// \param perm The fill-reducing permutation of the rows and columns of \a A.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function performs the symbolic analysis of the given sparse symmetric matrix for the
+// given permutation. Element \f$ p_k \f$ of the permutation refers to the row/column of \a A
+// that is eliminated in the \f$ k \f$-th step. The permutation is refined by a postordering of
+// the elimination tree, which does not change the fill-in but results in larger supernodes.
+// Note that this function only considers the sparsity pattern of the lower part of \a A. In
+// case the given permutation is not a valid permutation of the rows and columns of \a A, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLDLT<Type>::analyze( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   if( perm.size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   factorized_ = false;
+   n_          = n;
+   perm_       = perm;
+   pinv_.assign( n, n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( perm[k] >= n || pinv_[perm[k]] != n ) {
+         n_ = 0UL;
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+      }
+      pinv_[perm[k]] = k;
+   }
+
+   std::vector<size_t> ptr, idx;
+   std::vector<size_t> parent( n ), ancestor( n );
+
+   // Computing the elimination tree of the permuted matrix
+   const auto etree = [&]()
+   {
+      lowerPattern( ~A, ptr, idx );
+
+      for( size_t k=0UL; k<n; ++k )
+      {
+         parent[k]   = n;
+         ancestor[k] = n;
+
+         for( size_t p=ptr[k]; p<ptr[k+1UL]; ++p )
+         {
+            size_t j( idx[p] );
+
+            while( ancestor[j] != n && ancestor[j] != k ) {
+               const size_t next( ancestor[j] );
+               ancestor[j] = k;
+               j = next;
+            }
+
+            if( ancestor[j] == n ) {
+               ancestor[j] = k;
+               parent[j]   = k;
+            }
+         }
+      }
+   };
+
+   etree();
+
+   // Postordering the elimination tree
+   {
+      std::vector<size_t> head( n+1UL, n ), next( n, n ), stack;
+      std::vector<size_t> post;
+
+      for( size_t j=n; j-->0UL; ) {
+         next[j] = head[parent[j]];
+         head[parent[j]] = j;
+      }
+
+      post.reserve( n );
+      stack.reserve( n );
+
+      for( size_t root=head[n]; root!=n; root=next[root] )
+      {
+         stack.push_back( root );
+
+         while( !stack.empty() ) {
+            const size_t j( stack.back() );
+            if( head[j] == n ) {
+               stack.pop_back();
+               post.push_back( j );
+            }
+            else {
+               stack.push_back( head[j] );
+               head[j] = next[head[j]];
+            }
+         }
+      }
+
+      const std::vector<size_t> order( perm_ );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         perm_[k] = order[post[k]];
+         pinv_[perm_[k]] = k;
+      }
+   }
+
+   etree();
+
+   // Computing the column counts by traversing the row subtrees
+   std::vector<size_t> count( n, 1UL ), children( n, 0UL ), mark( n, n );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      if( parent[k] != n )
+         ++children[parent[k]];
+
+      mark[k] = k;
+
+      for( size_t p=ptr[k]; p<ptr[k+1UL]; ++p ) {
+         for( size_t j=idx[p]; mark[j]!=k; j=parent[j] ) {
+            ++count[j];
+            mark[j] = k;
+         }
+      }
+   }
+
+   nonzeros_ = 0UL;
+   for( size_t j=0UL; j<n; ++j ) {
+      nonzeros_ += count[j];
+   }
+
+   // Partitioning the columns into fundamental supernodes
+   std::vector<size_t> super( n );
+
+   sptr_.assign( 1UL, 0UL );
+   rptr_.assign( 1UL, 0UL );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( j > 0UL && ( parent[j-1UL] != j || count[j-1UL] != count[j]+1UL || children[j] != 1UL ) ) {
+         sptr_.push_back( j );
+         rptr_.push_back( rptr_.back() + count[sptr_[sptr_.size()-2UL]] );
+      }
+      super[j] = sptr_.size() - 1UL;
+   }
+
+   if( n > 0UL ) {
+      sptr_.push_back( n );
+      rptr_.push_back( rptr_.back() + count[sptr_[sptr_.size()-2UL]] );
+   }
+
+   const size_t nsuper( sptr_.size() - 1UL );
+
+   // Computing the row structure of the supernodes
+   std::vector<size_t> pos( rptr_.begin(), rptr_.end()-1L );
+   ridx_.resize( rptr_.back() );
+
+   for( size_t s=0UL; s<nsuper; ++s ) {
+      ridx_[pos[s]++] = sptr_[s];
+   }
+
+   std::fill( mark.begin(), mark.end(), n );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      mark[k] = k;
+
+      for( size_t p=ptr[k]; p<ptr[k+1UL]; ++p ) {
+         for( size_t j=idx[p]; mark[j]!=k; j=parent[j] ) {
+            if( sptr_[super[j]] == j )
+               ridx_[pos[super[j]]++] = k;
+            mark[j] = k;
+         }
+      }
+   }
+
+   // Computing the updating supernodes of each supernode
+   uptr_.assign( nsuper+1UL, 0UL );
+
+   for( size_t pass=0UL; pass<2UL; ++pass )
+   {
+      if( pass == 1UL ) {
+         for( size_t s=0UL; s<nsuper; ++s )
+            uptr_[s+1UL] += uptr_[s];
+         pos.assign( uptr_.begin(), uptr_.end()-1L );
+         uidx_.resize( uptr_.back() );
+      }
+
+      for( size_t d=0UL; d<nsuper; ++d )
+      {
+         size_t last( nsuper );
+
+         for( size_t p=rptr_[d]+sptr_[d+1UL]-sptr_[d]; p<rptr_[d+1UL]; ++p ) {
+            const size_t s( super[ridx_[p]] );
+            if( s != last ) {
+               if( pass == 0UL ) ++uptr_[s+1UL];
+               else uidx_[pos[s]++] = d;
+               last = s;
+            }
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric factorization of the given sparse symmetric matrix.
+//
+// \param A The given sparse symmetric matrix.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Factorization of singular matrix failed.
+//
+// This function computes the numeric \f$ LDL^T \f$ decomposition of the given sparse symmetric
+// matrix based on the previously performed symbolic analysis. The sparsity pattern of the lower
+// part of \a A must be a subset of the pattern of the analyzed matrix. In case the size of the
+// given matrix does not match the analyzed matrix, a \a std::invalid_argument exception is
+// thrown. In case a zero pivot is encountered, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLDLT<Type>::factorize( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).rows() != n_ || (~A).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   factorized_ = false;
+
+   CompositeType_t<MT> tmp( ~A );
+
+   // Gathering the columns of the lower part of the permuted matrix
+   std::vector<size_t> cptr( n_+1UL, 0UL ), cidx( tmp.nonZeros() );
+   std::vector<Type> cval( tmp.nonZeros() );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         if( pinv_[k] >= pinv_[element->index()] )
+            ++cptr[pinv_[element->index()]+1UL];
+      }
+   }
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      cptr[j+1UL] += cptr[j];
+   }
+
+   std::vector<size_t> pos( cptr.begin(), cptr.end()-1L );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         const size_t i( pinv_[k] );
+         const size_t j( pinv_[element->index()] );
+         if( i >= j ) {
+            cidx[pos[j]  ] = i;
+            cval[pos[j]++] = element->value();
+         }
+      }
+   }
+
+   // Factorizing the supernodes in order
+   const size_t nsuper( sptr_.size() - 1UL );
+
+   const size_t panelBlockSize( 32UL );
+
+   std::vector<size_t> map( n_ );
+   DynamicMatrix<Type,columnMajor> W, U;
+
+   panels_.resize( nsuper );
+   diag_.resize( n_, false );
+
+   for( size_t s=0UL; s<nsuper; ++s )
+   {
+      const size_t first( sptr_[s] );
+      const size_t last ( sptr_[s+1UL] );
+      const size_t ns   ( last - first );
+      const size_t ms   ( rptr_[s+1UL] - rptr_[s] );
+      const size_t* rows( ridx_.data() + rptr_[s] );
+
+      DynamicMatrix<Type,columnMajor>& F( panels_[s] );
+      F.resize( ms, ns, false );
+      reset( F );
+
+      for( size_t i=0UL; i<ms; ++i ) {
+         map[rows[i]] = i;
+      }
+
+      // Assembling the elements of A
+      for( size_t j=first; j<last; ++j ) {
+         for( size_t p=cptr[j]; p<cptr[j+1UL]; ++p ) {
+            if( map[cidx[p]] >= ms || rows[map[cidx[p]]] != cidx[p] ) {
+               BLAZE_THROW_INVALID_ARGUMENT( "Matrix pattern does not match the symbolic analysis" );
+            }
+            F(map[cidx[p]],j-first) += cval[p];
+         }
+      }
+
+      // Applying the updates of all descendant supernodes
+      for( size_t u=uptr_[s]; u<uptr_[s+1UL]; ++u )
+      {
+         const size_t d ( uidx_[u] );
+         const size_t nd( sptr_[d+1UL] - sptr_[d] );
+         const size_t md( rptr_[d+1UL] - rptr_[d] );
+         const size_t* drows( ridx_.data() + rptr_[d] );
+
+         const size_t p1( std::lower_bound( drows+nd, drows+md, first ) - drows );
+         const size_t p2( std::lower_bound( drows+p1, drows+md, last  ) - drows );
+
+         const DynamicMatrix<Type,columnMajor>& Ld( panels_[d] );
+
+         W = submatrix( Ld, p1, 0UL, md-p1, nd, unchecked );
+         for( size_t c=0UL; c<nd; ++c ) {
+            column( W, c, unchecked ) *= diag_[sptr_[d]+c];
+         }
+
+         U = W * trans( submatrix( Ld, p1, 0UL, p2-p1, nd, unchecked ) );
+
+         for( size_t c=0UL; c<p2-p1; ++c ) {
+            const size_t j( drows[p1+c] - first );
+            for( size_t r=c; r<md-p1; ++r ) {
+               F(map[drows[p1+r]],j) -= U(r,c);
+            }
+         }
+      }
+
+      // Dense blocked LDLT decomposition of the supernode panel
+      for( size_t k0=0UL; k0<ns; k0+=panelBlockSize )
+      {
+         const size_t k1( min( k0+panelBlockSize, ns ) );
+
+         for( size_t k=k0; k<k1; ++k )
+         {
+            const Type dk( F(k,k) );
+
+            if( isDefault( dk ) ) {
+               BLAZE_THROW_DIVISION_BY_ZERO( "Factorization of singular matrix failed" );
+            }
+
+            diag_[first+k] = dk;
+            F(k,k) = Type(1);
+
+            auto fk( subvector( column( F, k, unchecked ), k+1UL, ms-k-1UL, unchecked ) );
+            fk /= dk;
+
+            for( size_t c=k+1UL; c<k1; ++c ) {
+               subvector( column( F, c, unchecked ), c, ms-c, unchecked ) -=
+                  subvector( fk, c-k-1UL, ms-c, unchecked ) * ( F(c,k) * dk );
+            }
+         }
+
+         if( k1 == ns ) break;
+
+         // Updating the trailing columns of the panel by a dense matrix multiplication
+         W = submatrix( F, k1, k0, ms-k1, k1-k0, unchecked );
+         for( size_t c=0UL; c<k1-k0; ++c ) {
+            column( W, c, unchecked ) *= diag_[first+k0+c];
+         }
+
+         U = W * trans( submatrix( F, k1, k0, ns-k1, k1-k0, unchecked ) );
+
+         for( size_t c=0UL; c<ns-k1; ++c ) {
+            subvector( column( F, k1+c, unchecked ), k1+c, ms-k1-c, unchecked ) -=
+               subvector( column( U, c, unchecked ), c, ms-k1-c, unchecked );
+         }
+      }
+   }
+
+   factorized_ = true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of the linear system \f$ A x = b \f$.
+//
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::logic_error Missing numeric factorization.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the linear system \f$ A x = b \f$ by means of the computed \f$ LDL^T
+// \f$ decomposition. The vectors \a x and \a b may refer to the same vector. In case no numeric
+// factorization has been computed, a \a std::logic_error exception is thrown. In case the size
+// of \a b does not match the size of the decomposed matrix, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename VT1     // Type of the left-hand side dense vector
+        , typename VT2 >   // Type of the right-hand side dense vector
+void SparseLDLT<Type>::solve( DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b ) const
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !factorized_ ) {
+      BLAZE_THROW_LOGIC_ERROR( "Missing numeric factorization" );
+   }
+
+   if( (~b).size() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   const size_t nsuper( sptr_.size() - 1UL );
+
+   DynamicVector<Type> z( n_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      z[k] = (~b)[perm_[k]];
+   }
+
+   // Forward substitution with L
+   for( size_t s=0UL; s<nsuper; ++s )
+   {
+      const DynamicMatrix<Type,columnMajor>& L( panels_[s] );
+      const size_t* rows( ridx_.data() + rptr_[s] );
+
+      for( size_t k=0UL; k<L.columns(); ++k ) {
+         const Type zk( z[rows[k]] );
+         for( size_t i=k+1UL; i<L.rows(); ++i ) {
+            z[rows[i]] -= L(i,k) * zk;
+         }
+      }
+   }
+
+   // Scaling with the inverse of D
+   for( size_t k=0UL; k<n_; ++k ) {
+      z[k] /= diag_[k];
+   }
+
+   // Backward substitution with the transpose of L
+   for( size_t s=nsuper; s-->0UL; )
+   {
+      const DynamicMatrix<Type,columnMajor>& L( panels_[s] );
+      const size_t* rows( ridx_.data() + rptr_[s] );
+
+      for( size_t k=L.columns(); k-->0UL; ) {
+         Type sum( z[rows[k]] );
+         for( size_t i=k+1UL; i<L.rows(); ++i ) {
+            sum -= L(i,k) * z[rows[i]];
+         }
+         z[rows[k]] = sum;
+      }
+   }
+
+   resize( ~x, n_, false );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      (~x)[perm_[k]] = z[k];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows and columns of the analyzed matrix.
+//
+// \return The number of rows and columns of the analyzed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t SparseLDLT<Type>::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the factor \f$ L \f$.
+//
+// \return The number of non-zero elements of \f$ L \f$ including its unit diagonal.
+//
+// The number of non-zero elements of \f$ L \f$ is determined by the symbolic analysis and is a
+// measure for the quality of the fill-reducing ordering.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t SparseLDLT<Type>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of supernodes of the factor \f$ L \f$.
+//
+// \return The number of supernodes.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline size_t SparseLDLT<Type>::supernodes() const noexcept
+{
+   return sptr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the numeric factorization has been computed.
+//
+// \return \a true in case the numeric factorization has been computed, \a false if not.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline bool SparseLDLT<Type>::isFactorized() const noexcept
+{
+   return factorized_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the fill-reducing permutation of the decomposition.
+//
+// \return The permutation vector \f$ p \f$ with \f$ p_k \f$ being the \f$ k \f$-th row/column.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const std::vector<size_t>& SparseLDLT<Type>::permutation() const noexcept
+{
+   return perm_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the diagonal matrix \f$ D \f$ of the decomposition.
+//
+// \return The diagonal elements of \f$ D \f$ in permuted order.
+//
+// The signs of the diagonal elements determine the inertia of the decomposed matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+inline const DynamicVector<Type>& SparseLDLT<Type>::diagonal() const noexcept
+{
+   return diag_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the structure of the strictly lower part of the permuted matrix.
+//
+// \param A The given sparse symmetric matrix.
+// \param ptr The resulting offsets of the rows.
+// \param idx The resulting sorted column indices of all rows.
+// \return void
+//
+// This function computes the sparsity pattern of the strictly lower part of the matrix
+// \f$ P (A + A^T) P^T \f$ in compressed row format.
+*/
+template< typename Type >  // Data type of the matrix elements
+template< typename MT      // Type of the sparse matrix
+        , bool SO >        // Storage order of the sparse matrix
+void SparseLDLT<Type>::lowerPattern( const SparseMatrix<MT,SO>& A, std::vector<size_t>& ptr,
+                                     std::vector<size_t>& idx ) const
+{
+   CompositeType_t<MT> tmp( ~A );
+
+   std::vector< std::vector<size_t> > rows( n_ );
+
+   for( size_t k=0UL; k<n_; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         const size_t i( pinv_[k] );
+         const size_t j( pinv_[element->index()] );
+         if( i > j ) rows[i].push_back( j );
+         else if( j > i ) rows[j].push_back( i );
+      }
+   }
+
+   ptr.assign( 1UL, 0UL );
+   idx.clear();
+
+   for( std::vector<size_t>& row : rows ) {
+      std::sort( row.begin(), row.end() );
+      idx.insert( idx.end(), row.begin(), std::unique( row.begin(), row.end() ) );
+      ptr.push_back( idx.size() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,617 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Ordering.h
+//  \brief Header file for the orderings and permutations of sparse matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_ORDERING_H_
+#define _BLAZE_MATH_SPARSE_ORDERING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <set>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE MATRIX ORDERING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Sparse matrix ordering functions */
+//@{
+template< typename MT, bool SO >
+std::vector<size_t> minimumDegree( const SparseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A );
+
+inline std::vector<size_t> inversePermutation( const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+CompressedMatrix<ElementType_t<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm );
+
+template< typename MT, bool SO >
+CompressedMatrix<ElementType_t<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& columnPerm );
+
+template< typename VT, bool TF >
+DynamicVector<ElementType_t<VT>,TF>
+   permute( const DenseVector<VT,TF>& v, const std::vector<size_t>& perm );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the symmetrized adjacency structure of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \return The sorted adjacency lists of all rows/columns of \f$ A + A^T \f$ without diagonal.
+//
+// This auxiliary function computes the undirected graph of the given square sparse matrix. The
+// graph contains an edge \f$ (i,j) \f$ for every non-zero off-diagonal element \f$ a_{ij} \f$
+// or \f$ a_{ji} \f$.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector< std::vector<size_t> > symmetricAdjacency( const SparseMatrix<MT,SO>& A )
+{
+   CompositeType_t<MT> tmp( ~A );
+
+   const size_t n( tmp.rows() );
+
+   std::vector< std::vector<size_t> > adj( n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      for( auto element=tmp.begin(k); element!=tmp.end(k); ++element ) {
+         const size_t idx( element->index() );
+         if( idx != k ) {
+            adj[k].push_back( idx );
+            adj[idx].push_back( k );
+         }
+      }
+   }
+
+   for( std::vector<size_t>& list : adj ) {
+      std::sort( list.begin(), list.end() );
+      list.erase( std::unique( list.begin(), list.end() ), list.end() );
+   }
+
+   return adj;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a fill-reducing approximate minimum degree ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \return The permutation vector \f$ p \f$ with \f$ p_k \f$ being the \f$ k \f$-th row/column.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes a symmetric approximate minimum degree (AMD) ordering of the structure
+// of \f$ A + A^T \f$. In every step the row/column with the smallest approximate degree is
+// eliminated, where ties are broken by the smaller index, which makes the ordering deterministic.
+// Element \f$ p_k \f$ of the returned permutation vector refers to the row/column of \a A that
+// is eliminated in the \f$ k \f$-th step, i.e. the permuted matrix is given by \f$ B_{ij} =
+// A_{p_i p_j} \f$.
+
+   \code
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double> > A;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::minimumDegree( A ) );
+   \endcode
+
+// The elimination is performed on a quotient graph: every eliminated row/column becomes an
+// element that represents the clique formed by its neighbors, and elements adjacent to the
+// eliminated row/column are absorbed into the new element. Therefore the fill-in is never
+// formed explicitly and the required memory is proportional to the number of non-zero elements
+// of \a A. The degrees are approximated by the upper bound of Amestoy, Davis, and Duff instead
+// of being computed exactly. Note that only the sparsity pattern of the given matrix is
+// considered. In case the given matrix is not a square matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> minimumDegree( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   enum : char { variable, element, absorbed };
+
+   std::vector< std::vector<size_t> > adj( symmetricAdjacency( ~A ) );  // Adjacent variables
+   std::vector< std::vector<size_t> > elements( n );                    // Adjacent elements
+   std::vector< std::vector<size_t> > pattern( n );                     // Variables of elements
+   std::vector<size_t> degree( n );
+   std::vector<size_t> weight( n, n );
+   std::vector<size_t> mark( n, n );
+   std::vector<char> state( n, variable );
+   std::vector<size_t> perm;
+
+   std::set< std::pair<size_t,size_t> > queue;
+
+   for( size_t i=0UL; i<n; ++i ) {
+      degree[i] = adj[i].size();
+      queue.emplace( degree[i], i );
+   }
+
+   perm.reserve( n );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t p( queue.begin()->second );
+      queue.erase( queue.begin() );
+      perm.push_back( p );
+
+      // Computing the variables of the new element and absorbing all adjacent elements
+      std::vector<size_t>& Lp( pattern[p] );
+
+      mark[p] = p;
+
+      for( size_t i : adj[p] ) {
+         if( state[i] == variable && mark[i] != p ) {
+            mark[i] = p;
+            Lp.push_back( i );
+         }
+      }
+
+      for( size_t e : elements[p] ) {
+         if( state[e] != element ) continue;
+         for( size_t i : pattern[e] ) {
+            if( state[i] == variable && mark[i] != p ) {
+               mark[i] = p;
+               Lp.push_back( i );
+            }
+         }
+         state[e] = absorbed;
+         std::vector<size_t>().swap( pattern[e] );
+      }
+
+      state[p] = element;
+      std::vector<size_t>().swap( adj[p] );
+      std::vector<size_t>().swap( elements[p] );
+
+      // Computing the number of variables of each adjacent element outside of the new element
+      for( size_t i : Lp ) {
+         queue.erase( std::make_pair( degree[i], i ) );
+         for( size_t e : elements[i] ) {
+            if( state[e] != element ) continue;
+            if( weight[e] == n ) weight[e] = pattern[e].size();
+            --weight[e];
+         }
+      }
+
+      // Updating the lists and the approximate degrees of all variables of the new element
+      for( size_t i : Lp )
+      {
+         std::vector<size_t>& Ei( elements[i] );
+         size_t external( 0UL );
+
+         Ei.erase( std::remove_if( Ei.begin(), Ei.end(), [&]( size_t e ) {
+                      if( state[e] != element ) return true;
+                      if( weight[e] == 0UL ) {  // Aggressive absorption
+                         state[e] = absorbed;
+                         std::vector<size_t>().swap( pattern[e] );
+                         return true;
+                      }
+                      external += weight[e];
+                      return false;
+                   } ), Ei.end() );
+         Ei.push_back( p );
+
+         std::vector<size_t>& Ai( adj[i] );
+
+         Ai.erase( std::remove_if( Ai.begin(), Ai.end(), [&]( size_t j ) {
+                      return state[j] != variable || mark[j] == p;
+                   } ), Ai.end() );
+
+         degree[i] = min( n-k-2UL, degree[i]+Lp.size()-1UL, Ai.size()+Lp.size()-1UL+external );
+         queue.emplace( degree[i], i );
+      }
+
+      for( size_t i : Lp ) {
+         for( size_t e : elements[i] )
+            weight[e] = n;
+      }
+   }
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes a bandwidth-reducing reverse Cuthill-McKee ordering of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \return The permutation vector \f$ p \f$ with \f$ p_k \f$ being the \f$ k \f$-th row/column.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+//
+// This function computes the reverse Cuthill-McKee ordering of the structure of \f$ A + A^T
+// \f$. Every connected component is traversed in breadth-first order starting from a pseudo-
+// peripheral row/column, where the neighbors of each row/column are visited in the order of
+// increasing degree. The reversed traversal order clusters the non-zero elements of the permuted
+// matrix \f$ B_{ij} = A_{p_i p_j} \f$ around the diagonal, which improves the locality of the
+// accesses to the dense vector in sparse matrix/dense vector multiplications:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   const std::vector<size_t> p( blaze::rcm( A ) );
+
+   const blaze::CompressedMatrix<double> B( blaze::permute( A, p ) );  // Symmetric permutation
+   const blaze::DynamicVector<double> z( blaze::permute( x, p ) );
+
+   y = blaze::permute( B * z, blaze::inversePermutation( p ) );  // Equivalent to y = A * x
+   \endcode
+
+// Note that only the sparsity pattern of the given matrix is considered. In case the given
+// matrix is not a square matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+std::vector<size_t> rcm( const SparseMatrix<MT,SO>& A )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n( (~A).rows() );
+
+   const std::vector< std::vector<size_t> > adj( symmetricAdjacency( ~A ) );
+
+   std::vector<size_t> perm;
+   std::vector<size_t> level( n, n );
+   std::vector<bool> visited( n, false );
+
+   perm.reserve( n );
+
+   // Breadth-first traversal of the unvisited part of the graph, starting from the given root;
+   // the traversed rows/columns are appended to 'order' and the eccentricity is returned
+   std::vector<size_t> order;
+
+   const auto traverse = [&]( size_t root )
+   {
+      for( size_t v : order ) {
+         level[v] = n;
+      }
+
+      order.assign( 1UL, root );
+      level[root] = 0UL;
+
+      for( size_t k=0UL; k<order.size(); ++k ) {
+         for( size_t u : adj[order[k]] ) {
+            if( !visited[u] && level[u] == n ) {
+               level[u] = level[order[k]] + 1UL;
+               order.push_back( u );
+            }
+         }
+      }
+
+      return level[order.back()];
+   };
+
+   for( size_t start=0UL; start<n; ++start )
+   {
+      if( visited[start] ) continue;
+
+      // Selecting the row/column of minimum degree of the connected component
+      traverse( start );
+
+      size_t root( start );
+      for( size_t v : order ) {
+         if( adj[v].size() < adj[root].size() )
+            root = v;
+      }
+
+      // Searching a pseudo-peripheral row/column
+      size_t eccentricity( traverse( root ) );
+
+      while( true )
+      {
+         size_t candidate( order.back() );
+         for( size_t k=order.size(); k-->0UL && level[order[k]] == eccentricity; ) {
+            if( adj[order[k]].size() < adj[candidate].size() )
+               candidate = order[k];
+         }
+
+         const size_t tmp( traverse( candidate ) );
+
+         if( tmp <= eccentricity ) break;
+
+         root = candidate;
+         eccentricity = tmp;
+      }
+
+      // Cuthill-McKee traversal with neighbors sorted by increasing degree
+      const size_t first( perm.size() );
+
+      perm.push_back( root );
+      visited[root] = true;
+
+      for( size_t k=first; k<perm.size(); ++k )
+      {
+         const size_t begin( perm.size() );
+
+         for( size_t u : adj[perm[k]] ) {
+            if( !visited[u] ) {
+               visited[u] = true;
+               perm.push_back( u );
+            }
+         }
+
+         std::stable_sort( perm.begin()+begin, perm.end(), [&adj]( size_t i, size_t j ) {
+            return adj[i].size() < adj[j].size();
+         } );
+      }
+   }
+
+   std::reverse( perm.begin(), perm.end() );
+
+   return perm;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the inverse of the given permutation.
+// \ingroup sparse_matrix
+//
+// \param perm The given permutation vector.
+// \return The inverse permutation vector.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function computes the inverse \f$ q \f$ of the given permutation vector \f$ p \f$, i.e.
+// \f$ q_{p_k} = k \f$. Applying \f$ q \f$ reverts the application of \f$ p \f$. In case the
+// given vector is not a permutation of the indices \f$ 0, \ldots, n-1 \f$, a
+// \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> inversePermutation( const std::vector<size_t>& perm )
+{
+   const size_t n( perm.size() );
+
+   std::vector<size_t> inv( n, n );
+
+   for( size_t k=0UL; k<n; ++k ) {
+      if( perm[k] >= n || inv[perm[k]] != n ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+      }
+      inv[perm[k]] = k;
+   }
+
+   return inv;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Symmetric permutation of the given square sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given square sparse matrix.
+// \param perm The permutation of the rows and columns.
+// \return The permuted matrix \f$ B_{ij} = A_{p_i p_j} \f$.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function applies the given permutation symmetrically to the rows and columns of the
+// given square sparse matrix (see the general permute() function for sparse matrices).
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix<ElementType_t<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& perm )
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   return permute( ~A, perm, perm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the rows and columns of the given sparse matrix.
+// \ingroup sparse_matrix
+//
+// \param A The given sparse matrix.
+// \param rowPerm The permutation of the rows.
+// \param columnPerm The permutation of the columns.
+// \return The permuted matrix \f$ B_{ij} = A_{r_i c_j} \f$.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function computes the compressed matrix \f$ B_{ij} = A_{r_i c_j} \f$, where \f$ r \f$
+// and \f$ c \f$ are the given row and column permutations. The rows (or columns in case of a
+// column-major matrix) of the result are gathered in parallel in case the number of non-zero
+// elements exceeds the \c BLAZE_SMP_PERMUTE_THRESHOLD. In case either permutation vector is not
+// a permutation of the according indices, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+CompressedMatrix<ElementType_t<MT>,SO>
+   permute( const SparseMatrix<MT,SO>& A, const std::vector<size_t>& rowPerm,
+            const std::vector<size_t>& columnPerm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = ElementType_t<MT>;
+
+   if( rowPerm.size() != (~A).rows() || columnPerm.size() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   CompositeType_t<MT> tmp( ~A );
+
+   const std::vector<size_t>& majorPerm( SO ? columnPerm : rowPerm );
+   const std::vector<size_t>  minorInv ( inversePermutation( SO ? rowPerm : columnPerm ) );
+
+   const size_t M( majorPerm.size() );
+
+   inversePermutation( majorPerm );  // Validation of the major permutation
+
+   std::vector<size_t> nonzeros( M );
+
+   for( size_t k=0UL; k<M; ++k ) {
+      nonzeros[k] = tmp.nonZeros( majorPerm[k] );
+   }
+
+   CompressedMatrix<ET,SO> B( (~A).rows(), (~A).columns(), nonzeros );
+
+   const size_t tasks( ( tmp.nonZeros() >= SMP_PERMUTE_THRESHOLD && M > 1UL )
+                       ? min( getNumThreads(), M )
+                       : 1UL );
+   const size_t blockSize( M / tasks + ( M % tasks != 0UL ? 1UL : 0UL ) );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      std::vector< std::pair<size_t,ET> > elements;
+
+      const size_t kend( min( (t+1UL)*blockSize, M ) );
+
+      for( size_t k=t*blockSize; k<kend; ++k )
+      {
+         elements.clear();
+
+         for( auto element=tmp.begin(majorPerm[k]); element!=tmp.end(majorPerm[k]); ++element ) {
+            elements.emplace_back( minorInv[element->index()], element->value() );
+         }
+
+         std::sort( elements.begin(), elements.end(),
+                    []( const std::pair<size_t,ET>& a, const std::pair<size_t,ET>& b ) {
+                       return a.first < b.first;
+                    } );
+
+         for( const auto& element : elements ) {
+            if( SO ) B.append( element.first, k, element.second );
+            else     B.append( k, element.first, element.second );
+         }
+      }
+   } );
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Permutation of the elements of the given dense vector.
+// \ingroup sparse_matrix
+//
+// \param v The given dense vector.
+// \param perm The permutation of the elements.
+// \return The permuted vector \f$ w_i = v_{p_i} \f$.
+// \exception std::invalid_argument Invalid permutation provided.
+//
+// This function computes the permuted dense vector \f$ w_i = v_{p_i} \f$. The elements are
+// gathered in parallel in case the size of the vector exceeds the \c BLAZE_SMP_PERMUTE_THRESHOLD.
+// The permutation can be reverted by means of the inverse permutation (see inversePermutation()).
+// In case the given vector is not a permutation of the indices of \a v, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+DynamicVector<ElementType_t<VT>,TF>
+   permute( const DenseVector<VT,TF>& v, const std::vector<size_t>& perm )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( perm.size() != (~v).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid permutation provided" );
+   }
+
+   inversePermutation( perm );  // Validation of the permutation
+
+   CompositeType_t<VT> tmp( ~v );
+
+   const size_t n( perm.size() );
+
+   DynamicVector<ElementType_t<VT>,TF> w( n );
+
+   const size_t tasks( ( n >= SMP_PERMUTE_THRESHOLD && n > 1UL )
+                       ? min( getNumThreads(), n )
+                       : 1UL );
+   const size_t blockSize( n / tasks + ( n % tasks != 0UL ? 1UL : 0UL ) );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t iend( min( (t+1UL)*blockSize, n ) );
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         w[i] = tmp[perm[i]];
+      }
+   } );
+
+   return w;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
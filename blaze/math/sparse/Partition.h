@@ -0,0 +1,124 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Partition.h
+//  \brief Header file for the non-zero balanced partitioning of sparse matrices
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_PARTITION_H_
+#define _BLAZE_MATH_SPARSE_PARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PARTITIONING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits a sequence of rows/columns into ranges of balanced work.
+// \ingroup sparse_matrix
+//
+// \param N The number of rows/columns.
+// \param nonZeros Callable returning the number of non-zero elements of a given row/column.
+// \param tasks The number of ranges.
+// \return The \a tasks+1 boundaries of the ranges.
+//
+// This function splits the \a N rows/columns into \a tasks contiguous ranges, such that every
+// range contains approximately the same number of non-zero elements. Every row/column is
+// weighted by its number of non-zero elements plus one in order to account for the constant
+// work per row/column. Range \a t is given by \f$[bounds[t]..bounds[t+1])\f$; ranges may be
+// empty in case a single row/column dominates the work.
+*/
+template< typename NZ >  // Type of the non-zero count callable
+std::vector<size_t> partitionNonZeros( size_t N, NZ nonZeros, size_t tasks )
+{
+   std::vector<size_t> bounds( tasks+1UL, N );
+   bounds[0] = 0UL;
+
+   size_t total( 0UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      total += nonZeros(i) + 1UL;
+   }
+
+   size_t work( 0UL );
+   for( size_t i=0UL, t=1UL; i<N && t<tasks; ++i ) {
+      work += nonZeros(i) + 1UL;
+      while( t < tasks && work*tasks >= total*t ) {
+         bounds[t++] = i+1UL;
+      }
+   }
+
+   return bounds;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Splits the rows/columns of a sparse matrix into ranges of balanced work.
+// \ingroup sparse_matrix
+//
+// \param sm The given sparse matrix.
+// \param tasks The number of ranges.
+// \return The \a tasks+1 boundaries of the ranges.
+//
+// This function splits the rows (in case of a row-major matrix) or the columns (in case of a
+// column-major matrix) of the given sparse matrix into \a tasks contiguous ranges, such that
+// every range contains approximately the same number of non-zero elements (see the
+// partitionNonZeros() function for a sequence of rows/columns).
+*/
+template< typename MT >  // Type of the sparse matrix
+std::vector<size_t> partitionNonZeros( const MT& sm, size_t tasks )
+{
+   const size_t N( IsRowMajorMatrix_v<MT> ? sm.rows() : sm.columns() );
+
+   return partitionNonZeros( N, [&sm]( size_t i ){ return sm.nonZeros(i); }, tasks );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1771 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/PatternMatrix.h
+//  \brief Implementation of a pattern-only sparse matrix
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_PATTERNMATRIX_H_
+#define _BLAZE_MATH_SPARSE_PATTERNMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Symmetric.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedIndexStorage.h>
+#include <blaze/math/sparse/Forward.h>
+#include <blaze/math/sparse/SparseElement.h>
+#include <blaze/math/typetraits/IsPattern.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/StorageIndex.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup pattern_matrix PatternMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Pattern-only implementation of a \f$ M \times N \f$ sparse matrix.
+// \ingroup pattern_matrix
+//
+// The PatternMatrix class template represents a sparse matrix whose non-zero elements all have
+// the value 1. Only the positions of the non-zero elements are stored in the classic compressed
+// row storage (CRS) respectively compressed column storage (CCS) layout, i.e. the matrix does
+// not manage any values at all. The type of the implicit elements, the storage order of the
+// matrix, and the type of the stored indices can be specified via the three template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class PatternMatrix;
+   \endcode
+
+//  - Type: specifies the type of the implicit matrix elements. PatternMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type that can be constructed
+//          from the integer values 0 and 1 (as for instance \c bool, \c int, or \c double).
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::defaultStorageOrder.
+//  - IT  : specifies the unsigned integral type of the stored indices. The default value is
+//          \c size_t.
+//
+// Pattern matrices are meant for adjacency and mask matrices, where storing a value for each
+// non-zero element wastes memory and memory bandwidth. A PatternMatrix can be used as operand
+// in all sparse matrix expressions. Its iterators provide the usual value() and index() access,
+// where value() always refers to the same implicit value 1. The products with dense operands
+// exploit the value-free storage and do not multiply at all: the matrix/dense vector products
+// and the dense vector/matrix products (for both storage orders) as well as the vectorized
+// matrix/dense matrix products with a row-major result (for a column-major PatternMatrix only
+// above the TSMATDMATMULT threshold) only traverse the stored indices and sum the referenced
+// elements of the dense operand. All other operations (for instance sparse matrix/matrix
+// products, products with views on a PatternMatrix, and products with a symmetric, Hermitian,
+// or triangular result) read the implicit value 1 via the iterators exactly like the values of
+// a CompressedMatrix and therefore only benefit from the reduced memory traffic. Additionally,
+// a PatternMatrix can be used as mask for the masked sparse matrix products (see the mxm()
+// functions):
+
+   \code
+   using blaze::PatternMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::rowMajor;
+   using blaze::columnVector;
+
+   PatternMatrix<double,rowMajor> A( 3UL, 3UL, 4UL );
+   A.append( 0UL, 1UL );
+   A.finalize( 0UL );
+   A.append( 1UL, 0UL );
+   A.append( 1UL, 2UL );
+   A.finalize( 1UL );
+   A.append( 2UL, 1UL );
+   A.finalize( 2UL );
+
+   DynamicVector<double,columnVector> x{ 1.0, 2.0, 3.0 };
+   DynamicVector<double,columnVector> y( A * x );  // Results in ( 2 4 2 )
+
+   CompressedMatrix<double,rowMajor> B( A * A );   // Number of paths of length 2
+
+   A.set( 2UL, 2UL );                              // Adding the element (2,2)
+   A.erase( 1UL, 0UL );                            // Removing the element (1,0)
+   \endcode
+
+// Since no values are stored, assigning a matrix to a PatternMatrix stores the positions of
+// all non-default elements of the assigned matrix. Element-wise modifications via the function
+// call operator or the iterators are not possible.
+*/
+template< typename Type                    // Data type of the matrix
+        , bool SO = defaultStorageOrder    // Storage order
+        , typename IT = size_t >           // Index type
+class PatternMatrix
+   : public SparseMatrix< PatternMatrix<Type,SO,IT>, SO >
+   , private CompressedIndexStorage<SO,IT>
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Storage = CompressedIndexStorage<SO,IT>;  //!< Type of the offset and index storage.
+   //**********************************************************************************************
+
+   //**Private class PatternElement****************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Proxy for a single element of the PatternMatrix class.
+   //
+   // This proxy combines the index of an element and the implicit value 1 into a single sparse
+   // element.
+   */
+   class PatternElement
+      : private SparseElement
+   {
+    public:
+      //**Constructor******************************************************************************
+      explicit inline PatternElement( const IT* index ) noexcept
+         : index_( index )  // Pointer to the index of the element
+      {}
+      //*******************************************************************************************
+
+      //**Access functions*************************************************************************
+      inline const Type& value() const noexcept { return one_; }
+      inline size_t      index() const noexcept { return *index_; }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const IT* index_;  //!< Pointer to the index of the element.
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Private class PatternIterator***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Iterator over the elements of a row/column of the PatternMatrix class.
+   //
+   // The iterator only advances a pointer into the index array. The element access via the
+   // arrow operator provides the value() and index() functions of the iterator itself, where
+   // value() refers to the implicit value 1 of all elements.
+   */
+   class PatternIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = PatternElement;                   //!< Type of the underlying elements.
+      using PointerType      = const PatternIterator*;           //!< Pointer return type.
+      using ReferenceType    = PatternElement;                   //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      inline PatternIterator() noexcept
+         : index_( nullptr )  // Pointer to the current index
+      {}
+
+      explicit inline PatternIterator( const IT* index ) noexcept
+         : index_( index )  // Pointer to the current index
+      {}
+      //*******************************************************************************************
+
+      //**Increment/decrement operators************************************************************
+      inline PatternIterator& operator++() noexcept { ++index_; return *this; }
+      inline PatternIterator& operator--() noexcept { --index_; return *this; }
+
+      inline const PatternIterator operator++( int ) noexcept { PatternIterator tmp( *this ); ++index_; return tmp; }
+      inline const PatternIterator operator--( int ) noexcept { PatternIterator tmp( *this ); --index_; return tmp; }
+
+      inline PatternIterator& operator+=( ptrdiff_t inc ) noexcept { index_ += inc; return *this; }
+      inline PatternIterator& operator-=( ptrdiff_t dec ) noexcept { index_ -= dec; return *this; }
+
+      inline const PatternIterator operator+( ptrdiff_t inc ) const noexcept { return PatternIterator( index_+inc ); }
+      inline const PatternIterator operator-( ptrdiff_t dec ) const noexcept { return PatternIterator( index_-dec ); }
+
+      friend inline const PatternIterator operator+( ptrdiff_t inc, const PatternIterator& it ) noexcept {
+         return it + inc;
+      }
+      //*******************************************************************************************
+
+      //**Access operators*************************************************************************
+      inline ReferenceType operator*() const noexcept { return ReferenceType( index_ ); }
+      inline PointerType   operator->() const noexcept { return this; }
+
+      inline ReferenceType operator[]( ptrdiff_t n ) const noexcept {
+         return ReferenceType( index_+n );
+      }
+      //*******************************************************************************************
+
+      //**Access functions*************************************************************************
+      inline const Type& value  () const noexcept { return one_; }
+      inline size_t      index  () const noexcept { return *index_; }
+      inline const IT*   indices() const noexcept { return index_; }
+      //*******************************************************************************************
+
+      //**Comparison operators*********************************************************************
+      inline bool operator==( const PatternIterator& rhs ) const noexcept { return index_ == rhs.index_; }
+      inline bool operator!=( const PatternIterator& rhs ) const noexcept { return index_ != rhs.index_; }
+      inline bool operator< ( const PatternIterator& rhs ) const noexcept { return index_ <  rhs.index_; }
+      inline bool operator> ( const PatternIterator& rhs ) const noexcept { return index_ >  rhs.index_; }
+      inline bool operator<=( const PatternIterator& rhs ) const noexcept { return index_ <= rhs.index_; }
+      inline bool operator>=( const PatternIterator& rhs ) const noexcept { return index_ >= rhs.index_; }
+
+      inline DifferenceType operator-( const PatternIterator& rhs ) const noexcept { return index_ - rhs.index_; }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const IT* index_;  //!< Pointer to the current index.
+      //*******************************************************************************************
+
+      //**Friend declarations**********************************************************************
+      friend class PatternMatrix;
+      //*******************************************************************************************
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = PatternMatrix<Type,SO,IT>;   //!< Type of this PatternMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;       //!< Base type of this PatternMatrix instance.
+   using ResultType     = This;                        //!< Result type for expression template evaluations.
+   using OppositeType   = PatternMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = PatternMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                        //!< Type of the implicit matrix elements.
+   using ReturnType     = const Type&;                 //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                 //!< Data type for composite expression templates.
+   using Reference      = const Type&;                 //!< Reference to a pattern matrix value.
+   using ConstReference = const Type&;                 //!< Reference to a constant pattern matrix value.
+   using Iterator       = PatternIterator;             //!< Iterator over the elements.
+   using ConstIterator  = PatternIterator;             //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a sparse matrix with different data/element type.
+   //
+   // Since a matrix with a different element type is not restricted to the values 0 and 1,
+   // the rebound type is a CompressedMatrix.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = CompressedMatrix<NewType,SO>;  //!< The type of the other matrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a PatternMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = PatternMatrix<Type,SO,IT>;  //!< The type of the other PatternMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation flag for SMP assignments.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PatternMatrix();
+   explicit inline PatternMatrix( size_t m, size_t n );
+   explicit inline PatternMatrix( size_t m, size_t n, size_t nonzeros );
+   explicit        PatternMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+
+   inline PatternMatrix( const PatternMatrix& sm );
+   inline PatternMatrix( PatternMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline PatternMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline PatternMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin  ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin ( size_t i ) const noexcept;
+   inline ConstIterator  end    ( size_t i ) const noexcept;
+   inline ConstIterator  cend   ( size_t i ) const noexcept;
+
+   using Storage::indices;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline PatternMatrix& operator=( const PatternMatrix& rhs );
+   inline PatternMatrix& operator=( PatternMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline PatternMatrix& operator=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline PatternMatrix& operator=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using Storage::rows;
+   using Storage::columns;
+   using Storage::capacity;
+   using Storage::nonZeros;
+   using Storage::reset;
+   using Storage::clear;
+   using Storage::resize;
+
+   inline void reserve( size_t nonzeros );
+   inline void reserve( size_t i, size_t nonzeros );
+   inline void trim   ();
+   inline void trim   ( size_t i );
+   inline void shrinkToFit();
+   inline void swap( PatternMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t i, size_t j );
+   inline Iterator insert( size_t i, size_t j );
+   inline void     append( size_t i, size_t j );
+
+   using Storage::finalize;
+
+   template< typename Other >
+   inline void append( size_t i, size_t j, const Other& value, bool check=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline PatternMatrix& transpose();
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign( const SparseMatrix<MT,!SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   using Storage::majorSize;
+   using Storage::minorSize;
+   using Storage::extendCapacity;
+   using Storage::lowerOffset;
+   using Storage::upperOffset;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( size_t pos, size_t k, size_t l );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   using Storage::m_;
+   using Storage::n_;
+   using Storage::capacity_;
+   using Storage::indices_;
+   using Storage::begin_;
+   using Storage::end_;
+
+   static const Type zero_;  //!< Value of all zero elements.
+   static const Type one_;   //!< Value of all non-zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type PatternMatrix<Type,SO,IT>::zero_( 0 );
+
+template< typename Type, bool SO, typename IT >
+const Type PatternMatrix<Type,SO,IT>::one_( 1 );
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for PatternMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>::PatternMatrix()
+   : Storage()  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( size_t m, size_t n )
+   : Storage( m, n )  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and will have at least the capacity for
+// \a nonzeros non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( size_t m, size_t n, size_t nonzeros )
+   : Storage( m, n, nonzeros )  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Number of columns/rows exceeds the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+PatternMatrix<Type,SO,IT>::PatternMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : Storage( m, n, nonzeros )  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for PatternMatrix.
+//
+// \param sm Pattern matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( const PatternMatrix& sm )
+   : Storage( sm )  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for PatternMatrix.
+//
+// \param sm The pattern matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( PatternMatrix&& sm ) noexcept
+   : Storage( std::move( sm ) )  // The row/column offsets and the index array
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+//
+// The pattern matrix stores the positions of all non-default elements of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign dense matrix
+        , bool SO2 >     // Storage order of the foreign dense matrix
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( const DenseMatrix<MT,SO2>& dm )
+   : PatternMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   assign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+//
+// The pattern matrix stores the positions of all non-default elements of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the foreign sparse matrix
+        , bool SO2 >     // Storage order of the foreign sparse matrix
+inline PatternMatrix<Type,SO,IT>::PatternMatrix( const SparseMatrix<MT,SO2>& sm )
+   : PatternMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   using blaze::assign;
+
+   assign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the pattern matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the value 1 in case the element is stored, reference to 0 otherwise.
+//
+// Note that this function only performs an index check in case BLAZE_USER_ASSERT() is active.
+// In contrast, the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstReference
+   PatternMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos == end_[k] || indices_[pos] != l )
+      return zero_;
+   else
+      return one_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the value 1 in case the element is stored, reference to 0 otherwise.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstReference
+   PatternMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid pattern matrix row/column access index" );
+   return ConstIterator( indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PatternMatrix.
+//
+// \param rhs Pattern matrix to be copied.
+// \return Reference to the assigned pattern matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>&
+   PatternMatrix<Type,SO,IT>::operator=( const PatternMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   PatternMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for PatternMatrix.
+//
+// \param rhs The pattern matrix to be moved into this instance.
+// \return Reference to the assigned pattern matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>&
+   PatternMatrix<Type,SO,IT>::operator=( PatternMatrix&& rhs ) noexcept
+{
+   Storage::operator=( std::move( rhs ) );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The pattern matrix stores the positions of all non-default elements of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline PatternMatrix<Type,SO,IT>&
+   PatternMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   PatternMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+//
+// The pattern matrix stores the positions of all non-default elements of the given matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+inline PatternMatrix<Type,SO,IT>&
+   PatternMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   PatternMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the pattern matrix.
+//
+// \param nonzeros The new minimum capacity of the pattern matrix.
+// \return void
+//
+// This function increases the capacity of the pattern matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows
+// are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity_ )
+      Storage::reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the pattern matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the pattern matrix to at least
+// \a nonzeros elements. The current values of the pattern matrix and all other individual row
+// capacities are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   Storage::reserveElements( i, nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::trim()
+{
+   const size_t M( majorSize() );
+
+   for( size_t k=0UL; k<M; ++k )
+      trim( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the pattern matrix.
+//
+// \param i The index of the row/column to be trimmed \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::trim( size_t i )
+{
+   Storage::trimElements( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      PatternMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two pattern matrices.
+//
+// \param sm The pattern matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::swap( PatternMatrix& sm ) noexcept
+{
+   Storage::swap( sm );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the pattern matrix.
+//
+// \param i The row index of the element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the set element.
+//
+// This function adds the element at position (\a i,\a j) to the pattern of the matrix. In case
+// the element is already contained in the pattern, the pattern remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::Iterator
+   PatternMatrix<Type,SO,IT>::set( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return Iterator( indices_+pos );
+   else
+      return insert( pos, k, l );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the pattern matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid pattern matrix access index.
+//
+// This function inserts a new element into the pattern matrix. However, duplicate elements are
+// not allowed. In case the pattern matrix already contains an element with row index \a i and
+// column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::Iterator
+   PatternMatrix<Type,SO,IT>::insert( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, k, l );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the pattern matrix.
+//
+// \param pos The offset of the new element.
+// \param k The row/column index of the new element.
+// \param l The column/row index of the new element.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+typename PatternMatrix<Type,SO,IT>::Iterator
+   PatternMatrix<Type,SO,IT>::insert( size_t pos, size_t k, size_t l )
+{
+   Storage::insertElement( pos, k, l );
+
+   return Iterator( indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the pattern matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function provides a very efficient way to fill a pattern matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! In order to move to the
+// next row/column, the finalize() function has to be called.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::append( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < n_, "Invalid column access index" );
+
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[k] < end_[majorSize()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[k] == end_[k] || l > indices_[end_[k]-1UL], "Index is not strictly increasing" );
+
+   indices_[end_[k]] = l;
+   ++end_[k];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element with the given value to the specified row/column of the pattern
+//        matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides the same interface as the append() function of the CompressedMatrix
+// class template and enables the use of a PatternMatrix as target of sparse matrix assignments.
+// The given value is only used to decide whether the element is stored: In case \a check is
+// \a true and the value is a default value, the element is not appended.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the value
+inline void PatternMatrix<Type,SO,IT>::append( size_t i, size_t j, const Other& value, bool check )
+{
+   if( !check || !isDefault<strict>( value ) )
+      append( i, j );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the pattern matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void PatternMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( find( i, j ) );
+   if( pos != end( SO ? j : i ) )
+      erase( SO ? j : i, pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the pattern matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::Iterator
+   PatternMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin(i) && pos <= end(i), "Invalid pattern matrix iterator" );
+
+   if( pos != end(i) ) {
+      const size_t offset( pos.index_ - indices_ );
+      Storage::eraseElements( i, offset, offset+1UL );
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the pattern matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::Iterator
+   PatternMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < majorSize(), "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range" );
+   BLAZE_USER_ASSERT( first >= begin(i) && first <= end(i), "Invalid pattern matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin(i) && last  <= end(i), "Invalid pattern matrix iterator" );
+
+   if( first != last ) {
+      const size_t ofirst( first.index_ - indices_ );
+      const size_t olast ( last.index_  - indices_ );
+      Storage::eraseElements( i, ofirst, olast );
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const size_t k( SO ? j : i );
+   const size_t l( SO ? i : j );
+   const size_t pos( lowerOffset( k, l ) );
+
+   if( pos != end_[k] && indices_[pos] == l )
+      return ConstIterator( indices_+pos );
+   else return end( k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   const size_t pos( SO ? lowerOffset( j, i ) : lowerOffset( i, j ) );
+   return ConstIterator( indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline typename PatternMatrix<Type,SO,IT>::ConstIterator
+   PatternMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   const size_t pos( SO ? upperOffset( j, i ) : upperOffset( i, j ) );
+   return ConstIterator( indices_+pos );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline PatternMatrix<Type,SO,IT>& PatternMatrix<Type,SO,IT>::transpose()
+{
+   PatternMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool PatternMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Index type
+template< typename Other >  // Data type of the foreign expression
+inline bool PatternMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool PatternMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline void PatternMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t M( majorSize() );
+   const size_t N( minorSize() );
+
+   if( M == 0UL || N == 0UL )
+      return;
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<M; ++k )
+   {
+      begin_[k] = end_[k] = nonzeros;
+
+      for( size_t l=0UL; l<N; ++l )
+      {
+         if( isDefault<strict>( SO ? (~rhs)(l,k) : (~rhs)(k,l) ) )
+            continue;
+
+         if( nonzeros == capacity_ ) {
+            Storage::reserveElements( extendCapacity() );
+         }
+
+         indices_[nonzeros] = l;
+         ++end_[k];
+         ++nonzeros;
+      }
+   }
+
+   begin_[M] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void PatternMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t M( majorSize() );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t k=0UL; k<M; ++k )
+   {
+      begin_[k] = nonzeros;
+
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         if( !isDefault<strict>( element->value() ) ) {
+            indices_[nonzeros] = element->index();
+            ++nonzeros;
+         }
+      }
+
+      end_[k] = nonzeros;
+   }
+
+   begin_[M] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void PatternMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t M( majorSize() );
+   const size_t N( minorSize() );
+
+   if( M == 0UL )
+      return;
+
+   std::fill( end_, end_+M, 0UL );
+
+   // Counting the number of elements per row/column
+   for( size_t l=0UL; l<N; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element )
+         if( !isDefault<strict>( element->value() ) )
+            ++end_[element->index()];
+   }
+
+   // Calculating the row/column offsets
+   begin_[0UL] = 0UL;
+   for( size_t k=0UL; k<M; ++k ) {
+      begin_[k+1UL] = begin_[k] + end_[k];
+      end_[k] = begin_[k];
+   }
+
+   // Scattering the indices
+   for( size_t l=0UL; l<N; ++l ) {
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element )
+         if( !isDefault<strict>( element->value() ) )
+            indices_[end_[element->index()]++] = l;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PATTERNMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PatternMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+void reset( PatternMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void reset( PatternMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+void clear( PatternMatrix<Type,SO,IT>& m );
+
+template< bool RF, typename Type, bool SO, typename IT >
+bool isDefault( const PatternMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+bool isIntact( const PatternMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+void swap( PatternMatrix<Type,SO,IT>& a, PatternMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( PatternMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void reset( PatternMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given pattern matrix.
+// \ingroup pattern_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void clear( PatternMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given pattern matrix is in default state.
+// \ingroup pattern_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isDefault( const PatternMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given pattern matrix are intact.
+// \ingroup pattern_matrix
+//
+// \param m The pattern matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline bool isIntact( const PatternMatrix<Type,SO,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two pattern matrices.
+// \ingroup pattern_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Index type
+inline void swap( PatternMatrix<Type,SO,IT>& a, PatternMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPATTERN SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsPattern< PatternMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< PatternMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< PatternMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  STORAGEINDEX SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct StorageIndex< PatternMatrix<T,SO,IT> >
+{
+   using Type = IT;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
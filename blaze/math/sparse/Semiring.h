@@ -0,0 +1,1008 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Semiring.h
+//  \brief Header file for the semiring-generic and masked sparse matrix products
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SEMIRING_H_
+#define _BLAZE_MATH_SPARSE_SEMIRING_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecDVecMapExpr.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/LogicalAnd.h>
+#include <blaze/math/functors/LogicalOr.h>
+#include <blaze/math/functors/Max.h>
+#include <blaze/math/functors/Min.h>
+#include <blaze/math/functors/Mult.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS SEMIRINGIDENTITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identity element of the additive operation of a semiring.
+// \ingroup sparse_matrix
+//
+// The SemiringIdentity class template provides the identity element of the given additive
+// operation \a OP for the data type \a T via the static \a value() function. It is specialized
+// for the Add, Min, Max and LogicalOr functors. In order to use a custom functor as additive
+// operation of a Semiring, the class template can be specialized accordingly:
+
+   \code
+   template< typename T >
+   struct SemiringIdentity<MyOperation,T>
+   {
+      static constexpr T value() { return T(...); }
+   };
+   \endcode
+*/
+template< typename OP  // Type of the additive operation
+        , typename T > // Data type of the identity element
+struct SemiringIdentity;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SemiringIdentity class template for the Add functor.
+// \ingroup sparse_matrix
+*/
+template< typename T >  // Data type of the identity element
+struct SemiringIdentity<Add,T>
+{
+   static constexpr T value() { return T(); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SemiringIdentity class template for the Min functor.
+// \ingroup sparse_matrix
+*/
+template< typename T >  // Data type of the identity element
+struct SemiringIdentity<Min,T>
+{
+   static constexpr T value() {
+      return ( std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::max() );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SemiringIdentity class template for the Max functor.
+// \ingroup sparse_matrix
+*/
+template< typename T >  // Data type of the identity element
+struct SemiringIdentity<Max,T>
+{
+   static constexpr T value() {
+      return ( std::numeric_limits<T>::has_infinity ? -std::numeric_limits<T>::infinity()
+                                                    : std::numeric_limits<T>::lowest() );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the SemiringIdentity class template for the LogicalOr functor.
+// \ingroup sparse_matrix
+*/
+template< typename T >  // Data type of the identity element
+struct SemiringIdentity<LogicalOr,T>
+{
+   static constexpr T value() { return T( false ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS SEMIRING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Semiring built from two Blaze functors.
+// \ingroup sparse_matrix
+//
+// The Semiring class template combines an additive operation \a OP1 and a multiplicative
+// operation \a OP2 to a semiring for the semiring-generic sparse matrix/dense vector product
+// (see the mxv() function) and the sparse matrix/sparse matrix product (see the mxm() function).
+// The identity element of the additive operation is provided by the SemiringIdentity class
+// template. The following semirings are predefined:
+//
+//  - PlusTimes: the conventional arithmetic (+,*) semiring
+//  - MinPlus  : the tropical (min,+) semiring for shortest path computations
+//  - MaxTimes : the (max,*) semiring for instance for most reliable path computations
+//  - OrAnd    : the boolean (or,and) semiring for reachability and breadth-first search
+
+   \code
+   blaze::CompressedMatrix<double> A;  // Weighted adjacency matrix
+   blaze::DynamicVector<double> d;     // Tentative distances
+   // ... Resizing and initialization
+
+   // One relaxation step of the Bellman-Ford algorithm
+   d = blaze::map( d, blaze::mxv( A, d, blaze::MinPlus() ), blaze::Min() );
+   \endcode
+*/
+template< typename OP1    // Type of the additive operation
+        , typename OP2 >  // Type of the multiplicative operation
+class Semiring
+{
+ public:
+   //**Type definitions****************************************************************************
+   using AddOperation  = OP1;  //!< Type of the additive operation.
+   using MultOperation = OP2;  //!< Type of the multiplicative operation.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the Semiring class template.
+   //
+   // \param add The additive operation.
+   // \param mult The multiplicative operation.
+   */
+   explicit inline Semiring( OP1 add = OP1(), OP2 mult = OP2() )
+      : add_ ( add  )  // The additive operation
+      , mult_( mult )  // The multiplicative operation
+   {}
+   //**********************************************************************************************
+
+   //**Add function********************************************************************************
+   /*!\brief Returns the additive operation.
+   //
+   // \return The additive operation.
+   */
+   inline const OP1& add() const noexcept { return add_; }
+   //**********************************************************************************************
+
+   //**Mult function*******************************************************************************
+   /*!\brief Returns the multiplicative operation.
+   //
+   // \return The multiplicative operation.
+   */
+   inline const OP2& mult() const noexcept { return mult_; }
+   //**********************************************************************************************
+
+   //**Identity function***************************************************************************
+   /*!\brief Returns the identity element of the additive operation.
+   //
+   // \return The identity element of the additive operation for the data type \a T.
+   */
+   template< typename T >
+   static constexpr T identity() { return SemiringIdentity<OP1,T>::value(); }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   OP1 add_;   //!< The additive operation.
+   OP2 mult_;  //!< The multiplicative operation.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The conventional arithmetic (+,*) semiring.
+// \ingroup sparse_matrix
+*/
+using PlusTimes = Semiring<Add,Mult>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The tropical (min,+) semiring.
+// \ingroup sparse_matrix
+*/
+using MinPlus = Semiring<Min,Add>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The (max,*) semiring.
+// \ingroup sparse_matrix
+*/
+using MaxTimes = Semiring<Max,Mult>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The boolean (or,and) semiring.
+// \ingroup sparse_matrix
+*/
+using OrAnd = Semiring<LogicalOr,LogicalAnd>;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SEMIRING PRODUCTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Result element type of a semiring product.
+// \ingroup sparse_matrix
+*/
+template< typename OP2, typename T1, typename T2 >
+using SemiringElement_t =
+   Decay_t< decltype( std::declval<OP2>()( std::declval<T1>(), std::declval<T2>() ) ) >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the semiring product of a row-major sparse matrix and a
+//        dense vector.
+// \ingroup sparse_matrix
+//
+// \param A The row-major sparse matrix.
+// \param x The dense vector.
+// \param y The resulting dense vector.
+// \param sr The semiring.
+// \return void
+//
+// Every element of \a y is computed independently. In case the size of \a y exceeds the
+// \c BLAZE_SMP_SMATDVECMULT_THRESHOLD, the rows are distributed among all available threads.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the dense vector
+        , typename VT2    // Type of the result vector
+        , typename OP1    // Type of the additive operation
+        , typename OP2 >  // Type of the multiplicative operation
+void mxvBackend( const MT& A, const VT1& x, VT2& y, const Semiring<OP1,OP2>& sr, FalseType )
+{
+   using ET = ElementType_t<VT2>;
+
+   const size_t m( A.rows() );
+
+   const size_t tasks( ( m >= SMP_SMATDVECMULT_THRESHOLD && m > 1UL )
+                       ? min( getNumThreads(), m )
+                       : 1UL );
+   const size_t blockSize( m / tasks + ( m % tasks != 0UL ? 1UL : 0UL ) );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t iend( min( (t+1UL)*blockSize, m ) );
+
+      for( size_t i=t*blockSize; i<iend; ++i )
+      {
+         ET value( sr.template identity<ET>() );
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            value = sr.add()( value, sr.mult()( element->value(), x[element->index()] ) );
+         }
+         y[i] = value;
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the semiring product of a column-major sparse matrix and a
+//        dense vector.
+// \ingroup sparse_matrix
+//
+// \param A The column-major sparse matrix.
+// \param x The dense vector.
+// \param y The resulting dense vector.
+// \param sr The semiring.
+// \return void
+//
+// In case the number of columns exceeds the \c BLAZE_SMP_TSMATDVECMULT_THRESHOLD, the columns
+// are distributed among all available threads and each thread accumulates a private partial
+// result. The partial results are combined in parallel by means of the vectorized map()
+// operation with the additive operation of the semiring.
+*/
+template< typename MT     // Type of the sparse matrix
+        , typename VT1    // Type of the dense vector
+        , typename VT2    // Type of the result vector
+        , typename OP1    // Type of the additive operation
+        , typename OP2 >  // Type of the multiplicative operation
+void mxvBackend( const MT& A, const VT1& x, VT2& y, const Semiring<OP1,OP2>& sr, TrueType )
+{
+   using ET = ElementType_t<VT2>;
+
+   const size_t m( A.rows() );
+   const size_t n( A.columns() );
+
+   const size_t tasks( ( n >= SMP_TSMATDVECMULT_THRESHOLD && n > 1UL && m > 0UL )
+                       ? min( getNumThreads(), n )
+                       : 1UL );
+   const size_t blockSize( n / tasks + ( n % tasks != 0UL ? 1UL : 0UL ) );
+
+   const auto accumulate = [&]( auto& z, size_t t )
+   {
+      for( size_t i=0UL; i<m; ++i ) {
+         z[i] = sr.template identity<ET>();
+      }
+
+      const size_t jend( min( (t+1UL)*blockSize, n ) );
+
+      for( size_t j=t*blockSize; j<jend; ++j ) {
+         for( auto element=A.begin(j); element!=A.end(j); ++element ) {
+            const size_t i( element->index() );
+            z[i] = sr.add()( z[i], sr.mult()( element->value(), x[j] ) );
+         }
+      }
+   };
+
+   if( tasks == 1UL ) {
+      accumulate( y, 0UL );
+      return;
+   }
+
+   std::vector< DynamicVector<ET> > partials( tasks, DynamicVector<ET>( m ) );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      accumulate( partials[t], t );
+   } );
+
+   const size_t rowBlock( m / tasks + ( m % tasks != 0UL ? 1UL : 0UL ) );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t ibegin( min( t*rowBlock, m ) );
+      const size_t iend  ( min( (t+1UL)*rowBlock, m ) );
+
+      if( ibegin == iend ) return;
+
+      auto ys( subvector( y, ibegin, iend-ibegin, unchecked ) );
+
+      assign( ys, subvector( partials[0UL], ibegin, iend-ibegin, unchecked ) );
+
+      for( size_t p=1UL; p<tasks; ++p ) {
+         const auto zs( subvector( partials[p], ibegin, iend-ibegin, unchecked ) );
+         assign( ys, map( ys, zs, sr.add() ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring-generic multiplication of a sparse matrix and a dense vector.
+// \ingroup sparse_matrix
+//
+// \param A The given sparse matrix.
+// \param x The given dense column vector.
+// \param sr The semiring (optional, default: PlusTimes).
+// \return The resulting dense vector \f$ y_i = \bigoplus_j A_{ij} \otimes x_j \f$.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of the given sparse matrix and dense vector over the given
+// semiring. The sum only runs over the non-zero elements of \a A, i.e. every element of the
+// result starts from the identity element of the additive operation. The following example
+// demonstrates a breadth-first search step and a shortest path relaxation step:
+
+   \code
+   blaze::CompressedMatrix<bool> G;    // Transposed adjacency matrix
+   blaze::CompressedMatrix<double> W;  // Transposed weighted adjacency matrix
+   blaze::DynamicVector<bool> frontier;
+   blaze::DynamicVector<double> d;
+   // ... Resizing and initialization
+
+   frontier = blaze::mxv( G, frontier, blaze::OrAnd() );
+   d = blaze::map( d, blaze::mxv( W, d, blaze::MinPlus() ), blaze::Min() );
+   \endcode
+
+// Row-major matrices are processed row-wise in parallel, column-major matrices by means of
+// thread-private partial results. Note that in case of integral data types the identity element
+// of the (min,+) semiring is the largest representable value, which may overflow on addition.
+// In case the number of columns of \a A does not match the size of \a x, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT            // Type of the sparse matrix
+        , bool SO                // Storage order of the sparse matrix
+        , typename VT            // Type of the dense vector
+        , typename OP1=Add       // Type of the additive operation
+        , typename OP2=Mult >    // Type of the multiplicative operation
+DynamicVector< SemiringElement_t< OP2, ElementType_t<MT>, ElementType_t<VT> > >
+   mxv( const SparseMatrix<MT,SO>& A, const DenseVector<VT,false>& x,
+        const Semiring<OP1,OP2>& sr = Semiring<OP1,OP2>() )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = SemiringElement_t< OP2, ElementType_t<MT>, ElementType_t<VT> >;
+
+   if( (~A).columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_t<MT> tmpA( ~A );
+   CompositeType_t<VT> tmpx( ~x );
+
+   DynamicVector<ET> y( (~A).rows() );
+
+   mxvBackend( tmpA, tmpx, y, sr, BoolConstant<SO>() );
+
+   return y;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the semiring product of two row-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side row-major sparse matrix.
+// \param B The right-hand side row-major sparse matrix.
+// \param sr The semiring.
+// \return The resulting row-major compressed matrix.
+//
+// This function implements the row-by-row (Gustavson) algorithm with a dense accumulator. In
+// a first pass the number of non-zero elements of each row of the result is determined, in a
+// second pass the rows are computed and appended to the preallocated result. In case the
+// number of elements of the result exceeds the \c BLAZE_SMP_SMATSMATMULT_THRESHOLD, both
+// passes distribute the rows among all available threads.
+*/
+template< typename MT1    // Type of the left-hand side sparse matrix
+        , typename MT2    // Type of the right-hand side sparse matrix
+        , typename OP1    // Type of the additive operation
+        , typename OP2 >  // Type of the multiplicative operation
+CompressedMatrix< SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mxmBackend( const MT1& A, const MT2& B, const Semiring<OP1,OP2>& sr )
+{
+   using ET = SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >;
+
+   const size_t m( A.rows() );
+   const size_t n( B.columns() );
+
+   const size_t tasks( ( n > 0UL && m >= SMP_SMATSMATMULT_THRESHOLD / n && m > 1UL )
+                       ? min( getNumThreads(), m )
+                       : 1UL );
+   const size_t blockSize( m / tasks + ( m % tasks != 0UL ? 1UL : 0UL ) );
+
+   // Counting the non-zero elements of each row of the result
+   std::vector<size_t> nonzeros( m, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      std::vector<size_t> mark( n, m );
+
+      const size_t iend( min( (t+1UL)*blockSize, m ) );
+
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         for( auto a=A.begin(i); a!=A.end(i); ++a ) {
+            for( auto b=B.begin(a->index()); b!=B.end(a->index()); ++b ) {
+               if( mark[b->index()] != i ) {
+                  mark[b->index()] = i;
+                  ++nonzeros[i];
+               }
+            }
+         }
+      }
+   } );
+
+   // Computing the rows of the result
+   CompressedMatrix<ET,rowMajor> C( m, n, nonzeros );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      std::vector<size_t> mark( n, m );
+      std::vector<size_t> indices;
+      std::vector<ET> values( n );
+
+      const size_t iend( min( (t+1UL)*blockSize, m ) );
+
+      for( size_t i=t*blockSize; i<iend; ++i )
+      {
+         indices.clear();
+
+         for( auto a=A.begin(i); a!=A.end(i); ++a ) {
+            for( auto b=B.begin(a->index()); b!=B.end(a->index()); ++b ) {
+               const size_t j( b->index() );
+               const ET product( sr.mult()( a->value(), b->value() ) );
+               if( mark[j] != i ) {
+                  mark[j] = i;
+                  values[j] = product;
+                  indices.push_back( j );
+               }
+               else {
+                  values[j] = sr.add()( values[j], product );
+               }
+            }
+         }
+
+         std::sort( indices.begin(), indices.end() );
+
+         for( size_t j : indices ) {
+            C.append( i, j, values[j] );
+         }
+      }
+   } );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Semiring-generic multiplication of two sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param sr The semiring (optional, default: PlusTimes).
+// \return The resulting row-major matrix \f$ C_{ij} = \bigoplus_k A_{ik} \otimes B_{kj} \f$.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the two given sparse matrices over the given semiring.
+// The result contains an element for every structurally non-zero product \f$ A_{ik} B_{kj} \f$,
+// independent of its value. For instance, the (or,and) product of an adjacency matrix with
+// itself yields all paths of length two:
+
+   \code
+   blaze::CompressedMatrix<bool> G;
+   // ... Resizing and initialization
+
+   const blaze::CompressedMatrix<bool> G2( blaze::mxm( G, G, blaze::OrAnd() ) );
+   \endcode
+
+// Column-major operands are converted to row-major storage prior to the multiplication. In
+// case the number of columns of \a A does not match the number of rows of \a B, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1           // Type of the left-hand side sparse matrix
+        , bool SO1               // Storage order of the left-hand side sparse matrix
+        , typename MT2           // Type of the right-hand side sparse matrix
+        , bool SO2               // Storage order of the right-hand side sparse matrix
+        , typename OP1=Add       // Type of the additive operation
+        , typename OP2=Mult >    // Type of the multiplicative operation
+CompressedMatrix< SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mxm( const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B,
+        const Semiring<OP1,OP2>& sr = Semiring<OP1,OP2>() )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using TmpA = If_t< SO1, const CompressedMatrix<ElementType_t<MT1>,rowMajor>, CompositeType_t<MT1> >;
+   using TmpB = If_t< SO2, const CompressedMatrix<ElementType_t<MT2>,rowMajor>, CompositeType_t<MT2> >;
+
+   TmpA tmpA( ~A );
+   TmpB tmpB( ~B );
+
+   return mxmBackend( tmpA, tmpB, sr );
+}
+//*************************************************************************************************
+
+
+//=================================================================================================
+//
+//  CLASS MASKCOMPLEMENT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Complement of the sparsity pattern of a sparse matrix mask.
+// \ingroup sparse_matrix
+//
+// The MaskComplement class template represents the complement of the sparsity pattern of the
+// given sparse matrix. It is created by the complement() function and selects all elements of
+// a masked product (see the mxm() function) that are \b not contained in the mask.
+*/
+template< typename MT  // Type of the sparse matrix mask
+        , bool SO >    // Storage order of the sparse matrix mask
+class MaskComplement
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the MaskComplement class template.
+   //
+   // \param mask The sparse matrix mask.
+   */
+   explicit inline MaskComplement( const SparseMatrix<MT,SO>& mask ) noexcept
+      : mask_( ~mask )  // The sparse matrix mask
+   {}
+   //**********************************************************************************************
+
+   //**Mask function*******************************************************************************
+   /*!\brief Returns the complemented sparse matrix mask.
+   //
+   // \return The complemented sparse matrix mask.
+   */
+   inline const MT& mask() const noexcept { return mask_; }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   const MT& mask_;  //!< The sparse matrix mask.
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complements the sparsity pattern of the given sparse matrix mask.
+// \ingroup sparse_matrix
+//
+// \param mask The sparse matrix mask.
+// \return The complement of the sparsity pattern of the given mask.
+//
+// This function creates the complement of the sparsity pattern of the given sparse matrix for
+// a masked sparse matrix multiplication (see the mxm() function). Note that the returned object
+// refers to the given mask and must not outlive it.
+*/
+template< typename MT  // Type of the sparse matrix mask
+        , bool SO >    // Storage order of the sparse matrix mask
+inline MaskComplement<MT,SO> complement( const SparseMatrix<MT,SO>& mask ) noexcept
+{
+   return MaskComplement<MT,SO>( ~mask );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MASKED SEMIRING PRODUCTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembly of the rows of a masked product.
+// \ingroup sparse_matrix
+//
+// \param m The number of rows of the result.
+// \param n The number of columns of the result.
+// \param tasks The number of tasks.
+// \param kernel The kernel computing the rows of a single task.
+// \return The resulting row-major compressed matrix.
+//
+// The rows of the result are distributed among the given number of tasks. Every task computes
+// its rows into private buffers by means of the given kernel. Afterwards, the buffers are copied
+// in parallel into the preallocated result matrix.
+*/
+template< typename ET        // Element type of the result
+        , typename Kernel >  // Type of the row kernel
+CompressedMatrix<ET,rowMajor> assembleMaskedProduct( size_t m, size_t n, size_t tasks, Kernel kernel )
+{
+   const size_t blockSize( m / tasks + ( m % tasks != 0UL ? 1UL : 0UL ) );
+
+   std::vector< std::vector<size_t> > indices( tasks );
+   std::vector< std::vector<ET> > values( tasks );
+   std::vector<size_t> nonzeros( m, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t iend( min( (t+1UL)*blockSize, m ) );
+
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         const size_t before( indices[t].size() );
+         kernel( i, indices[t], values[t] );
+         nonzeros[i] = indices[t].size() - before;
+      }
+   } );
+
+   CompressedMatrix<ET,rowMajor> C( m, n, nonzeros );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t iend( min( (t+1UL)*blockSize, m ) );
+
+      size_t k( 0UL );
+
+      for( size_t i=t*blockSize; i<iend; ++i ) {
+         for( const size_t kend=k+nonzeros[i]; k<kend; ++k ) {
+            C.append( i, indices[t][k], values[t][k] );
+         }
+      }
+   } );
+
+   return C;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Masked semiring-generic multiplication of two sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param M The sparse matrix mask.
+// \param sr The semiring (optional, default: PlusTimes).
+// \return The resulting row-major matrix \f$ C\langle M \rangle = A B \f$.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the two given sparse matrices over the given semiring
+// only for the positions contained in the sparsity pattern of the mask \a M. The values of the
+// mask are ignored. Every masked element is computed as sparse dot product of a row of \a A and
+// a column of \a B, i.e. the work is proportional to the number of elements of the mask instead
+// of the number of products of the complete multiplication. Masked elements without any common
+// index are not stored. The following example counts the triangles of an undirected graph given
+// by its strictly lower adjacency matrix \a L:
+
+   \code
+   blaze::CompressedMatrix<int> L;
+   // ... Resizing and initialization
+
+   const size_t triangles( blaze::sum( blaze::mxm( L, L, L ) ) );
+   \endcode
+
+// The rows of the result are computed in parallel in case the number of elements of the result
+// exceeds the \c BLAZE_SMP_SMATSMATMULT_THRESHOLD. Row-major right-hand side matrices as well
+// as column-major left-hand side matrices and masks are converted prior to the multiplication.
+// In case the sizes of the matrices do not match, a \a std::invalid_argument exception is thrown.
+*/
+template< typename MT1           // Type of the left-hand side sparse matrix
+        , bool SO1               // Storage order of the left-hand side sparse matrix
+        , typename MT2           // Type of the right-hand side sparse matrix
+        , bool SO2               // Storage order of the right-hand side sparse matrix
+        , typename MT3           // Type of the sparse matrix mask
+        , bool SO3               // Storage order of the sparse matrix mask
+        , typename OP1=Add       // Type of the additive operation
+        , typename OP2=Mult >    // Type of the multiplicative operation
+CompressedMatrix< SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mxm( const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B,
+        const SparseMatrix<MT3,SO3>& M, const Semiring<OP1,OP2>& sr = Semiring<OP1,OP2>() )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >;
+
+   if( (~A).columns() != (~B).rows() ||
+       (~M).rows() != (~A).rows() || (~M).columns() != (~B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using TmpA = If_t< SO1, const CompressedMatrix<ElementType_t<MT1>,rowMajor>, CompositeType_t<MT1> >;
+   using TmpB = If_t< SO2, CompositeType_t<MT2>, const CompressedMatrix<ElementType_t<MT2>,columnMajor> >;
+   using TmpM = If_t< SO3, const CompressedMatrix<ElementType_t<MT3>,rowMajor>, CompositeType_t<MT3> >;
+
+   TmpA tmpA( ~A );
+   TmpB tmpB( ~B );
+   TmpM tmpM( ~M );
+
+   const size_t m( tmpA.rows() );
+   const size_t n( tmpB.columns() );
+
+   const size_t tasks( ( n > 0UL && m >= SMP_SMATSMATMULT_THRESHOLD / n && m > 1UL )
+                       ? min( getNumThreads(), m )
+                       : 1UL );
+
+   return assembleMaskedProduct<ET>( m, n, tasks,
+      [&]( size_t i, std::vector<size_t>& indices, std::vector<ET>& values )
+   {
+      const auto abegin( tmpA.begin(i) );
+      const auto aend  ( tmpA.end(i) );
+
+      if( abegin == aend ) return;
+
+      for( auto mask=tmpM.begin(i); mask!=tmpM.end(i); ++mask )
+      {
+         const size_t j( mask->index() );
+
+         auto a( abegin );
+         auto b( tmpB.begin(j) );
+         const auto bend( tmpB.end(j) );
+
+         bool found( false );
+         ET value( sr.template identity<ET>() );
+
+         while( a != aend && b != bend ) {
+            if( a->index() < b->index() ) ++a;
+            else if( b->index() < a->index() ) ++b;
+            else {
+               value = sr.add()( value, sr.mult()( a->value(), b->value() ) );
+               found = true;
+               ++a;
+               ++b;
+            }
+         }
+
+         if( found ) {
+            indices.push_back( j );
+            values.push_back( value );
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Complement-masked semiring-generic multiplication of two sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side sparse matrix.
+// \param M The complemented sparse matrix mask.
+// \param sr The semiring (optional, default: PlusTimes).
+// \return The resulting row-major matrix \f$ C\langle \neg M \rangle = A B \f$.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the product of the two given sparse matrices over the given semiring
+// only for the positions that are \b not contained in the sparsity pattern of the mask \a M.
+// The rows of the result are computed by the row-by-row algorithm, which skips the accumulation
+// of all products that fall into the mask. The following example computes the vertices that are
+// reachable in two steps but not in a single step:
+
+   \code
+   blaze::CompressedMatrix<bool> G;
+   // ... Resizing and initialization
+
+   const blaze::CompressedMatrix<bool> R( blaze::mxm( G, G, blaze::complement( G ), blaze::OrAnd() ) );
+   \endcode
+
+// The rows of the result are computed in parallel in case the number of elements of the result
+// exceeds the \c BLAZE_SMP_SMATSMATMULT_THRESHOLD. Column-major matrices are converted prior to
+// the multiplication. In case the sizes of the matrices do not match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename MT1           // Type of the left-hand side sparse matrix
+        , bool SO1               // Storage order of the left-hand side sparse matrix
+        , typename MT2           // Type of the right-hand side sparse matrix
+        , bool SO2               // Storage order of the right-hand side sparse matrix
+        , typename MT3           // Type of the sparse matrix mask
+        , bool SO3               // Storage order of the sparse matrix mask
+        , typename OP1=Add       // Type of the additive operation
+        , typename OP2=Mult >    // Type of the multiplicative operation
+CompressedMatrix< SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >, rowMajor >
+   mxm( const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B,
+        const MaskComplement<MT3,SO3>& M, const Semiring<OP1,OP2>& sr = Semiring<OP1,OP2>() )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using ET = SemiringElement_t< OP2, ElementType_t<MT1>, ElementType_t<MT2> >;
+
+   if( (~A).columns() != (~B).rows() ||
+       M.mask().rows() != (~A).rows() || M.mask().columns() != (~B).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using TmpA = If_t< SO1, const CompressedMatrix<ElementType_t<MT1>,rowMajor>, CompositeType_t<MT1> >;
+   using TmpB = If_t< SO2, const CompressedMatrix<ElementType_t<MT2>,rowMajor>, CompositeType_t<MT2> >;
+   using TmpM = If_t< SO3, const CompressedMatrix<ElementType_t<MT3>,rowMajor>, CompositeType_t<MT3> >;
+
+   TmpA tmpA( ~A );
+   TmpB tmpB( ~B );
+   TmpM tmpM( M.mask() );
+
+   const size_t m( tmpA.rows() );
+   const size_t n( tmpB.columns() );
+
+   const size_t tasks( ( n > 0UL && m >= SMP_SMATSMATMULT_THRESHOLD / n && m > 1UL )
+                       ? min( getNumThreads(), m )
+                       : 1UL );
+
+   // Per-task accumulators, indexed by the task owning the current row
+   const size_t blockSize( m / tasks + ( m % tasks != 0UL ? 1UL : 0UL ) );
+
+   std::vector< std::vector<size_t> > marks( tasks, std::vector<size_t>( n, 2UL*m ) );
+   std::vector< std::vector<ET> > accumulators( tasks, std::vector<ET>( n ) );
+   std::vector< std::vector<size_t> > columns( tasks );
+
+   return assembleMaskedProduct<ET>( m, n, tasks,
+      [&]( size_t i, std::vector<size_t>& indices, std::vector<ET>& values )
+   {
+      const size_t t( i / blockSize );
+
+      std::vector<size_t>& mark( marks[t] );
+      std::vector<ET>& acc( accumulators[t] );
+      std::vector<size_t>& cols( columns[t] );
+
+      // Excluding all masked elements of the current row
+      for( auto mask=tmpM.begin(i); mask!=tmpM.end(i); ++mask ) {
+         mark[mask->index()] = 2UL*i;
+      }
+
+      cols.clear();
+
+      for( auto a=tmpA.begin(i); a!=tmpA.end(i); ++a ) {
+         for( auto b=tmpB.begin(a->index()); b!=tmpB.end(a->index()); ++b )
+         {
+            const size_t j( b->index() );
+
+            if( mark[j] == 2UL*i ) continue;
+
+            const ET product( sr.mult()( a->value(), b->value() ) );
+
+            if( mark[j] != 2UL*i+1UL ) {
+               mark[j] = 2UL*i+1UL;
+               acc[j] = product;
+               cols.push_back( j );
+            }
+            else {
+               acc[j] = sr.add()( acc[j], product );
+            }
+         }
+      }
+
+      std::sort( cols.begin(), cols.end() );
+
+      for( size_t j : cols ) {
+         indices.push_back( j );
+         values.push_back( acc[j] );
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,512 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SymmetricMult.h
+//  \brief Header file for the half-storage symmetric sparse matrix/dense vector multiplication
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SPARSE_SYMMETRICMULT_H_
+#define _BLAZE_MATH_SPARSE_SYMMETRICMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SYMMETRIC SPARSE MATRIX/DENSE VECTOR MULTIPLICATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the half-storage symmetric sparse matrix/dense vector
+//        multiplication.
+// \ingroup sparse_matrix
+//
+// \param y The resulting dense vector.
+// \param A The triangular sparse matrix.
+// \param x The dense vector.
+// \return void
+//
+// Every stored element \f$ a_{kj} \f$ of row/column \a k contributes \f$ a_{kj} x_j \f$ to
+// \f$ y_k \f$ and, in case it is an off-diagonal element, \f$ a_{kj} x_k \f$ to \f$ y_j \f$.
+// The rows/columns are distributed among all available threads in case their number reaches
+// the \c BLAZE_SMP_SMATDVECMULT_THRESHOLD. Every thread only writes the elements of \a y that
+// correspond to its own rows/columns; contributions to other elements are collected in a
+// thread-private vector, which only covers the range of indices touched by the rows/columns of
+// the thread. The private vectors are added to the result in parallel afterwards, where every
+// thread only adds the overlap of the private vectors with its own rows/columns.
+*/
+template< typename VT1    // Type of the result vector
+        , typename MT     // Type of the sparse matrix
+        , typename VT2 >  // Type of the dense vector
+void symvBackend( VT1& y, const MT& A, const VT2& x )
+{
+   using ET = ElementType_t<VT1>;
+
+   const size_t n( A.rows() );
+
+   const size_t tasks( ( n >= SMP_SMATDVECMULT_THRESHOLD && n > 1UL )
+                       ? min( getNumThreads(), n )
+                       : 1UL );
+   const size_t blockSize( n / tasks + ( n % tasks != 0UL ? 1UL : 0UL ) );
+
+   std::vector< DynamicVector<ET> > partials( tasks > 1UL ? tasks : 0UL );
+   std::vector<size_t> offsets( tasks, 0UL );
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t kbegin( min( t*blockSize, n ) );
+      const size_t kend  ( min( (t+1UL)*blockSize, n ) );
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         y[k] = ET();
+      }
+
+      DynamicVector<ET>* z( nullptr );
+
+      if( tasks > 1UL )
+      {
+         // Restricting the private vector to the range of indices touched by the rows/columns
+         size_t jbegin( kbegin );
+         size_t jend  ( kend   );
+
+         for( size_t k=kbegin; k<kend; ++k ) {
+            for( auto element=A.begin(k); element!=A.end(k); ++element ) {
+               jbegin = min( jbegin, element->index() );
+               jend   = max( jend, element->index()+1UL );
+            }
+         }
+
+         partials[t].resize( jend-jbegin, false );
+         partials[t] = ET();
+         offsets[t] = jbegin;
+         z = &partials[t];
+      }
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         ET value = ET();
+
+         for( auto element=A.begin(k); element!=A.end(k); ++element )
+         {
+            const size_t j( element->index() );
+
+            value += element->value() * x[j];
+
+            if( j == k ) continue;
+
+            if( z == nullptr || ( j >= kbegin && j < kend ) )
+               y[j] += element->value() * x[k];
+            else
+               (*z)[j-offsets[t]] += element->value() * x[k];
+         }
+
+         y[k] += value;
+      }
+   } );
+
+   if( tasks == 1UL ) return;
+
+   smpFor( tasks, [&]( size_t t )
+   {
+      const size_t kbegin( min( t*blockSize, n ) );
+      const size_t kend  ( min( (t+1UL)*blockSize, n ) );
+
+      for( size_t p=0UL; p<tasks; ++p )
+      {
+         const size_t ibegin( max( kbegin, offsets[p] ) );
+         const size_t iend  ( min( kend, offsets[p]+partials[p].size() ) );
+
+         if( p == t || ibegin >= iend ) continue;
+
+         auto ys( subvector( y, ibegin, iend-ibegin, unchecked ) );
+         addAssign( ys, subvector( partials[p], ibegin-offsets[p], iend-ibegin, unchecked ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a half-storage symmetric sparse matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param y The resulting dense vector.
+// \param A The lower or upper triangle of the symmetric sparse matrix.
+// \param x The dense vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function computes the product of a symmetric sparse matrix and a dense vector, where
+// only the lower or the upper triangle of the symmetric matrix \f$ S = A + A^T - diag(A) \f$
+// is stored in \a A. In comparison to a SymmetricMatrix, which stores both triangles, the half
+// storage reduces both the memory footprint and the memory bandwidth of the multiplication
+// by up to a factor of two. Every off-diagonal element of \a A is applied twice:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+
+   LowerMatrix< CompressedMatrix<double> > L;  // Lower triangle of the stiffness matrix
+   DynamicVector<double> x, y;
+   // ... Resizing and initialization
+
+   blaze::symv( y, L, x );  // Multiplication with the complete symmetric matrix
+   \endcode
+
+// The given matrix can be any row-major or column-major sparse matrix whose elements are
+// restricted to one triangle, for instance a LowerMatrix, an UpperMatrix or a CompressedMatrix
+// that has been assembled as triangular matrix. In case the result vector \a y has a size
+// different from the number of rows of \a A it is resized accordingly. Note that \a y and \a x
+// must not refer to the same vector. In case \a A is not square, in case \a A is neither a
+// lower nor an upper triangular matrix, or in case the size of \a x does not match, a
+// \a std::invalid_argument exception is thrown. Note that for matrices that are not known to be
+// triangular at compile time this check traverses all non-zero elements of \a A. In order to
+// avoid the check for repeated multiplications, the triangle can be stored in a
+// HalfSymmetricMatrix, which checks its triangle only once during construction.
+*/
+template< typename VT1    // Type of the result vector
+        , typename MT     // Type of the sparse matrix
+        , bool SO         // Storage order of the sparse matrix
+        , typename VT2 >  // Type of the dense vector
+void symv( DenseVector<VT1,false>& y, const SparseMatrix<MT,SO>& A, const DenseVector<VT2,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   BLAZE_USER_ASSERT( !isSame( ~y, ~x ), "Aliasing of the result and the operand vector detected" );
+
+   CompositeType_t<MT>  tmpA( ~A );
+   CompositeType_t<VT2> tmpx( ~x );
+
+   if( !IsLower_v<MT> && !IsUpper_v<MT> && !isLower( tmpA ) && !isUpper( tmpA ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-triangular matrix provided" );
+   }
+
+   resize( ~y, tmpA.rows(), false );
+
+   symvBackend( ~y, tmpA, tmpx );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of a half-storage symmetric sparse matrix and a dense vector
+//        (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param A The lower or upper triangle of the symmetric sparse matrix.
+// \param x The dense vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function returns the product of the symmetric sparse matrix, whose lower or upper
+// triangle is stored in \a A, and the given dense vector. See the three-argument overload
+// for details.
+*/
+template< typename MT    // Type of the sparse matrix
+        , bool SO        // Storage order of the sparse matrix
+        , typename VT >  // Type of the dense vector
+DynamicVector< MultTrait_t< ElementType_t<MT>, ElementType_t<VT> > >
+   symv( const SparseMatrix<MT,SO>& A, const DenseVector<VT,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   DynamicVector< MultTrait_t< ElementType_t<MT>, ElementType_t<VT> > > y;
+   symv( y, ~A, ~x );
+
+   return y;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS HALFSYMMETRICMATRIX
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Half-storage adaptor for symmetric sparse matrices.
+// \ingroup sparse_matrix
+//
+// The HalfSymmetricMatrix class template stores only the lower or the upper triangle of a
+// symmetric sparse matrix \f$ S = A + A^T - diag(A) \f$ in the given sparse matrix type \a MT.
+// In contrast to a plain triangular matrix, the multiplication of a HalfSymmetricMatrix with
+// a dense vector computes the product with the complete symmetric matrix (see symv()):
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::HalfSymmetricMatrix;
+
+   CompressedMatrix<double> L;  // Lower triangle of the stiffness matrix
+   DynamicVector<double> x;
+   // ... Resizing and initialization
+
+   const HalfSymmetricMatrix< CompressedMatrix<double> > S( L );
+
+   DynamicVector<double> y( S * x );  // Multiplication with the complete symmetric matrix
+   \endcode
+
+// The given triangle is checked once during the construction; a non-square matrix or a matrix
+// that is neither lower nor upper triangular results in a \a std::invalid_argument exception.
+// Since the triangle is only accessible as constant reference, it remains triangular for the
+// lifetime of the adaptor.
+*/
+template< typename MT >  // Type of the sparse matrix
+class HalfSymmetricMatrix
+{
+ public:
+   //**Type definitions****************************************************************************
+   using MatrixType  = MT;                 //!< Type of the stored triangle.
+   using ElementType = ElementType_t<MT>;  //!< Type of the matrix elements.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline HalfSymmetricMatrix( const MT& triangle );
+   explicit inline HalfSymmetricMatrix( MT&& triangle );
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t    rows()     const noexcept;
+   inline size_t    columns()  const noexcept;
+   inline const MT& triangle() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void check() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT triangle_;  //!< The lower or upper triangle of the symmetric matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_SPARSE_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a HalfSymmetricMatrix.
+//
+// \param triangle The lower or upper triangle of the symmetric matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline HalfSymmetricMatrix<MT>::HalfSymmetricMatrix( const MT& triangle )
+   : triangle_( triangle )  // The lower or upper triangle of the symmetric matrix
+{
+   check();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move constructor for a HalfSymmetricMatrix.
+//
+// \param triangle The lower or upper triangle of the symmetric matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline HalfSymmetricMatrix<MT>::HalfSymmetricMatrix( MT&& triangle )
+   : triangle_( std::move( triangle ) )  // The lower or upper triangle of the symmetric matrix
+{
+   check();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the symmetric matrix.
+//
+// \return The number of rows of the symmetric matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline size_t HalfSymmetricMatrix<MT>::rows() const noexcept
+{
+   return triangle_.rows();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the symmetric matrix.
+//
+// \return The number of columns of the symmetric matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline size_t HalfSymmetricMatrix<MT>::columns() const noexcept
+{
+   return triangle_.columns();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the stored triangle of the symmetric matrix.
+//
+// \return Reference to the lower or upper triangle of the symmetric matrix.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline const MT& HalfSymmetricMatrix<MT>::triangle() const noexcept
+{
+   return triangle_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checks that the stored matrix is a square, triangular matrix.
+//
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+*/
+template< typename MT >  // Type of the sparse matrix
+inline void HalfSymmetricMatrix<MT>::check() const
+{
+   if( !isSquare( triangle_ ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( !IsLower_v<MT> && !IsUpper_v<MT> && !isLower( triangle_ ) && !isUpper( triangle_ ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-triangular matrix provided" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication operator for the multiplication of a half-storage symmetric sparse matrix
+//        and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup sparse_matrix
+//
+// \param A The half-storage symmetric sparse matrix.
+// \param x The dense vector.
+// \return The resulting dense vector.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This operator computes the product of the complete symmetric matrix and the given dense
+// vector. In contrast to symv(), the triangle of the matrix is not checked again.
+*/
+template< typename MT    // Type of the sparse matrix
+        , typename VT >  // Type of the dense vector
+inline DynamicVector< MultTrait_t< ElementType_t<MT>, ElementType_t<VT> > >
+   operator*( const HalfSymmetricMatrix<MT>& A, const DenseVector<VT,false>& x )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( A.columns() != (~x).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_t<VT> tmpx( ~x );
+
+   DynamicVector< MultTrait_t< ElementType_t<MT>, ElementType_t<VT> > > y( A.rows() );
+   symvBackend( y, A.triangle(), tmpx );
+
+   return y;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,818 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/TriangularSolve.h
+//  \brief Header file for the sparse triangular solve functions
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_TRIANGULARSOLVE_H_
+#define _BLAZE_MATH_SPARSE_TRIANGULARSOLVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/sparse/SparseMatrix.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUniLower.h>
+#include <blaze/math/typetraits/IsUniUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Level schedule for the parallel solution of sparse triangular systems.
+// \ingroup sparse_matrix
+//
+// The LevelSchedule class represents the result of the dependency analysis of a sparse lower or
+// upper triangular matrix. The rows of the matrix are grouped into levels such that the rows of
+// a single level only depend on rows of preceding levels. Consequently, all rows of a level can
+// be computed in parallel during a forward or backward substitution (see the solve() functions
+// for sparse matrices).
+//
+// The analysis only depends on the sparsity pattern of the matrix. Therefore a level schedule
+// can be computed once and reused for any number of solves with matrices of the same pattern,
+// as for instance in case of the repeated application of an incomplete factorization as
+// preconditioner:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+   using blaze::LowerMatrix;
+
+   LowerMatrix< CompressedMatrix<double> > L;
+   DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );  // Dependency analysis of the sparsity pattern
+
+   for( ... ) {
+      solve( L, x, b, schedule );  // Level-scheduled forward substitution
+   }
+   \endcode
+
+// The lower or upper triangular structure of the given matrix is determined at compile time in
+// case of a lower or upper adaptor and at runtime in case of any other sparse matrix.
+*/
+class LevelSchedule
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline LevelSchedule();
+
+   template< typename MT, bool SO >
+   explicit inline LevelSchedule( const SparseMatrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t        size()     const noexcept;
+   inline size_t        nonZeros() const noexcept;
+   inline size_t        levels()   const noexcept;
+   inline size_t        size ( size_t l ) const noexcept;
+   inline const size_t* begin( size_t l ) const noexcept;
+   inline const size_t* end  ( size_t l ) const noexcept;
+   inline bool          isLower()  const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t n_;                  //!< The number of rows of the analyzed matrix.
+   size_t nonzeros_;           //!< The number of non-zero elements of the analyzed matrix.
+   bool   lower_;              //!< \a true in case of a lower, \a false in case of an upper matrix.
+   std::vector<size_t> ptr_;   //!< Offsets of the first row of each level.
+   std::vector<size_t> rows_;  //!< The row indices sorted by level.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for LevelSchedule.
+//
+// The default constructor creates the level schedule of a \f$ 0 \times 0 \f$ matrix.
+*/
+inline LevelSchedule::LevelSchedule()
+   : n_       ( 0UL )      // The number of rows of the analyzed matrix
+   , nonzeros_( 0UL )      // The number of non-zero elements of the analyzed matrix
+   , lower_   ( true )     // Lower or upper triangular matrix
+   , ptr_     ( 1UL, 0UL ) // Offsets of the first row of each level
+   , rows_    ()           // The row indices sorted by level
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dependency analysis of the given sparse triangular matrix.
+//
+// \param A The given lower or upper triangular sparse matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+//
+// This constructor computes the level of each row of the given lower or upper triangular
+// matrix. The level of a row is one larger than the maximum level of all rows it depends on.
+// In case the given matrix is neither lower nor upper triangular, a \a std::invalid_argument
+// exception is thrown. Diagonal matrices are treated as lower triangular matrices.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+inline LevelSchedule::LevelSchedule( const SparseMatrix<MT,SO>& A )
+   : LevelSchedule()
+{
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_t<MT> tmp( ~A );
+
+   lower_ = IsLower_v<MT> || ( !IsUpper_v<MT> && blaze::isLower( tmp ) );
+
+   if( !lower_ && !IsUpper_v<MT> && !blaze::isUpper( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-triangular matrix provided" );
+   }
+
+   n_        = tmp.rows();
+   nonzeros_ = tmp.nonZeros();
+
+   std::vector<size_t> level( n_, 0UL );
+   size_t maxLevel( 0UL );
+
+   // Computing the level of each row
+   for( size_t k=0UL; k<n_; ++k )
+   {
+      const size_t i( lower_ ? k : n_-k-1UL );
+
+      if( !SO ) {
+         for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+            const size_t j( element->index() );
+            if( lower_ ? j < i : j > i )
+               level[i] = max( level[i], level[j]+1UL );
+         }
+         maxLevel = max( maxLevel, level[i] );
+      }
+      else {
+         for( auto element=tmp.begin(i); element!=tmp.end(i); ++element ) {
+            const size_t j( element->index() );
+            if( lower_ ? j > i : j < i )
+               level[j] = max( level[j], level[i]+1UL );
+         }
+         maxLevel = max( maxLevel, level[i] );
+      }
+   }
+
+   if( n_ == 0UL ) return;
+
+   // Sorting the rows by level
+   ptr_.assign( maxLevel+2UL, 0UL );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      ++ptr_[level[i]+1UL];
+   }
+   for( size_t l=0UL; l<=maxLevel; ++l ) {
+      ptr_[l+1UL] += ptr_[l];
+   }
+
+   std::vector<size_t> pos( ptr_.begin(), ptr_.end()-1L );
+   rows_.resize( n_ );
+
+   for( size_t i=0UL; i<n_; ++i ) {
+      rows_[pos[level[i]]++] = i;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the analyzed matrix.
+//
+// \return The number of rows of the analyzed matrix.
+*/
+inline size_t LevelSchedule::size() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements of the analyzed matrix.
+//
+// \return The number of non-zero elements of the analyzed matrix.
+*/
+inline size_t LevelSchedule::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of levels of the schedule.
+//
+// \return The number of levels.
+*/
+inline size_t LevelSchedule::levels() const noexcept
+{
+   return ptr_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows of the given level.
+//
+// \param l The index of the level.
+// \return The number of rows of level \a l.
+*/
+inline size_t LevelSchedule::size( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return ptr_[l+1UL] - ptr_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer to the first row index of the given level.
+//
+// \param l The index of the level.
+// \return Pointer to the first row index of level \a l.
+*/
+inline const size_t* LevelSchedule::begin( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return rows_.data() + ptr_[l];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns a pointer just past the last row index of the given level.
+//
+// \param l The index of the level.
+// \return Pointer just past the last row index of level \a l.
+*/
+inline const size_t* LevelSchedule::end( size_t l ) const noexcept
+{
+   BLAZE_USER_ASSERT( l < levels(), "Invalid level access index" );
+   return rows_.data() + ptr_[l+1UL];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the analyzed matrix is lower or upper triangular.
+//
+// \return \a true in case of a lower triangular matrix, \a false in case of an upper matrix.
+*/
+inline bool LevelSchedule::isLower() const noexcept
+{
+   return lower_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIANGULAR SOLVE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Triangular solve functions */
+//@{
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b );
+
+template< typename MT, bool SO, typename VT1, typename VT2 >
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b, const LevelSchedule& schedule );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B );
+
+template< typename MT1, bool SO1, typename MT2, bool SO2, typename MT3, bool SO3 >
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B, const LevelSchedule& schedule );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executes the given row kernel for all rows of a level schedule.
+// \ingroup sparse_matrix
+//
+// \param schedule The level schedule.
+// \param kernel The row kernel, which returns \a false in case of a singular diagonal element.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function processes the levels of the given schedule one after another. The rows of
+// a level are distributed among the available threads in case the number of rows reaches
+// the BLAZE_SMP_SMATTRSV_THRESHOLD.
+*/
+template< typename Kernel >  // Type of the row kernel
+void solveLevels( const LevelSchedule& schedule, Kernel kernel )
+{
+   std::atomic<bool> singular( false );
+
+   for( size_t l=0UL; l<schedule.levels(); ++l )
+   {
+      const size_t* const rows( schedule.begin(l) );
+      const size_t size( schedule.size(l) );
+
+      const size_t tasks( ( size >= SMP_SMATTRSV_THRESHOLD && size > 1UL )
+                          ? min( getNumThreads(), size )
+                          : 1UL );
+      const size_t blockSize( size / tasks + ( size % tasks != 0UL ? 1UL : 0UL ) );
+
+      smpFor( tasks, [&]( size_t t )
+      {
+         const size_t kend( min( (t+1UL)*blockSize, size ) );
+         for( size_t k=t*blockSize; k<kend; ++k ) {
+            if( !kernel( rows[k] ) )
+               singular = true;
+         }
+      } );
+
+      if( singular ) {
+         BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the level-scheduled triangular solve for row-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The row-major triangular system matrix.
+// \param x The right-hand side vector, which is overwritten with the solution.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT    // Type of the system matrix
+        , typename VT >  // Type of the solution vector
+void solveBackend( const MT& A, DenseVector<VT,false>& x, const LevelSchedule& schedule,
+                   FalseType /*columnMajor*/ )
+{
+   using ET = ElementType_t<VT>;
+
+   constexpr bool unit( IsUniLower_v<MT> || IsUniUpper_v<MT> );
+
+   const bool lower( schedule.isLower() );
+
+   solveLevels( schedule, [&]( size_t i )
+   {
+      ET sum( (~x)[i] );
+      ElementType_t<MT> diag{};
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( lower ? j < i : j > i )
+            sum -= element->value() * (~x)[j];
+         else if( j == i )
+            diag = element->value();
+      }
+
+      if( unit ) {
+         (~x)[i] = sum;
+      }
+      else {
+         if( isDefault( diag ) ) return false;
+         (~x)[i] = sum / diag;
+      }
+
+      return true;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the triangular solve for column-major sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The column-major triangular system matrix.
+// \param x The right-hand side vector, which is overwritten with the solution.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// Since the columns of a column-major matrix scatter their contributions to the subsequent
+// rows, the substitution is performed column by column by the calling thread.
+*/
+template< typename MT    // Type of the system matrix
+        , typename VT >  // Type of the solution vector
+void solveBackend( const MT& A, DenseVector<VT,false>& x, const LevelSchedule& schedule,
+                   TrueType /*columnMajor*/ )
+{
+   using ET = ElementType_t<VT>;
+
+   constexpr bool unit( IsUniLower_v<MT> || IsUniUpper_v<MT> );
+
+   const bool lower( schedule.isLower() );
+   const size_t n( A.columns() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t j( lower ? k : n-k-1UL );
+
+      if( !unit ) {
+         const auto diag( A.find( j, j ) );
+         if( diag == A.end(j) || isDefault( diag->value() ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+         }
+         (~x)[j] /= diag->value();
+      }
+
+      const ET xj( (~x)[j] );
+
+      for( auto element=A.begin(j); element!=A.end(j); ++element ) {
+         const size_t i( element->index() );
+         if( lower ? i > j : i < j )
+            (~x)[i] -= element->value() * xj;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the level-scheduled triangular solve with multiple right-hand sides.
+// \ingroup sparse_matrix
+//
+// \param A The row-major triangular system matrix.
+// \param X The right-hand side matrix, which is overwritten with the solution.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT1   // Type of the system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2 >     // Storage order of the solution matrix
+void solveBackend( const MT1& A, DenseMatrix<MT2,SO2>& X, const LevelSchedule& schedule,
+                   FalseType /*columnMajor*/ )
+{
+   constexpr bool unit( IsUniLower_v<MT1> || IsUniUpper_v<MT1> );
+
+   const bool lower( schedule.isLower() );
+
+   solveLevels( schedule, [&]( size_t i )
+   {
+      auto xi( row( ~X, i, unchecked ) );
+      ElementType_t<MT1> diag{};
+
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         const size_t j( element->index() );
+         if( lower ? j < i : j > i )
+            subAssign( xi, element->value() * row( ~X, j, unchecked ) );
+         else if( j == i )
+            diag = element->value();
+      }
+
+      if( !unit ) {
+         if( isDefault( diag ) ) return false;
+         assign( xi, xi / diag );
+      }
+
+      return true;
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the triangular solve with multiple right-hand sides for column-major
+//        sparse matrices.
+// \ingroup sparse_matrix
+//
+// \param A The column-major triangular system matrix.
+// \param X The right-hand side matrix, which is overwritten with the solution.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+*/
+template< typename MT1   // Type of the system matrix
+        , typename MT2   // Type of the solution matrix
+        , bool SO2 >     // Storage order of the solution matrix
+void solveBackend( const MT1& A, DenseMatrix<MT2,SO2>& X, const LevelSchedule& schedule,
+                   TrueType /*columnMajor*/ )
+{
+   constexpr bool unit( IsUniLower_v<MT1> || IsUniUpper_v<MT1> );
+
+   const bool lower( schedule.isLower() );
+   const size_t n( A.columns() );
+
+   for( size_t k=0UL; k<n; ++k )
+   {
+      const size_t j( lower ? k : n-k-1UL );
+      auto xj( row( ~X, j, unchecked ) );
+
+      if( !unit ) {
+         const auto diag( A.find( j, j ) );
+         if( diag == A.end(j) || isDefault( diag->value() ) ) {
+            BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+         }
+         assign( xj, xj / diag->value() );
+      }
+
+      for( auto element=A.begin(j); element!=A.end(j); ++element ) {
+         const size_t i( element->index() );
+         if( lower ? i > j : i < j )
+         {
+            auto xi( row( ~X, i, unchecked ) );
+            subAssign( xi, element->value() * xj );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations (\f$ A*x=b \f$).
+// \ingroup sparse_matrix
+//
+// \param A The lower or upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the sparse triangular linear system of equations \f$ A*x=b \f$ by means
+// of forward substitution (in case \a A is lower triangular) or backward substitution (in case
+// \a A is upper triangular). For that purpose, it performs a dependency analysis of the matrix
+// (see the LevelSchedule class), which is not retained. For repeated solves with matrices of
+// the same sparsity pattern, the level schedule should be computed once and passed to the
+// according overload of the solve() function:
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   solve( L, x, b );  // Solving the lower triangular system L*x=b
+   \endcode
+
+// In case the diagonal of \a A contains a zero element, a \a std::runtime_error exception is
+// thrown. In case \a A is a unilower or uniupper matrix, the diagonal elements are assumed
+// to be 1.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<MT> tmp( ~A );
+
+   solve( tmp, ~x, ~b, LevelSchedule( tmp ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations (\f$ A*x=b \f$).
+// \ingroup sparse_matrix
+//
+// \param A The lower or upper triangular system matrix.
+// \param x The resulting solution vector.
+// \param b The right-hand side vector.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the sparse triangular linear system of equations \f$ A*x=b \f$ based on
+// the given level schedule, which must have been computed for a matrix with the same sparsity
+// pattern as \a A. In case \a A is stored in row-major order, all rows of a level are computed
+// in parallel (in case the number of rows of the level reaches the BLAZE_SMP_SMATTRSV_THRESHOLD).
+// In case \a A is stored in column-major order, the system is solved column by column by the
+// calling thread.
+
+   \code
+   blaze::LowerMatrix< blaze::CompressedMatrix<double> > L;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::LevelSchedule schedule( L );
+
+   solve( L, x, b, schedule );  // Solving the lower triangular system L*x=b
+   \endcode
+
+// Note that the right-hand side vector \a b may be identical to the solution vector \a x.
+*/
+template< typename MT     // Type of the system matrix
+        , bool SO         // Storage order of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void solve( const SparseMatrix<MT,SO>& A, DenseVector<VT1,false>& x,
+            const DenseVector<VT2,false>& b, const LevelSchedule& schedule )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( schedule.size() != (~A).rows() || schedule.size() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid level schedule provided" );
+   }
+
+   if( (~A).columns() != (~b).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+
+   CompositeType_t<MT> tmp( ~A );
+
+   BLAZE_USER_ASSERT( tmp.nonZeros() == schedule.nonZeros(), "Invalid level schedule detected" );
+
+   (~x) = ~b;
+
+   solveBackend( tmp, ~x, schedule, BoolConstant<SO>() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations (\f$ A*X=B \f$).
+// \ingroup sparse_matrix
+//
+// \param A The lower or upper triangular system matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Invalid non-triangular matrix provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the sparse triangular linear system of equations \f$ A*X=B \f$ with
+// multiple right-hand sides. For that purpose, it performs a dependency analysis of the matrix
+// (see the LevelSchedule class), which is not retained.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the solution matrix
+        , bool SO2      // Storage order of the solution matrix
+        , typename MT3  // Type of the right-hand side matrix
+        , bool SO3 >    // Storage order of the right-hand side matrix
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   CompositeType_t<MT1> tmp( ~A );
+
+   solve( tmp, ~X, ~B, LevelSchedule( tmp ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solving the given sparse triangular linear system of equations (\f$ A*X=B \f$).
+// \ingroup sparse_matrix
+//
+// \param A The lower or upper triangular system matrix.
+// \param X The resulting solution matrix.
+// \param B The right-hand side matrix.
+// \param schedule The level schedule of the system matrix.
+// \return void
+// \exception std::invalid_argument Invalid level schedule provided.
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the sparse triangular linear system of equations \f$ A*X=B \f$ with
+// multiple right-hand sides based on the given level schedule, which must have been computed
+// for a matrix with the same sparsity pattern as \a A. In case \a A is stored in row-major
+// order, all rows of a level are computed in parallel. The solution is most efficient for a
+// row-major solution matrix \a X.
+*/
+template< typename MT1  // Type of the system matrix
+        , bool SO1      // Storage order of the system matrix
+        , typename MT2  // Type of the solution matrix
+        , bool SO2      // Storage order of the solution matrix
+        , typename MT3  // Type of the right-hand side matrix
+        , bool SO3 >    // Storage order of the right-hand side matrix
+void solve( const SparseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& X,
+            const DenseMatrix<MT3,SO3>& B, const LevelSchedule& schedule )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( schedule.size() != (~A).rows() || schedule.size() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid level schedule provided" );
+   }
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT1> tmp( ~A );
+
+   BLAZE_USER_ASSERT( tmp.nonZeros() == schedule.nonZeros(), "Invalid level schedule detected" );
+
+   (~X) = ~B;
+
+   solveBackend( tmp, ~X, schedule, BoolConstant<SO1>() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
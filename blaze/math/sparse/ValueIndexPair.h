@@ -40,11 +40,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <limits>
 #include <blaze/math/sparse/SparseElement.h>
 #include <blaze/math/typetraits/IsSparseElement.h>
+#include <blaze/util/Assert.h>
 #include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
 #include <blaze/util/constraints/Pointer.h>
 #include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
 #include <blaze/util/constraints/Volatile.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/And.h>
@@ -67,9 +71,13 @@ namespace blaze {
 // \ingroup math
 //
 // The ValueIndexPair class represents a single index-value-pair of a sparse vector or sparse
-// matrix.
+// matrix. The second template parameter specifies the type used to store the index. By default
+// the index is stored as \c size_t, but a smaller unsigned integral type (as for instance
+// \c uint32_t) can be used to reduce the memory footprint of the pair. Independent of the
+// storage type, the index is always accessed as \c size_t.
 */
-template< typename Type >  // Type of the value element
+template< typename Type           // Type of the value element
+        , typename IT = size_t >  // Type of the stored index
 class ValueIndexPair
    : private SparseElement
 {
@@ -143,15 +151,15 @@ class ValueIndexPair
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   Type   value_;  //!< Value of the value-index-pair.
-   size_t index_;  //!< Index of the value-index-pair.
+   Type value_;  //!< Value of the value-index-pair.
+   IT   index_;  //!< Index of the value-index-pair.
    //@}
    //**********************************************************************************************
 
  private:
    //**Friend declarations*************************************************************************
    /*! \cond BLAZE_INTERNAL */
-   template< typename Other > friend class ValueIndexPair;
+   template< typename, typename > friend class ValueIndexPair;
    /*! \endcond */
    //**********************************************************************************************
 
@@ -161,6 +169,8 @@ class ValueIndexPair
    BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
    BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
    /*! \endcond */
    //**********************************************************************************************
 };
@@ -178,8 +188,9 @@ class ValueIndexPair
 //*************************************************************************************************
 /*!\brief Default constructor for value-index-pairs.
 */
-template< typename Type >  // Type of the value element
-inline constexpr ValueIndexPair<Type>::ValueIndexPair()
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline constexpr ValueIndexPair<Type,IT>::ValueIndexPair()
    : value_()  // Value of the value-index-pair
    , index_()  // Index of the value-index-pair
 {}
@@ -191,12 +202,18 @@ inline constexpr ValueIndexPair<Type>::ValueIndexPair()
 //
 // \param v The value of the value-index-pair.
 // \param i The index of the value-index-pair.
+//
+// Note that the given index must be representable by the index type \a IT. In case the index
+// exceeds the maximum value of \a IT, a user assertion is triggered.
 */
-template< typename Type >  // Type of the value element
-inline constexpr ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
-   : value_( v )  // Value of the value-index-pair
-   , index_( i )  // Index of the value-index-pair
-{}
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline constexpr ValueIndexPair<Type,IT>::ValueIndexPair( const Type& v, size_t i )
+   : value_( v )                     // Value of the value-index-pair
+   , index_( static_cast<IT>( i ) )  // Index of the value-index-pair
+{
+   BLAZE_USER_ASSERT( i <= std::numeric_limits<IT>::max(), "Index exceeds the index type" );
+}
 //*************************************************************************************************
 
 
@@ -218,13 +235,17 @@ inline constexpr ValueIndexPair<Type>::ValueIndexPair( const Type& v, size_t i )
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value-index-pair
-inline constexpr auto ValueIndexPair<Type>::operator=( const Other& rhs )
+inline constexpr auto ValueIndexPair<Type,IT>::operator=( const Other& rhs )
    -> EnableIf_t< IsSparseElement_v<Other>, ValueIndexPair& >
 {
+   BLAZE_USER_ASSERT( rhs.index() <= std::numeric_limits<IT>::max()
+                    , "Index exceeds the index type" );
+
    value_ = rhs.value();
-   index_ = rhs.index();
+   index_ = static_cast<IT>( rhs.index() );
    return *this;
 }
 //*************************************************************************************************
@@ -240,14 +261,18 @@ inline constexpr auto ValueIndexPair<Type>::operator=( const Other& rhs )
 // \a Other data type qualifies as value-index-pair type in case it provides a value() and an
 // index() member function.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value-index-pair
-inline constexpr auto ValueIndexPair<Type>::operator=( Other&& rhs )
+inline constexpr auto ValueIndexPair<Type,IT>::operator=( Other&& rhs )
    -> EnableIf_t< IsSparseElement_v< RemoveReference_t<Other> > &&
                   IsRValueReference_v<Other&&>, ValueIndexPair& >
 {
+   BLAZE_USER_ASSERT( rhs.index() <= std::numeric_limits<IT>::max()
+                    , "Index exceeds the index type" );
+
    value_ = std::move( rhs.value() );
-   index_ = rhs.index();
+   index_ = static_cast<IT>( rhs.index() );
    return *this;
 }
 //*************************************************************************************************
@@ -259,9 +284,10 @@ inline constexpr auto ValueIndexPair<Type>::operator=( Other&& rhs )
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr auto ValueIndexPair<Type>::operator=( const Other& v )
+inline constexpr auto ValueIndexPair<Type,IT>::operator=( const Other& v )
    -> EnableIf_t< !IsSparseElement_v<Other>, ValueIndexPair& >
 {
    value_ = v;
@@ -276,9 +302,10 @@ inline constexpr auto ValueIndexPair<Type>::operator=( const Other& v )
 // \param v The new value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr auto ValueIndexPair<Type>::operator=( Other&& v )
+inline constexpr auto ValueIndexPair<Type,IT>::operator=( Other&& v )
    -> EnableIf_t< !IsSparseElement_v< RemoveReference_t<Other> > &&
                   IsRValueReference_v<Other&&>, ValueIndexPair& >
 {
@@ -294,9 +321,10 @@ inline constexpr auto ValueIndexPair<Type>::operator=( Other&& v )
 // \param v The right-hand side value to be added to the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const Other& v )
+inline constexpr ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator+=( const Other& v )
 {
    value_ += v;
    return *this;
@@ -310,9 +338,10 @@ inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator+=( const O
 // \param v The right-hand side value to be subtracted from the value-index-pair value.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const Other& v )
+inline constexpr ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator-=( const Other& v )
 {
    value_ -= v;
    return *this;
@@ -326,9 +355,10 @@ inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator-=( const O
 // \param v The right-hand side value for the multiplication.
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const Other& v )
+inline constexpr ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator*=( const Other& v )
 {
    value_ *= v;
    return *this;
@@ -342,9 +372,10 @@ inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator*=( const O
 // \param v The right-hand side value for the division
 // \return Reference to the assigned value-index-pair.
 */
-template< typename Type >   // Type of the value element
+template< typename Type     // Type of the value element
+        , typename IT >     // Type of the stored index
 template< typename Other >  // Data type of the right-hand side value
-inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const Other& v )
+inline constexpr ValueIndexPair<Type,IT>& ValueIndexPair<Type,IT>::operator/=( const Other& v )
 {
    value_ /= v;
    return *this;
@@ -365,9 +396,10 @@ inline constexpr ValueIndexPair<Type>& ValueIndexPair<Type>::operator/=( const O
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline constexpr typename ValueIndexPair<Type>::Reference
-   ValueIndexPair<Type>::value() noexcept
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline constexpr typename ValueIndexPair<Type,IT>::Reference
+   ValueIndexPair<Type,IT>::value() noexcept
 {
    return value_;
 }
@@ -379,9 +411,10 @@ inline constexpr typename ValueIndexPair<Type>::Reference
 //
 // \return The current value of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline constexpr typename ValueIndexPair<Type>::ConstReference
-   ValueIndexPair<Type>::value() const noexcept
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline constexpr typename ValueIndexPair<Type,IT>::ConstReference
+   ValueIndexPair<Type,IT>::value() const noexcept
 {
    return value_;
 }
@@ -393,9 +426,10 @@ inline constexpr typename ValueIndexPair<Type>::ConstReference
 //
 // \return The current index of the value-index-pair.
 */
-template< typename Type >  // Type of the value element
-inline constexpr typename ValueIndexPair<Type>::IndexType
-   ValueIndexPair<Type>::index() const noexcept
+template< typename Type  // Type of the value element
+        , typename IT >  // Type of the stored index
+inline constexpr typename ValueIndexPair<Type,IT>::IndexType
+   ValueIndexPair<Type,IT>::index() const noexcept
 {
    return index_;
 }
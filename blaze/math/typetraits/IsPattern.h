@@ -0,0 +1,139 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsPattern.h
+//  \brief Header file for the IsPattern type trait
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISPATTERN_H_
+#define _BLAZE_MATH_TYPETRAITS_ISPATTERN_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/FalseType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for pattern-only sparse matrix types.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the given data type is a pattern-only sparse matrix type, i.e.
+// a sparse matrix type that stores the positions of its non-zero elements only and whose non-zero
+// elements all have the implicit value 1. In case the type is a pattern-only matrix type, the
+// \a value member constant is set to \a true, the nested type definition \a Type is \a TrueType,
+// and the class derives from \a TrueType. Otherwise \a value is set to \a false, \a Type is
+// \a FalseType, and the class derives from \a FalseType. Examples:
+
+   \code
+   blaze::IsPattern< PatternMatrix<double,false> >::value         // Evaluates to 1
+   blaze::IsPattern< const PatternMatrix<int,true> >::Type        // Results in TrueType
+   blaze::IsPattern< volatile PatternMatrix<float,false> >        // Is derived from TrueType
+   blaze::IsPattern< CompressedMatrix<double,false> >::value      // Evaluates to 0
+   blaze::IsPattern< const DynamicMatrix<float,true> >::Type      // Results in FalseType
+   blaze::IsPattern< volatile CompressedSoAMatrix<int,false> >    // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsPattern
+   : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPattern type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPattern< const T >
+   : public IsPattern<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPattern type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPattern< volatile T >
+   : public IsPattern<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPattern type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPattern< const volatile T >
+   : public IsPattern<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary variable template for the IsPattern type trait.
+// \ingroup type_traits
+//
+// The IsPattern_v variable template provides a convenient shortcut to access the nested
+// \a value of the IsPattern class template. For instance, given the type \a T the following
+// two statements are identical:
+
+   \code
+   constexpr bool value1 = blaze::IsPattern<T>::value;
+   constexpr bool value2 = blaze::IsPattern_v<T>;
+   \endcode
+*/
+template< typename T >
+constexpr bool IsPattern_v = IsPattern<T>::value;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
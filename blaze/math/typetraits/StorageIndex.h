@@ -0,0 +1,177 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/StorageIndex.h
+//  \brief Header file for the StorageIndex type trait
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_STORAGEINDEX_H_
+#define _BLAZE_MATH_TYPETRAITS_STORAGEINDEX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Evaluation of the index type used to store the indices of sparse vectors and matrices.
+// \ingroup math_type_traits
+//
+// This type trait evaluates the unsigned integral type that is used to store the indices of the
+// non-zero elements of the given sparse vector or matrix types. In case of a single type, the
+// index type of this type is reported via the nested type \a Type. In case of several types,
+// the largest of their index types is reported. By default, the index type of any type is
+// \c size_t. For all sparse vector and matrix types with a configurable index type (as for
+// instance CompressedVector and CompressedMatrix) the StorageIndex class template is
+// specialized accordingly. Examples:
+
+   \code
+   using VT1 = blaze::CompressedVector<double,blaze::columnVector,uint32_t>;
+   using VT2 = blaze::CompressedVector<double,blaze::columnVector,uint16_t>;
+   using VT3 = blaze::DynamicVector<double,blaze::columnVector>;
+
+   blaze::StorageIndex< VT1 >::Type       // Results in uint32_t
+   blaze::StorageIndex< VT1, VT2 >::Type  // Results in uint32_t
+   blaze::StorageIndex< VT3 >::Type       // Results in size_t
+   \endcode
+*/
+template< typename... Ts >
+struct StorageIndex;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the StorageIndex type trait for a single type.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct StorageIndex<T>
+{
+   using Type = size_t;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the StorageIndex type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct StorageIndex< const T >
+   : public StorageIndex<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the StorageIndex type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct StorageIndex< volatile T >
+   : public StorageIndex<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the StorageIndex type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct StorageIndex< const volatile T >
+   : public StorageIndex<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the StorageIndex type trait for several types.
+// \ingroup math_type_traits
+*/
+template< typename T1, typename T2, typename... Ts >
+struct StorageIndex<T1,T2,Ts...>
+{
+ private:
+   //**********************************************************************************************
+   using IT1 = typename StorageIndex<T1>::Type;
+   using IT2 = typename StorageIndex<T2,Ts...>::Type;
+   //**********************************************************************************************
+
+ public:
+   //**********************************************************************************************
+   using Type = If_t< ( sizeof( IT1 ) >= sizeof( IT2 ) ), IT1, IT2 >;
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary alias declaration for the StorageIndex type trait.
+// \ingroup math_type_traits
+//
+// The StorageIndex_t alias declaration provides a convenient shortcut to access the nested
+// \a Type of the StorageIndex class template. For instance, given the types \a T1 and \a T2
+// the following two type definitions are identical:
+
+   \code
+   using Type1 = typename blaze::StorageIndex<T1,T2>::Type;
+   using Type2 = blaze::StorageIndex_t<T1,T2>;
+   \endcode
+*/
+template< typename... Ts >
+using StorageIndex_t = typename StorageIndex<Ts...>::Type;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
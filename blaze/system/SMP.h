@@ -41,6 +41,8 @@
 //*************************************************************************************************
 
 #include <blaze/config/SMP.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
 
 
 
@@ -153,4 +155,77 @@
 #endif
 //*************************************************************************************************
 
+
+
+
+//=================================================================================================
+//
+//  PARALLEL AND SERIAL SECTION CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Storage specifier for the activity flags of parallel and serial sections.
+// \ingroup system
+//
+// In case the C++11 or Boost thread parallelization is active, the activity flags of parallel
+// and serial sections are thread-local. Therefore several threads can concurrently execute
+// parallel operations via the same thread pool and a serial section only affects the thread
+// that has started it. In all other cases the activity flags are shared by all threads.
+*/
+#if !BLAZE_HPX_PARALLEL_MODE && ( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_SMP_SECTION_STORAGE thread_local
+#else
+#define BLAZE_SMP_SECTION_STORAGE
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD PARALLEL TASK CONFIGURATION
+//
+//=================================================================================================
+
+namespace blaze {
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t smpTasksPerThread = BLAZE_SMP_TASKS_PER_THREAD;
+constexpr size_t smpSpinCount      = BLAZE_SMP_SPIN_COUNT;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr bool smpFirstTouch = ( BLAZE_SMP_FIRST_TOUCH &&
+                                 ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_HPX_PARALLEL_MODE ||
+                                   BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE ) );
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( blaze::smpTasksPerThread > 0UL );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
 #endif
@@ -40,7 +40,17 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 #include <blaze/system/Debugging.h>
+#include <blaze/util/Exception.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -246,24 +256,6 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
-//*************************************************************************************************
-/*! \cond BLAZE_INTERNAL */
-constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
-constexpr size_t TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATDMATMULT_THRESHOLD   );
-constexpr size_t DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_DMATSMATMULT_THRESHOLD   );
-constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
-/*! \endcond */
-//*************************************************************************************************
-
-
 
 
 //=================================================================================================
@@ -967,60 +959,746 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assembly threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSEMBLE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the assembly of a sparse matrix from a list of triplets can be
+// executed in parallel. In case the number of given triplets is larger or equal to this threshold,
+// the operation is executed in parallel. If the number of triplets is below this threshold the
+// operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSEMBLE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRANSPOSE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the conversion of a sparse matrix between row-major and
+// column-major storage order can be executed in parallel. In case the number of non-zero elements
+// is larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_SMATTRANSPOSE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse triangular solve threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATTRSV_THRESHOLD while the Blaze debug mode
+// is active. It specifies when the rows of a single level of a level-scheduled sparse triangular
+// solve can be computed in parallel. In case the number of rows of a level is larger or equal to
+// this threshold, the level is processed in parallel. If the number of rows is below this
+// threshold the level is processed single-threaded.
+*/
+constexpr size_t SMP_SMATTRSV_DEBUG_THRESHOLD = 8UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP permutation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_PERMUTE_THRESHOLD while the Blaze debug mode
+// is active. It specifies when the permutation of a sparse matrix or a dense vector can be
+// executed in parallel.
+*/
+constexpr size_t SMP_PERMUTE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix compaction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATCOMPACT_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the compaction of a CompressedMatrixBuilder can be executed in
+// parallel.
+*/
+constexpr size_t SMP_SMATCOMPACT_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SPARSEREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the total reduction and the norm computation of a sparse
+// vector or sparse matrix can be executed in parallel.
+*/
+constexpr size_t SMP_SPARSEREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the total reduction and the norm computation of a dense
+// vector can be executed in parallel.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the scalar product of two dense vectors can be executed in
+// parallel.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLDS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Indices of the thresholds within the runtime threshold table.
+// \ingroup config
+*/
+enum ThresholdID : size_t
+{
+   DMATDVECMULT_THRESHOLD_ID = 0UL,
+   TDMATDVECMULT_THRESHOLD_ID,
+   TDVECDMATMULT_THRESHOLD_ID,
+   TDVECTDMATMULT_THRESHOLD_ID,
+   DMATDMATMULT_THRESHOLD_ID,
+   DMATTDMATMULT_THRESHOLD_ID,
+   TDMATDMATMULT_THRESHOLD_ID,
+   TDMATTDMATMULT_THRESHOLD_ID,
+   DMATSMATMULT_THRESHOLD_ID,
+   TDMATSMATMULT_THRESHOLD_ID,
+   TSMATDMATMULT_THRESHOLD_ID,
+   TSMATTDMATMULT_THRESHOLD_ID,
+   SMP_DVECASSIGN_THRESHOLD_ID,
+   SMP_DVECSCALARMULT_THRESHOLD_ID,
+   SMP_DVECDVECADD_THRESHOLD_ID,
+   SMP_DVECDVECSUB_THRESHOLD_ID,
+   SMP_DVECDVECMULT_THRESHOLD_ID,
+   SMP_DVECDVECDIV_THRESHOLD_ID,
+   SMP_DVECDVECOUTER_THRESHOLD_ID,
+   SMP_DMATDVECMULT_THRESHOLD_ID,
+   SMP_TDMATDVECMULT_THRESHOLD_ID,
+   SMP_TDVECDMATMULT_THRESHOLD_ID,
+   SMP_TDVECTDMATMULT_THRESHOLD_ID,
+   SMP_DMATSVECMULT_THRESHOLD_ID,
+   SMP_TDMATSVECMULT_THRESHOLD_ID,
+   SMP_TSVECDMATMULT_THRESHOLD_ID,
+   SMP_TSVECTDMATMULT_THRESHOLD_ID,
+   SMP_SMATDVECMULT_THRESHOLD_ID,
+   SMP_TSMATDVECMULT_THRESHOLD_ID,
+   SMP_TDVECSMATMULT_THRESHOLD_ID,
+   SMP_TDVECTSMATMULT_THRESHOLD_ID,
+   SMP_SMATSVECMULT_THRESHOLD_ID,
+   SMP_TSMATSVECMULT_THRESHOLD_ID,
+   SMP_TSVECSMATMULT_THRESHOLD_ID,
+   SMP_TSVECTSMATMULT_THRESHOLD_ID,
+   SMP_DMATASSIGN_THRESHOLD_ID,
+   SMP_DMATSCALARMULT_THRESHOLD_ID,
+   SMP_DMATDMATADD_THRESHOLD_ID,
+   SMP_DMATTDMATADD_THRESHOLD_ID,
+   SMP_DMATDMATSUB_THRESHOLD_ID,
+   SMP_DMATTDMATSUB_THRESHOLD_ID,
+   SMP_DMATDMATSCHUR_THRESHOLD_ID,
+   SMP_DMATTDMATSCHUR_THRESHOLD_ID,
+   SMP_DMATDMATMULT_THRESHOLD_ID,
+   SMP_DMATTDMATMULT_THRESHOLD_ID,
+   SMP_TDMATDMATMULT_THRESHOLD_ID,
+   SMP_TDMATTDMATMULT_THRESHOLD_ID,
+   SMP_DMATSMATMULT_THRESHOLD_ID,
+   SMP_DMATTSMATMULT_THRESHOLD_ID,
+   SMP_TDMATSMATMULT_THRESHOLD_ID,
+   SMP_TDMATTSMATMULT_THRESHOLD_ID,
+   SMP_SMATDMATMULT_THRESHOLD_ID,
+   SMP_SMATTDMATMULT_THRESHOLD_ID,
+   SMP_TSMATDMATMULT_THRESHOLD_ID,
+   SMP_TSMATTDMATMULT_THRESHOLD_ID,
+   SMP_SMATSMATMULT_THRESHOLD_ID,
+   SMP_SMATTSMATMULT_THRESHOLD_ID,
+   SMP_TSMATSMATMULT_THRESHOLD_ID,
+   SMP_TSMATTSMATMULT_THRESHOLD_ID,
+   SMP_DMATREDUCE_THRESHOLD_ID,
+   SMP_SMATREDUCE_THRESHOLD_ID,
+   SMP_SMATASSEMBLE_THRESHOLD_ID,
+   SMP_SMATTRANSPOSE_THRESHOLD_ID,
+   SMP_SMATTRSV_THRESHOLD_ID,
+   SMP_PERMUTE_THRESHOLD_ID,
+   SMP_SMATCOMPACT_THRESHOLD_ID,
+   SMP_SPARSEREDUCE_THRESHOLD_ID,
+   SMP_DVECREDUCE_THRESHOLD_ID,
+   SMP_DVECDVECINNER_THRESHOLD_ID,
+   THRESHOLD_COUNT
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Entry of the runtime threshold table.
+// \ingroup config
+//
+// Each entry stores the name of a threshold, its compile time default (i.e. the debug value in
+// case the Blaze debug mode is active and the value of the according configuration macro in all
+// other cases), the smallest admissible value and the current value of the threshold.
+*/
+struct Threshold
+{
+   constexpr Threshold( const char* n, size_t debugValue, size_t releaseValue, size_t minimum ) noexcept
+      : name        ( n )                                              // The name of the threshold
+      , defaultValue( BLAZE_DEBUG_MODE ? debugValue : releaseValue )  // The compile time default
+      , minimumValue( minimum )                                        // The smallest admissible value
+      , value       ( defaultValue )                                   // The current value
+   {}
+
+   const char* const name;          //!< The name of the threshold.
+   const size_t      defaultValue;  //!< The compile time default of the threshold.
+   const size_t      minimumValue;  //!< The smallest admissible value of the threshold.
+   size_t            value;         //!< The current value of the threshold.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The runtime threshold table.
+// \ingroup config
+//
+// The runtime threshold table holds the current values of all thresholds. It is constant
+// initialized with the compile time defaults and updated from the environment during the
+// dynamic initialization of the program (see initThresholds()). All decisions between serial
+// and parallel execution and between the kernels for small and large operands are based on
+// the values in this table.
+*/
+template< typename T = void >
+struct ThresholdTable
+{
+   static Threshold entries_[THRESHOLD_COUNT];  //!< The entries of the threshold table.
+   static const bool initialized_;              //!< Initialization flag of the threshold table.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T >
+Threshold ThresholdTable<T>::entries_[THRESHOLD_COUNT] = {
+   Threshold( "DMATDVECMULT_THRESHOLD",            DMATDVECMULT_DEBUG_THRESHOLD,          BLAZE_DMATDVECMULT_THRESHOLD,           1UL ),
+   Threshold( "TDMATDVECMULT_THRESHOLD",           TDMATDVECMULT_DEBUG_THRESHOLD,         BLAZE_TDMATDVECMULT_THRESHOLD,          1UL ),
+   Threshold( "TDVECDMATMULT_THRESHOLD",           TDVECDMATMULT_DEBUG_THRESHOLD,         BLAZE_TDVECDMATMULT_THRESHOLD,          1UL ),
+   Threshold( "TDVECTDMATMULT_THRESHOLD",          TDVECTDMATMULT_DEBUG_THRESHOLD,        BLAZE_TDVECTDMATMULT_THRESHOLD,         1UL ),
+   Threshold( "DMATDMATMULT_THRESHOLD",            DMATDMATMULT_DEBUG_THRESHOLD,          BLAZE_DMATDMATMULT_THRESHOLD,           1UL ),
+   Threshold( "DMATTDMATMULT_THRESHOLD",           DMATTDMATMULT_DEBUG_THRESHOLD,         BLAZE_DMATTDMATMULT_THRESHOLD,          1UL ),
+   Threshold( "TDMATDMATMULT_THRESHOLD",           TDMATDMATMULT_DEBUG_THRESHOLD,         BLAZE_TDMATDMATMULT_THRESHOLD,          1UL ),
+   Threshold( "TDMATTDMATMULT_THRESHOLD",          TDMATTDMATMULT_DEBUG_THRESHOLD,        BLAZE_TDMATTDMATMULT_THRESHOLD,         1UL ),
+   Threshold( "DMATSMATMULT_THRESHOLD",            DMATSMATMULT_DEBUG_THRESHOLD,          BLAZE_DMATSMATMULT_THRESHOLD,           1UL ),
+   Threshold( "TDMATSMATMULT_THRESHOLD",           TDMATSMATMULT_DEBUG_THRESHOLD,         BLAZE_TDMATSMATMULT_THRESHOLD,          1UL ),
+   Threshold( "TSMATDMATMULT_THRESHOLD",           TSMATDMATMULT_DEBUG_THRESHOLD,         BLAZE_TSMATDMATMULT_THRESHOLD,          1UL ),
+   Threshold( "TSMATTDMATMULT_THRESHOLD",          TSMATTDMATMULT_DEBUG_THRESHOLD,        BLAZE_TSMATTDMATMULT_THRESHOLD,         1UL ),
+   Threshold( "SMP_DVECASSIGN_THRESHOLD",          SMP_DVECASSIGN_DEBUG_THRESHOLD,        BLAZE_SMP_DVECASSIGN_THRESHOLD,         0UL ),
+   Threshold( "SMP_DVECSCALARMULT_THRESHOLD",      SMP_DVECSCALARMULT_DEBUG_THRESHOLD,    BLAZE_SMP_DVECSCALARMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DVECDVECADD_THRESHOLD",         SMP_DVECDVECADD_DEBUG_THRESHOLD,       BLAZE_SMP_DVECDVECADD_THRESHOLD,        0UL ),
+   Threshold( "SMP_DVECDVECSUB_THRESHOLD",         SMP_DVECDVECSUB_DEBUG_THRESHOLD,       BLAZE_SMP_DVECDVECSUB_THRESHOLD,        0UL ),
+   Threshold( "SMP_DVECDVECMULT_THRESHOLD",        SMP_DVECDVECMULT_DEBUG_THRESHOLD,      BLAZE_SMP_DVECDVECMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_DVECDVECDIV_THRESHOLD",         SMP_DVECDVECDIV_DEBUG_THRESHOLD,       BLAZE_SMP_DVECDVECDIV_THRESHOLD,        0UL ),
+   Threshold( "SMP_DVECDVECOUTER_THRESHOLD",       SMP_DVECDVECOUTER_DEBUG_THRESHOLD,     BLAZE_SMP_DVECDVECOUTER_THRESHOLD,      0UL ),
+   Threshold( "SMP_DMATDVECMULT_THRESHOLD",        SMP_DMATDVECMULT_DEBUG_THRESHOLD,      BLAZE_SMP_DMATDVECMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_TDMATDVECMULT_THRESHOLD",       SMP_TDMATDVECMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDMATDVECMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDVECDMATMULT_THRESHOLD",       SMP_TDVECDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDVECDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDVECTDMATMULT_THRESHOLD",      SMP_TDVECTDMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TDVECTDMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATSVECMULT_THRESHOLD",        SMP_DMATSVECMULT_DEBUG_THRESHOLD,      BLAZE_SMP_DMATSVECMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_TDMATSVECMULT_THRESHOLD",       SMP_TDMATSVECMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDMATSVECMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSVECDMATMULT_THRESHOLD",       SMP_TSVECDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSVECDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSVECTDMATMULT_THRESHOLD",      SMP_TSVECTDMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TSVECTDMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_SMATDVECMULT_THRESHOLD",        SMP_SMATDVECMULT_DEBUG_THRESHOLD,      BLAZE_SMP_SMATDVECMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_TSMATDVECMULT_THRESHOLD",       SMP_TSMATDVECMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSMATDVECMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDVECSMATMULT_THRESHOLD",       SMP_TDVECSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDVECSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDVECTSMATMULT_THRESHOLD",      SMP_TDVECTSMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TDVECTSMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_SMATSVECMULT_THRESHOLD",        SMP_SMATSVECMULT_DEBUG_THRESHOLD,      BLAZE_SMP_SMATSVECMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_TSMATSVECMULT_THRESHOLD",       SMP_TSMATSVECMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSMATSVECMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSVECSMATMULT_THRESHOLD",       SMP_TSVECSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSVECSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSVECTSMATMULT_THRESHOLD",      SMP_TSVECTSMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TSVECTSMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATASSIGN_THRESHOLD",          SMP_DMATASSIGN_DEBUG_THRESHOLD,        BLAZE_SMP_DMATASSIGN_THRESHOLD,         0UL ),
+   Threshold( "SMP_DMATSCALARMULT_THRESHOLD",      SMP_DMATSCALARMULT_DEBUG_THRESHOLD,    BLAZE_SMP_DMATSCALARMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATDMATADD_THRESHOLD",         SMP_DMATDMATADD_DEBUG_THRESHOLD,       BLAZE_SMP_DMATDMATADD_THRESHOLD,        0UL ),
+   Threshold( "SMP_DMATTDMATADD_THRESHOLD",        SMP_DMATTDMATADD_DEBUG_THRESHOLD,      BLAZE_SMP_DMATTDMATADD_THRESHOLD,       0UL ),
+   Threshold( "SMP_DMATDMATSUB_THRESHOLD",         SMP_DMATDMATSUB_DEBUG_THRESHOLD,       BLAZE_SMP_DMATDMATSUB_THRESHOLD,        0UL ),
+   Threshold( "SMP_DMATTDMATSUB_THRESHOLD",        SMP_DMATTDMATSUB_DEBUG_THRESHOLD,      BLAZE_SMP_DMATTDMATSUB_THRESHOLD,       0UL ),
+   Threshold( "SMP_DMATDMATSCHUR_THRESHOLD",       SMP_DMATDMATSCHUR_DEBUG_THRESHOLD,     BLAZE_SMP_DMATDMATSCHUR_THRESHOLD,      0UL ),
+   Threshold( "SMP_DMATTDMATSCHUR_THRESHOLD",      SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD,    BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATDMATMULT_THRESHOLD",        SMP_DMATDMATMULT_DEBUG_THRESHOLD,      BLAZE_SMP_DMATDMATMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_DMATTDMATMULT_THRESHOLD",       SMP_DMATTDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_DMATTDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDMATDMATMULT_THRESHOLD",       SMP_TDMATDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDMATDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDMATTDMATMULT_THRESHOLD",      SMP_TDMATTDMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TDMATTDMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATSMATMULT_THRESHOLD",        SMP_DMATSMATMULT_DEBUG_THRESHOLD,      BLAZE_SMP_DMATSMATMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_DMATTSMATMULT_THRESHOLD",       SMP_DMATTSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_DMATTSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDMATSMATMULT_THRESHOLD",       SMP_TDMATSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TDMATSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TDMATTSMATMULT_THRESHOLD",      SMP_TDMATTSMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TDMATTSMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_SMATDMATMULT_THRESHOLD",        SMP_SMATDMATMULT_DEBUG_THRESHOLD,      BLAZE_SMP_SMATDMATMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_SMATTDMATMULT_THRESHOLD",       SMP_SMATTDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_SMATTDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSMATDMATMULT_THRESHOLD",       SMP_TSMATDMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSMATDMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSMATTDMATMULT_THRESHOLD",      SMP_TSMATTDMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TSMATTDMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_SMATSMATMULT_THRESHOLD",        SMP_SMATSMATMULT_DEBUG_THRESHOLD,      BLAZE_SMP_SMATSMATMULT_THRESHOLD,       0UL ),
+   Threshold( "SMP_SMATTSMATMULT_THRESHOLD",       SMP_SMATTSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_SMATTSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSMATSMATMULT_THRESHOLD",       SMP_TSMATSMATMULT_DEBUG_THRESHOLD,     BLAZE_SMP_TSMATSMATMULT_THRESHOLD,      0UL ),
+   Threshold( "SMP_TSMATTSMATMULT_THRESHOLD",      SMP_TSMATTSMATMULT_DEBUG_THRESHOLD,    BLAZE_SMP_TSMATTSMATMULT_THRESHOLD,     0UL ),
+   Threshold( "SMP_DMATREDUCE_THRESHOLD",          SMP_DMATREDUCE_DEBUG_THRESHOLD,        BLAZE_SMP_DMATREDUCE_THRESHOLD,         0UL ),
+   Threshold( "SMP_SMATREDUCE_THRESHOLD",          SMP_SMATREDUCE_DEBUG_THRESHOLD,        BLAZE_SMP_SMATREDUCE_THRESHOLD,         0UL ),
+   Threshold( "SMP_SMATASSEMBLE_THRESHOLD",        SMP_SMATASSEMBLE_DEBUG_THRESHOLD,      BLAZE_SMP_SMATASSEMBLE_THRESHOLD,       0UL ),
+   Threshold( "SMP_SMATTRANSPOSE_THRESHOLD",       SMP_SMATTRANSPOSE_DEBUG_THRESHOLD,     BLAZE_SMP_SMATTRANSPOSE_THRESHOLD,      0UL ),
+   Threshold( "SMP_SMATTRSV_THRESHOLD",            SMP_SMATTRSV_DEBUG_THRESHOLD,          BLAZE_SMP_SMATTRSV_THRESHOLD,           0UL ),
+   Threshold( "SMP_PERMUTE_THRESHOLD",             SMP_PERMUTE_DEBUG_THRESHOLD,           BLAZE_SMP_PERMUTE_THRESHOLD,            0UL ),
+   Threshold( "SMP_SMATCOMPACT_THRESHOLD",         SMP_SMATCOMPACT_DEBUG_THRESHOLD,       BLAZE_SMP_SMATCOMPACT_THRESHOLD,        0UL ),
+   Threshold( "SMP_SPARSEREDUCE_THRESHOLD",        SMP_SPARSEREDUCE_DEBUG_THRESHOLD,      BLAZE_SMP_SPARSEREDUCE_THRESHOLD,       0UL ),
+   Threshold( "SMP_DVECREDUCE_THRESHOLD",          SMP_DVECREDUCE_DEBUG_THRESHOLD,        BLAZE_SMP_DVECREDUCE_THRESHOLD,         0UL ),
+   Threshold( "SMP_DVECDVECINNER_THRESHOLD",       SMP_DVECDVECINNER_DEBUG_THRESHOLD,     BLAZE_SMP_DVECDVECINNER_THRESHOLD,      0UL )
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+constexpr size_t& DMATDVECMULT_THRESHOLD       = ThresholdTable<>::entries_[DMATDVECMULT_THRESHOLD_ID      ].value;
+constexpr size_t& TDMATDVECMULT_THRESHOLD      = ThresholdTable<>::entries_[TDMATDVECMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TDVECDMATMULT_THRESHOLD      = ThresholdTable<>::entries_[TDVECDMATMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TDVECTDMATMULT_THRESHOLD     = ThresholdTable<>::entries_[TDVECTDMATMULT_THRESHOLD_ID    ].value;
+constexpr size_t& DMATDMATMULT_THRESHOLD       = ThresholdTable<>::entries_[DMATDMATMULT_THRESHOLD_ID      ].value;
+constexpr size_t& DMATTDMATMULT_THRESHOLD      = ThresholdTable<>::entries_[DMATTDMATMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TDMATDMATMULT_THRESHOLD      = ThresholdTable<>::entries_[TDMATDMATMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TDMATTDMATMULT_THRESHOLD     = ThresholdTable<>::entries_[TDMATTDMATMULT_THRESHOLD_ID    ].value;
+constexpr size_t& DMATSMATMULT_THRESHOLD       = ThresholdTable<>::entries_[DMATSMATMULT_THRESHOLD_ID      ].value;
+constexpr size_t& TDMATSMATMULT_THRESHOLD      = ThresholdTable<>::entries_[TDMATSMATMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TSMATDMATMULT_THRESHOLD      = ThresholdTable<>::entries_[TSMATDMATMULT_THRESHOLD_ID     ].value;
+constexpr size_t& TSMATTDMATMULT_THRESHOLD     = ThresholdTable<>::entries_[TSMATTDMATMULT_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_DVECASSIGN_THRESHOLD     = ThresholdTable<>::entries_[SMP_DVECASSIGN_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_DVECSCALARMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_DVECSCALARMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DVECDVECADD_THRESHOLD    = ThresholdTable<>::entries_[SMP_DVECDVECADD_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_DVECDVECSUB_THRESHOLD    = ThresholdTable<>::entries_[SMP_DVECDVECSUB_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_DVECDVECMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_DVECDVECMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DVECDVECDIV_THRESHOLD    = ThresholdTable<>::entries_[SMP_DVECDVECDIV_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_DVECDVECOUTER_THRESHOLD  = ThresholdTable<>::entries_[SMP_DVECDVECOUTER_THRESHOLD_ID ].value;
+constexpr size_t& SMP_DMATDVECMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATDVECMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_TDMATDVECMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDMATDVECMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDVECDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDVECDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDVECTDMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TDVECTDMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATSVECMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATSVECMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_TDMATSVECMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDMATSVECMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSVECDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSVECDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSVECTDMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TSVECTDMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_SMATDVECMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_SMATDVECMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_TSMATDVECMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSMATDVECMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDVECSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDVECSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDVECTSMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TDVECTSMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_SMATSVECMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_SMATSVECMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_TSMATSVECMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSMATSVECMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSVECSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSVECSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSVECTSMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TSVECTSMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATASSIGN_THRESHOLD     = ThresholdTable<>::entries_[SMP_DMATASSIGN_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_DMATSCALARMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_DMATSCALARMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATDMATADD_THRESHOLD    = ThresholdTable<>::entries_[SMP_DMATDMATADD_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_DMATTDMATADD_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATTDMATADD_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DMATDMATSUB_THRESHOLD    = ThresholdTable<>::entries_[SMP_DMATDMATSUB_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_DMATTDMATSUB_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATTDMATSUB_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DMATDMATSCHUR_THRESHOLD  = ThresholdTable<>::entries_[SMP_DMATDMATSCHUR_THRESHOLD_ID ].value;
+constexpr size_t& SMP_DMATTDMATSCHUR_THRESHOLD = ThresholdTable<>::entries_[SMP_DMATTDMATSCHUR_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATDMATMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATDMATMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DMATTDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_DMATTDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDMATDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDMATDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDMATTDMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TDMATTDMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATSMATMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_DMATSMATMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DMATTSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_DMATTSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDMATSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TDMATSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TDMATTSMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TDMATTSMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_SMATDMATMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_SMATDMATMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_SMATTDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_SMATTDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSMATDMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSMATDMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSMATTDMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TSMATTDMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_SMATSMATMULT_THRESHOLD   = ThresholdTable<>::entries_[SMP_SMATSMATMULT_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_SMATTSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_SMATTSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSMATSMATMULT_THRESHOLD  = ThresholdTable<>::entries_[SMP_TSMATSMATMULT_THRESHOLD_ID ].value;
+constexpr size_t& SMP_TSMATTSMATMULT_THRESHOLD = ThresholdTable<>::entries_[SMP_TSMATTSMATMULT_THRESHOLD_ID].value;
+constexpr size_t& SMP_DMATREDUCE_THRESHOLD     = ThresholdTable<>::entries_[SMP_DMATREDUCE_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_SMATREDUCE_THRESHOLD     = ThresholdTable<>::entries_[SMP_SMATREDUCE_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_SMATASSEMBLE_THRESHOLD   = ThresholdTable<>::entries_[SMP_SMATASSEMBLE_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_SMATTRANSPOSE_THRESHOLD  = ThresholdTable<>::entries_[SMP_SMATTRANSPOSE_THRESHOLD_ID ].value;
+constexpr size_t& SMP_SMATTRSV_THRESHOLD       = ThresholdTable<>::entries_[SMP_SMATTRSV_THRESHOLD_ID      ].value;
+constexpr size_t& SMP_PERMUTE_THRESHOLD        = ThresholdTable<>::entries_[SMP_PERMUTE_THRESHOLD_ID       ].value;
+constexpr size_t& SMP_SMATCOMPACT_THRESHOLD    = ThresholdTable<>::entries_[SMP_SMATCOMPACT_THRESHOLD_ID   ].value;
+constexpr size_t& SMP_SPARSEREDUCE_THRESHOLD   = ThresholdTable<>::entries_[SMP_SPARSEREDUCE_THRESHOLD_ID  ].value;
+constexpr size_t& SMP_DVECREDUCE_THRESHOLD     = ThresholdTable<>::entries_[SMP_DVECREDUCE_THRESHOLD_ID    ].value;
+constexpr size_t& SMP_DVECDVECINNER_THRESHOLD  = ThresholdTable<>::entries_[SMP_DVECDVECINNER_THRESHOLD_ID ].value;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RUNTIME THRESHOLD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Runtime threshold functions */
+//@{
+size_t getThreshold( const std::string& name );
+void   setThreshold( const std::string& name, size_t value );
+void   resetThresholds() noexcept;
+void   loadThresholds( std::istream& is );
+void   loadThresholds( const std::string& filename );
+void   saveThresholds( std::ostream& os );
+void   saveThresholds( const std::string& filename );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the entry of the runtime threshold table with the given name.
+// \ingroup config
+//
+// \param name The name of the threshold (with or without \c BLAZE_ prefix).
+// \return Reference to the entry of the threshold.
+// \exception std::invalid_argument Unknown threshold.
+*/
+inline Threshold& findThreshold( const std::string& name )
+{
+   const std::string key( name.compare( 0UL, 6UL, "BLAZE_" ) == 0 ? name.substr( 6UL ) : name );
+
+   for( Threshold& entry : ThresholdTable<>::entries_ ) {
+      if( key == entry.name )
+         return entry;
+   }
+
+   BLAZE_THROW_INVALID_ARGUMENT( "Unknown threshold" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Converts the given string into a threshold value.
+// \ingroup config
+//
+// \param value The string representation of the threshold value.
+// \param number The resulting threshold value.
+// \return \a true in case the string is a valid threshold value, \a false if not.
+//
+// This function only accepts non-empty strings of decimal digits that fit into a \c size_t.
+// In particular, signs, suffixes, and floating point numbers are rejected.
+*/
+inline bool parseThresholdValue( const std::string& value, size_t& number ) noexcept
+{
+   if( value.empty() || value.find_first_not_of( "0123456789" ) != std::string::npos )
+      return false;
+
+   try {
+      number = std::stoull( value );
+   }
+   catch( ... ) {
+      return false;
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance \c "SMP_DVECASSIGN_THRESHOLD").
+// \return The current value of the threshold.
+// \exception std::invalid_argument Unknown threshold.
+//
+// The name can be given with or without the \c BLAZE_ prefix of the according configuration
+// macro, i.e. \c "SMP_DVECASSIGN_THRESHOLD" and \c "BLAZE_SMP_DVECASSIGN_THRESHOLD" refer to
+// the same threshold.
+*/
+inline size_t getThreshold( const std::string& name )
+{
+   return findThreshold( name ).value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the value of the given threshold.
+// \ingroup config
+//
+// \param name The name of the threshold (as for instance \c "SMP_DVECASSIGN_THRESHOLD").
+// \param value The new value of the threshold.
+// \return void
+// \exception std::invalid_argument Unknown threshold.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function sets the given threshold to the given value. The new value affects all
+// subsequent operations. Note that all SMP thresholds accept the value 0 (i.e. parallel
+// execution is always preferred), whereas the kernel thresholds require a value of at least 1.
+// Also note that changing thresholds is not thread-safe: No Blaze operation must be executed
+// concurrently to the call of this function.
+*/
+inline void setThreshold( const std::string& name, size_t value )
+{
+   Threshold& entry( findThreshold( name ) );
+
+   if( value < entry.minimumValue ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+   }
+
+   entry.value = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets all thresholds to their compile time defaults.
+// \ingroup config
+//
+// \return void
+//
+// Note that resetting the thresholds is not thread-safe: No Blaze operation must be executed
+// concurrently to the call of this function.
+*/
+inline void resetThresholds() noexcept
+{
+   for( Threshold& entry : ThresholdTable<>::entries_ ) {
+      entry.value = entry.defaultValue;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads thresholds from the given input stream.
+// \ingroup config
+//
+// \param is The input stream containing the threshold specifications.
+// \return void
+// \exception std::invalid_argument Invalid threshold specification.
+// \exception std::invalid_argument Unknown threshold.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function reads threshold specifications of the form \c "NAME = VALUE" (or \c "NAME VALUE")
+// from the given input stream, one per line. Empty lines and everything following a \c '#' are
+// ignored. Thresholds that are not specified keep their current values. In case any line cannot
+// be parsed or refers to an unknown threshold, a \a std::invalid_argument exception is thrown
+// and none of the thresholds is changed. Example:
+
+   \code
+   # Thresholds for a 2-socket, 32-core machine
+   SMP_DVECASSIGN_THRESHOLD   = 16384
+   SMP_DMATDMATMULT_THRESHOLD = 2500
+   BLAZE_DMATDVECMULT_THRESHOLD 10000
+   \endcode
+
+// Note that loading thresholds is not thread-safe: No Blaze operation must be executed
+// concurrently to the call of this function.
+*/
+inline void loadThresholds( std::istream& is )
+{
+   std::vector< std::pair<Threshold*,size_t> > values;
+   std::string line;
+
+   while( std::getline( is, line ) )
+   {
+      line = line.substr( 0UL, line.find( '#' ) );
+      std::replace( line.begin(), line.end(), '=', ' ' );
+
+      std::istringstream iss( line );
+      std::string name, value, rest;
+
+      if( !( iss >> name ) )
+         continue;
+
+      size_t number( 0UL );
+
+      if( !( iss >> value ) || ( iss >> rest ) || !parseThresholdValue( value, number ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold specification" );
+      }
+
+      Threshold& entry( findThreshold( name ) );
+
+      if( number < entry.minimumValue ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid threshold value" );
+      }
+
+      values.emplace_back( &entry, number );
+   }
+
+   for( const auto& value : values ) {
+      value.first->value = value.second;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Loads thresholds from the given file.
+// \ingroup config
+//
+// \param filename The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be opened.
+// \exception std::invalid_argument Invalid threshold specification.
+// \exception std::invalid_argument Unknown threshold.
+// \exception std::invalid_argument Invalid threshold value.
+//
+// This function loads thresholds from the given file (see loadThresholds(std::istream&) for the
+// file format). Note that loading thresholds is not thread-safe: No Blaze operation must be
+// executed concurrently to the call of this function.
+*/
+inline void loadThresholds( const std::string& filename )
+{
+   std::ifstream file( filename );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold file could not be opened" );
+   }
+
+   loadThresholds( file );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current values of all thresholds to the given output stream.
+// \ingroup config
+//
+// \param os The output stream.
+// \return void
+//
+// This function writes the current values of all thresholds in the format expected by the
+// loadThresholds() functions.
+*/
+inline void saveThresholds( std::ostream& os )
+{
+   for( const Threshold& entry : ThresholdTable<>::entries_ ) {
+      os << entry.name << " = " << entry.value << "\n";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the current values of all thresholds to the given file.
+// \ingroup config
+//
+// \param filename The name of the threshold file.
+// \return void
+// \exception std::runtime_error Threshold file could not be opened.
+//
+// This function writes the current values of all thresholds in the format expected by the
+// loadThresholds() functions to the given file.
+*/
+inline void saveThresholds( const std::string& filename )
+{
+   std::ofstream file( filename );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Threshold file could not be opened" );
+   }
+
+   saveThresholds( file );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initializes the runtime threshold table from the environment.
+// \ingroup config
+//
+// \return \a true after the initialization.
+//
+// This function first loads the threshold file specified by the \c BLAZE_THRESHOLDS environment
+// variable and afterwards applies all environment variables named after the configuration macro
+// of a threshold (as for instance \c BLAZE_SMP_DVECASSIGN_THRESHOLD=16384).
+//
+// \warning This function swallows all errors! Since it is called during the dynamic
+// initialization of the program, where an exception would terminate the program, a threshold
+// file that cannot be opened or parsed is ignored as a whole (i.e. none of its thresholds is
+// applied) and an environment variable with an invalid or too small value is ignored
+// individually. Environment values are validated exactly like the values of a threshold file,
+// i.e. signs, suffixes, and floating point numbers (as for instance \c -1, \c 16k, or \c 1e6)
+// are rejected. The affected thresholds silently keep their compile time defaults.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline bool initThresholds() noexcept
+{
+   const char* file = std::getenv( "BLAZE_THRESHOLDS" );
+
+   try {
+      if( file != nullptr )
+         loadThresholds( std::string( file ) );
+   }
+   catch( ... ) {}
+
+   for( Threshold& entry : ThresholdTable<>::entries_ )
+   {
+      const char* env = std::getenv( ( std::string( "BLAZE_" ) + entry.name ).c_str() );
+      size_t number( 0UL );
+
+      if( env != nullptr && parseThresholdValue( env, number ) && number >= entry.minimumValue )
+         entry.value = number;
+   }
+
+   return true;
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
-constexpr size_t SMP_DVECSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DVECSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DVECSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DVECDVECADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECADD_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECADD_THRESHOLD    );
-constexpr size_t SMP_DVECDVECSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECSUB_THRESHOLD    );
-constexpr size_t SMP_DVECDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DVECDVECMULT_THRESHOLD   );
-constexpr size_t SMP_DVECDVECDIV_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECDIV_DEBUG_THRESHOLD    : BLAZE_SMP_DVECDVECDIV_THRESHOLD    );
-constexpr size_t SMP_DVECDVECOUTER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECOUTER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECOUTER_THRESHOLD  );
-constexpr size_t SMP_DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TDMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATDVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDVECMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSVECMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSVECMULT_THRESHOLD   );
-constexpr size_t SMP_TSMATSVECMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSVECMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSVECMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSVECSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSVECSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSVECTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSVECTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSVECTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DMATASSIGN_THRESHOLD     );
-constexpr size_t SMP_DMATSCALARMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATSCALARMULT_DEBUG_THRESHOLD : BLAZE_SMP_DMATSCALARMULT_THRESHOLD );
-constexpr size_t SMP_DMATDMATADD_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATADD_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATADD_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATADD_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATADD_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATADD_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSUB_THRESHOLD    = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSUB_DEBUG_THRESHOLD    : BLAZE_SMP_DMATDMATSUB_THRESHOLD    );
-constexpr size_t SMP_DMATTDMATSUB_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSUB_DEBUG_THRESHOLD   : BLAZE_SMP_DMATTDMATSUB_THRESHOLD   );
-constexpr size_t SMP_DMATDMATSCHUR_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATSCHUR_DEBUG_THRESHOLD  : BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  );
-constexpr size_t SMP_DMATTDMATSCHUR_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATSCHUR_DEBUG_THRESHOLD : BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD );
-constexpr size_t SMP_DMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_DMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_DMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_DMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_DMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TDMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TDMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TDMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TDMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATDMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATDMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATDMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATDMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTDMATMULT_THRESHOLD );
-constexpr size_t SMP_SMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? SMP_SMATSMATMULT_DEBUG_THRESHOLD   : BLAZE_SMP_SMATSMATMULT_THRESHOLD   );
-constexpr size_t SMP_SMATTSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_SMATTSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_SMATTSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_SMP_TSMATSMATMULT_THRESHOLD  );
-constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
-constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
-constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+template< typename T >
+const bool ThresholdTable<T>::initialized_ = initThresholds();
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+const bool thresholdsInitialized = ThresholdTable<>::initialized_;
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 } // namespace blaze
 
 
@@ -1036,64 +1714,72 @@ constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATRED
 /*! \cond BLAZE_INTERNAL */
 namespace {
 
-BLAZE_STATIC_ASSERT( blaze::DMATDVECMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDVECMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDVECTDMATMULT_THRESHOLD > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATDMATMULT_THRESHOLD   > 0UL );
-BLAZE_STATIC_ASSERT( blaze::DMATTDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATDMATMULT_THRESHOLD  > 0UL );
-BLAZE_STATIC_ASSERT( blaze::TDMATTDMATMULT_THRESHOLD > 0UL );
-
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATASSIGN_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATADD_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
-BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATDVECMULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATDVECMULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDVECDMATMULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDVECTDMATMULT_THRESHOLD > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATDMATMULT_THRESHOLD   > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_DMATTDMATMULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATDMATMULT_THRESHOLD  > 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_TDMATTDMATMULT_THRESHOLD > 0UL );
+
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECASSIGN_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECDIV_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECOUTER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATSVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATDVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATDVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDVECTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATSVECMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATSVECMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSVECTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATASSIGN_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSCALARMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATADD_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATADD_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATSUB_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATSUB_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATSCHUR_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATSCHUR_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TDMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATDMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATDMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATTDMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATSMATMULT_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATASSEMBLE_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTRANSPOSE_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATTRSV_THRESHOLD       >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_PERMUTE_THRESHOLD        >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SMATCOMPACT_THRESHOLD    >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_SPARSEREDUCE_THRESHOLD   >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( BLAZE_SMP_DVECDVECINNER_THRESHOLD  >= 0UL );
 
 }
 /*! \endcond */
@@ -42,8 +42,11 @@
 
 #include <functional>
 #include <memory>
+#include <vector>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/Types.h>
 
 
 namespace blaze {
@@ -260,7 +263,7 @@ class Thread
    //**Constructors********************************************************************************
    /*!\name Constructors */
    //@{
-   explicit Thread( ThreadPoolType* pool );
+   explicit Thread( ThreadPoolType* pool, size_t slot );
    //@}
    //**********************************************************************************************
 
@@ -293,6 +296,7 @@ class Thread
    /*!\name Utility functions */
    //@{
    inline bool hasTerminated() const;
+   inline void pin( const std::vector<size_t>& cpus );
    //@}
    //**********************************************************************************************
 
@@ -311,6 +315,7 @@ class Thread
                                       pool to learn whether the thread has terminated
                                       its execution. */
    ThreadPoolType* pool_;        //!< Handle to the managing thread pool.
+   size_t          index_;       //!< Slot of the thread in the thread pool.
    ThreadHandle    thread_;      //!< Handle to the thread of execution.
    //@}
    //**********************************************************************************************
@@ -336,6 +341,7 @@ class Thread
 /*!\brief Starting a thread in a thread pool.
 //
 // \param pool Handle to the managing thread pool.
+// \param slot Slot of the thread in the thread pool.
 //
 // This function creates a new thread in the given thread pool. The thread is kept alive until
 // explicitly killed by the managing thread pool.
@@ -344,9 +350,10 @@ template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool )
+Thread<TT,MT,LT,CT>::Thread( ThreadPoolType* pool, size_t slot )
    : terminated_( false   )  // Thread termination flag
    , pool_      ( pool    )  // Handle to the managing thread pool
+   , index_     ( slot    )  // Slot of the thread in the thread pool
    , thread_    ( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( std::bind( &Thread::run, this ) ) );
@@ -371,6 +378,7 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 inline Thread<TT,MT,LT,CT>::Thread( Callable func, Args&&... args )
    : pool_  ( nullptr )  // Handle to the managing thread pool
+   , index_ ( 0UL     )  // Slot of the thread in the thread pool
    , thread_( nullptr )  // Handle to the thread of execution
 {
    thread_.reset( new ThreadType( func, std::forward<Args>( args )... ) );
@@ -464,6 +472,26 @@ inline bool Thread<TT,MT,LT,CT>::hasTerminated() const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the thread to the CPU assigned to its slot in the thread pool.
+//
+// \param cpus The list of CPUs the threads of the thread pool are pinned to (empty: no pinning).
+// \return void
+//
+// This function is used by the managing thread pool to pin the thread to the CPU
+// \a cpus[slot % cpus.size()]. In case the given list is empty, the thread is released again.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void Thread<TT,MT,LT,CT>::pin( const std::vector<size_t>& cpus )
+{
+   threadpool::pinThread( *thread_, cpus, index_ );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -487,7 +515,7 @@ void Thread<TT,MT,LT,CT>::run()
    BLAZE_INTERNAL_ASSERT( pool_, "Uninitialized pool handle detected" );
 
    // Executing scheduled tasks
-   while( pool_->executeTask() ) {}
+   while( pool_->executeTask( index_ ) ) {}
 
    // Setting the termination flag
    terminated_ = true;
@@ -40,16 +40,23 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <thread>
 #include <vector>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/Exception.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Thread.h>
+#include <blaze/util/threadpool/Affinity.h>
 #include <blaze/util/threadpool/Task.h>
-#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/threadpool/TaskGroup.h>
+#include <blaze/util/threadpool/WorkQueue.h>
 #include <blaze/util/Types.h>
 
 
@@ -193,6 +200,60 @@ namespace blaze {
 // for the given functions/functors.
 //
 //
+// \section threadpool_scheduling Task distribution
+//
+// Every thread of the thread pool owns a separate work queue. The scheduled tasks are distributed
+// round-robin among the work queues of the threads. Every thread processes the tasks of its own
+// queue in the order they have been scheduled. As soon as its own queue is empty, a thread steals
+// tasks from the queues of the other threads. Therefore tasks of different duration are
+// automatically balanced between the threads and no thread stays idle as long as there are
+// scheduled tasks left. The work queues are lock-free ring buffers, i.e. scheduling a task and
+// acquiring a task do not require to lock a mutex. Optionally, idle threads can spin for a
+// given number of iterations before they are parked (see the ThreadPool constructor). This
+// reduces the latency for tasks that are scheduled in quick succession.
+//
+// Every thread occupies a fixed slot of the thread pool, which determines its work queue. Since
+// the distribution of tasks restarts with the first work queue after every call to the wait()
+// function, the \f$ i \f$-th task of a sequence of tasks is placed in the work queue of the same
+// thread every time. Note however that this only makes it likely, but does not guarantee that
+// the \f$ i \f$-th task is also executed by this thread: Parked threads are woken up in arbitrary
+// order and every idle thread steals tasks from the work queues of the other threads. Therefore
+// repeated parallel operations on the same data assign the same part of the data to the same
+// thread on a best-effort basis only. Additionally, via the setAffinity() function the threads
+// can be pinned to specific CPUs:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   threadpool.setAffinity( { 0, 2, 4, 6 } );                     // Thread i runs on CPU 2*i
+   threadpool.setAffinity( threadpool::parseAffinity( "scatter" ) );  // Round-robin among sockets
+   threadpool.setAffinity( {} );                                 // No pinning
+   \endcode
+
+// Pinning threads prevents their migration between CPUs and processor packages (i.e. sockets)
+// and thus keeps the threads close to the data they have previously worked on. Note that pinning
+// is currently only supported on Linux; on all other platforms setAffinity() has no effect.
+//
+//
+// \section threadpool_groups Task groups
+//
+// The wait() function without arguments blocks until all scheduled tasks have been completed,
+// including the tasks scheduled by other threads. In case several threads share a thread pool,
+// every thread can schedule its tasks as part of its own task group and wait for this group only:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   // Executed concurrently by several threads
+   blaze::threadpool::TaskGroup group;
+   threadpool.schedule( group, function0 );
+   threadpool.wait( group );  // Does not wait for the tasks of other threads
+   \endcode
+
+// Since all tasks are executed by the same threads, concurrently scheduled tasks of several
+// groups do not oversubscribe the machine.
+//
+//
 // \section threadpool_exception Throwing exceptions in a thread parallel environment
 //
 // It can happen that during the execution of a given task a thread encounters an erroneous
@@ -319,17 +380,23 @@ class ThreadPool
    //! Type of the thread container.
    using Threads = std::vector< std::unique_ptr<ManagedThread> >;
 
-   using TaskQueue = threadpool::TaskQueue;  //!< Type of the task queue.
-   using Mutex     = MT;                     //!< Type of the mutex.
-   using Lock      = LT;                     //!< Type of a locking object.
-   using Condition = CT;                     //!< Condition variable type.
+   //! Type of the per-thread work queues.
+   using WorkQueue = threadpool::WorkQueue<MT,LT>;
+
+   //! Type of the work queue container.
+   using WorkQueues = std::vector< std::unique_ptr<WorkQueue> >;
+
+   using Mutex     = MT;  //!< Type of the mutex.
+   using Lock      = LT;  //!< Type of a locking object.
+   using Condition = CT;  //!< Condition variable type.
    //**********************************************************************************************
 
  public:
    //**Constructor*********************************************************************************
    /*!\name Constructor */
    //@{
-   explicit ThreadPool( size_t n );
+   explicit ThreadPool( size_t n, size_t spin=0UL,
+                        const std::vector<size_t>& cpus=std::vector<size_t>() );
    //@}
    //**********************************************************************************************
 
@@ -355,15 +422,20 @@ class ThreadPool
    //@{
    template< typename Callable, typename... Args >
    void schedule( Callable func, Args&&... args );
+
+   template< typename Callable, typename... Args >
+   void schedule( threadpool::TaskGroup& group, Callable func, Args&&... args );
    //@}
    //**********************************************************************************************
 
    //**Utility functions***************************************************************************
    /*!\name Utility functions */
    //@{
-   void resize( size_t n, bool block=false );
-   void wait();
-   void clear();
+   void resize     ( size_t n, bool block=false );
+   void setAffinity( const std::vector<size_t>& cpus );
+   void wait       ();
+   void wait       ( threadpool::TaskGroup& group );
+   void clear      ();
    //@}
    //**********************************************************************************************
 
@@ -372,23 +444,32 @@ class ThreadPool
    /*!\name Thread functions */
    //@{
    void createThread();
-   bool executeTask();
+   bool executeTask( size_t slot );
+   bool acquireTask( size_t index, threadpool::Task& task );
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   volatile size_t total_;     //!< Total number of threads in the thread pool.
-   volatile size_t expected_;  //!< Expected number of threads in the thread pool.
-                               /*!< This number may differ from the total number of threads
-                                    during a resize of the thread pool. */
-   volatile size_t active_;    //!< Number of currently active/busy threads.
-   Threads threads_;           //!< The threads contained in the thread pool.
-   TaskQueue taskqueue_;       //!< Task queue for the scheduled tasks.
-   mutable Mutex mutex_;       //!< Synchronization mutex.
-   Condition waitForTask_;     //!< Wait condition for idle threads.
-   Condition waitForThread_;   //!< Wait condition for the thread management.
+   volatile size_t total_;        //!< Total number of threads in the thread pool.
+   volatile size_t expected_;     //!< Expected number of threads in the thread pool.
+                                  /*!< This number may differ from the total number of threads
+                                       during a resize of the thread pool. */
+   volatile size_t active_;       //!< Number of currently active/busy threads.
+   Threads threads_;              //!< The threads contained in the thread pool.
+   std::vector<bool> slots_;      //!< Occupation flags of the slots of the thread pool.
+   std::vector<size_t> cpus_;     //!< The CPUs the threads are pinned to (empty: no pinning).
+   WorkQueues queues_;            //!< The work queues of the threads for the scheduled tasks.
+   std::atomic<size_t> width_;    //!< Number of work queues the scheduled tasks are distributed to.
+   std::atomic<size_t> next_;     //!< Index of the work queue for the next scheduled task.
+   std::atomic<size_t> queued_;   //!< Number of scheduled tasks not yet acquired by a thread.
+   std::atomic<size_t> pending_;  //!< Number of scheduled tasks not yet completed.
+   std::atomic<size_t> parked_;   //!< Number of threads waiting for a new task.
+   const size_t spin_;            //!< Number of spin iterations before an idle thread is parked.
+   mutable Mutex mutex_;          //!< Synchronization mutex.
+   Condition waitForTask_;        //!< Wait condition for idle threads.
+   Condition waitForThread_;      //!< Wait condition for the thread management.
    //@}
    //**********************************************************************************************
 
@@ -413,24 +494,45 @@ class ThreadPool
 /*!\brief Constructor for the ThreadPool class.
 //
 // \param n Initial number of threads \f$[1..\infty)\f$.
+// \param spin The number of spin iterations before an idle thread is parked.
+// \param cpus The CPUs the threads are pinned to (empty: no pinning).
 //
 // This constructor creates a thread pool with initially \a n new threads. All threads are
-// initially idle until a task is scheduled.
+// initially idle until a task is scheduled. In case the given list of CPUs is not empty, the
+// \f$ i \f$-th thread is pinned to the CPU \a cpus[i % cpus.size()] (see setAffinity()). Via the \a spin parameter it is possible to specify
+// how often an idle thread and a thread waiting in the wait() function check for new tasks and
+// the completion of all tasks, respectively, before blocking on a condition variable. Spinning
+// avoids the latency of waking up blocked threads in case tasks are scheduled in quick
+// succession, but occupies the according cores while spinning.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n )
+ThreadPool<TT,MT,LT,CT>::ThreadPool( size_t n, size_t spin, const std::vector<size_t>& cpus )
    : total_   ( 0UL )  // Total number of threads in the thread pool
    , expected_( 0UL )  // Expected number of threads in the thread pool
    , active_  ( 0UL )  // Number of currently active/busy threads
    , threads_      ()  // The threads contained in the thread pool
-   , taskqueue_    ()  // Task queue for the scheduled tasks
+   , slots_        ()  // Occupation flags of the slots of the thread pool
+   , cpus_    ( cpus )  // The CPUs the threads are pinned to
+   , queues_       ()  // The work queues of the threads for the scheduled tasks
+   , width_   ( 1UL )  // Number of work queues the scheduled tasks are distributed to
+   , next_    ( 0UL )  // Index of the work queue for the next scheduled task
+   , queued_  ( 0UL )  // Number of scheduled tasks not yet acquired by a thread
+   , pending_ ( 0UL )  // Number of scheduled tasks not yet completed
+   , parked_  ( 0UL )  // Number of threads waiting for a new task
+   , spin_    ( spin )  // Number of spin iterations before an idle thread is parked
    , mutex_        ()  // Synchronization mutex
    , waitForTask_  ()  // Wait condition for idle threads
    , waitForThread_()  // Wait condition for the thread management
 {
+   const size_t queues( max( n, static_cast<size_t>( TT::hardware_concurrency() ), 1UL ) );
+
+   for( size_t i=0UL; i<queues; ++i ) {
+      queues_.push_back( std::unique_ptr<WorkQueue>( new WorkQueue() ) );
+   }
+
    resize( n );
 }
 //*************************************************************************************************
@@ -459,7 +561,11 @@ ThreadPool<TT,MT,LT,CT>::~ThreadPool()
    Lock lock( mutex_ );
 
    // Removing all currently queued tasks
-   taskqueue_.clear();
+   for( auto const& queue : queues_ ) {
+      const size_t removed( queue->clear() );
+      queued_  -= removed;
+      pending_ -= removed;
+   }
 
    // Setting the expected number of threads
    expected_ = 0UL;
@@ -502,8 +608,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline bool ThreadPool<TT,MT,LT,CT>::isEmpty() const
 {
-   Lock lock( mutex_ );
-   return taskqueue_.isEmpty();
+   return queued_ == 0UL;
 }
 //*************************************************************************************************
 
@@ -576,7 +681,8 @@ inline size_t ThreadPool<TT,MT,LT,CT>::ready() const
 //
 // This function schedules the given function/functor for execution. The given function/functor
 // must be copyable, must be callable with the given type and number of arguments and must return
-// \c void.
+// \c void. The task is published via the lock-free work queue of one of the threads. The pool
+// mutex is only acquired in case a parked thread has to be woken up.
 */
 template< typename TT         // Type of the encapsulated thread
         , typename MT         // Type of the synchronization mutex
@@ -586,9 +692,62 @@ template< typename Callable   // Type of the function/functor
         , typename... Args >  // Types of the function/functor arguments
 void ThreadPool<TT,MT,LT,CT>::schedule( Callable func, Args&&... args )
 {
-   Lock lock( mutex_ );
-   taskqueue_.push( std::bind<void>( func, std::forward<Args>( args )... ) );
-   waitForTask_.notify_one();
+   ++pending_;
+   ++queued_;
+
+   queues_[next_++ % width_]->push( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   if( parked_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution as part of the given task group.
+//
+// \param group The task group the task belongs to.
+// \param func The given function/functor.
+// \param args The arguments for the function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution as part of the given task
+// group. The tasks of the group can be waited for via the wait() function for task groups,
+// independent of all other scheduled tasks. The distribution of the tasks of a group among the
+// work queues restarts with the first work queue after every wait for the group. Note that the
+// task group must not be destroyed before all of its tasks have been completed.
+*/
+template< typename TT         // Type of the encapsulated thread
+        , typename MT         // Type of the synchronization mutex
+        , typename LT         // Type of the mutex lock
+        , typename CT >       // Type of the condition variable
+template< typename Callable   // Type of the function/functor
+        , typename... Args >  // Types of the function/functor arguments
+void ThreadPool<TT,MT,LT,CT>::schedule( threadpool::TaskGroup& group, Callable func, Args&&... args )
+{
+   ++pending_;
+   ++queued_;
+   ++group.pending_;
+
+   threadpool::Task task( std::bind<void>( func, std::forward<Args>( args )... ) );
+
+   queues_[group.next_++ % width_]->push( [this,&group,task]()
+   {
+      task();
+
+      // Signaling the completion of all tasks of the group
+      if( --group.pending_ == 0UL ) {
+         Lock lock( mutex_ );
+         waitForThread_.notify_all();
+      }
+   } );
+
+   if( parked_ > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
 }
 //*************************************************************************************************
 
@@ -674,6 +833,9 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
          }
       }
 
+      // Adjusting the number of work queues for the scheduled tasks
+      width_ = min( max( n, 1UL ), queues_.size() );
+
       // Joining and destroying any terminated thread
       for( typename Threads::iterator thread=threads_.begin(); thread!=threads_.end(); ) {
          if( (*thread)->hasTerminated() ) {
@@ -687,12 +849,48 @@ void ThreadPool<TT,MT,LT,CT>::resize( size_t n, bool block )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Pins the threads of the thread pool to the given CPUs.
+//
+// \param cpus The CPUs the threads are pinned to (empty: no pinning).
+// \return void
+//
+// This function pins the thread in the \f$ i \f$-th slot of the thread pool to the CPU
+// \a cpus[i % cpus.size()]. This also applies to all threads added to the pool later on. In
+// case the given list of CPUs is empty, all threads are released again and may run on any CPU.
+// Note that pinning is currently only supported on Linux; on all other platforms the function
+// has no effect.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::setAffinity( const std::vector<size_t>& cpus )
+{
+   Lock lock( mutex_ );
+
+   const bool pinned( !cpus_.empty() );
+
+   cpus_ = cpus;
+
+   if( !pinned && cpus_.empty() )
+      return;
+
+   for( auto const& thread : threads_ ) {
+      if( !thread->hasTerminated() )
+         thread->pin( cpus_ );
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Waiting for all scheduled tasks to be completed.
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all scheduled tasks have been completed. Before blocking, the
+// calling thread spins for the number of spin iterations specified during construction.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -700,11 +898,50 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::wait()
 {
+   for( size_t i=0UL; pending_ > 0UL && i<spin_; ++i ) {
+      std::this_thread::yield();
+   }
+
+   Lock lock( mutex_ );
+
+   while( pending_ > 0UL ) {
+      waitForThread_.wait( lock );
+   }
+
+   next_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks of the given task group to be completed.
+//
+// \param group The task group to wait for.
+// \return void
+//
+// This function blocks until all tasks scheduled as part of the given task group have been
+// completed. In contrast to the wait() function without arguments, it does not wait for the
+// tasks of any other group or for tasks scheduled without group. Therefore several threads can
+// concurrently wait for their own tasks. Before blocking, the calling thread spins for the
+// number of spin iterations specified during construction.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void ThreadPool<TT,MT,LT,CT>::wait( threadpool::TaskGroup& group )
+{
+   for( size_t i=0UL; group.pending_ > 0UL && i<spin_; ++i ) {
+      std::this_thread::yield();
+   }
+
    Lock lock( mutex_ );
 
-   while( !taskqueue_.isEmpty() || active_ > 0UL ) {
+   while( group.pending_ > 0UL ) {
       waitForThread_.wait( lock );
    }
+
+   group.next_ = 0UL;
 }
 //*************************************************************************************************
 
@@ -724,7 +961,16 @@ template< typename TT    // Type of the encapsulated thread
 void ThreadPool<TT,MT,LT,CT>::clear()
 {
    Lock lock( mutex_ );
-   taskqueue_.clear();
+
+   for( auto const& queue : queues_ ) {
+      const size_t removed( queue->clear() );
+      queued_  -= removed;
+      pending_ -= removed;
+   }
+
+   if( pending_ == 0UL ) {
+      waitForThread_.notify_all();
+   }
 }
 //*************************************************************************************************
 
@@ -741,6 +987,9 @@ void ThreadPool<TT,MT,LT,CT>::clear()
 /*!\brief Adding a new thread to the thread pool.
 //
 // \return void
+//
+// The new thread occupies the first free slot of the thread pool. In case the threads of the
+// pool are pinned to specific CPUs, the new thread is pinned to the CPU assigned to its slot.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -748,7 +997,17 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 void ThreadPool<TT,MT,LT,CT>::createThread()
 {
-   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this ) ) );
+   const size_t slot( std::find( slots_.begin(), slots_.end(), false ) - slots_.begin() );
+
+   if( slot == slots_.size() )
+      slots_.push_back( true );
+   else slots_[slot] = true;
+
+   threads_.push_back( std::unique_ptr<ManagedThread>( new ManagedThread( this, slot ) ) );
+
+   if( !cpus_.empty() )
+      threads_.back()->pin( cpus_ );
+
    ++total_;
    ++expected_;
    ++active_;
@@ -759,49 +1018,109 @@ void ThreadPool<TT,MT,LT,CT>::createThread()
 //*************************************************************************************************
 /*!\brief Executing a scheduled task.
 //
-// \return \a true in case a task was successfully finished, \a false if not.
+// \param slot The slot of the calling thread.
+// \return \a true in case a task was successfully finished, \a false if the thread terminates.
 //
 // This function is repeatedly called by every thread to execute one of the scheduled tasks.
-// In case there is no task available, the thread blocks and waits for a new task to be
-// scheduled.
+// The thread first tries to acquire a task from its own work queue and, in case its own queue
+// is empty, tries to steal a task from the work queues of the other threads. In case there is
+// no task available in any work queue, the thread spins for the number of spin iterations
+// specified during construction. Only afterwards the thread is parked and waits for a new task
+// to be scheduled. In case the thread pool has been shrunk such that the slot of the calling
+// thread is no longer in use, the thread releases its slot and terminates.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
         , typename LT    // Type of the mutex lock
         , typename CT >  // Type of the condition variable
-bool ThreadPool<TT,MT,LT,CT>::executeTask()
+bool ThreadPool<TT,MT,LT,CT>::executeTask( size_t slot )
 {
+   const size_t index( slot % queues_.size() );
+
    threadpool::Task task;
 
    // Acquiring a scheduled task
+   bool acquired( acquireTask( index, task ) );
+
+   for( size_t i=0UL; !acquired && i<spin_; ++i ) {
+      std::this_thread::yield();
+      acquired = acquireTask( index, task );
+   }
+
+   if( !acquired )
    {
       Lock lock( mutex_ );
 
-      while( taskqueue_.isEmpty() )
+      while( !acquireTask( index, task ) )
       {
          --active_;
          waitForThread_.notify_all();
 
-         if( total_ > expected_ ) {
+         if( slot >= expected_ ) {
+            slots_[slot] = false;
             --total_;
             return false;
          }
 
-         waitForTask_.wait( lock );
+         ++parked_;
+         if( queued_ == 0UL ) {
+            waitForTask_.wait( lock );
+         }
+         --parked_;
+
          ++active_;
       }
-
-      BLAZE_INTERNAL_ASSERT( !taskqueue_.isEmpty(), "Empty task queue detected" );
-      task = taskqueue_.pop();
    }
 
    // Executing the task
    task();
 
+   // Signaling the completion of all scheduled tasks
+   if( --pending_ == 0UL ) {
+      Lock lock( mutex_ );
+      waitForThread_.notify_all();
+   }
+
    return true;
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Acquiring a scheduled task from the work queues.
+//
+// \param index The index of the work queue of the calling thread.
+// \param task The task handle to be assigned the acquired task.
+// \return \a true in case a task was acquired, \a false if all work queues are empty.
+//
+// This function removes the next task from the work queue with the given index. In case this
+// work queue is empty, it steals the next task from the first non-empty work queue of the
+// remaining threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+bool ThreadPool<TT,MT,LT,CT>::acquireTask( size_t index, threadpool::Task& task )
+{
+   BLAZE_INTERNAL_ASSERT( index < queues_.size(), "Invalid work queue index" );
+
+   if( queued_ == 0UL )
+      return false;
+
+   const size_t queues( queues_.size() );
+
+   for( size_t i=0UL; i<queues; ++i ) {
+      if( queues_[(index+i)%queues]->pop( task ) ) {
+         --queued_;
+         return true;
+      }
+   }
+
+   return false;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,319 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/Affinity.h
+//  \brief Thread affinity functionality for the thread pool
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+#define _BLAZE_UTIL_THREADPOOL_AFFINITY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+#  include <pthread.h>
+#  include <sched.h>
+#  include <fstream>
+#endif
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/util/Exception.h>
+#include <blaze/util/MaybeUnused.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  AFFINITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Affinity functions */
+//@{
+inline std::vector<size_t> availableCPUs();
+inline size_t cpuPackage( size_t cpu );
+inline std::vector<size_t> parseAffinity( const std::string& affinity );
+
+template< typename TT >
+inline void pinThread( TT& thread, const std::vector<size_t>& cpus, size_t slot );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the CPUs the calling thread is allowed to run on.
+// \ingroup threads
+//
+// \return The sorted list of available CPUs.
+//
+// On Linux the function returns the CPUs contained in the affinity mask of the calling thread
+// (which for instance respects a restriction via \c taskset or \c numactl). On all other
+// platforms it returns the CPUs \f$[0..N)\f$, where \f$ N \f$ is the number of hardware threads.
+*/
+inline std::vector<size_t> availableCPUs()
+{
+   std::vector<size_t> cpus;
+
+#if defined(__linux__) && defined(_GNU_SOURCE)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( sched_getaffinity( 0, sizeof( set ), &set ) == 0 ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         if( CPU_ISSET( cpu, &set ) )
+            cpus.push_back( cpu );
+      }
+   }
+#endif
+
+   if( cpus.empty() ) {
+      const size_t n( std::max( std::thread::hardware_concurrency(), 1U ) );
+      for( size_t cpu=0UL; cpu<n; ++cpu ) {
+         cpus.push_back( cpu );
+      }
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the processor package (i.e. socket) containing the given CPU.
+// \ingroup threads
+//
+// \param cpu The index of the CPU.
+// \return The index of the processor package of the CPU.
+//
+// On Linux the package is queried from the CPU topology in \c /sys. In case the topology cannot
+// be determined and on all other platforms, the function returns 0.
+*/
+inline size_t cpuPackage( size_t cpu )
+{
+#if defined(__linux__) && defined(_GNU_SOURCE)
+   std::ifstream file( "/sys/devices/system/cpu/cpu" + std::to_string( cpu ) +
+                       "/topology/physical_package_id" );
+
+   long package( 0L );
+   if( file >> package && package > 0L )
+      return static_cast<size_t>( package );
+#else
+   MAYBE_UNUSED( cpu );
+#endif
+
+   return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Converts the given thread affinity specification into a list of CPUs.
+// \ingroup threads
+//
+// \param affinity The thread affinity specification.
+// \return The list of CPUs the threads of a thread pool are pinned to (empty: no pinning).
+// \exception std::invalid_argument Invalid thread affinity.
+//
+// This function converts the given thread affinity specification into the list of CPUs the
+// threads of a thread pool are pinned to. The \f$ i \f$-th thread of the pool is pinned to the
+// \f$ i \f$-th CPU of the list (modulo the length of the list). The following specifications
+// are supported:
+//
+//  - \c "none" or an empty string: the threads are not pinned and may migrate freely.
+//  - \c "compact": the threads are pinned to consecutive CPUs, filling one processor package
+//    (i.e. socket) before using the next one.
+//  - \c "scatter": the threads are distributed round-robin among the processor packages.
+//  - an explicit, comma-separated list of CPUs and CPU ranges, as for instance \c "0,2,4-7".
+//
+// All policies only consider CPUs the calling thread is allowed to run on (see availableCPUs()).
+// In case the given specification is malformed, contains a descending range, or refers to a CPU
+// that is not available, a \a std::invalid_argument exception is thrown.
+*/
+inline std::vector<size_t> parseAffinity( const std::string& affinity )
+{
+   std::string spec;
+
+   for( char c : affinity ) {
+      if( !std::isspace( static_cast<unsigned char>( c ) ) )
+         spec.push_back( static_cast<char>( std::tolower( static_cast<unsigned char>( c ) ) ) );
+   }
+
+   if( spec.empty() || spec == "none" )
+      return std::vector<size_t>();
+
+   const std::vector<size_t> available( availableCPUs() );
+
+   if( spec == "compact" || spec == "scatter" )
+   {
+      std::map< size_t, std::vector<size_t> > packages;
+
+      for( size_t cpu : available ) {
+         packages[cpuPackage( cpu )].push_back( cpu );
+      }
+
+      std::vector<size_t> cpus;
+
+      if( spec == "compact" ) {
+         for( auto const& package : packages ) {
+            cpus.insert( cpus.end(), package.second.begin(), package.second.end() );
+         }
+      }
+      else {
+         for( size_t i=0UL; cpus.size() < available.size(); ++i ) {
+            for( auto const& package : packages ) {
+               if( i < package.second.size() )
+                  cpus.push_back( package.second[i] );
+            }
+         }
+      }
+
+      return cpus;
+   }
+
+   std::vector<size_t> cpus;
+   std::string::const_iterator it( spec.begin() );
+
+   const auto parseNumber = [&]() -> size_t
+   {
+      if( it == spec.end() || !std::isdigit( static_cast<unsigned char>( *it ) ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+      }
+
+      size_t number( 0UL );
+      while( it != spec.end() && std::isdigit( static_cast<unsigned char>( *it ) ) ) {
+         const size_t digit( static_cast<size_t>( *it - '0' ) );
+         if( number > ( std::numeric_limits<size_t>::max() - digit ) / 10UL ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+         }
+         number = number*10UL + digit;
+         ++it;
+      }
+      return number;
+   };
+
+   while( true )
+   {
+      const size_t first( parseNumber() );
+      size_t last( first );
+
+      if( it != spec.end() && *it == '-' ) {
+         ++it;
+         last = parseNumber();
+      }
+
+      if( last < first ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+      }
+
+      // Checking the range before its expansion, which bounds its length by the number of CPUs
+      if( last > available.back() ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Unavailable CPU in thread affinity" );
+      }
+
+      for( size_t cpu=first; cpu<=last; ++cpu ) {
+         if( !std::binary_search( available.begin(), available.end(), cpu ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Unavailable CPU in thread affinity" );
+         }
+         cpus.push_back( cpu );
+      }
+
+      if( it == spec.end() )
+         break;
+
+      if( *it != ',' ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid thread affinity" );
+      }
+      ++it;
+   }
+
+   return cpus;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pins the given thread to the CPU assigned to the given slot.
+// \ingroup threads
+//
+// \param thread The thread to be pinned.
+// \param cpus The list of CPUs the threads of the thread pool are pinned to.
+// \param slot The slot of the thread in the thread pool.
+// \return void
+//
+// This function pins the given thread to the CPU \a cpus[slot % cpus.size()]. In case the given
+// list of CPUs is empty, the thread is released again, i.e. it may run on any CPU. Pinning is
+// currently only supported on Linux; on all other platforms the function has no effect. Also,
+// a CPU that cannot be used (e.g. since it is not available to the process) is silently
+// ignored, i.e. the thread remains unpinned.
+*/
+template< typename TT >  // Type of the thread
+inline void pinThread( TT& thread, const std::vector<size_t>& cpus, size_t slot )
+{
+#if defined(__linux__) && defined(_GNU_SOURCE)
+   cpu_set_t set;
+   CPU_ZERO( &set );
+
+   if( cpus.empty() ) {
+      for( size_t cpu=0UL; cpu<CPU_SETSIZE; ++cpu ) {
+         CPU_SET( cpu, &set );
+      }
+   }
+   else {
+      const size_t cpu( cpus[slot % cpus.size()] );
+      if( cpu >= CPU_SETSIZE ) return;
+      CPU_SET( cpu, &set );
+   }
+
+   pthread_setaffinity_np( thread.native_handle(), sizeof( set ), &set );
+#else
+   MAYBE_UNUSED( thread, cpus, slot );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,183 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/TaskGroup.h
+//  \brief Header file of the TaskGroup class
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+#define _BLAZE_UTIL_THREADPOOL_TASKGROUP_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ::blaze NAMESPACE FORWARD DECLARATIONS
+//
+//=================================================================================================
+
+template< typename TT, typename MT, typename LT, typename CT > class ThreadPool;
+
+
+
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Group of tasks that can be waited for independently of all other tasks of a thread pool.
+// \ingroup threads
+//
+// The TaskGroup class represents a set of tasks scheduled via the ThreadPool::schedule() function
+// for task groups. Waiting for a task group (see ThreadPool::wait()) only blocks until the tasks
+// of this particular group have been completed, independent of the tasks scheduled by other
+// threads. Therefore several threads can concurrently use the same thread pool without waiting
+// for each other's tasks:
+
+   \code
+   StdThreadPool threadpool( 4 );
+
+   blaze::threadpool::TaskGroup group;
+   threadpool.schedule( group, function0 );
+   threadpool.schedule( group, Functor2(), 4, 6 );
+   threadpool.wait( group );
+   \endcode
+
+// Note that a task group must not be destroyed before all of its tasks have been completed.
+// Also note that tasks removed from the thread pool via ThreadPool::clear() are never completed.
+*/
+class TaskGroup
+   : private NonCopyable
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline TaskGroup();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool   isEmpty() const;
+   inline size_t pending() const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::atomic<size_t> pending_;  //!< Number of scheduled tasks of the group not yet completed.
+   size_t next_;                  //!< Index of the work queue for the next task of the group.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename TT, typename MT, typename LT, typename CT >
+   friend class blaze::ThreadPool;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for the TaskGroup class.
+*/
+inline TaskGroup::TaskGroup()
+   : pending_( 0UL )  // Number of scheduled tasks of the group not yet completed
+   , next_   ( 0UL )  // Index of the work queue for the next task of the group
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether all tasks of the group have been completed.
+//
+// \return \a true in case all tasks of the group have been completed, \a false if not.
+*/
+inline bool TaskGroup::isEmpty() const
+{
+   return pending_ == 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of scheduled tasks of the group that have not yet been completed.
+//
+// \return The number of pending tasks of the group.
+*/
+inline size_t TaskGroup::pending() const
+{
+   return pending_;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,387 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkQueue.h
+//  \brief Per-thread work queue for the thread pool
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <memory>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/threadpool/Task.h>
+#include <blaze/util/threadpool/TaskQueue.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Per-thread work queue for the thread pool.
+// \ingroup threads
+//
+// The WorkQueue class represents the task queue of a single thread of a thread pool. Tasks are
+// published via a bounded, lock-free ring buffer, from which both the owning thread and idle
+// threads of the same pool (stealing tasks) remove tasks in FIFO order without acquiring a lock.
+// Only in case the ring buffer is full, additional tasks are stored in a mutex-protected overflow
+// queue.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+class WorkQueue
+   : private NonCopyable
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Mutex = MT;  //!< Type of the mutex.
+   using Lock  = LT;  //!< Type of a locking object.
+   //**********************************************************************************************
+
+   //**Cell type***********************************************************************************
+   /*!\brief A single cell of the ring buffer.
+   //
+   // The sequence number of a cell encodes whether the cell is ready to be written (sequence
+   // equals the write position) or to be read (sequence equals the read position plus one).
+   */
+   struct Cell {
+      std::atomic<size_t> sequence;  //!< The sequence number of the cell.
+      Task task;                     //!< The task stored in the cell.
+   };
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkQueue();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isEmpty() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline void   push ( Task task );
+   inline bool   pop  ( Task& task );
+   inline size_t clear();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Ring buffer functions***********************************************************************
+   /*!\name Ring buffer functions */
+   //@{
+   inline bool tryPush( Task& task );
+   inline bool tryPop ( Task& task );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   static constexpr size_t capacity = 256UL;  //!< The capacity of the ring buffer.
+
+   std::unique_ptr<Cell[]> cells_;     //!< The cells of the ring buffer.
+   std::atomic<size_t>     head_;      //!< The read position of the ring buffer.
+   std::atomic<size_t>     tail_;      //!< The write position of the ring buffer.
+   std::atomic<size_t>     overflow_;  //!< The number of tasks in the overflow queue.
+   TaskQueue               tasks_;     //!< The overflow queue for tasks exceeding the ring buffer.
+   mutable Mutex           mutex_;     //!< Synchronization mutex for the overflow queue.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER CONSTANTS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, typename LT >
+constexpr size_t WorkQueue<MT,LT>::capacity;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for WorkQueue.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline WorkQueue<MT,LT>::WorkQueue()
+   : cells_   ( new Cell[capacity] )  // The cells of the ring buffer
+   , head_    ( 0UL )                 // The read position of the ring buffer
+   , tail_    ( 0UL )                 // The write position of the ring buffer
+   , overflow_( 0UL )                 // The number of tasks in the overflow queue
+   , tasks_   ()                      // The overflow queue for tasks exceeding the ring buffer
+   , mutex_   ()                      // Synchronization mutex for the overflow queue
+{
+   for( size_t i=0UL; i<capacity; ++i ) {
+      cells_[i].sequence.store( i, std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns \a true if the work queue has no elements.
+//
+// \return \a true if the work queue is empty, \a false if it is not.
+//
+// Note that in case other threads concurrently add or remove tasks, the result is only a
+// snapshot of the state of the work queue.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkQueue<MT,LT>::isEmpty() const
+{
+   return head_.load() == tail_.load() && overflow_.load() == 0UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the end of the work queue.
+//
+// \param task The task to be added to the end of the work queue.
+// \return void
+//
+// This function publishes the given task via the lock-free ring buffer. Only in case the ring
+// buffer is full, the task is added to the mutex-protected overflow queue.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline void WorkQueue<MT,LT>::push( Task task )
+{
+   if( tryPush( task ) )
+      return;
+
+   Lock lock( mutex_ );
+   tasks_.push( task );
+   ++overflow_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the task from the front of the work queue.
+//
+// \param task The task handle to be assigned the removed task.
+// \return \a true in case a task was removed, \a false if the work queue is empty.
+//
+// This function is used by the owning thread of the work queue to acquire its next task and by
+// idle threads to steal tasks from the work queue of another thread.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkQueue<MT,LT>::pop( Task& task )
+{
+   if( tryPop( task ) )
+      return true;
+
+   if( overflow_.load() == 0UL )
+      return false;
+
+   Lock lock( mutex_ );
+
+   if( tasks_.isEmpty() )
+      return false;
+
+   task = tasks_.pop();
+   --overflow_;
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all tasks from the work queue.
+//
+// \return The number of removed tasks.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline size_t WorkQueue<MT,LT>::clear()
+{
+   Task task;
+   size_t removed( 0UL );
+
+   while( pop( task ) ) {
+      ++removed;
+   }
+
+   return removed;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  RING BUFFER FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the ring buffer.
+//
+// \param task The task to be added to the ring buffer.
+// \return \a true in case the task was added, \a false if the ring buffer is full.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkQueue<MT,LT>::tryPush( Task& task )
+{
+   size_t pos( tail_.load( std::memory_order_relaxed ) );
+   Cell* cell( nullptr );
+
+   while( true )
+   {
+      cell = &cells_[pos % capacity];
+
+      const size_t sequence( cell->sequence.load( std::memory_order_acquire ) );
+
+      if( sequence == pos ) {
+         if( tail_.compare_exchange_weak( pos, pos+1UL, std::memory_order_relaxed ) )
+            break;
+      }
+      else if( sequence < pos ) {
+         return false;
+      }
+      else {
+         pos = tail_.load( std::memory_order_relaxed );
+      }
+   }
+
+   cell->task = std::move( task );
+   cell->sequence.store( pos+1UL, std::memory_order_release );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing the task from the front of the ring buffer.
+//
+// \param task The task handle to be assigned the removed task.
+// \return \a true in case a task was removed, \a false if the ring buffer is empty.
+*/
+template< typename MT    // Type of the synchronization mutex
+        , typename LT >  // Type of the mutex lock
+inline bool WorkQueue<MT,LT>::tryPop( Task& task )
+{
+   size_t pos( head_.load( std::memory_order_relaxed ) );
+   Cell* cell( nullptr );
+
+   while( true )
+   {
+      cell = &cells_[pos % capacity];
+
+      const size_t sequence( cell->sequence.load( std::memory_order_acquire ) );
+
+      if( sequence == pos+1UL ) {
+         if( head_.compare_exchange_weak( pos, pos+1UL, std::memory_order_relaxed ) )
+            break;
+      }
+      else if( sequence < pos+1UL ) {
+         return false;
+      }
+      else {
+         pos = head_.load( std::memory_order_relaxed );
+      }
+   }
+
+   task = std::move( cell->task );
+   cell->task = nullptr;
+   cell->sequence.store( pos+capacity, std::memory_order_release );
+
+   return true;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
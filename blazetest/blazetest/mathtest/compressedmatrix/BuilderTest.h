@@ -0,0 +1,186 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/BuilderTest.h
+//  \brief Header file for the CompressedMatrixBuilder test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_BUILDERTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_BUILDERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the CompressedMatrixBuilder class template.
+//
+// This class represents a test suite for the blaze::CompressedMatrixBuilder class template. It
+// performs a series of runtime tests of the incremental assembly and the compaction into a
+// CompressedMatrix.
+*/
+class BuilderTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit BuilderTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testConstructors();
+   void testAdd();
+   void testCompact();
+   void testClear();
+   void testErrors();
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a compaction.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a compaction with the given reference result. In case
+// the two do not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the reference result
+void BuilderTest::checkResult( const Type1& result, const Type2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid compaction result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the functionality of the CompressedMatrixBuilder class template.
+//
+// \return void
+*/
+void runTest()
+{
+   BuilderTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrixBuilder class test.
+*/
+#define RUN_COMPRESSEDMATRIX_BUILDER_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
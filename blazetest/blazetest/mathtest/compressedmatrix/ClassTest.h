@@ -118,6 +118,10 @@ class ClassTest
    void testTranspose   ();
    void testCTranspose  ();
    void testIsDefault   ();
+   void testFromTriplets();
+   void testConversion  ();
+   void testIndexType   ();
+   void testSoAStorage  ();
 
    template< typename Type >
    void checkRows( const Type& matrix, size_t expectedRows ) const;
@@ -112,6 +112,7 @@ class ClassTest
    void testLowerBound  ();
    void testUpperBound  ();
    void testIsDefault   ();
+   void testIndexType   ();
 
    template< typename Type >
    void checkSize( const Type& vector, size_t expectedSize ) const;
@@ -0,0 +1,243 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dmatreduce/columnwise/ParallelTest.h
+//  \brief Header file for the parallel dense matrix column-wise reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DMATREDUCE_COLUMNWISE_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_DMATREDUCE_COLUMNWISE_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the parallel column-wise dense matrix reductions.
+//
+// This class represents a test suite for the parallel evaluation of column-wise reductions of
+// row-major dense matrices (and row-wise reductions of column-major dense matrices) and of the
+// row-wise and column-wise softmax() function. The matrices cover both the split into blocks of
+// columns and the split into blocks of rows (i.e. tall, narrow matrices). All tests are performed
+// both with the default thresholds and with thresholds that enforce the parallel evaluation even
+// for tiny matrices. All results are compared to a straightforward reference implementation.
+*/
+class ParallelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testAssign();
+   template< typename Type > void testCompoundAssign();
+                             void testColumnMajor();
+                             void testSoftmax();
+
+   template< typename VT, typename Type >
+   void checkVector( const VT& result, const std::vector<Type>& ref ) const;
+
+   template< typename MT >
+   void checkSoftmax( const MT& result, const MT& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector< std::pair<size_t,size_t> > sizes_;  //!< The sizes of the test matrices.
+   std::string mode_;                               //!< Label of the currently used thresholds.
+   std::string test_;                               //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a column-wise dense matrix reduction.
+//
+// \param result The computed result vector.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a column-wise dense matrix reduction with the given
+// reference result. Since all test matrices contain small integral values, the results are
+// exact and are compared element by element. In case any element does not match, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename VT      // Type of the computed result vector
+        , typename Type >  // Element type of the reference result
+void ParallelTest::checkVector( const VT& result, const std::vector<Type>& ref ) const
+{
+   bool valid( result.size() == ref.size() );
+
+   for( size_t j=0UL; valid && j<ref.size(); ++j ) {
+      valid = ( result[j] == ref[j] );
+   }
+
+   if( !valid ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << " (" << mode_ << ")\n"
+          << " Error: Invalid reduction result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n(";
+      for( const Type& value : ref ) {
+         oss << " " << value;
+      }
+      oss << " )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a softmax() operation.
+//
+// \param result The computed result matrix.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a softmax() operation, whose accuracy depends on the
+// order of the accumulation, with the given reference result. In case the relative deviation
+// of any element exceeds \f$ 10^{-12} \f$, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the result matrices
+void ParallelTest::checkSoftmax( const MT& result, const MT& ref ) const
+{
+   for( size_t i=0UL; i<ref.rows(); ++i ) {
+      for( size_t j=0UL; j<ref.columns(); ++j ) {
+         if( std::abs( result(i,j) - ref(i,j) ) > 1E-12 * std::abs( ref(i,j) ) ) {
+            std::ostringstream oss;
+            oss.precision( 17 );
+            oss << " Test: " << test_ << " (" << mode_ << ")\n"
+                << " Error: Invalid softmax result\n"
+                << " Details:\n"
+                << "   Element (" << i << "," << j << "):\n"
+                << "     Result:          " << result(i,j) << "\n"
+                << "     Expected result: " << ref(i,j) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel column-wise dense matrix reductions.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel dense matrix column-wise reduction test.
+*/
+#define RUN_DMATREDUCE_COLUMNWISE_PARALLEL_TEST \
+   blazetest::mathtest::dmatreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dmatreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
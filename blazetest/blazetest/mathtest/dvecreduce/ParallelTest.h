@@ -0,0 +1,224 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dvecreduce/ParallelTest.h
+//  \brief Header file for the parallel dense vector reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DVECREDUCE_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_DVECREDUCE_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the parallel dense vector reductions.
+//
+// This class represents a test suite for the parallel evaluation of total reductions, inner
+// products, and norms of dense vectors. The vector sizes are no multiples of the SIMD width and
+// range up to sizes above the SMP_DVECREDUCE_THRESHOLD and SMP_DVECDVECINNER_THRESHOLD. All
+// tests are performed both with the default thresholds and with thresholds that enforce the
+// parallel evaluation even for tiny vectors. All results are compared to a straightforward
+// reference implementation.
+*/
+class ParallelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type > void testReduce();
+   template< typename Type > void testInner();
+   template< typename Type > void testNorm();
+                             void testVectorElements();
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& ref ) const;
+
+   void checkApprox( double result, double ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> sizes_;  //!< The sizes of the test vectors.
+   std::string mode_;           //!< Label of the currently used thresholds.
+   std::string test_;           //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a dense vector reduction.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a dense vector reduction with the given reference
+// result. In case the two do not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the reference result
+void ParallelTest::checkResult( const Type1& result, const Type2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << " (" << mode_ << ")\n"
+          << " Error: Invalid reduction result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Approximate check of the result of a dense vector reduction.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a dense vector reduction, whose accuracy depends on the
+// order of the accumulation, with the given reference result. In case the relative deviation
+// exceeds \f$ 10^{-12} \f$, a \a std::runtime_error exception is thrown.
+*/
+inline void ParallelTest::checkApprox( double result, double ref ) const
+{
+   if( std::abs( result - ref ) > 1E-12 * std::max( std::abs( ref ), 1.0 ) ) {
+      std::ostringstream oss;
+      oss.precision( 17 );
+      oss << " Test: " << test_ << " (" << mode_ << ")\n"
+          << " Error: Invalid reduction result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel dense vector reductions.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel dense vector reduction test.
+*/
+#define RUN_DVECREDUCE_PARALLEL_TEST \
+   blazetest::mathtest::dvecreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dvecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
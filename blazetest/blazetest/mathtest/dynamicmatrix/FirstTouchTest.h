@@ -0,0 +1,346 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dynamicmatrix/FirstTouchTest.h
+//  \brief Header file for the DynamicMatrix first-touch test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DYNAMICMATRIX_FIRSTTOUCHTEST_H_
+#define _BLAZETEST_MATHTEST_DYNAMICMATRIX_FIRSTTOUCHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamicmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the tests of the first-touch initialization of dynamic operands.
+//
+// This class represents a test suite for the DynamicVector and DynamicMatrix class templates
+// with activated \c BLAZE_SMP_FIRST_TOUCH switch. It tests the constructors, the resize()
+// functions, and the numaDistribute() functions for operands exceeding the according SMP
+// assignment thresholds, both for built-in and for non-built-in element types.
+*/
+class FirstTouchTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit FirstTouchTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testVector( const std::string& type );
+
+   template< typename Type, bool SO >
+   void testMatrix( const std::string& type );
+
+   template< typename Type, typename Expected >
+   void checkVector( const blaze::DynamicVector<Type>& vec, size_t size, Expected expected ) const;
+
+   template< typename Type, bool SO, typename Expected >
+   void checkMatrix( const blaze::DynamicMatrix<Type,SO>& mat,
+                     size_t rows, size_t columns, Expected expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static Type value( size_t index, size_t seed );
+
+   template< typename Type >
+   static void fill( blaze::DynamicVector<Type>& vec, size_t seed );
+
+   template< typename Type, bool SO >
+   static void fill( blaze::DynamicMatrix<Type,SO>& mat, size_t seed );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the size, the elements, and the invariants of the given dense vector.
+//
+// \param vec The dynamic vector to be checked.
+// \param size The expected size of the vector.
+// \param expected Function returning the expected value of the element with the given index.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the given vector against the expected size and the expected values and
+// checks that all padding elements are default values. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type        // Element type of the vector
+        , typename Expected >  // Type of the expected values
+void FirstTouchTest::checkVector( const blaze::DynamicVector<Type>& vec,
+                                  size_t size, Expected expected ) const
+{
+   if( vec.size() != size ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid vector size\n"
+          << " Details:\n"
+          << "   Size         : " << vec.size() << "\n"
+          << "   Expected size: " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<size; ++i ) {
+      if( vec[i] != expected( i ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid vector element\n"
+             << " Details:\n"
+             << "   Index         : " << i << "\n"
+             << "   Element       : " << vec[i] << "\n"
+             << "   Expected value: " << expected( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( !vec.isIntact() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected (non-default padding elements)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size, the elements, and the invariants of the given dense matrix.
+//
+// \param mat The dynamic matrix to be checked.
+// \param rows The expected number of rows of the matrix.
+// \param columns The expected number of columns of the matrix.
+// \param expected Function returning the expected value of the element with the given indices.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the given matrix against the expected size and the expected values and
+// checks that all padding elements are default values. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type        // Element type of the matrix
+        , bool SO              // Storage order of the matrix
+        , typename Expected >  // Type of the expected values
+void FirstTouchTest::checkMatrix( const blaze::DynamicMatrix<Type,SO>& mat,
+                                  size_t rows, size_t columns, Expected expected ) const
+{
+   if( mat.rows() != rows || mat.columns() != columns ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid matrix size\n"
+          << " Details:\n"
+          << "   Size         : " << mat.rows() << "x" << mat.columns() << "\n"
+          << "   Expected size: " << rows << "x" << columns << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=0UL; i<rows; ++i ) {
+      for( size_t j=0UL; j<columns; ++j ) {
+         if( mat(i,j) != expected( i, j ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid matrix element\n"
+                << " Details:\n"
+                << "   Index         : (" << i << "," << j << ")\n"
+                << "   Element       : " << mat(i,j) << "\n"
+                << "   Expected value: " << expected( i, j ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+   if( !mat.isIntact() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected (non-default padding elements)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the test value of the element with the given linear index.
+//
+// \param index The linear index of the element.
+// \param seed The seed of the values.
+// \return The test value of the element.
+*/
+template< typename Type >  // Element type
+Type FirstTouchTest::value( size_t index, size_t seed )
+{
+   return Type( ( index + seed ) % 7UL + 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigning test values to all elements of the given dense vector.
+//
+// \param vec The dynamic vector to be filled.
+// \param seed The seed of the values.
+// \return void
+*/
+template< typename Type >  // Element type of the vector
+void FirstTouchTest::fill( blaze::DynamicVector<Type>& vec, size_t seed )
+{
+   for( size_t i=0UL; i<vec.size(); ++i ) {
+      vec[i] = value<Type>( i, seed );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assigning test values to all elements of the given dense matrix.
+//
+// \param mat The dynamic matrix to be filled.
+// \param seed The seed of the values.
+// \return void
+*/
+template< typename Type  // Element type of the matrix
+        , bool SO >      // Storage order of the matrix
+void FirstTouchTest::fill( blaze::DynamicMatrix<Type,SO>& mat, size_t seed )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i ) {
+      for( size_t j=0UL; j<mat.columns(); ++j ) {
+         mat(i,j) = value<Type>( i*mat.columns()+j, seed );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the first-touch initialization of dynamic vectors and matrices.
+//
+// \return void
+*/
+void runTest()
+{
+   FirstTouchTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the DynamicMatrix first-touch test.
+*/
+#define RUN_DYNAMICMATRIX_FIRSTTOUCH_TEST \
+   blazetest::mathtest::dynamicmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dynamicmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
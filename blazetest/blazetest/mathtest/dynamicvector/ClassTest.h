@@ -114,6 +114,7 @@ class ClassTest
    void testExtend      ();
    void testReserve     ();
    void testShrinkToFit ();
+   void testNumaDistribute();
    void testSwap        ();
    void testIsDefault   ();
 
@@ -0,0 +1,293 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatdmatmult/KernelTest.h
+//  \brief Header file for the sparse matrix/dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATDMATMULT_KERNELTEST_H_
+#define _BLAZETEST_MATHTEST_SMATDMATMULT_KERNELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatdmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the sparse matrix/dense matrix multiplication kernels.
+//
+// This class represents a test suite for the register blocked kernel and the non-zero balanced
+// SMP assignment of general products of a row-major sparse matrix and a row-major dense matrix.
+// All results are compared to a straightforward reference implementation.
+*/
+class KernelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit KernelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testBlockedKernel( const std::string& type );
+
+   template< typename Type >
+   void testSMPAssign( const std::string& type );
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   static blaze::CompressedMatrix<Type,blaze::rowMajor>
+      createSparse( size_t m, size_t n, size_t denseRow );
+
+   template< typename Type >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor> createDense( size_t m, size_t n );
+
+   template< typename Type, typename MT >
+   static blaze::DynamicMatrix<Type,blaze::rowMajor>
+      reference( const blaze::CompressedMatrix<Type,blaze::rowMajor>& A, const MT& B );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a sparse matrix/dense matrix multiplication.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a sparse matrix/dense matrix multiplication with the
+// given reference result. In case the two do not match, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the reference result
+void KernelTest::checkResult( const Type1& result, const Type2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid multiplication result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a row-major sparse test matrix.
+//
+// \param m The number of rows.
+// \param n The number of columns.
+// \param denseRow The index of a completely filled row.
+// \return The sparse test matrix.
+//
+// This function creates a sparse matrix with integral values, a varying number of non-zero
+// elements per row, empty rows, and a single completely filled row.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::CompressedMatrix<Type,blaze::rowMajor>
+   KernelTest::createSparse( size_t m, size_t n, size_t denseRow )
+{
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A( m, n, m*n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( i == denseRow || ( i % 5UL != 3UL && ( i*7UL + j*3UL ) % 11UL < i % 7UL ) )
+            A.append( i, j, Type( int( ( i + 2UL*j ) % 9UL ) - 4 ) );
+      }
+      A.finalize( i );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a row-major dense test matrix.
+//
+// \param m The number of rows.
+// \param n The number of columns.
+// \return The dense test matrix.
+*/
+template< typename Type >  // Data type of the matrix elements
+blaze::DynamicMatrix<Type,blaze::rowMajor> KernelTest::createDense( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> B( m, n );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         B(i,j) = Type( int( ( 3UL*i + j ) % 7UL ) - 3 );
+      }
+   }
+
+   return B;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reference implementation of the sparse matrix/dense matrix multiplication.
+//
+// \param A The left-hand side sparse matrix.
+// \param B The right-hand side dense matrix.
+// \return The result of the multiplication.
+*/
+template< typename Type    // Data type of the matrix elements
+        , typename MT >    // Type of the right-hand side dense matrix
+blaze::DynamicMatrix<Type,blaze::rowMajor>
+   KernelTest::reference( const blaze::CompressedMatrix<Type,blaze::rowMajor>& A, const MT& B )
+{
+   blaze::DynamicMatrix<Type,blaze::rowMajor> C( A.rows(), B.columns(), Type() );
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+         for( size_t j=0UL; j<B.columns(); ++j ) {
+            C(i,j) += element->value() * B(element->index(),j);
+         }
+      }
+   }
+
+   return C;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix/dense matrix multiplication kernels.
+//
+// \return void
+*/
+void runTest()
+{
+   KernelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix/dense matrix multiplication kernel test.
+*/
+#define RUN_SMATDMATMULT_KERNEL_TEST \
+   blazetest::mathtest::smatdmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
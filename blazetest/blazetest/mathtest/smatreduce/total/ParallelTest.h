@@ -0,0 +1,260 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatreduce/total/ParallelTest.h
+//  \brief Header file for the parallel sparse matrix reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATREDUCE_TOTAL_PARALLELTEST_H_
+#define _BLAZETEST_MATHTEST_SMATREDUCE_TOTAL_PARALLELTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the parallel sparse matrix reductions.
+//
+// This class represents a test suite for the non-zero balanced partitioning of sparse matrices
+// and for the parallel evaluation of total reductions, norms, and row-wise and column-wise
+// reductions of sparse matrices. All tests are performed both with the default thresholds and
+// with thresholds that enforce the parallel evaluation even for tiny matrices. All results are
+// compared to a straightforward reference implementation.
+*/
+class ParallelTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ParallelTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testPartition();
+
+   template< bool SO >
+   void testTotalReduction( const std::string& order );
+
+   template< bool SO >
+   void testPartialReduction( const std::string& order );
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& ref ) const;
+
+   void checkBounds( const std::vector<size_t>& bounds, const std::vector<size_t>& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static blaze::CompressedMatrix<double,SO>
+      createMatrix( size_t majors, size_t minors, bool emptyFirst );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::vector<size_t> sizes_;  //!< The number of rows/columns of the test matrices.
+   std::string mode_;           //!< Label of the currently used thresholds.
+   std::string test_;           //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a sparse matrix reduction.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of a sparse matrix reduction with the given reference
+// result. In case the two do not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the reference result
+void ParallelTest::checkResult( const Type1& result, const Type2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << " (" << mode_ << ")\n"
+          << " Error: Invalid reduction result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a sparse test matrix.
+//
+// \param majors The number of rows (row-major) or columns (column-major).
+// \param minors The number of columns (row-major) or rows (column-major).
+// \param emptyFirst \a true if the first row/column should be empty, \a false if not.
+// \return The sparse test matrix.
+//
+// This function creates a sparse matrix with integral, non-zero values, a varying number of
+// non-zero elements per row/column, every fourth row/column being empty, and a single
+// completely filled row/column, which dominates the work of the reduction.
+*/
+template< bool SO >  // Storage order
+blaze::CompressedMatrix<double,SO>
+   ParallelTest::createMatrix( size_t majors, size_t minors, bool emptyFirst )
+{
+   blaze::CompressedMatrix<double,SO> A( SO ? minors : majors, SO ? majors : minors );
+   A.reserve( majors*minors );
+
+   const size_t dense( majors / 3UL );
+   const size_t offset( emptyFirst ? 0UL : 1UL );
+
+   for( size_t k=0UL; k<majors; ++k )
+   {
+      if( k == dense || ( k + offset ) % 4UL != 0UL )
+      {
+         for( size_t l=0UL; l<minors; ++l )
+         {
+            if( k != dense && ( k*7UL + l*3UL ) % 11UL >= 1UL + k % 5UL )
+               continue;
+
+            const double sign( ( k + l ) % 2UL ? 1.0 : -1.0 );
+            const double value( sign * double( ( k + 2UL*l ) % 9UL + 1UL ) );
+
+            if( SO ) A.append( l, k, value );
+            else     A.append( k, l, value );
+         }
+      }
+
+      A.finalize( k );
+   }
+
+   return A;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel sparse matrix reductions.
+//
+// \return void
+*/
+void runTest()
+{
+   ParallelTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the parallel sparse matrix reduction test.
+*/
+#define RUN_SMATREDUCE_PARALLEL_TEST \
+   blazetest::mathtest::smatreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,224 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/AsyncTest.h
+//  \brief Header file for the SMP asynchronous evaluation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_ASYNCTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the asynchronous evaluation of expressions.
+//
+// This class represents a test suite for the asyncAssign() and evaluateAsync() functions. It
+// tests the results of several concurrently pending vector and matrix operations, the handling
+// of temporary operands, the rethrow of exceptions via the returned futures, and the carry-over
+// of the thread limit and the serial section of the calling thread. In case of the C++11 and Boost thread parallelizations it
+// additionally tests that the launcher pool follows the size of the thread pool, that nested
+// asynchronous operations do not deadlock, and that all asynchronous operations are completed
+// before the end of the program.
+*/
+class AsyncTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AsyncTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testAsyncAssign  ();
+   void testEvaluateAsync();
+   void testTemporaries  ();
+   void testExceptions   ();
+   void testCarryOver    ();
+   void testLauncherSize ();
+   void testNestedLaunch ();
+   void testOutliveMain  ();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& ref ) const;
+
+   template< typename Exception, typename Future >
+   void checkThrows( const std::string& operation, Future& future ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an asynchronous operation.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the reference result
+void AsyncTest::checkResult( const T1& result, const T2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of an asynchronous operation\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given future rethrows an exception of the given type.
+//
+// \param operation Description of the asynchronous operation.
+// \param future The future of the asynchronous operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Exception  // Type of the expected exception
+        , typename Future >   // Type of the future
+void AsyncTest::checkThrows( const std::string& operation, Future& future ) const
+{
+   bool thrown( false );
+
+   try {
+      future.get();
+   }
+   catch( Exception& ) {
+      thrown = true;
+   }
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the asynchronous evaluation of expressions.
+//
+// \return void
+*/
+void runTest()
+{
+   AsyncTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP asynchronous evaluation test.
+*/
+#define RUN_SMP_ASYNC_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,249 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smp/TaskGraphTest.h
+//  \brief Header file for the SMP task graph test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMP_TASKGRAPHTEST_H_
+#define _BLAZETEST_MATHTEST_SMP_TASKGRAPHTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/smp/TaskGraph.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the TaskGraph class.
+//
+// This class represents a test suite for the TaskGraph class. It tests the ordering of dependent
+// assignments (read after write, write after read, and write after write), the dependencies of
+// views on the same vector or matrix, the number of stages of the task graph, the pipelined
+// execution of element-wise chains, the propagation of exceptions, and task graphs of matrix
+// assignments. All results are compared to the results of the according serial operations.
+*/
+class TaskGraphTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TaskGraphTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testDependencies();
+   void testViews       ();
+   void testStages      ();
+   void testPipeline    ();
+   void testExceptions  ();
+   void testMatrices    ();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& ref ) const;
+
+   void checkStages( const blaze::TaskGraph& graph, size_t size, size_t stages ) const;
+
+   template< typename Exception >
+   void checkThrows( const std::string& operation, blaze::TaskGraph& graph ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of a task graph.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the reference result
+void TaskGraphTest::checkResult( const T1& result, const T2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of a task graph\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of assignments and stages of the given task graph.
+//
+// \param graph The task graph to be checked.
+// \param size The expected number of assignments.
+// \param stages The expected number of stages.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void TaskGraphTest::checkStages( const blaze::TaskGraph& graph,
+                                        size_t size, size_t stages ) const
+{
+   if( graph.size() != size || graph.stages() != stages ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid structure of a task graph\n"
+          << " Details:\n"
+          << "   Number of assignments : " << graph.size() << "\n"
+          << "   Expected assignments  : " << size << "\n"
+          << "   Number of stages      : " << graph.stages() << "\n"
+          << "   Expected stages       : " << stages << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the execution of the given task graph throws an exception.
+//
+// \param operation Description of the failing assignment.
+// \param graph The task graph to be executed.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Exception >  // Type of the expected exception
+void TaskGraphTest::checkThrows( const std::string& operation, blaze::TaskGraph& graph ) const
+{
+   bool thrown( false );
+
+   try {
+      graph.run();
+   }
+   catch( Exception& ) {
+      thrown = true;
+   }
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the TaskGraph class.
+//
+// \return void
+*/
+void runTest()
+{
+   TaskGraphTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the SMP task graph test.
+*/
+#define RUN_SMP_TASKGRAPH_TEST \
+   blazetest::mathtest::smp::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,271 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/sparsematrix/IntersectionTest.h
+//  \brief Header file for the sparse index intersection test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SPARSEMATRIX_INTERSECTIONTEST_H_
+#define _BLAZETEST_MATHTEST_SPARSEMATRIX_INTERSECTIONTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the adaptive intersection of sparse indices.
+//
+// This class represents a test suite for the nextCommonIndex() function contained in the
+// <em><blaze/math/sparse/Intersection.h></em> header file and for the sparse inner product,
+// the sparse element-wise vector product and the sparse Schur product, which are based on it.
+// The operands differ in their number of non-zero elements by a factor of at least eight in
+// order to trigger the galloping search. Additionally, the SIMD block comparison for operands
+// with contiguous 32-bit indices is tested with operands of comparable densities. All results
+// are compared to the according dense operations or to std::set_intersection().
+*/
+class IntersectionTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit IntersectionTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testVectors( const std::string& label, const blaze::CompressedVector<int>& a,
+                     const blaze::CompressedVector<int>& b );
+
+   template< bool SO1, bool SO2 >
+   void testSchur();
+
+   void testContiguousIndices();
+
+   template< typename MT >
+   void testRows( const std::string& label, const MT& A, const MT& B );
+
+   template< typename Type1, typename Type2 >
+   void checkResult( const Type1& result, const Type2& ref ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static blaze::CompressedVector<int>
+      createVector( size_t n, size_t first, size_t last, size_t stride );
+
+   template< bool SO >
+   static blaze::CompressedMatrix<int,SO>
+      createMatrix( size_t m, size_t n, size_t stride );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the result of an intersection based operation.
+//
+// \param result The computed result.
+// \param ref The reference result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of an intersection based operation with the given
+// reference result. In case the two do not match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the computed result
+        , typename Type2 >  // Type of the reference result
+void IntersectionTest::checkResult( const Type1& result, const Type2& ref ) const
+{
+   if( result != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid intersection result\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creation of a sparse test vector.
+//
+// \param n The size of the vector.
+// \param first The index of the first non-zero element.
+// \param last The upper bound for the indices of the non-zero elements.
+// \param stride The distance between two non-zero elements.
+// \return The sparse test vector.
+//
+// This function creates a sparse vector with non-zero integral elements at the indices
+// \a first, \a first+stride, ... below \a last.
+*/
+inline blaze::CompressedVector<int>
+   IntersectionTest::createVector( size_t n, size_t first, size_t last, size_t stride )
+{
+   blaze::CompressedVector<int> a( n, ( last - first ) / stride + 1UL );
+
+   for( size_t i=first; i<last; i+=stride ) {
+      a.append( i, int( i % 7UL ) + 1 );
+   }
+
+   return a;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creation of a sparse test matrix.
+//
+// \param m The number of rows.
+// \param n The number of columns.
+// \param stride The average distance between two non-zero elements of a row.
+// \return The sparse test matrix.
+//
+// This function creates a sparse matrix with non-zero integral elements, whose positions within
+// the rows are shifted from row to row. A stride of 1 results in a completely filled matrix.
+*/
+template< bool SO >  // Storage order
+blaze::CompressedMatrix<int,SO> IntersectionTest::createMatrix( size_t m, size_t n, size_t stride )
+{
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( m, n, m*( n/stride + 1UL ) );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=i%stride; j<n; j+=stride ) {
+         A.append( i, j, int( ( i + 3UL*j ) % 5UL ) + 1 );
+      }
+      A.finalize( i );
+   }
+
+   return blaze::CompressedMatrix<int,SO>( A );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the adaptive intersection of sparse indices.
+//
+// \return void
+*/
+void runTest()
+{
+   IntersectionTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse index intersection test.
+*/
+#define RUN_SPARSEMATRIX_INTERSECTION_TEST \
+   blazetest::mathtest::sparsematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,182 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/sparsematrix/OrderingTest.h
+//  \brief Header file for the sparse matrix ordering test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SPARSEMATRIX_ORDERINGTEST_H_
+#define _BLAZETEST_MATHTEST_SPARSEMATRIX_ORDERINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for tests of the sparse matrix ordering functionality.
+//
+// This class represents a test suite for the orderings and permutations contained in the
+// <em><blaze/math/sparse/Ordering.h></em> header file. It performs a series of runtime tests
+// with the reverse Cuthill-McKee ordering and the permutation of sparse matrices and dense
+// vectors.
+*/
+class OrderingTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit OrderingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testRCM();
+   void testPermuteMatrix();
+   void testPermuteVector();
+   void testErrors();
+
+   template< typename Type >
+   size_t bandwidth( const Type& matrix ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Computes the bandwidth of the given row-major sparse matrix.
+//
+// \param matrix The given row-major sparse matrix.
+// \return The maximum distance of a non-zero element from the diagonal.
+*/
+template< typename Type >  // Type of the sparse matrix
+size_t OrderingTest::bandwidth( const Type& matrix ) const
+{
+   size_t bw( 0UL );
+
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( auto element=matrix.begin(i); element!=matrix.end(i); ++element ) {
+         const size_t j( element->index() );
+         bw = std::max( bw, ( i > j ? i-j : j-i ) );
+      }
+   }
+
+   return bw;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sparse matrix ordering functionality.
+//
+// \return void
+*/
+void runTest()
+{
+   OrderingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix ordering test.
+*/
+#define RUN_SPARSEMATRIX_ORDERING_TEST \
+   blazetest::mathtest::sparsematrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,313 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/thresholds/ClassTest.h
+//  \brief Header file for the runtime threshold test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_THRESHOLDS_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_THRESHOLDS_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/system/Thresholds.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the runtime thresholds.
+//
+// This class represents a test suite for the runtime threshold table. It performs a series of
+// tests of the getThreshold(), setThreshold(), resetThresholds(), loadThresholds(), and
+// saveThresholds() functions, including the handling of the \c BLAZE_ prefix, the rejection
+// of values below the minimum of a threshold, the rejection of malformed threshold files, and
+// the validation of thresholds given via environment variables.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testGetThreshold  ();
+   void testSetThreshold  ();
+   void testReset         ();
+   void testLoadSave      ();
+   void testMalformedInput();
+   void testFiles         ();
+   void testEnvironment   ();
+
+   void checkThreshold( const std::string& name, size_t expected ) const;
+   void checkUnchanged( const std::string& snapshot ) const;
+
+   template< typename Exception, typename Func >
+   void checkThrows( const std::string& operation, Func func ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static std::string snapshot();
+   static void        setEnvironment( const std::string& name, const std::string& value );
+   static void        unsetEnvironment( const std::string& name );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the current value of the given threshold.
+//
+// \param name The name of the threshold.
+// \param expected The expected value of the threshold.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkThreshold( const std::string& name, size_t expected ) const
+{
+   const size_t value( blaze::getThreshold( name ) );
+
+   if( value != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid threshold value\n"
+          << " Details:\n"
+          << "   Threshold        : " << name << "\n"
+          << "   Value            : " << value << "\n"
+          << "   Expected value   : " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that none of the thresholds has been changed.
+//
+// \param snapshot The saved thresholds before the operation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+inline void ClassTest::checkUnchanged( const std::string& snapshot ) const
+{
+   const std::string current( ClassTest::snapshot() );
+
+   if( current != snapshot ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Failed operation changed thresholds\n"
+          << " Details:\n"
+          << "   Thresholds:\n" << current << "\n"
+          << "   Expected thresholds:\n" << snapshot << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given operation fails with the given exception.
+//
+// \param operation Description of the operation.
+// \param func The operation to be performed.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename Exception  // Type of the expected exception
+        , typename Func >     // Type of the operation
+void ClassTest::checkThrows( const std::string& operation, Func func ) const
+{
+   bool thrown( false );
+
+   try {
+      func();
+   }
+   catch( Exception& ) {
+      thrown = true;
+   }
+
+   if( !thrown ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << operation << " succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current values of all thresholds in the format of a threshold file.
+//
+// \return The current values of all thresholds.
+*/
+inline std::string ClassTest::snapshot()
+{
+   std::ostringstream oss;
+   blaze::saveThresholds( oss );
+   return oss.str();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Sets the given environment variable to the given value.
+//
+// \param name The name of the environment variable.
+// \param value The new value of the environment variable.
+// \return void
+*/
+inline void ClassTest::setEnvironment( const std::string& name, const std::string& value )
+{
+#if (defined _MSC_VER)
+   _putenv_s( name.c_str(), value.c_str() );
+#else
+   setenv( name.c_str(), value.c_str(), 1 );
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the given environment variable.
+//
+// \param name The name of the environment variable.
+// \return void
+*/
+inline void ClassTest::unsetEnvironment( const std::string& name )
+{
+#if (defined _MSC_VER)
+   _putenv_s( name.c_str(), "" );
+#else
+   unsetenv( name.c_str() );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the runtime thresholds.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the runtime threshold test.
+*/
+#define RUN_THRESHOLDS_CLASS_TEST \
+   blazetest::mathtest::thresholds::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
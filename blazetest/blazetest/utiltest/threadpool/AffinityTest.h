@@ -0,0 +1,236 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/threadpool/AffinityTest.h
+//  \brief Header file for the thread affinity test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_THREADPOOL_AFFINITYTEST_H_
+#define _BLAZETEST_UTILTEST_THREADPOOL_AFFINITYTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <blaze/util/threadpool/Affinity.h>
+#include <blaze/util/Types.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the thread affinity tests.
+//
+// This class represents a test suite for the parsing of thread affinity specifications via the
+// blaze::threadpool::parseAffinity() function, which is used for the \c BLAZE_THREAD_AFFINITY
+// environment variable and the setThreadAffinity() function.
+*/
+class AffinityTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit AffinityTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testNone();
+   void testLists();
+   void testPolicies();
+   void testInvalid();
+
+   void checkCPUs( const std::string& spec, const std::vector<size_t>& expected ) const;
+   void checkInvalid( const std::string& spec ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the CPUs of the given thread affinity specification.
+//
+// \param spec The thread affinity specification.
+// \param expected The expected list of CPUs.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function parses the given thread affinity specification and compares the resulting list
+// of CPUs with the expected list. In case the two do not match or in case the specification is
+// rejected, a \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::checkCPUs( const std::string& spec, const std::vector<size_t>& expected ) const
+{
+   std::vector<size_t> cpus;
+
+   try {
+      cpus = blaze::threadpool::parseAffinity( spec );
+   }
+   catch( std::invalid_argument& ex ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Valid thread affinity rejected\n"
+          << " Details:\n"
+          << "   Affinity: \"" << spec << "\"\n"
+          << "   Error message: " << ex.what() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( cpus != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid list of CPUs\n"
+          << " Details:\n"
+          << "   Affinity: \"" << spec << "\"\n"
+          << "   Result  :";
+      for( size_t cpu : cpus ) oss << " " << cpu;
+      oss << "\n   Expected:";
+      for( size_t cpu : expected ) oss << " " << cpu;
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the given thread affinity specification is rejected.
+//
+// \param spec The invalid thread affinity specification.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the given thread affinity specification is rejected by means of
+// a \a std::invalid_argument exception. In case the specification is accepted, a
+// \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::checkInvalid( const std::string& spec ) const
+{
+   try {
+      blaze::threadpool::parseAffinity( spec );
+   }
+   catch( std::invalid_argument& ) {
+      return;
+   }
+
+   std::ostringstream oss;
+   oss << " Test: " << test_ << "\n"
+       << " Error: Invalid thread affinity accepted\n"
+       << " Details:\n"
+       << "   Affinity: \"" << spec << "\"\n";
+   throw std::runtime_error( oss.str() );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parsing of thread affinity specifications.
+//
+// \return void
+*/
+void runTest()
+{
+   AffinityTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the thread affinity test.
+*/
+#define RUN_THREADPOOL_AFFINITY_TEST \
+   blazetest::utiltest::threadpool::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
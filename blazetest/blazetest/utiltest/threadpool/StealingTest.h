@@ -0,0 +1,202 @@
+//=================================================================================================
+/*!
+//  \file blazetest/utiltest/threadpool/StealingTest.h
+//  \brief Header file for the ThreadPool work stealing test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_UTILTEST_THREADPOOL_STEALINGTEST_H_
+#define _BLAZETEST_UTILTEST_THREADPOOL_STEALINGTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <blaze/util/ThreadPool.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the work stealing tests of the ThreadPool class template.
+//
+// This class represents a test suite for the distribution of tasks among the threads of the
+// blaze::ThreadPool class template. It tests the underlying task queue, the stealing of tasks
+// from the work queue of a blocked thread, the execution of strongly imbalanced tasks, and the
+// splitting of parallel operations into several tasks per thread by the C++11/Boost thread
+// backend.
+*/
+class StealingTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Type of the tested thread pool.
+   using Pool = blaze::ThreadPool< std::thread
+                                 , std::mutex
+                                 , std::unique_lock<std::mutex>
+                                 , std::condition_variable >;
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit StealingTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testTaskQueue();
+   void testBlockedThread();
+   void testImbalancedTasks();
+   void testTaskSplit();
+
+   template< typename Type1, typename Type2 >
+   void checkValue( const Type1& value, const Type2& expected, const std::string& what ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the given value.
+//
+// \param value The value to be checked.
+// \param expected The expected value.
+// \param what Description of the checked value.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given value with the expected value. In case the two do not
+// match, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type1    // Type of the checked value
+        , typename Type2 >  // Type of the expected value
+void StealingTest::checkValue( const Type1& value, const Type2& expected,
+                               const std::string& what ) const
+{
+   if( value != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid " << what << "\n"
+          << " Details:\n"
+          << "   Result  : " << value << "\n"
+          << "   Expected: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the work stealing of the ThreadPool class template.
+//
+// \return void
+*/
+void runTest()
+{
+   StealingTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the ThreadPool work stealing test.
+*/
+#define RUN_THREADPOOL_STEALING_TEST \
+   blazetest::utiltest::threadpool::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,383 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedmatrix/BuilderTest.cpp
+//  \brief Source file for the CompressedMatrixBuilder test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blazetest/mathtest/compressedmatrix/BuilderTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the BuilderTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+BuilderTest::BuilderTest()
+{
+   testConstructors();
+   testAdd();
+   testCompact();
+   testClear();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrixBuilder constructors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of all constructors of the CompressedMatrixBuilder class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testConstructors()
+{
+   test_ = "CompressedMatrixBuilder default constructor";
+
+   {
+      const blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder;
+
+      if( builder.rows() != 0UL || builder.columns() != 0UL || builder.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid builder state\n"
+             << " Details:\n"
+             << "   Rows     : " << builder.rows() << "\n"
+             << "   Columns  : " << builder.columns() << "\n"
+             << "   Non-zeros: " << builder.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( blaze::CompressedMatrixBuilder<int,blaze::rowMajor>().compact(),
+                   blaze::CompressedMatrix<int,blaze::rowMajor>() );
+   }
+
+   test_ = "CompressedMatrixBuilder size constructor";
+
+   {
+      blaze::CompressedMatrixBuilder<int,blaze::columnMajor> builder( 3UL, 5UL );
+
+      if( builder.rows() != 3UL || builder.columns() != 5UL || builder.nonZeros() != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid builder state\n"
+             << " Details:\n"
+             << "   Rows     : " << builder.rows() << "\n"
+             << "   Columns  : " << builder.columns() << "\n"
+             << "   Non-zeros: " << builder.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( builder.compact(), blaze::CompressedMatrix<int,blaze::columnMajor>( 3UL, 5UL ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the add() function of the CompressedMatrixBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function adds elements in arbitrary order, including repeated elements, and compares
+// the compacted matrix to the expected result. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testAdd()
+{
+   const blaze::DynamicMatrix<int,blaze::rowMajor> ref{ { 0, 3, 0, 0 },
+                                                        { 5, 0, 0, 4 },
+                                                        { 0, 0, 0, 0 } };
+
+   test_ = "Row-major CompressedMatrixBuilder::add()";
+
+   {
+      blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder( 3UL, 4UL );
+      builder.add( 1UL, 3UL, 4 );
+      builder.add( 0UL, 1UL, 1 );
+      builder.add( 1UL, 0UL, 2 );
+      builder.add( 0UL, 1UL, 2 );
+      builder.add( 1UL, 0UL, 3 );
+
+      if( builder.nonZeros() != 5UL || builder.nonZeros( 1UL ) != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of added elements\n"
+             << " Details:\n"
+             << "   Number of elements         : " << builder.nonZeros() << "\n"
+             << "   Number of elements in row 1: " << builder.nonZeros( 1UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( builder.compact() );
+
+      checkResult( A, ref );
+
+      if( A.nonZeros() != 3UL || builder.nonZeros() != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of non-zero elements\n"
+             << " Details:\n"
+             << "   Number of non-zeros of the matrix : " << A.nonZeros() << "\n"
+             << "   Number of non-zeros of the builder: " << builder.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   test_ = "Column-major CompressedMatrixBuilder::add()";
+
+   {
+      blaze::CompressedMatrixBuilder<int,blaze::columnMajor> builder( 3UL, 4UL );
+      builder.reserve( 0UL, 2UL );
+      builder.add( 1UL, 0UL, 5 );
+      builder.add( 1UL, 3UL, 4 );
+      builder.add( 0UL, 1UL, 3 );
+
+      if( builder.nonZeros( 0UL ) != 1UL || builder.nonZeros( 3UL ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of added elements\n"
+             << " Details:\n"
+             << "   Number of elements in column 0: " << builder.nonZeros( 0UL ) << "\n"
+             << "   Number of elements in column 3: " << builder.nonZeros( 3UL ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkResult( builder.compact(), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the compact() function of the CompressedMatrixBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function assembles matrices large enough to trigger the parallel compaction, including a
+// matrix with a single dominant row, and compares the results to the dense reference assembly.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testCompact()
+{
+   const size_t M( 50UL );
+   const size_t N( 40UL );
+
+   test_ = "Row-major CompressedMatrixBuilder::compact()";
+
+   {
+      blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder( M, N );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( M, N, 0 );
+
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( ( k*37UL ) % M );
+         const size_t j( ( k*k*11UL + 3UL ) % N );
+         builder.add( i, j, int( k % 7UL ) + 1 );
+         ref(i,j) += int( k % 7UL ) + 1;
+      }
+
+      checkResult( builder.compact(), ref );
+
+      // Adding elements after the compaction
+      builder.add( 0UL, 0UL, 1 );
+      ref(0,0) += 1;
+
+      checkResult( builder.compact(), ref );
+   }
+
+   test_ = "Column-major CompressedMatrixBuilder::compact()";
+
+   {
+      blaze::CompressedMatrixBuilder<int,blaze::columnMajor> builder( M, N );
+      blaze::DynamicMatrix<int,blaze::columnMajor> ref( M, N, 0 );
+
+      for( size_t k=0UL; k<1000UL; ++k ) {
+         const size_t i( ( k*k*13UL + 1UL ) % M );
+         const size_t j( ( k*29UL ) % N );
+         builder.add( i, j, int( k % 5UL ) + 1 );
+         ref(i,j) += int( k % 5UL ) + 1;
+      }
+
+      checkResult( builder.compact(), ref );
+   }
+
+   test_ = "Row-major CompressedMatrixBuilder::compact() (skewed rows)";
+
+   {
+      const size_t nonzeros( blaze::SMP_SMATCOMPACT_THRESHOLD + 1000UL );
+
+      blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder( M, N );
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( M, N, 0 );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         const size_t i( k % 2UL == 0UL ? 7UL : ( k*37UL ) % M );
+         const size_t j( ( k*k*11UL + 3UL ) % N );
+         builder.add( i, j, int( k % 7UL ) + 1 );
+         ref(i,j) += int( k % 7UL ) + 1;
+      }
+
+      checkResult( builder.compact(), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the clear() function of the CompressedMatrixBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the clear() function of the CompressedMatrixBuilder class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testClear()
+{
+   test_ = "CompressedMatrixBuilder::clear()";
+
+   blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder( 2UL, 2UL );
+   builder.add( 0UL, 1UL, 1 );
+   builder.add( 1UL, 1UL, 2 );
+   builder.clear();
+
+   if( builder.rows() != 2UL || builder.columns() != 2UL || builder.nonZeros() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Clearing the builder failed\n"
+          << " Details:\n"
+          << "   Rows     : " << builder.rows() << "\n"
+          << "   Columns  : " << builder.columns() << "\n"
+          << "   Non-zeros: " << builder.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkResult( builder.compact(), blaze::CompressedMatrix<int,blaze::rowMajor>( 2UL, 2UL ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the CompressedMatrixBuilder class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that elements outside the matrix are rejected. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void BuilderTest::testErrors()
+{
+   test_ = "CompressedMatrixBuilder::add() with invalid index";
+
+   blaze::CompressedMatrixBuilder<int,blaze::rowMajor> builder( 2UL, 3UL );
+
+   try {
+      builder.add( 0UL, 3UL, 1 );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Adding an element outside the matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::out_of_range& ) {}
+}
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedMatrixBuilder class test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDMATRIX_BUILDER_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedMatrixBuilder class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,8 +37,15 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <type_traits>
+#include <vector>
+#include <blaze/math/CompressedSoAMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/compressedmatrix/ClassTest.h>
@@ -90,6 +97,10 @@ ClassTest::ClassTest()
    testTranspose();
    testCTranspose();
    testIsDefault();
+   testFromTriplets();
+   testConversion();
+   testIndexType();
+   testSoAStorage();
 }
 //*************************************************************************************************
 
@@ -7161,6 +7172,769 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the \c fromTriplets() function with the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c fromTriplets() function with the CompressedMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFromTriplets()
+{
+   const std::vector<size_t> rows   { 2UL, 0UL, 2UL, 1UL, 0UL, 2UL };
+   const std::vector<size_t> columns{ 1UL, 3UL, 1UL, 0UL, 0UL, 3UL };
+   const std::vector<int>    values { 1, 2, 3, 4, 5, 6 };
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major fromTriplets() (summation of duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL, 2UL );
+      mat(1,1) = 9;
+
+      fromTriplets( mat, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 5 || mat(0,3) != 2 || mat(1,0) != 4 || mat(1,1) != 0 ||
+          mat(2,1) != 4 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 0 0 2 )\n( 4 0 0 0 )\n( 0 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major fromTriplets() (custom combination of duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 3UL, 4UL );
+
+      fromTriplets( mat, rows.data(), columns.data(), values.data(), values.size(),
+                    []( int, int b ){ return b; } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,0) != 5 || mat(0,3) != 2 || mat(1,0) != 4 || mat(2,1) != 3 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 0 0 2 )\n( 4 0 0 0 )\n( 0 3 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major fromTriplets() (invalid index)";
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 4UL );
+
+      try {
+         fromTriplets( mat, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly with invalid row index succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major fromTriplets() (summation of duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL, 2UL );
+      mat(1,1) = 9;
+
+      fromTriplets( mat, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkCapacity( mat, 5UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,0) != 5 || mat(0,3) != 2 || mat(1,0) != 4 || mat(1,1) != 0 ||
+          mat(2,1) != 4 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 0 0 2 )\n( 4 0 0 0 )\n( 0 4 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major fromTriplets() (custom combination of duplicates)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 4UL );
+
+      fromTriplets( mat, rows.data(), columns.data(), values.data(), values.size(),
+                    []( int, int b ){ return b; } );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 0UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,0) != 5 || mat(0,3) != 2 || mat(1,0) != 4 || mat(2,1) != 3 || mat(2,3) != 6 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly from triplets failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 5 0 0 2 )\n( 4 0 0 0 )\n( 0 3 0 6 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major fromTriplets() (invalid index)";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat( 3UL, 3UL );
+
+      try {
+         fromTriplets( mat, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly with invalid column index succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Parallel assembly tests
+   //=====================================================================================
+
+   {
+      const size_t M( 557UL );
+      const size_t N( 331UL );
+      const size_t nonzeros( blaze::SMP_SMATASSEMBLE_THRESHOLD + 12345UL );
+
+      std::vector<size_t> largeRows   ( nonzeros );
+      std::vector<size_t> largeColumns( nonzeros );
+      std::vector<int>    largeValues ( nonzeros );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         largeRows[k]    = ( k * 7919UL ) % M;
+         largeColumns[k] = ( k * 104729UL + k / 13UL ) % N;
+         largeValues[k]  = static_cast<int>( k % 97UL ) - 48;
+      }
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> sum ( M, N, 0 );
+      blaze::DynamicMatrix<int,blaze::rowMajor> last( M, N, 0 );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         sum ( largeRows[k], largeColumns[k] ) += largeValues[k];
+         last( largeRows[k], largeColumns[k] )  = largeValues[k];
+      }
+
+      {
+         test_ = "Row-major fromTriplets() (parallel summation of duplicates)";
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( M, N );
+
+         fromTriplets( mat, largeRows.begin(), largeColumns.begin(), largeValues.begin(), nonzeros );
+
+         checkRows   ( mat, M );
+         checkColumns( mat, N );
+
+         if( mat != sum ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly from triplets failed\n"
+                << " Details:\n"
+                << "   Number of triplets: " << nonzeros << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "Row-major fromTriplets() (parallel custom combination of duplicates)";
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( M, N );
+
+         fromTriplets( mat, largeRows.begin(), largeColumns.begin(), largeValues.begin(), nonzeros,
+                       []( int, int b ){ return b; } );
+
+         if( mat != last ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly from triplets failed\n"
+                << " Details:\n"
+                << "   Number of triplets: " << nonzeros << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "Column-major fromTriplets() (parallel summation of duplicates)";
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( M, N );
+
+         fromTriplets( mat, largeRows.begin(), largeColumns.begin(), largeValues.begin(), nonzeros );
+
+         checkRows   ( mat, M );
+         checkColumns( mat, N );
+
+         if( mat != sum ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly from triplets failed\n"
+                << " Details:\n"
+                << "   Number of triplets: " << nonzeros << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "Column-major fromTriplets() (parallel custom combination of duplicates)";
+
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( M, N );
+
+         fromTriplets( mat, largeRows.begin(), largeColumns.begin(), largeValues.begin(), nonzeros,
+                       []( int, int b ){ return b; } );
+
+         if( mat != last ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly from triplets failed\n"
+                << " Details:\n"
+                << "   Number of triplets: " << nonzeros << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      {
+         test_ = "Row-major fromTriplets() (parallel assembly with invalid index)";
+
+         largeColumns[nonzeros/2UL] = N;
+
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( M, N );
+         mat(1,2) = 3;
+
+         try {
+            fromTriplets( mat, largeRows.begin(), largeColumns.begin(), largeValues.begin(), nonzeros );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly with invalid column index succeeded\n"
+                << " Details:\n"
+                << "   Number of triplets: " << nonzeros << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         checkRows    ( mat, M );
+         checkColumns ( mat, N );
+         checkNonZeros( mat, 1UL );
+
+         if( mat(1,2) != 3 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Failed assembly modified the matrix\n"
+                << " Details:\n"
+                << "   Result:\n" << mat(1,2) << "\n"
+                << "   Expected result:\n3\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the conversion between row-major and column-major CompressedMatrix instances.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the conversion between row-major and column-major instances
+// of the CompressedMatrix class template for a number of non-zero elements above the
+// BLAZE_SMP_SMATTRANSPOSE_THRESHOLD. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testConversion()
+{
+   const size_t M( 613UL );
+   const size_t N( 421UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> mat1( M, N, M*N/2UL );
+   blaze::DynamicMatrix<int,blaze::rowMajor> ref( M, N, 0 );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=i%3UL; i%17UL!=5UL && j<N; j+=( i % 4UL ) + 1UL ) {
+         if( j % 29UL == 11UL ) continue;
+         mat1.append( i, j, static_cast<int>( ( i * N + j ) % 1000UL ) + 1 );
+         ref(i,j) = static_cast<int>( ( i * N + j ) % 1000UL ) + 1;
+      }
+      mat1.finalize( i );
+   }
+
+   if( mat1.nonZeros() < blaze::SMP_SMATTRANSPOSE_THRESHOLD ) {
+      std::ostringstream oss;
+      oss << " Test: Conversion between row-major and column-major matrices\n"
+          << " Error: Invalid test setup\n"
+          << " Details:\n"
+          << "   Number of non-zero elements: " << mat1.nonZeros() << "\n"
+          << "   Threshold: " << blaze::SMP_SMATTRANSPOSE_THRESHOLD << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+
+   //=====================================================================================
+   // Row-major to column-major conversion
+   //=====================================================================================
+
+   {
+      test_ = "Row-major to column-major conversion";
+
+      blaze::CompressedMatrix<int,blaze::columnMajor> mat2( 2UL, 3UL, 4UL );
+      mat2(1,2) = 7;
+      mat2 = mat1;
+
+      checkRows    ( mat2, M );
+      checkColumns ( mat2, N );
+      checkNonZeros( mat2, mat1.nonZeros() );
+
+      for( size_t j=0UL; j<N; ++j ) {
+         for( auto element=mat2.begin(j); element!=mat2.end(j); ++element ) {
+            if( ( element+1UL != mat2.end(j) && element->index() >= (element+1UL)->index() ) ||
+                element->value() != ref(element->index(),j) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid column detected\n"
+                   << " Details:\n"
+                   << "   Column: " << j << "\n"
+                   << "   Element index: " << element->index() << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( mat2 != ref ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Conversion failed\n"
+             << " Details:\n"
+             << "   Number of non-zero elements: " << mat1.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major to row-major conversion
+   //=====================================================================================
+
+   {
+      test_ = "Column-major to row-major conversion";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> mat2( mat1 );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> mat3( mat2 );
+
+      checkRows    ( mat3, M );
+      checkColumns ( mat3, N );
+      checkNonZeros( mat3, mat1.nonZeros() );
+
+      for( size_t i=0UL; i<M; ++i ) {
+         if( mat3.nonZeros( i ) != mat1.nonZeros( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of non-zero elements in row " << i << "\n"
+                << " Details:\n"
+                << "   Number of non-zero elements: " << mat3.nonZeros( i ) << "\n"
+                << "   Expected number of non-zero elements: " << mat1.nonZeros( i ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         if( !std::equal( mat3.begin(i), mat3.end(i), mat1.begin(i),
+                          []( const auto& a, const auto& b ) {
+                             return a.index() == b.index() && a.value() == b.value();
+                          } ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid row detected\n"
+                << " Details:\n"
+                << "   Row: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedMatrix class template with a non-default index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedMatrix class template with a 32-bit index
+// type, of the index type of the results of operations, and of the rejection of dimensions
+// exceeding the index type. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   static_assert( sizeof( blaze::ValueIndexPair<float,uint32_t> ) < sizeof( blaze::ValueIndexPair<float> ),
+                  "Invalid size of value-index-pair detected" );
+
+
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedMatrix with 32-bit index type";
+
+      using MatrixType = blaze::CompressedMatrix<int,blaze::rowMajor,uint32_t>;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,1) = 1;
+      ref(1,3) = 2;
+      ref(2,0) = 3;
+      ref(2,2) = 4;
+
+      MatrixType mat( ref );
+      mat(0,3) = 5;
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor,uint32_t> tmat( trans( mat ) );
+      const blaze::DynamicVector<int,blaze::columnVector> vec{ 1, 2, 3, 4 };
+      const blaze::DynamicVector<int,blaze::columnVector> res( mat * vec );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(0,3) != 5 || mat(1,3) != 2 || mat(2,0) != 3 || mat(2,2) != 4 ||
+          mat.find( 2UL, 2UL )->index() != 2UL || tmat != trans( mat ) ||
+          res[0] != 22 || res[1] != 8 || res[2] != 15 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with 32-bit indices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 5 )\n( 0 0 0 2 )\n( 3 0 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedMatrix with 32-bit index type";
+
+      using MatrixType = blaze::CompressedMatrix<int,blaze::columnMajor,uint32_t>;
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> ref( 3UL, 4UL );
+      ref(0,1) = 1;
+      ref(1,3) = 2;
+      ref(2,0) = 3;
+      ref(2,2) = 4;
+
+      MatrixType mat( ref );
+      mat(0,3) = 5;
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor,uint32_t> tmat( trans( mat ) );
+      const blaze::DynamicVector<int,blaze::columnVector> vec{ 1, 2, 3, 4 };
+      const blaze::DynamicVector<int,blaze::columnVector> res( mat * vec );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 1UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 1UL );
+      checkNonZeros( mat, 3UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(0,3) != 5 || mat(1,3) != 2 || mat(2,0) != 3 || mat(2,2) != 4 ||
+          mat.find( 2UL, 2UL )->index() != 2UL || tmat != trans( mat ) ||
+          res[0] != 22 || res[1] != 8 || res[2] != 15 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with 32-bit indices failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 5 )\n( 0 0 0 2 )\n( 3 0 4 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Result type tests
+   //=====================================================================================
+
+   {
+      test_ = "Index type of CompressedMatrix results";
+
+      using RowMajorType    = blaze::CompressedMatrix<int,blaze::rowMajor,uint32_t>;
+      using ColumnMajorType = blaze::CompressedMatrix<int,blaze::columnMajor,uint16_t>;
+      using VectorType      = blaze::CompressedVector<int,blaze::columnVector,uint32_t>;
+
+      static_assert( std::is_same< blaze::AddTrait_t<RowMajorType,ColumnMajorType>
+                                 , blaze::CompressedMatrix<int,blaze::rowMajor,uint32_t> >::value
+                   , "Invalid index type of addition result detected" );
+      static_assert( std::is_same< blaze::MultTrait_t<ColumnMajorType,int>, ColumnMajorType >::value
+                   , "Invalid index type of scaling result detected" );
+      static_assert( std::is_same< blaze::MultTrait_t<ColumnMajorType,RowMajorType>
+                                 , blaze::CompressedMatrix<int,blaze::columnMajor,uint32_t> >::value
+                   , "Invalid index type of multiplication result detected" );
+      static_assert( std::is_same< blaze::MultTrait_t<RowMajorType,VectorType>, VectorType >::value
+                   , "Invalid index type of matrix/vector multiplication result detected" );
+      static_assert( std::is_same< blaze::SubmatrixTrait_t<ColumnMajorType>, ColumnMajorType >::value
+                   , "Invalid index type of submatrix result detected" );
+   }
+
+
+   //=====================================================================================
+   // Index range tests
+   //=====================================================================================
+
+   {
+      test_ = "CompressedMatrix dimensions exceeding the index type";
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor,uint8_t> mat( 1000UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a row-major matrix with too many columns succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedMatrix<int,blaze::columnMajor,uint8_t> mat( 256UL, 1000UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a column-major matrix with too many rows succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor,uint8_t> mat( 2UL, 255UL );
+         mat.resize( 2UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a row-major matrix beyond the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the structure-of-arrays CompressedSoAMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedSoAMatrix class template, which stores the
+// values and indices of the non-zero elements in separate arrays. The results are compared
+// to the results of the CompressedMatrix class template. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSoAStorage()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major CompressedSoAMatrix element access";
+
+      using MatrixType = blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint32_t>;
+
+      MatrixType mat{ { 0, 1, 0, 0 }, { 0, 0, 0, 2 }, { 3, 0, 4, 0 } };
+      mat(0,3) = 5;
+      mat.insert( 1UL, 0UL, 6 );
+      mat.erase( 1UL, 3UL );
+      mat.set( 2UL, 2UL, 7 );
+
+      checkRows    ( mat, 3UL );
+      checkColumns ( mat, 4UL );
+      checkNonZeros( mat, 5UL );
+      checkNonZeros( mat, 0UL, 2UL );
+      checkNonZeros( mat, 1UL, 1UL );
+      checkNonZeros( mat, 2UL, 2UL );
+
+      if( mat(0,1) != 1 || mat(0,3) != 5 || mat(1,0) != 6 || mat(2,0) != 3 || mat(2,2) != 7 ||
+          mat.values( 2UL )[1] != 7 || mat.indices( 2UL )[1] != 2U ||
+          mat.find( 0UL, 3UL )->index() != 3UL || mat.lowerBound( 2UL, 1UL )->value() != 7 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Element access failed\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n"
+             << "   Expected result:\n( 0 1 0 5 )\n( 6 0 0 0 )\n( 3 0 7 0 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Row-major CompressedSoAMatrix operations";
+
+      using MatrixType = blaze::CompressedSoAMatrix<double,blaze::rowMajor,uint32_t>;
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref(
+         blaze::rand< blaze::CompressedMatrix<double,blaze::rowMajor> >( 37UL, 29UL, 300UL ) );
+      const blaze::DynamicVector<double,blaze::columnVector> vec(
+         blaze::rand< blaze::DynamicVector<double,blaze::columnVector> >( 29UL ) );
+
+      const MatrixType mat( ref );
+      const blaze::DynamicVector<double,blaze::columnVector> res1( mat * vec );
+      const blaze::DynamicVector<double,blaze::columnVector> res2( ref * vec );
+      const MatrixType prod( mat * trans( mat ) );
+
+      checkNonZeros( mat, ref.nonZeros() );
+
+      if( mat != ref || prod != ref * trans( ref ) ||
+          !blaze::equal( blaze::norm( res1 - res2 ), 0.0 ) ||
+          !blaze::equal( sum( mat ), sum( ref ) ) || max( mat ) != max( ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with structure-of-arrays storage failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res1 << "\n"
+             << "   Expected result:\n" << res2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major CompressedSoAMatrix operations";
+
+      using MatrixType = blaze::CompressedSoAMatrix<float,blaze::columnMajor>;
+
+      const blaze::CompressedMatrix<float,blaze::rowMajor> ref(
+         blaze::rand< blaze::CompressedMatrix<float,blaze::rowMajor> >( 23UL, 31UL, 200UL ) );
+      const blaze::DynamicVector<float,blaze::columnVector> vec(
+         blaze::rand< blaze::DynamicVector<float,blaze::columnVector> >( 31UL ) );
+
+      MatrixType mat( ref );
+      const blaze::DynamicVector<float,blaze::columnVector> res1( mat * vec );
+      const blaze::DynamicVector<float,blaze::columnVector> res2( ref * vec );
+
+      mat.transpose();
+
+      if( mat != trans( ref ) || !blaze::equal( blaze::norm( res1 - res2 ), 0.0F ) ||
+          !blaze::equal( sum( mat ), sum( ref ) ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Operation with structure-of-arrays storage failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res1 << "\n"
+             << "   Expected result:\n" << res2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Index range tests
+   //=====================================================================================
+
+   {
+      test_ = "CompressedSoAMatrix dimensions exceeding the index type";
+
+      try {
+         blaze::CompressedSoAMatrix<int,blaze::columnMajor,uint8_t> mat( 256UL, 1000UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Creating a column-major matrix with too many rows succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      try {
+         blaze::CompressedSoAMatrix<int,blaze::rowMajor,uint8_t> mat( 2UL, 255UL );
+         mat.resize( 2UL, 256UL );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Resizing a row-major matrix beyond the index type succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
 } // namespace compressedmatrix
 
 } // namespace mathtest
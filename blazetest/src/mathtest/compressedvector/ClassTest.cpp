@@ -37,8 +37,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <cstdint>
 #include <cstdlib>
 #include <iostream>
+#include <type_traits>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/shims/Equal.h>
 #include <blaze/util/Complex.h>
@@ -97,6 +99,7 @@ ClassTest::ClassTest()
    testLowerBound();
    testUpperBound();
    testIsDefault();
+   testIndexType();
 }
 //*************************************************************************************************
 
@@ -3515,6 +3518,94 @@ void ClassTest::testIsDefault()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the CompressedVector class template with a non-default index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the CompressedVector class template with a 16-bit index
+// type, of the index type of the results of operations, and of the rejection of sizes exceeding
+// the index type. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexType()
+{
+   test_ = "CompressedVector with 16-bit index type";
+
+   using VectorType = blaze::CompressedVector<int,blaze::rowVector,uint16_t>;
+
+   static_assert( sizeof( blaze::ValueIndexPair<int,uint16_t> ) < sizeof( blaze::ValueIndexPair<int> ),
+                  "Invalid size of value-index-pair detected" );
+
+   blaze::CompressedVector<int,blaze::rowVector> ref( 1000UL );
+   ref[2] = 1;
+   ref[500] = 2;
+   ref[999] = 3;
+
+   VectorType vec( ref );
+   vec *= 2;
+   vec[700] = 4;
+
+   checkSize    ( vec, 1000UL );
+   checkCapacity( vec, 4UL );
+   checkNonZeros( vec, 4UL );
+
+   if( vec[2] != 2 || vec[500] != 4 || vec[700] != 4 || vec[999] != 6 ||
+       vec.find( 999UL )->index() != 999UL || ( vec, trans( ref ) ) != 28 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation with 16-bit indices failed\n"
+          << " Details:\n"
+          << "   Result:\n" << vec << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::CompressedVector<int,blaze::rowVector> sum( vec + ref );
+
+   if( sum.nonZeros() != 4UL || sum[2] != 3 || sum[500] != 6 || sum[700] != 4 || sum[999] != 9 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Addition with 16-bit indices failed\n"
+          << " Details:\n"
+          << "   Result:\n" << sum << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   static_assert( std::is_same< blaze::AddTrait_t<VectorType,blaze::CompressedVector<int,blaze::rowVector,uint32_t> >
+                              , blaze::CompressedVector<int,blaze::rowVector,uint32_t> >::value
+                , "Invalid index type of addition result detected" );
+   static_assert( std::is_same< blaze::MultTrait_t<VectorType,int>, VectorType >::value
+                , "Invalid index type of scaling result detected" );
+   static_assert( std::is_same< blaze::SubvectorTrait_t<VectorType>, VectorType >::value
+                , "Invalid index type of subvector result detected" );
+
+   try {
+      VectorType tmp( 65536UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Creating a vector exceeding the index type succeeded\n"
+          << " Details:\n"
+          << "   Size: " << tmp.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      vec.resize( 65536UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing a vector beyond the index type succeeded\n"
+          << " Details:\n"
+          << "   Size: " << vec.size() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
 } // namespace compressedvector
 
 } // namespace mathtest
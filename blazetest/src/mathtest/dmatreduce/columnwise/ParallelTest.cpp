@@ -0,0 +1,423 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dmatreduce/columnwise/ParallelTest.cpp
+//  \brief Source file for the parallel dense matrix column-wise reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Submatrix.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/dmatreduce/columnwise/ParallelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dmatreduce {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the test value of the matrix element at the given position.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The test value in the range \f$ [1..11] \f$.
+*/
+inline int value( size_t i, size_t j )
+{
+   return static_cast<int>( ( i*7UL + j*3UL ) % 11UL ) + 1;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ParallelTest::ParallelTest()
+   : sizes_()  // The sizes of the test matrices
+   , mode_()   // Label of the currently used thresholds
+   , test_()   // Label of the currently performed test
+{
+   const size_t reduceThreshold( blaze::SMP_DMATREDUCE_THRESHOLD );
+   const size_t assignThreshold( blaze::SMP_DMATASSIGN_THRESHOLD );
+
+   const size_t square( static_cast<size_t>( std::sqrt( assignThreshold ) ) );
+
+   // Odd sizes only, including wide matrices above the reduction threshold and tall, narrow
+   // matrices above the assignment threshold
+   sizes_ = { { 1UL, 1UL }, { 3UL, 5UL }, { 7UL, 33UL }, { 33UL, 7UL }, { 65UL, 3UL },
+              { 5UL, ( reduceThreshold + 7UL ) | 1UL },
+              { ( reduceThreshold + 7UL ) | 1UL, 5UL },
+              { ( assignThreshold / 3UL + 1UL ) | 1UL, 3UL },
+              { ( square + 3UL ) | 1UL, ( square + 5UL ) | 1UL } };
+
+   mode_ = "default thresholds";
+
+   testAssign<int>();
+   testAssign<double>();
+   testCompoundAssign<int>();
+   testCompoundAssign<double>();
+   testColumnMajor();
+   testSoftmax();
+
+   mode_ = "enforced parallel evaluation";
+
+   blaze::SMP_DMATREDUCE_THRESHOLD = 0UL;
+   blaze::SMP_DMATASSIGN_THRESHOLD = 0UL;
+
+   testAssign<int>();
+   testAssign<double>();
+   testCompoundAssign<int>();
+   testCompoundAssign<double>();
+   testColumnMajor();
+   testSoftmax();
+
+   blaze::SMP_DMATREDUCE_THRESHOLD = reduceThreshold;
+   blaze::SMP_DMATASSIGN_THRESHOLD = assignThreshold;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of column-wise row-major dense matrix reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of the column-wise sum(), min(), max(), and reduce()
+// functions of row-major dense matrices, submatrices, and dense matrix expressions to dense
+// vectors and subvectors. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename Type >  // Element type of the matrices
+void ParallelTest::testAssign()
+{
+   using blaze::columnwise;
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n ), B( m+2UL, n+2UL, Type(-100) );
+      std::vector<Type> sum( n, Type(0) ), min( n, Type(100) ), max( n, Type(-100) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = B(i+1UL,j+1UL) = Type( value( i, j ) );
+            sum[j] += A(i,j);
+            min[j] = std::min( min[j], A(i,j) );
+            max[j] = std::max( max[j], A(i,j) );
+         }
+      }
+
+      const std::string label( " (" + std::to_string( m ) + "x" + std::to_string( n ) + ")" );
+
+      blaze::DynamicVector<Type,blaze::rowVector> y;
+
+      test_ = "sum<columnwise>()" + label;
+      y = blaze::sum<columnwise>( A );
+      checkVector( y, sum );
+
+      test_ = "min<columnwise>()" + label;
+      y = blaze::min<columnwise>( A );
+      checkVector( y, min );
+
+      test_ = "max<columnwise>()" + label;
+      y = blaze::max<columnwise>( A );
+      checkVector( y, max );
+
+      test_ = "reduce<columnwise>() with a custom operation" + label;
+      y = blaze::reduce<columnwise>( A, []( Type a, Type b ){ return std::max( a, b ); } );
+      checkVector( y, max );
+
+      test_ = "sum<columnwise>() of a submatrix" + label;
+      y = blaze::sum<columnwise>( blaze::submatrix( B, 1UL, 1UL, m, n ) );
+      checkVector( y, sum );
+
+      test_ = "sum<columnwise>() of a matrix expression" + label;
+      std::vector<Type> exprSum( sum );
+      for( Type& element : exprSum ) {
+         element *= Type(2);
+      }
+      y = blaze::sum<columnwise>( A + A );
+      checkVector( y, exprSum );
+
+      test_ = "sum<columnwise>() assigned to a subvector" + label;
+      std::vector<Type> subSum( n+4UL, Type(-1) );
+      std::copy( sum.begin(), sum.end(), subSum.begin()+2UL );
+      blaze::DynamicVector<Type,blaze::rowVector> z( n+4UL, Type(-1) );
+      blaze::subvector( z, 2UL, n ) = blaze::sum<columnwise>( A );
+      checkVector( z, subSum );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel compound assignments of column-wise row-major matrix reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the addition, subtraction, multiplication, and division assignment of
+// column-wise reductions of row-major dense matrices to dense vectors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the matrices
+void ParallelTest::testCompoundAssign()
+{
+   using blaze::columnwise;
+
+   for( const auto& size : sizes_ )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+
+      blaze::DynamicMatrix<Type,blaze::rowMajor> A( m, n );
+      std::vector<Type> sum( n, Type(0) ), max( n, Type(-100) );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = Type( value( i, j ) );
+            sum[j] += A(i,j);
+            max[j] = std::max( max[j], A(i,j) );
+         }
+      }
+
+      const std::string label( " (" + std::to_string( m ) + "x" + std::to_string( n ) + ")" );
+
+      blaze::DynamicVector<Type,blaze::rowVector> y( n );
+      std::vector<Type> ref( n );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         y[j] = ref[j] = Type( j % 5UL ) + Type(1);
+      }
+
+      test_ = "Addition assignment of sum<columnwise>()" + label;
+      y += blaze::sum<columnwise>( A );
+      for( size_t j=0UL; j<n; ++j ) ref[j] += sum[j];
+      checkVector( y, ref );
+
+      test_ = "Subtraction assignment of max<columnwise>()" + label;
+      y -= blaze::max<columnwise>( A );
+      for( size_t j=0UL; j<n; ++j ) ref[j] -= max[j];
+      checkVector( y, ref );
+
+      test_ = "Multiplication assignment of max<columnwise>()" + label;
+      y *= blaze::max<columnwise>( A );
+      for( size_t j=0UL; j<n; ++j ) ref[j] *= max[j];
+      checkVector( y, ref );
+
+      test_ = "Division assignment of max<columnwise>()" + label;
+      y /= blaze::max<columnwise>( A );
+      for( size_t j=0UL; j<n; ++j ) ref[j] /= max[j];
+      checkVector( y, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions of column-major dense matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the row-wise and column-wise sum() of column-major dense matrices. The
+// row-wise reduction of a column-major matrix is evaluated via the column-wise reduction of its
+// row-major transpose. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testColumnMajor()
+{
+   for( const auto& size : sizes_ )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+
+      blaze::DynamicMatrix<double,blaze::columnMajor> A( m, n );
+      std::vector<double> rowSum( m, 0.0 ), columnSum( n, 0.0 );
+
+      for( size_t j=0UL; j<n; ++j ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            A(i,j) = value( i, j );
+            rowSum[i]    += A(i,j);
+            columnSum[j] += A(i,j);
+         }
+      }
+
+      const std::string label( " (" + std::to_string( m ) + "x" + std::to_string( n ) + ")" );
+
+      test_ = "sum<rowwise>() of a column-major matrix" + label;
+      blaze::DynamicVector<double,blaze::columnVector> x;
+      x = blaze::sum<blaze::rowwise>( A );
+      checkVector( x, rowSum );
+
+      test_ = "sum<columnwise>() of a column-major matrix" + label;
+      blaze::DynamicVector<double,blaze::rowVector> y;
+      y = blaze::sum<blaze::columnwise>( A );
+      checkVector( y, columnSum );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel row-wise and column-wise softmax() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the row-wise and column-wise softmax() function for both row-major and
+// column-major dense matrices, i.e. both the reduction along and across the storage order. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testSoftmax()
+{
+   for( const auto& size : sizes_ )
+   {
+      const size_t m( size.first  );
+      const size_t n( size.second );
+
+      blaze::DynamicMatrix<double,blaze::rowMajor> A( m, n ), rowRef( m, n ), columnRef( m, n );
+      std::vector<double> rowSum( m, 0.0 ), columnSum( n, 0.0 );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = 0.1 * value( i, j ) - 0.5;
+            rowSum[i]    += std::exp( A(i,j) );
+            columnSum[j] += std::exp( A(i,j) );
+         }
+      }
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            rowRef(i,j)    = std::exp( A(i,j) ) / rowSum[i];
+            columnRef(i,j) = std::exp( A(i,j) ) / columnSum[j];
+         }
+      }
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> B( A );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> rowRefB( rowRef );
+      const blaze::DynamicMatrix<double,blaze::columnMajor> columnRefB( columnRef );
+
+      const std::string label( " (" + std::to_string( m ) + "x" + std::to_string( n ) + ")" );
+
+      test_ = "softmax<rowwise>() of a row-major matrix" + label;
+      checkSoftmax( blaze::DynamicMatrix<double,blaze::rowMajor>(
+                       blaze::softmax<blaze::rowwise>( A ) ), rowRef );
+
+      test_ = "softmax<columnwise>() of a row-major matrix" + label;
+      checkSoftmax( blaze::DynamicMatrix<double,blaze::rowMajor>(
+                       blaze::softmax<blaze::columnwise>( A ) ), columnRef );
+
+      test_ = "softmax<rowwise>() of a column-major matrix" + label;
+      checkSoftmax( blaze::DynamicMatrix<double,blaze::columnMajor>(
+                       blaze::softmax<blaze::rowwise>( B ) ), rowRefB );
+
+      test_ = "softmax<columnwise>() of a column-major matrix" + label;
+      checkSoftmax( blaze::DynamicMatrix<double,blaze::columnMajor>(
+                       blaze::softmax<blaze::columnwise>( B ) ), columnRefB );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dmatreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel dense matrix column-wise reduction test..." << std::endl;
+
+   try
+   {
+      RUN_DMATREDUCE_COLUMNWISE_PARALLEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel dense matrix column-wise reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
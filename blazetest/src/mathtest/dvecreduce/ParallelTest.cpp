@@ -0,0 +1,366 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dvecreduce/ParallelTest.cpp
+//  \brief Source file for the parallel dense vector reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HybridVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blazetest/mathtest/dvecreduce/ParallelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecreduce {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ParallelTest::ParallelTest()
+   : sizes_()  // The sizes of the test vectors
+   , mode_()   // Label of the currently used thresholds
+   , test_()   // Label of the currently performed test
+{
+   const size_t reduceThreshold( blaze::SMP_DVECREDUCE_THRESHOLD );
+   const size_t innerThreshold ( blaze::SMP_DVECDVECINNER_THRESHOLD );
+
+   // Odd sizes only, i.e. no size is a multiple of the SIMD width
+   sizes_ = { 1UL, 3UL, 5UL, 7UL, 9UL, 15UL, 17UL, 31UL, 33UL, 63UL, 65UL,
+              ( reduceThreshold +  1UL ) | 1UL, ( reduceThreshold + 13UL ) | 1UL,
+              ( innerThreshold  +  1UL ) | 1UL, ( innerThreshold  + 37UL ) | 1UL };
+
+   mode_ = "default thresholds";
+
+   testReduce<int>();
+   testReduce<double>();
+   testInner<int>();
+   testInner<double>();
+   testNorm<int>();
+   testNorm<double>();
+   testVectorElements();
+
+   mode_ = "enforced parallel evaluation";
+
+   blaze::SMP_DVECREDUCE_THRESHOLD    = 0UL;
+   blaze::SMP_DVECDVECINNER_THRESHOLD = 0UL;
+
+   testReduce<int>();
+   testReduce<double>();
+   testInner<int>();
+   testInner<double>();
+   testNorm<int>();
+   testNorm<double>();
+   testVectorElements();
+
+   blaze::SMP_DVECREDUCE_THRESHOLD    = reduceThreshold;
+   blaze::SMP_DVECDVECINNER_THRESHOLD = innerThreshold;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions of a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sum(), prod(), min(), max(), and reduce() functions for dense vectors,
+// unaligned subvectors, and dense vector expressions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the vectors
+void ParallelTest::testReduce()
+{
+   for( size_t n : sizes_ )
+   {
+      blaze::DynamicVector<Type> a( n ), b( n ), s( n );
+
+      Type sum{}, subSum{}, exprSum{}, prod( 1 ), min( 100 ), max( -100 );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         a[i] = Type( i % 9UL + 1UL ) * ( i % 2UL ? Type( 1 ) : Type( -1 ) );
+         b[i] = Type( i % 5UL );
+         s[i] = ( i % 3UL == 1UL ? Type( -1 ) : Type( 1 ) );
+
+         sum     += a[i];
+         subSum  += ( i > 0UL ? a[i] : Type( 0 ) );
+         exprSum += a[i] + b[i];
+         prod    *= s[i];
+         min      = std::min( min, a[i] );
+         max      = std::max( max, a[i] );
+      }
+
+      test_ = "Total reduction (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sum( a ), sum );
+      checkResult( blaze::prod( s ), prod );
+      checkResult( blaze::min( a ), min );
+      checkResult( blaze::max( a ), max );
+      checkResult( blaze::reduce( a, blaze::Add() ), sum );
+      checkResult( blaze::reduce( a, []( Type x, Type y ){ return std::max( x, y ); } ), max );
+
+      test_ = "Total reduction of an unaligned subvector (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sum( blaze::subvector( a, 1UL, n-1UL ) ), subSum );
+
+      test_ = "Total reduction of a vector expression (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sum( a + b ), exprSum );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of two dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the inner product of dense vectors, of dense vectors with different
+// element types, of unaligned subvectors, and of dense vector expressions. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the vectors
+void ParallelTest::testInner()
+{
+   for( size_t n : sizes_ )
+   {
+      blaze::DynamicVector<Type> a( n ), b( n );
+      blaze::DynamicVector<short> c( n );
+
+      Type inner{}, mixed{}, subInner{}, exprInner{};
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         a[i] = Type( i % 7UL ) - Type( 3 );
+         b[i] = Type( i % 4UL + 1UL );
+         c[i] = static_cast<short>( i % 3UL );
+
+         inner     += a[i] * b[i];
+         mixed     += a[i] * c[i];
+         subInner  += ( i > 0UL ? a[i] * b[i-1UL] : Type( 0 ) );
+         exprInner += ( a[i] + b[i] ) * b[i];
+      }
+
+      test_ = "Inner product (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::trans( a ) * b, inner );
+      checkResult( blaze::trans( a ) * c, mixed );
+
+      test_ = "Inner product of unaligned subvectors (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::trans( blaze::subvector( a, 1UL, n-1UL ) ) *
+                   blaze::subvector( b, 0UL, n-1UL ), subInner );
+
+      test_ = "Inner product of a vector expression (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::trans( a + b ) * b, exprInner );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norms of a dense vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the norms of dense vectors and unaligned subvectors. Since the powers of
+// all elements are accumulated per block and the root is applied to the total only, the norms
+// based on integral powers are exact. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Element type of the vectors
+void ParallelTest::testNorm()
+{
+   for( size_t n : sizes_ )
+   {
+      blaze::DynamicVector<Type> a( n );
+
+      Type sqrSum{}, subSqrSum{}, absSum{}, cubeSum{}, quadSum{}, maxAbs{};
+      double powSum( 0.0 );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         a[i] = Type( i % 9UL + 1UL ) * ( i % 2UL ? Type( 1 ) : Type( -1 ) );
+
+         const Type absValue( std::abs( a[i] ) );
+
+         sqrSum    += a[i]*a[i];
+         subSqrSum += ( i > 0UL ? a[i]*a[i] : Type( 0 ) );
+         absSum    += absValue;
+         cubeSum   += absValue*absValue*absValue;
+         quadSum   += a[i]*a[i]*a[i]*a[i];
+         powSum    += std::pow( double( absValue ), 2.5 );
+         maxAbs     = std::max( maxAbs, absValue );
+      }
+
+      test_ = "Norm (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sqrNorm( a ), sqrSum );
+      checkResult( blaze::l1Norm( a ), absSum );
+      checkResult( blaze::maxNorm( a ), maxAbs );
+
+      checkApprox( blaze::norm( a ), std::sqrt( double( sqrSum ) ) );
+      checkApprox( blaze::l2Norm( a ), std::sqrt( double( sqrSum ) ) );
+      checkApprox( blaze::l3Norm( a ), std::cbrt( double( cubeSum ) ) );
+      checkApprox( blaze::l4Norm( a ), std::sqrt( std::sqrt( double( quadSum ) ) ) );
+      checkApprox( blaze::lpNorm<3>( a ), std::cbrt( double( cubeSum ) ) );
+
+      if( blaze::IsFloatingPoint_v<Type> ) {
+         checkApprox( blaze::lpNorm( a, 2.5 ), std::pow( powSum, 0.4 ) );
+      }
+
+      test_ = "Norm of an unaligned subvector (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sqrNorm( blaze::subvector( a, 1UL, n-1UL ) ), subSqrSum );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reductions of a dense vector with vector elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total reductions, inner products, and norms of dense vectors, whose
+// elements are vectors. Elements that are SMP assignable themselves (as for instance dynamic
+// vectors) must not result in nested parallel sections. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testVectorElements()
+{
+   using DynamicElement = blaze::DynamicVector<double>;
+   using HybridElement  = blaze::HybridVector<double,3UL>;
+
+   for( size_t n : sizes_ )
+   {
+      blaze::DynamicVector<DynamicElement> a( n );
+      blaze::DynamicVector<HybridElement> b( n );
+      blaze::DynamicVector<double> x( n );
+
+      DynamicElement sum( 3UL, 0.0 ), sqrSum( 3UL, 0.0 ), inner( 3UL, 0.0 );
+      HybridElement hsum( 3UL, 0.0 ), habsSum( 3UL, 0.0 );
+
+      for( size_t i=0UL; i<n; ++i )
+      {
+         a[i] = DynamicElement{ double( i % 7UL ), -1.0, double( i % 2UL ) - 2.0 };
+         b[i] = HybridElement{ double( i % 5UL ), 1.0, -double( i % 3UL ) };
+         x[i] = double( i % 4UL );
+
+         sum     += a[i];
+         sqrSum  += a[i] * a[i];
+         inner   += x[i] * a[i];
+         hsum    += b[i];
+         habsSum += abs( b[i] );
+      }
+
+      test_ = "Reductions with vector elements (size=" + std::to_string( n ) + ")";
+
+      checkResult( blaze::sum( a ), sum );
+      checkResult( blaze::sqrNorm( a ), sqrSum );
+      checkResult( blaze::trans( x ) * a, inner );
+      checkResult( blaze::sum( b ), hsum );
+      checkResult( blaze::l1Norm( b ), habsSum );
+   }
+}
+//*************************************************************************************************
+
+} // namespace dvecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel dense vector reduction test..." << std::endl;
+
+   try
+   {
+      RUN_DVECREDUCE_PARALLEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel dense vector reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -90,6 +90,7 @@ ClassTest::ClassTest()
    testExtend();
    testReserve();
    testShrinkToFit();
+   testNumaDistribute();
    testSwap();
    testTranspose();
    testCTranspose();
@@ -5054,6 +5055,105 @@ void ClassTest::testShrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c numaDistribute() member function of the DynamicMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c numaDistribute() member function of the DynamicMatrix
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNumaDistribute()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major DynamicMatrix::numaDistribute()";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat( 300UL, 301UL );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            mat(i,j) = static_cast<int>( i*mat.columns() + j );
+         }
+      }
+
+      numaDistribute( mat );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 301UL );
+      checkCapacity( mat, 90300UL );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( mat(i,j) != static_cast<int>( i*mat.columns() + j ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Redistributing the matrix failed\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                   << "   Expected value: " << ( i*mat.columns() + j ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major DynamicMatrix::numaDistribute()";
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat( 300UL, 301UL );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            mat(i,j) = static_cast<int>( i*mat.columns() + j );
+         }
+      }
+
+      numaDistribute( mat );
+
+      checkRows    ( mat, 300UL );
+      checkColumns ( mat, 301UL );
+      checkCapacity( mat, 90300UL );
+
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( mat(i,j) != static_cast<int>( i*mat.columns() + j ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Redistributing the matrix failed\n"
+                   << " Details:\n"
+                   << "   Element (" << i << "," << j << "): " << mat(i,j) << "\n"
+                   << "   Expected value: " << ( i*mat.columns() + j ) << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      if( !isIntact( mat ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c swap() functionality of the DynamicMatrix class template.
 //
@@ -0,0 +1,331 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dynamicmatrix/FirstTouchTest.cpp
+//  \brief Source file for the DynamicMatrix first-touch test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Configuration
+//*************************************************************************************************
+
+// Activation of the first-touch initialization (has to precede all Blaze includes)
+#define BLAZE_SMP_FIRST_TOUCH 1
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/dynamicmatrix/FirstTouchTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dynamicmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DynamicMatrix first-touch test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+FirstTouchTest::FirstTouchTest()
+{
+   testVector<int>( "int" );
+   testVector<double>( "double" );
+   testVector< blaze::complex<double> >( "complex<double>" );
+
+   testMatrix<int,blaze::rowMajor>( "int" );
+   testMatrix<double,blaze::rowMajor>( "double" );
+   testMatrix<blaze::complex<double>,blaze::rowMajor>( "complex<double>" );
+
+   testMatrix<int,blaze::columnMajor>( "int" );
+   testMatrix<double,blaze::columnMajor>( "double" );
+   testMatrix<blaze::complex<double>,blaze::columnMajor>( "complex<double>" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of a dynamic vector.
+//
+// \param type Label of the element type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the constructors, the resize() function, and the numaDistribute()
+// function of a DynamicVector exceeding the SMP assignment threshold. The size of the vector
+// is no multiple of the SIMD width. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Element type of the vector
+void FirstTouchTest::testVector( const std::string& type )
+{
+   const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 17UL );
+
+   const auto values = []( size_t seed ) {
+      return [seed]( size_t i ) { return value<Type>( i, seed ); };
+   };
+
+   {
+      test_ = "DynamicVector<" + type + "> size constructor";
+
+      blaze::DynamicVector<Type> vec( N );
+      fill( vec, 1UL );
+
+      checkVector( vec, N, values( 1UL ) );
+   }
+
+   {
+      test_ = "DynamicVector<" + type + "> homogeneous initialization";
+
+      blaze::DynamicVector<Type> vec( N, Type( 5 ) );
+
+      checkVector( vec, N, []( size_t ) { return Type( 5 ); } );
+   }
+
+   {
+      test_ = "DynamicVector<" + type + "> resize without preservation";
+
+      blaze::DynamicVector<Type> vec( N, Type( 5 ) );
+
+      vec.resize( 2UL*N+3UL, false );
+      fill( vec, 2UL );
+      checkVector( vec, 2UL*N+3UL, values( 2UL ) );
+
+      vec.resize( N-5UL, false );
+      fill( vec, 3UL );
+      checkVector( vec, N-5UL, values( 3UL ) );
+   }
+
+   {
+      test_ = "DynamicVector<" + type + "> resize with preservation";
+
+      blaze::DynamicVector<Type> vec( N );
+      fill( vec, 4UL );
+
+      vec.resize( 2UL*N+1UL, true );
+      for( size_t i=N; i<vec.size(); ++i ) {
+         vec[i] = value<Type>( i, 5UL );
+      }
+
+      checkVector( vec, 2UL*N+1UL, [N]( size_t i ) {
+         return value<Type>( i, ( i < N ? 4UL : 5UL ) );
+      } );
+   }
+
+   {
+      test_ = "DynamicVector<" + type + "> copy constructor and numaDistribute()";
+
+      blaze::DynamicVector<Type> vec( N );
+      fill( vec, 6UL );
+
+      const blaze::DynamicVector<Type> copy( vec );
+      checkVector( copy, N, values( 6UL ) );
+
+      numaDistribute( vec );
+      checkVector( vec, N, values( 6UL ) );
+   }
+
+   {
+      test_ = "DynamicVector<" + type + "> initialization within a serial section";
+
+      BLAZE_SERIAL_SECTION
+      {
+         blaze::DynamicVector<Type> vec( N, Type( 2 ) );
+         checkVector( vec, N, []( size_t ) { return Type( 2 ); } );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the first-touch initialization of a dynamic matrix.
+//
+// \param type Label of the element type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the constructors, the resize() function, and the numaDistribute()
+// function of a DynamicMatrix exceeding the SMP assignment threshold. The number of columns
+// of the matrix is no multiple of the SIMD width. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the matrix
+        , bool SO >      // Storage order of the matrix
+void FirstTouchTest::testMatrix( const std::string& type )
+{
+   using MatrixType = blaze::DynamicMatrix<Type,SO>;
+
+   const std::string order( SO == blaze::rowMajor ? "Row-major" : "Column-major" );
+
+   const size_t M( 37UL );
+   const size_t N( blaze::SMP_DMATASSIGN_THRESHOLD / M + 13UL );
+
+   const auto values = []( size_t seed, size_t columns ) {
+      return [seed,columns]( size_t i, size_t j ) { return value<Type>( i*columns+j, seed ); };
+   };
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> size constructor";
+
+      MatrixType mat( M, N );
+      fill( mat, 1UL );
+
+      checkMatrix( mat, M, N, values( 1UL, N ) );
+   }
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> homogeneous initialization";
+
+      MatrixType mat( M, N, Type( 5 ) );
+
+      checkMatrix( mat, M, N, []( size_t, size_t ) { return Type( 5 ); } );
+   }
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> resize without preservation";
+
+      MatrixType mat( M, N, Type( 5 ) );
+
+      mat.resize( M+5UL, N+9UL, false );
+      fill( mat, 2UL );
+      checkMatrix( mat, M+5UL, N+9UL, values( 2UL, N+9UL ) );
+
+      mat.resize( M-3UL, N-7UL, false );
+      fill( mat, 3UL );
+      checkMatrix( mat, M-3UL, N-7UL, values( 3UL, N-7UL ) );
+   }
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> resize with preservation";
+
+      MatrixType mat( M, N );
+      fill( mat, 4UL );
+
+      mat.resize( M+3UL, N+5UL, true );
+      for( size_t i=0UL; i<mat.rows(); ++i ) {
+         for( size_t j=0UL; j<mat.columns(); ++j ) {
+            if( i >= M || j >= N )
+               mat(i,j) = Type( 9 );
+         }
+      }
+
+      checkMatrix( mat, M+3UL, N+5UL, [M,N]( size_t i, size_t j ) {
+         return ( i < M && j < N ? value<Type>( i*N+j, 4UL ) : Type( 9 ) );
+      } );
+   }
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> copy constructor and numaDistribute()";
+
+      MatrixType mat( M, N );
+      fill( mat, 6UL );
+
+      const MatrixType copy( mat );
+      checkMatrix( copy, M, N, values( 6UL, N ) );
+
+      numaDistribute( mat );
+      checkMatrix( mat, M, N, values( 6UL, N ) );
+   }
+
+   {
+      test_ = order + " DynamicMatrix<" + type + "> initialization within a serial section";
+
+      BLAZE_SERIAL_SECTION
+      {
+         MatrixType mat( M, N, Type( 2 ) );
+         checkMatrix( mat, M, N, []( size_t, size_t ) { return Type( 2 ); } );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace dynamicmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running DynamicMatrix first-touch test..." << std::endl;
+
+   try
+   {
+      RUN_DYNAMICMATRIX_FIRSTTOUCH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during DynamicMatrix first-touch test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
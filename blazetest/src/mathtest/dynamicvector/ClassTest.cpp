@@ -116,6 +116,7 @@ ClassTest::ClassTest()
    testExtend();
    testReserve();
    testShrinkToFit();
+   testNumaDistribute();
    testSwap();
    testIsDefault();
 }
@@ -2819,6 +2820,76 @@ void ClassTest::testShrinkToFit()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c numaDistribute() member function of the DynamicVector class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c numaDistribute() member function of the DynamicVector
+// class template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testNumaDistribute()
+{
+   test_ = "DynamicVector::numaDistribute()";
+
+   // Redistributing a vector with excessive capacity
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec{ 1, 2, 3, 4, 5 };
+      vec.reserve( 100UL );
+
+      vec.numaDistribute();
+
+      checkSize    ( vec, 5UL );
+      checkCapacity( vec, 5UL );
+      checkNonZeros( vec, 5UL );
+
+      if( vec[0] != 1 || vec[1] != 2 || vec[2] != 3 || vec[3] != 4 || vec[4] != 5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Redistributing the vector failed\n"
+             << " Details:\n"
+             << "   Result:\n" << vec << "\n"
+             << "   Expected result:\n( 1 2 3 4 5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Redistributing a large vector
+   {
+      blaze::DynamicVector<int,blaze::rowVector> vec( 100000UL );
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         vec[i] = static_cast<int>( i );
+      }
+
+      numaDistribute( vec );
+
+      checkSize    ( vec, 100000UL );
+      checkCapacity( vec, 100000UL );
+
+      for( size_t i=0UL; i<vec.size(); ++i ) {
+         if( vec[i] != static_cast<int>( i ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Redistributing the vector failed\n"
+                << " Details:\n"
+                << "   Element " << i << ": " << vec[i] << "\n"
+                << "   Expected value: " << i << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      if( !isIntact( vec ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invariant violation detected\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c swap() functionality of the DynamicVector class template.
 //
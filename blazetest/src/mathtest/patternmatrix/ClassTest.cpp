@@ -0,0 +1,471 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/patternmatrix/ClassTest.cpp
+//  \brief Source file for the PatternMatrix class test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PatternMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/mathtest/patternmatrix/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace patternmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the PatternMatrix class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testElementAccess();
+   testRowMajorOperations();
+   testColumnMajorOperations();
+   testIndexRange();
+   testInnerKernel<float ,uint32_t>( "float, uint32_t"  );
+   testInnerKernel<float ,size_t  >( "float, size_t"    );
+   testInnerKernel<double,uint32_t>( "double, uint32_t" );
+   testInnerKernel<double,size_t  >( "double, size_t"   );
+   testInnerKernel<int   ,size_t  >( "int, size_t"      );
+   testValueFreeKernels<double,blaze::rowMajor   >( "row-major, double"    );
+   testValueFreeKernels<double,blaze::columnMajor>( "column-major, double" );
+   testValueFreeKernels<int   ,blaze::rowMajor   >( "row-major, int"       );
+   testValueFreeKernels<int   ,blaze::columnMajor>( "column-major, int"    );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the element access and the modification of the pattern.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access of a row-major PatternMatrix and the modification of
+// its pattern via the set(), insert(), and erase() functions. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testElementAccess()
+{
+   test_ = "Row-major PatternMatrix element access";
+
+   using MatrixType = blaze::PatternMatrix<int,blaze::rowMajor,uint32_t>;
+
+   MatrixType mat( blaze::CompressedMatrix<int>{ { 0, 1, 0, 0 }, { 0, 0, 0, 2 }, { 3, 0, 4, 0 } } );
+   mat.set( 0UL, 3UL );
+   mat.insert( 1UL, 0UL );
+   mat.erase( 1UL, 3UL );
+   mat.set( 2UL, 2UL );
+
+   checkRows    ( mat, 3UL );
+   checkColumns ( mat, 4UL );
+   checkNonZeros( mat, 5UL );
+   checkNonZeros( mat, 0UL, 2UL );
+   checkNonZeros( mat, 1UL, 1UL );
+   checkNonZeros( mat, 2UL, 2UL );
+
+   if( mat(0,1) != 1 || mat(0,3) != 1 || mat(1,0) != 1 || mat(1,3) != 0 || mat(2,2) != 1 ||
+       mat.indices( 2UL )[1] != 2U || mat.find( 0UL, 3UL )->index() != 3UL ||
+       mat.lowerBound( 2UL, 1UL )->value() != 1 ||
+       mat.upperBound( 2UL, 2UL ) != mat.end( 2UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Element access failed\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n"
+          << "   Expected result:\n( 0 1 0 1 )\n( 1 0 0 0 )\n( 1 0 1 0 )\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of operations with a row-major PatternMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix/vector product, the matrix/matrix product, the masked matrix
+// product, and the total sum of a row-major PatternMatrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRowMajorOperations()
+{
+   test_ = "Row-major PatternMatrix operations";
+
+   using MatrixType = blaze::PatternMatrix<double,blaze::rowMajor,uint32_t>;
+   using RefType    = blaze::CompressedMatrix<double,blaze::rowMajor>;
+   using VectorType = blaze::DynamicVector<double,blaze::columnVector>;
+
+   const RefType ref( blaze::map( blaze::rand<RefType>( 37UL, 29UL, 300UL, 1.0, 2.0 ),
+                                  []( double ){ return 1.0; } ) );
+   const VectorType vec( blaze::rand<VectorType>( 29UL ) );
+
+   const MatrixType mat( ref );
+   const VectorType res1( mat * vec );
+   const VectorType res2( ref * vec );
+   const RefType prod( mat * trans( mat ) );
+
+   checkNonZeros( mat, ref.nonZeros() );
+
+   if( mat != ref || prod != ref * trans( ref ) ||
+       blaze::mxm( ref, trans( ref ), mat * trans( mat ) ) != prod ||
+       !blaze::equal( blaze::norm( res1 - res2 ), 0.0 ) ||
+       !blaze::equal( sum( mat ), double( ref.nonZeros() ) ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation with pattern storage failed\n"
+          << " Details:\n"
+          << "   Result:\n" << res1 << "\n"
+          << "   Expected result:\n" << res2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of operations with a column-major PatternMatrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix/vector product and the in-place transposition of a
+// column-major PatternMatrix. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testColumnMajorOperations()
+{
+   test_ = "Column-major PatternMatrix operations";
+
+   using MatrixType = blaze::PatternMatrix<float,blaze::columnMajor>;
+   using RefType    = blaze::CompressedMatrix<float,blaze::rowMajor>;
+   using VectorType = blaze::DynamicVector<float,blaze::columnVector>;
+
+   const RefType ref( blaze::map( blaze::rand<RefType>( 23UL, 31UL, 200UL, 1.0F, 2.0F ),
+                                  []( float ){ return 1.0F; } ) );
+   const VectorType vec( blaze::rand<VectorType>( 31UL ) );
+
+   MatrixType mat( ref );
+   const VectorType res1( mat * vec );
+   const VectorType res2( ref * vec );
+
+   mat.transpose();
+
+   if( mat != trans( ref ) || !blaze::equal( blaze::norm( res1 - res2 ), 0.0F ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation with pattern storage failed\n"
+          << " Details:\n"
+          << "   Result:\n" << res1 << "\n"
+          << "   Expected result:\n" << res2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the index range check of the PatternMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that creating or resizing a PatternMatrix with more columns (row-major)
+// or rows (column-major) than its index type can represent results in a \a std::invalid_argument
+// exception. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   test_ = "PatternMatrix dimensions exceeding the index type";
+
+   try {
+      blaze::PatternMatrix<int,blaze::rowMajor,uint8_t> mat( 1000UL, 256UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Creating a row-major matrix with too many columns succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::PatternMatrix<int,blaze::columnMajor,uint8_t> mat( 2UL, 255UL );
+      mat.resize( 256UL, 255UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing a column-major matrix beyond the index type succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << mat << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the row/dense vector inner product kernel of a row-major PatternMatrix.
+//
+// \param type The name of the element and index type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the multiplication of a row-major PatternMatrix with a dense vector for
+// rows with 0 to 40 non-zero elements, i.e. for numbers of non-zero elements that are and that
+// are not multiples of the SIMD width. The dense vector contains small integral values, which
+// allows an exact comparison. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , typename IT >  // Index type
+void ClassTest::testInnerKernel( const std::string& type )
+{
+   test_ = "Row-major PatternMatrix/dense vector multiplication (" + type + ")";
+
+   const size_t M( 41UL );
+   const size_t N( 97UL );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> ref( M, N, M*(M-1UL)/2UL );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t k=0UL; k<i; ++k ) {
+         ref.append( i, k*2UL + i%2UL, Type(1) );
+      }
+      ref.finalize( i );
+   }
+
+   const blaze::PatternMatrix<Type,blaze::rowMajor,IT> mat( ref );
+
+   blaze::DynamicVector<Type,blaze::columnVector> vec( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      vec[j] = Type( int( j % 11UL ) - 5 );
+   }
+
+   const blaze::DynamicVector<Type,blaze::columnVector> res( mat * vec );
+
+   for( size_t i=0UL; i<M; ++i )
+   {
+      Type expected{};
+      for( auto element=ref.begin(i); element!=ref.end(i); ++element ) {
+         expected += vec[element->index()];
+      }
+
+      if( res[i] != expected ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid result in row " << i << "\n"
+             << " Details:\n"
+             << "   Result: " << res[i] << "\n"
+             << "   Expected result: " << expected << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the value-free kernels of the PatternMatrix products.
+//
+// \param type The name of the storage order and element type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the matrix/vector product, the vector/matrix product, and the matrix/dense
+// matrix product of a PatternMatrix, including the addition and subtraction assignments, by
+// comparing their results to the products of a CompressedMatrix with all non-zero elements set
+// to 1. The dense operands contain small integral values, which allows an exact comparison.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix elements
+        , bool SO >      // Storage order
+void ClassTest::testValueFreeKernels( const std::string& type )
+{
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   using MatrixType = blaze::PatternMatrix<Type,SO,uint32_t>;
+   using RefType    = blaze::CompressedMatrix<Type,SO>;
+   using DenseType  = blaze::DynamicMatrix<Type,blaze::rowMajor>;
+
+   const size_t M( 67UL );
+   const size_t N( 53UL );
+
+   const RefType ref( blaze::map( blaze::rand<RefType>( M, N, 700UL ), []( Type ){ return Type(1); } ) );
+   const MatrixType mat( ref );
+
+   blaze::DynamicVector<Type,columnVector> x( N );
+   for( size_t j=0UL; j<N; ++j ) {
+      x[j] = Type( int( j % 7UL ) - 3 );
+   }
+
+   blaze::DynamicVector<Type,rowVector> z( M );
+   for( size_t i=0UL; i<M; ++i ) {
+      z[i] = Type( int( i % 5UL ) - 2 );
+   }
+
+   const blaze::DynamicVector<Type,columnVector> x3( x * Type(3) );
+   const blaze::DynamicVector<Type,rowVector> z3( z * Type(3) );
+
+   {
+      test_ = "PatternMatrix/dense vector multiplication (" + type + ")";
+
+      blaze::DynamicVector<Type,columnVector> res( mat * x );
+      res += mat * x;
+      res -= mat * x3;
+
+      if( res != -( ref * x ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with pattern storage failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << -( ref * x ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Dense vector/PatternMatrix multiplication (" + type + ")";
+
+      blaze::DynamicVector<Type,rowVector> res( z * mat );
+      res += z * mat;
+      res -= z3 * mat;
+
+      if( res != -( z * ref ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with pattern storage failed\n"
+             << " Details:\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << -( z * ref ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   for( size_t P : { 19UL, 150UL } )
+   {
+      test_ = "PatternMatrix/dense matrix multiplication (" + type + ")";
+
+      DenseType B( N, P );
+      for( size_t i=0UL; i<N; ++i ) {
+         for( size_t j=0UL; j<P; ++j ) {
+            B(i,j) = Type( int( ( i + j*3UL ) % 9UL ) - 4 );
+         }
+      }
+
+      const DenseType res( mat * B );
+
+      if( res != ref * B ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Multiplication with pattern storage failed\n"
+             << " Details:\n"
+             << "   Number of columns: " << P << "\n"
+             << "   Result:\n" << res << "\n"
+             << "   Expected result:\n" << ( ref * B ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace patternmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running PatternMatrix class test..." << std::endl;
+
+   try
+   {
+      RUN_PATTERNMATRIX_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during PatternMatrix class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
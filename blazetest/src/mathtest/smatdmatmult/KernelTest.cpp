@@ -0,0 +1,229 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smatdmatmult/KernelTest.cpp
+//  \brief Source file for the sparse matrix/dense matrix multiplication kernel test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CustomMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blazetest/mathtest/smatdmatmult/KernelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatdmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the KernelTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+KernelTest::KernelTest()
+{
+   testBlockedKernel<float >( "float"  );
+   testBlockedKernel<double>( "double" );
+   testSMPAssign<float >( "float"  );
+   testSMPAssign<double>( "double" );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the register blocked sparse matrix/dense matrix multiplication kernel.
+//
+// \param type The name of the element type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the register blocked kernel for all numbers of columns up to two full
+// blocks of four SIMD vectors plus a partial block, i.e. for numbers of columns that are and
+// that are not multiples of the SIMD width and of the block width. Both padded and unpadded
+// operands and targets are used. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void KernelTest::testBlockedKernel( const std::string& type )
+{
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   using UnpaddedType = blaze::CustomMatrix<Type,unaligned,unpadded,rowMajor>;
+
+   const size_t simdsize( blaze::SIMDTrait<Type>::size );
+   const size_t M( 23UL );
+   const size_t K( 17UL );
+
+   const blaze::CompressedMatrix<Type,rowMajor> A( createSparse<Type>( M, K, 5UL ) );
+
+   for( size_t N=1UL; N<=9UL*simdsize+3UL; ++N )
+   {
+      const blaze::DynamicMatrix<Type,rowMajor> B( createDense<Type>( K, N ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( reference( A, B ) );
+
+      {
+         test_ = "Register blocked kernel (" + type + ", padded, N=" + std::to_string( N ) + ")";
+
+         blaze::DynamicMatrix<Type,rowMajor> C( M, N );
+         C = A * B;
+
+         checkResult( C, ref );
+      }
+
+      {
+         test_ = "Register blocked kernel (" + type + ", unpadded, N=" + std::to_string( N ) + ")";
+
+         std::vector<Type> memory1( K*N ), memory2( M*N );
+         UnpaddedType B2( memory1.data(), K, N );
+         UnpaddedType C2( memory2.data(), M, N );
+
+         B2 = B;
+         C2 = A * B2;
+
+         checkResult( C2, ref );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the non-zero balanced SMP assignment of a sparse matrix/dense matrix product.
+//
+// \param type The name of the element type.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SMP assignment of a product large enough to trigger the parallel
+// execution. The sparse matrix contains empty rows and a single completely filled row, which
+// results in strongly unbalanced row ranges. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Data type of the matrix elements
+void KernelTest::testSMPAssign( const std::string& type )
+{
+   using blaze::rowMajor;
+
+   const size_t simdsize( blaze::SIMDTrait<Type>::size );
+   const size_t K( 61UL );
+
+   for( size_t N : { 4UL*simdsize, 37UL } )
+   {
+      const size_t M( blaze::SMP_SMATDMATMULT_THRESHOLD / N + 211UL );
+
+      const blaze::CompressedMatrix<Type,rowMajor> A( createSparse<Type>( M, K, M/3UL ) );
+      const blaze::DynamicMatrix<Type,rowMajor> B( createDense<Type>( K, N ) );
+      const blaze::DynamicMatrix<Type,rowMajor> ref( reference( A, B ) );
+
+      {
+         test_ = "SMP assignment (" + type + ", N=" + std::to_string( N ) + ")";
+
+         blaze::DynamicMatrix<Type,rowMajor> C( M, N );
+         C = A * B;
+
+         checkResult( C, ref );
+      }
+
+      {
+         test_ = "Serial assignment (" + type + ", N=" + std::to_string( N ) + ")";
+
+         blaze::DynamicMatrix<Type,rowMajor> C( M, N );
+         C = blaze::serial( A * B );
+
+         checkResult( C, ref );
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace smatdmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix/dense matrix multiplication kernel test..." << std::endl;
+
+   try
+   {
+      RUN_SMATDMATMULT_KERNEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix/dense matrix multiplication kernel test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,371 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smatreduce/total/ParallelTest.cpp
+//  \brief Source file for the parallel sparse matrix reduction test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/sparse/Partition.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smatreduce/total/ParallelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatreduce {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ParallelTest::ParallelTest()
+   : sizes_()  // The number of rows/columns of the test matrices
+   , mode_()   // Label of the currently used thresholds
+   , test_()   // Label of the currently performed test
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t threshold1( blaze::SMP_SPARSEREDUCE_THRESHOLD );
+   const size_t threshold2( blaze::SMP_SMATREDUCE_THRESHOLD );
+
+   sizes_ = { 1UL, 2UL, 3UL, 5UL, 17UL, threshold1 / 50UL + threshold2 + 211UL };
+
+   testPartition();
+
+   mode_ = "default thresholds";
+
+   testTotalReduction<rowMajor>( "row-major" );
+   testTotalReduction<columnMajor>( "column-major" );
+   testPartialReduction<rowMajor>( "row-major" );
+   testPartialReduction<columnMajor>( "column-major" );
+
+   mode_ = "enforced parallel evaluation";
+
+   blaze::SMP_SPARSEREDUCE_THRESHOLD = 0UL;
+   blaze::SMP_SMATREDUCE_THRESHOLD   = 0UL;
+
+   testTotalReduction<rowMajor>( "row-major" );
+   testTotalReduction<columnMajor>( "column-major" );
+   testPartialReduction<rowMajor>( "row-major" );
+   testPartialReduction<columnMajor>( "column-major" );
+
+   blaze::SMP_SPARSEREDUCE_THRESHOLD = threshold1;
+   blaze::SMP_SMATREDUCE_THRESHOLD   = threshold2;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the non-zero balanced partitioning of rows/columns.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the partitionNonZeros() functions for uniformly distributed non-zero
+// elements, for a single dominating row, for more tasks than rows, and for both storage orders
+// of a sparse matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testPartition()
+{
+   using blaze::partitionNonZeros;
+
+   mode_ = "partitioning";
+
+   {
+      test_ = "Partitioning of uniformly filled rows";
+
+      const std::vector<size_t> nnz( 8UL, 3UL );
+      const auto counts( [&nnz]( size_t i ){ return nnz[i]; } );
+
+      checkBounds( partitionNonZeros( 8UL, counts, 1UL ), { 0UL, 8UL } );
+      checkBounds( partitionNonZeros( 8UL, counts, 4UL ), { 0UL, 2UL, 4UL, 6UL, 8UL } );
+      checkBounds( partitionNonZeros( 8UL, counts, 3UL ), { 0UL, 3UL, 6UL, 8UL } );
+   }
+
+   {
+      test_ = "Partitioning with a single dominating row";
+
+      const std::vector<size_t> nnz{ 1UL, 1UL, 1000UL, 1UL, 1UL };
+      const auto counts( [&nnz]( size_t i ){ return nnz[i]; } );
+
+      checkBounds( partitionNonZeros( 5UL, counts, 4UL ), { 0UL, 3UL, 3UL, 3UL, 5UL } );
+      checkBounds( partitionNonZeros( 5UL, counts, 2UL ), { 0UL, 3UL, 5UL } );
+   }
+
+   {
+      test_ = "Partitioning with more tasks than rows";
+
+      const std::vector<size_t> nnz{ 5UL, 5UL };
+      const auto counts( [&nnz]( size_t i ){ return nnz[i]; } );
+
+      checkBounds( partitionNonZeros( 2UL, counts, 4UL ), { 0UL, 1UL, 1UL, 2UL, 2UL } );
+      checkBounds( partitionNonZeros( 0UL, counts, 3UL ), { 0UL, 0UL, 0UL, 0UL } );
+   }
+
+   {
+      test_ = "Partitioning of a row-major matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A(
+         createMatrix<blaze::rowMajor>( 5UL, 500UL, true ) );
+
+      // Rows 0 and 4 are empty, row 1 is completely filled
+      checkBounds( partitionNonZeros( A, 2UL ), { 0UL, 2UL, 5UL } );
+      checkBounds( partitionNonZeros( A, 1UL ), { 0UL, 5UL } );
+   }
+
+   {
+      test_ = "Partitioning of a column-major matrix";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A(
+         createMatrix<blaze::columnMajor>( 5UL, 500UL, true ) );
+
+      // Columns 0 and 4 are empty, column 1 is completely filled
+      checkBounds( partitionNonZeros( A, 2UL ), { 0UL, 2UL, 5UL } );
+      checkBounds( partitionNonZeros( A, 1UL ), { 0UL, 5UL } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel total reductions and norms of a sparse matrix.
+//
+// \param order The name of the storage order.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the total sum, minimum, and maximum and several norms of sparse matrices
+// with and without an empty first row/column. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order
+void ParallelTest::testTotalReduction( const std::string& order )
+{
+   for( size_t majors : sizes_ ) {
+      for( bool emptyFirst : { true, false } )
+      {
+         const blaze::CompressedMatrix<double,SO> A( createMatrix<SO>( majors, 93UL, emptyFirst ) );
+
+         double sum( 0.0 ), sqrSum( 0.0 ), absSum( 0.0 ), cubeSum( 0.0 ), maxAbs( 0.0 );
+         double min( 0.0 ), max( 0.0 );
+         bool initialized( A.begin(0UL) == A.end(0UL) );
+
+         for( size_t k=0UL; k<majors; ++k ) {
+            for( auto element=A.begin(k); element!=A.end(k); ++element )
+            {
+               const double value( element->value() );
+
+               sum     += value;
+               sqrSum  += value*value;
+               absSum  += std::abs( value );
+               cubeSum += std::abs( value*value*value );
+               maxAbs   = std::max( maxAbs, std::abs( value ) );
+               min      = ( initialized ? std::min( min, value ) : value );
+               max      = ( initialized ? std::max( max, value ) : value );
+               initialized = true;
+            }
+         }
+
+         test_ = "Total reduction (" + order + ", size=" + std::to_string( majors ) +
+                 ( emptyFirst ? ", empty first" : "" ) + ")";
+
+         checkResult( blaze::sum( A ), sum );
+         checkResult( blaze::min( A ), min );
+         checkResult( blaze::max( A ), max );
+
+         test_ = "Norm (" + order + ", size=" + std::to_string( majors ) +
+                 ( emptyFirst ? ", empty first" : "" ) + ")";
+
+         checkResult( blaze::sqrNorm( A ), sqrSum );
+         checkResult( blaze::norm( A ), std::sqrt( sqrSum ) );
+         checkResult( blaze::l1Norm( A ), absSum );
+         checkResult( blaze::l2Norm( A ), std::sqrt( sqrSum ) );
+         checkResult( blaze::l3Norm( A ), std::cbrt( cubeSum ) );
+         checkResult( blaze::maxNorm( A ), maxAbs );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel row-wise and column-wise reductions of a sparse matrix.
+//
+// \param order The name of the storage order.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the assignment of row-wise and column-wise sums and maxima of sparse
+// matrices to dense vectors. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< bool SO >  // Storage order
+void ParallelTest::testPartialReduction( const std::string& order )
+{
+   using blaze::rowwise;
+   using blaze::columnwise;
+
+   for( size_t majors : sizes_ )
+   {
+      const blaze::CompressedMatrix<double,SO> A( createMatrix<SO>( majors, 93UL, true ) );
+
+      blaze::DynamicVector<double,blaze::columnVector> rowSums( A.rows(), 0.0 );
+      blaze::DynamicVector<double,blaze::columnVector> rowMax ( A.rows(), 0.0 );
+      blaze::DynamicVector<double,blaze::rowVector> columnSums( A.columns(), 0.0 );
+      blaze::DynamicVector<double,blaze::rowVector> columnMax ( A.columns(), 0.0 );
+      std::vector<bool> rowFound( A.rows(), false ), columnFound( A.columns(), false );
+
+      for( size_t k=0UL; k<majors; ++k ) {
+         for( auto element=A.begin(k); element!=A.end(k); ++element )
+         {
+            const size_t i( SO ? element->index() : k );
+            const size_t j( SO ? k : element->index() );
+            const double value( element->value() );
+
+            rowSums[i]    += value;
+            columnSums[j] += value;
+            rowMax[i]      = ( rowFound[i] ? std::max( rowMax[i], value ) : value );
+            columnMax[j]   = ( columnFound[j] ? std::max( columnMax[j], value ) : value );
+            rowFound[i]    = true;
+            columnFound[j] = true;
+         }
+      }
+
+      test_ = "Row-wise reduction (" + order + ", size=" + std::to_string( majors ) + ")";
+
+      blaze::DynamicVector<double,blaze::columnVector> r1( blaze::sum<rowwise>( A ) );
+      checkResult( r1, rowSums );
+
+      r1 = blaze::max<rowwise>( A );
+      checkResult( r1, rowMax );
+
+      test_ = "Column-wise reduction (" + order + ", size=" + std::to_string( majors ) + ")";
+
+      blaze::DynamicVector<double,blaze::rowVector> r2( blaze::sum<columnwise>( A ) );
+      checkResult( r2, columnSums );
+
+      r2 = blaze::max<columnwise>( A );
+      checkResult( r2, columnMax );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the boundaries of a partitioning.
+//
+// \param bounds The computed boundaries.
+// \param ref The reference boundaries.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ParallelTest::checkBounds( const std::vector<size_t>& bounds,
+                                const std::vector<size_t>& ref ) const
+{
+   if( bounds != ref ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid partitioning\n"
+          << " Details:\n"
+          << "   Result:";
+      for( size_t bound : bounds ) oss << " " << bound;
+      oss << "\n   Expected result:";
+      for( size_t bound : ref ) oss << " " << bound;
+      oss << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smatreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel sparse matrix reduction test..." << std::endl;
+
+   try
+   {
+      RUN_SMATREDUCE_PARALLEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel sparse matrix reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
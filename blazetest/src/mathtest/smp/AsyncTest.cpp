@@ -0,0 +1,732 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/AsyncTest.cpp
+//  \brief Source file for the SMP asynchronous evaluation test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smp/AsyncTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the test value of the element at the given position.
+//
+// \param i The row index of the element.
+// \param j The column index of the element.
+// \return The test value in the range \f$ [-5..5] \f$.
+*/
+inline double value( size_t i, size_t j )
+{
+   return static_cast<double>( ( i*7UL + j*3UL ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Number of nested asynchronous operations outliving the main() function.
+*/
+constexpr size_t outliving( 4UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Number of completed nested asynchronous operations outliving the main() function.
+*/
+std::atomic<size_t> outlivingCompleted( 0UL );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Operand and targets of the nested asynchronous operations outliving the main() function.
+*/
+const blaze::DynamicVector<int> outlivingOperand( 1UL, 1 );
+std::vector< blaze::DynamicVector<int> > outlivingResults( outliving );
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the check of the nested asynchronous operations outliving main().
+//
+// The destructor of the single instance of this class is executed after the end of the main()
+// function. Since the instance is created before the launcher pool, the launcher pool has been
+// destroyed at this time and all asynchronous operations are required to be completed. In case
+// an error is detected, the program is terminated with a failure exit code.
+*/
+struct OutlivingCheck
+{
+   ~OutlivingCheck()
+   {
+      bool valid( outlivingCompleted == outliving );
+
+      for( const auto& result : outlivingResults ) {
+         if( result.size() != 1UL || result[0] != 2 )
+            valid = false;
+      }
+
+      if( !valid ) {
+         std::cerr << "\n\n ERROR DETECTED during SMP asynchronous evaluation test:\n"
+                   << " Test: Nested asynchronous operations outliving main()\n"
+                   << " Error: Asynchronous operations not completed at the end of the program\n"
+                   << " Details:\n"
+                   << "   Completed operations: " << outlivingCompleted << "\n"
+                   << "   Expected operations : " << outliving << "\n";
+         std::_Exit( EXIT_FAILURE );
+      }
+   }
+} outlivingCheck;
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AsyncTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AsyncTest::AsyncTest()
+   : test_()  // Label of the currently performed test
+{
+   testAsyncAssign();
+   testEvaluateAsync();
+   testTemporaries();
+   testExceptions();
+   testCarryOver();
+
+   {
+      const size_t vecAssignThreshold( blaze::SMP_DVECASSIGN_THRESHOLD );
+      const size_t matAssignThreshold( blaze::SMP_DMATASSIGN_THRESHOLD );
+      const size_t addThreshold      ( blaze::SMP_DVECDVECADD_THRESHOLD );
+      const size_t matvecThreshold   ( blaze::SMP_DMATDVECMULT_THRESHOLD );
+      const size_t matmatThreshold   ( blaze::SMP_DMATDMATMULT_THRESHOLD );
+
+      blaze::SMP_DVECASSIGN_THRESHOLD   = 0UL;
+      blaze::SMP_DMATASSIGN_THRESHOLD   = 0UL;
+      blaze::SMP_DVECDVECADD_THRESHOLD  = 0UL;
+      blaze::SMP_DMATDVECMULT_THRESHOLD = 0UL;
+      blaze::SMP_DMATDMATMULT_THRESHOLD = 0UL;
+
+      testAsyncAssign();
+      testEvaluateAsync();
+
+      blaze::SMP_DVECASSIGN_THRESHOLD   = vecAssignThreshold;
+      blaze::SMP_DMATASSIGN_THRESHOLD   = matAssignThreshold;
+      blaze::SMP_DVECDVECADD_THRESHOLD  = addThreshold;
+      blaze::SMP_DMATDVECMULT_THRESHOLD = matvecThreshold;
+      blaze::SMP_DMATDMATMULT_THRESHOLD = matmatThreshold;
+   }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   testLauncherSize();
+   testNestedLaunch();
+   testOutliveMain();
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the asyncAssign() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several asynchronous vector and matrix assignments at the same time
+// and compares their results to the results of the according serial operations. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testAsyncAssign()
+{
+   test_ = "asyncAssign()";
+
+   blaze::DynamicMatrix<double> A( 101UL, 103UL ), B( 103UL, 97UL );
+   blaze::DynamicVector<double> x( 103UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = value( i, j );
+
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<B.columns(); ++j )
+         B(i,j) = value( j, i );
+
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = value( i, 1UL );
+
+   blaze::DynamicVector<double> yRef, zRef;
+   blaze::DynamicMatrix<double> CRef, DRef;
+
+   BLAZE_SERIAL_SECTION
+   {
+      yRef = A * x;
+      zRef = x + x;
+      CRef = A * B;
+      DRef = trans( A );
+   }
+
+   blaze::DynamicVector<double> y, z;
+   blaze::DynamicMatrix<double> C, D;
+
+   std::future<void> matvec( blaze::asyncAssign( y, A * x ) );
+   std::future<void> add   ( blaze::asyncAssign( z, x + x ) );
+   std::future<void> matmat( blaze::asyncAssign( C, A * B ) );
+   std::future<void> trans ( blaze::asyncAssign( D, blaze::trans( A ) ) );
+
+   matvec.get();
+   add.get();
+   matmat.get();
+   trans.get();
+
+   checkResult( y, yRef );
+   checkResult( z, zRef );
+   checkResult( C, CRef );
+   checkResult( D, DRef );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the evaluateAsync() functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts several asynchronous evaluations of vectors, matrices, and expressions
+// at the same time and compares their results to the results of the according serial
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testEvaluateAsync()
+{
+   test_ = "evaluateAsync()";
+
+   blaze::DynamicMatrix<double> A( 67UL, 71UL ), B( 71UL, 73UL );
+   blaze::DynamicVector<double> x( 71UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = value( i, j );
+
+   for( size_t i=0UL; i<B.rows(); ++i )
+      for( size_t j=0UL; j<B.columns(); ++j )
+         B(i,j) = value( j, i );
+
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = value( i, 2UL );
+
+   blaze::DynamicVector<double> yRef;
+   blaze::DynamicMatrix<double> CRef;
+
+   BLAZE_SERIAL_SECTION
+   {
+      yRef = A * x;
+      CRef = A * B;
+   }
+
+   auto matvec( blaze::evaluateAsync( A * x ) );
+   auto matmat( blaze::evaluateAsync( A * B ) );
+   auto vector( blaze::evaluateAsync( x ) );
+   auto matrix( blaze::evaluateAsync( A ) );
+
+   checkResult( matvec.get(), yRef );
+   checkResult( matmat.get(), CRef );
+   checkResult( vector.get(), x );
+   checkResult( matrix.get(), A );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the asynchronous operations on temporary operands.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the asyncAssign() and evaluateAsync() functions with temporary vectors
+// and matrices, which are destroyed before the asynchronous operations are completed. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testTemporaries()
+{
+   test_ = "asyncAssign() and evaluateAsync() of temporaries";
+
+   blaze::DynamicMatrix<double> A( 59UL, 61UL );
+   blaze::DynamicVector<double> x( 61UL );
+
+   for( size_t i=0UL; i<A.rows(); ++i )
+      for( size_t j=0UL; j<A.columns(); ++j )
+         A(i,j) = value( i, j );
+
+   for( size_t i=0UL; i<x.size(); ++i )
+      x[i] = value( i, 3UL );
+
+   blaze::DynamicVector<double> yRef;
+   blaze::DynamicMatrix<double> CRef;
+
+   BLAZE_SERIAL_SECTION
+   {
+      yRef = A * x;
+      CRef = A * trans( A );
+   }
+
+   blaze::DynamicVector<double> y, z;
+   blaze::DynamicMatrix<double> C, D;
+
+   using VT = blaze::DynamicVector<double>;
+   using MT = blaze::DynamicMatrix<double>;
+
+   std::future<void> vecAssign( blaze::asyncAssign( y, blaze::evaluate( A * x ) ) );
+   std::future<void> matAssign( blaze::asyncAssign( C, MT( A * trans( A ) ) ) );
+   auto vecEvaluate( blaze::evaluateAsync( VT( A * x ) ) );
+   auto matEvaluate( blaze::evaluateAsync( blaze::evaluate( A * trans( A ) ) ) );
+
+   // Reusing the memory of the destroyed temporaries
+   std::future<void> vecFill( blaze::asyncAssign( z, VT( 61UL, -1.0 ) ) );
+   std::future<void> matFill( blaze::asyncAssign( D, MT( 59UL, 59UL, -1.0 ) ) );
+
+   vecAssign.get();
+   matAssign.get();
+   vecFill.get();
+   matFill.get();
+
+   checkResult( y, yRef );
+   checkResult( C, CRef );
+   checkResult( vecEvaluate.get(), yRef );
+   checkResult( matEvaluate.get(), CRef );
+   checkResult( z, VT( 61UL, -1.0 ) );
+   checkResult( D, MT( 59UL, 59UL, -1.0 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rethrow of exceptions via the futures of asynchronous operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that exceptions thrown during an asynchronous assignment or evaluation
+// are rethrown by the \c get() function of the returned future. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testExceptions()
+{
+   test_ = "Exceptions of asyncAssign()";
+
+   {
+      blaze::StaticVector<int,3UL> s;
+      const blaze::DynamicVector<int> d( 5UL, 1 );
+
+      std::future<void> future( blaze::asyncAssign( s, d ) );
+      checkThrows<std::invalid_argument>( "Assignment to a vector of different size", future );
+   }
+
+   {
+      blaze::StaticMatrix<int,2UL,2UL> s;
+      const blaze::DynamicMatrix<int> d( 3UL, 3UL, 1 );
+
+      std::future<void> future( blaze::asyncAssign( s, d ) );
+      checkThrows<std::invalid_argument>( "Assignment to a matrix of different size", future );
+   }
+
+   test_ = "Exceptions of evaluateAsync()";
+
+   {
+      const blaze::DynamicVector<int> d( 3UL, 1 );
+      const auto fail = []( int ) -> int { throw std::runtime_error( "Failing operation" ); };
+
+      auto future( blaze::evaluateAsync( blaze::map( d, fail ) ) );
+      checkThrows<std::runtime_error>( "Evaluation of a failing operation", future );
+   }
+
+   test_ = "Operation after a failed asynchronous operation";
+
+   {
+      const blaze::DynamicVector<int> d( 3UL, 1 );
+
+      auto future( blaze::evaluateAsync( d + d ) );
+      checkResult( future.get(), blaze::DynamicVector<int>( 3UL, 2 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the carry-over of the thread limit and the serial section.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the thread limit and the serial section of the calling thread also
+// apply to the asynchronous operation, and that neither of them is retained for subsequent
+// asynchronous operations. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void AsyncTest::testCarryOver()
+{
+   const size_t unlimited( std::numeric_limits<size_t>::max() );
+
+   std::atomic<size_t> limit ( 0UL );
+   std::atomic<bool>   serial( false );
+
+   const blaze::DynamicVector<int> d( 1UL, 1 );
+
+   // The probe is evaluated serially by the thread executing the asynchronous evaluation
+   const auto probe = [&limit,&serial]( int v ) {
+      limit  = blaze::getThreadLimit();
+      serial = blaze::isSerialSectionActive();
+      return v;
+   };
+
+   const auto check = [this,&limit,&serial]( size_t expectedLimit, bool expectedSerial ) {
+      if( limit != expectedLimit || serial != expectedSerial ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid state of the asynchronous operation\n"
+             << " Details:\n"
+             << "   Thread limit          : " << limit << "\n"
+             << "   Expected thread limit : " << expectedLimit << "\n"
+             << "   Serial section        : " << serial << "\n"
+             << "   Expected section      : " << expectedSerial << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   };
+
+   test_ = "Carry-over of the thread limit";
+
+   BLAZE_THREAD_LIMIT( 2UL ) {
+      blaze::evaluateAsync( blaze::map( d, probe ) ).get();
+   }
+   check( 2UL, false );
+
+   test_ = "Carry-over of the serial section";
+
+   BLAZE_SERIAL_SECTION {
+      blaze::evaluateAsync( blaze::map( d, probe ) ).get();
+   }
+   check( unlimited, true );
+
+   test_ = "Carry-over of the thread limit and the serial section";
+
+   BLAZE_THREAD_LIMIT( 3UL ) {
+      BLAZE_SERIAL_SECTION {
+         blaze::evaluateAsync( blaze::map( d, probe ) ).get();
+      }
+   }
+   check( 3UL, true );
+
+   test_ = "Reset of the thread limit and the serial section";
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      blaze::evaluateAsync( blaze::map( d, probe ) ).get();
+      check( unlimited, false );
+   }
+}
+//*************************************************************************************************
+
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Test of the size of the launcher pool.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the launcher pool executing the asynchronous operations follows
+// the size of the thread pool after a call to setNumThreads(). For that purpose, as many
+// asynchronous operations as threads are started, which all wait for each other. In case
+// the launcher pool is too small, the operations give up waiting after ten seconds. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testLauncherSize()
+{
+   test_ = "Launcher pool following setNumThreads()";
+
+   using Clock = std::chrono::steady_clock;
+
+   const std::chrono::seconds timeout( 10 );
+   const size_t threads( blaze::getNumThreads() );
+   const size_t launches( 6UL );
+
+   const blaze::DynamicVector<int> d( 1UL, 1 );
+
+   // Creating the launcher pool with the initial number of threads
+   blaze::evaluateAsync( d ).get();
+
+   blaze::setNumThreads( launches );
+
+   std::atomic<size_t> started( 0UL );
+   std::atomic<bool> concurrent( true );
+
+   const auto barrier = [&]( int v ) {
+      ++started;
+      const Clock::time_point start( Clock::now() );
+      while( started < launches && Clock::now() - start < timeout ) {
+         std::this_thread::yield();
+      }
+      if( started < launches ) {
+         concurrent = false;
+      }
+      return v;
+   };
+
+   std::vector< std::future< blaze::DynamicVector<int> > > futures;
+
+   for( size_t i=0UL; i<launches; ++i ) {
+      futures.push_back( blaze::evaluateAsync( blaze::map( d, barrier ) ) );
+   }
+
+   for( auto& future : futures ) {
+      future.get();
+   }
+
+   blaze::setNumThreads( threads );
+
+   if( !concurrent ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Asynchronous operations not executed concurrently\n"
+          << " Details:\n"
+          << "   Number of threads: " << launches << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   // Shrinking the thread pool and with it the launcher pool
+   checkResult( blaze::evaluateAsync( d + d ).get(), blaze::DynamicVector<int>( 1UL, 2 ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested asynchronous operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a chain of nested asynchronous operations, each of which is started
+// and waited for from within the custom operation of the previous one, does not deadlock. The
+// nesting depth exceeds the number of threads of the launcher pool. Each operation gives up
+// waiting after ten seconds, such that a deadlock is detected instead of blocking the test. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testNestedLaunch()
+{
+   test_ = "Nested asynchronous operations";
+
+   const std::chrono::seconds timeout( 10 );
+   const size_t threads( blaze::getNumThreads() );
+   const size_t depth( 8UL );
+
+   blaze::setNumThreads( 1UL );
+
+   const blaze::DynamicVector<int> d( 1UL, 1 );
+   std::vector< blaze::DynamicVector<int> > results( depth );
+   std::atomic<size_t> completed( 0UL );
+   std::atomic<bool> deadlock( false );
+
+   std::function<int(size_t)> launch;
+
+   launch = [&]( size_t level ) -> int
+   {
+      if( level == depth )
+         return 1;
+
+      const auto nested = [&launch,&completed,level]( int ) {
+         const int value( launch( level+1UL ) );
+         ++completed;
+         return value;
+      };
+
+      std::future<void> future( blaze::asyncAssign( results[level], blaze::map( d, nested ) ) );
+
+      if( future.wait_for( timeout ) != std::future_status::ready ) {
+         deadlock = true;
+         return 0;
+      }
+
+      future.get();
+      return results[level][0] + 1;
+   };
+
+   const int result( launch( 0UL ) );
+
+   // Waiting for all nested operations in case of a deadlock
+   while( completed < depth ) {
+      std::this_thread::yield();
+   }
+
+   blaze::setNumThreads( threads );
+
+   if( deadlock ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Deadlock of nested asynchronous operations\n"
+          << " Details:\n"
+          << "   Nesting depth: " << depth << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( result != static_cast<int>( depth+1UL ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of nested asynchronous operations\n"
+          << " Details:\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << ( depth+1UL ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested asynchronous operations outliving the main() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function starts an asynchronous operation, whose custom operation in turn starts several
+// nested asynchronous operations without ever waiting for them. The nested operations are still
+// running after the last get() of the main() function. The check of their results is performed
+// after the end of the main() function (see OutlivingCheck), since all asynchronous operations
+// are required to be completed before the end of the program. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AsyncTest::testOutliveMain()
+{
+   test_ = "Nested asynchronous operations outliving main()";
+
+   const auto delayed = []( int v ) {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+      ++outlivingCompleted;
+      return v+1;
+   };
+
+   const auto nested = [delayed]( int v ) {
+      for( size_t i=0UL; i<outliving; ++i ) {
+         blaze::asyncAssign( outlivingResults[i], blaze::map( outlivingOperand, delayed ) );
+      }
+      return v;
+   };
+
+   const blaze::DynamicVector<int> d( 1UL, 1 );
+   blaze::DynamicVector<int> result;
+
+   blaze::asyncAssign( result, blaze::map( d, nested ) ).get();
+
+   checkResult( result, d );
+}
+//*************************************************************************************************
+#endif
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP asynchronous evaluation test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_ASYNC_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP asynchronous evaluation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,693 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/TaskGraphTest.cpp
+//  \brief Source file for the SMP task graph test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Row.h>
+#include <blaze/math/SMP.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/smp/TaskGraphTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initializes the given vector with test values.
+//
+// \param vec The vector to be initialized.
+// \param seed The seed of the test values.
+// \return void
+*/
+inline void initialize( blaze::DynamicVector<double>& vec, size_t seed )
+{
+   for( size_t i=0UL; i<vec.size(); ++i )
+      vec[i] = static_cast<double>( ( i*7UL + seed*3UL ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initializes the given matrix with test values.
+//
+// \param mat The matrix to be initialized.
+// \param seed The seed of the test values.
+// \return void
+*/
+inline void initialize( blaze::DynamicMatrix<double>& mat, size_t seed )
+{
+   for( size_t i=0UL; i<mat.rows(); ++i )
+      for( size_t j=0UL; j<mat.columns(); ++j )
+         mat(i,j) = static_cast<double>( ( i*7UL + j*3UL + seed ) % 11UL ) - 5.0;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskGraphTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TaskGraphTest::TaskGraphTest()
+   : test_()  // Label of the currently performed test
+{
+   testDependencies();
+   testViews();
+   testStages();
+   testPipeline();
+   testExceptions();
+   testMatrices();
+
+   {
+      size_t* const thresholds[] = {
+         &blaze::SMP_DVECASSIGN_THRESHOLD,
+         &blaze::SMP_DVECDVECADD_THRESHOLD,
+         &blaze::SMP_DVECDVECSUB_THRESHOLD,
+         &blaze::SMP_DVECDVECMULT_THRESHOLD,
+         &blaze::SMP_DVECSCALARMULT_THRESHOLD,
+         &blaze::SMP_DMATASSIGN_THRESHOLD,
+         &blaze::SMP_DMATDMATADD_THRESHOLD,
+         &blaze::SMP_DMATDVECMULT_THRESHOLD,
+         &blaze::SMP_DMATDMATMULT_THRESHOLD,
+         &blaze::SMP_DMATSCALARMULT_THRESHOLD
+      };
+
+      std::vector<size_t> defaults;
+
+      for( size_t* threshold : thresholds ) {
+         defaults.push_back( *threshold );
+         *threshold = 0UL;
+      }
+
+      testDependencies();
+      testViews();
+      testStages();
+      testPipeline();
+      testExceptions();
+      testMatrices();
+
+      for( size_t i=0UL; i<defaults.size(); ++i ) {
+         *thresholds[i] = defaults[i];
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the ordering of dependent assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that assignments reading a previously written vector (read after write),
+// writing a previously read vector (write after read), or writing a previously written vector
+// (write after write) are executed in a later stage, whereas independent assignments are
+// executed in the same stage. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void TaskGraphTest::testDependencies()
+{
+   const size_t n( 1009UL );
+
+   blaze::DynamicMatrix<double> A( n, n );
+   blaze::DynamicVector<double> x( n ), y( n ), z( n ), w( n );
+
+   initialize( A, 0UL );
+   initialize( x, 1UL );
+   initialize( z, 2UL );
+
+   test_ = "Read after write";
+
+   {
+      initialize( y, 3UL );
+      initialize( w, 4UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( y, A * x );
+      graph.assign( w, y * 2.0 );
+
+      checkStages( graph, 2UL, 2UL );
+
+      blaze::DynamicVector<double> yRef, wRef;
+      yRef = A * x;
+      wRef = yRef * 2.0;
+
+      graph.run();
+
+      checkResult( y, yRef );
+      checkResult( w, wRef );
+   }
+
+   test_ = "Write after read";
+
+   {
+      initialize( y, 3UL );
+      initialize( w, 4UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( w, y * 2.0 );
+      graph.assign( y, A * x );
+
+      checkStages( graph, 2UL, 2UL );
+
+      blaze::DynamicVector<double> yRef, wRef;
+      wRef = y * 2.0;
+      yRef = A * x;
+
+      graph.run();
+
+      checkResult( y, yRef );
+      checkResult( w, wRef );
+   }
+
+   test_ = "Write after write";
+
+   {
+      initialize( y, 3UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( y, A * x );
+      graph.assign( y, A * z );
+
+      checkStages( graph, 2UL, 2UL );
+
+      blaze::DynamicVector<double> yRef;
+      yRef = A * z;
+
+      graph.run();
+
+      checkResult( y, yRef );
+   }
+
+   test_ = "Write after write of element-wise assignments";
+
+   {
+      initialize( y, 3UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( y, x + z );
+      graph.assign( y, x - z );
+
+      checkStages( graph, 2UL, 1UL );
+
+      blaze::DynamicVector<double> yRef;
+      yRef = x - z;
+
+      graph.run();
+
+      checkResult( y, yRef );
+   }
+
+   test_ = "Independent assignments";
+
+   {
+      initialize( y, 3UL );
+      initialize( w, 4UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( y, A * x );
+      graph.assign( w, A * z );
+
+      checkStages( graph, 2UL, 1UL );
+
+      blaze::DynamicVector<double> yRef, wRef;
+      yRef = A * x;
+      wRef = A * z;
+
+      graph.run();
+
+      checkResult( y, yRef );
+      checkResult( w, wRef );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the dependencies of views.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that views resolve to the underlying vector or matrix, i.e. that writing
+// or reading two different views on the same vector or matrix results in a dependency. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testViews()
+{
+   const size_t n( 1009UL );
+   const size_t h( n / 2UL );
+
+   blaze::DynamicMatrix<double> A( n, n ), B( n, n );
+   blaze::DynamicVector<double> x( n ), y( n ), z( n ), w( n );
+
+   initialize( A, 0UL );
+   initialize( x, 1UL );
+   initialize( z, 2UL );
+
+   test_ = "Writing subvectors of the same vector";
+
+   {
+      initialize( y, 3UL );
+
+      auto head( blaze::subvector( y, 0UL, h ) );
+      auto tail( blaze::subvector( y, h, n-h ) );
+
+      blaze::TaskGraph graph;
+      graph.assign( head, blaze::subvector( x, 0UL, h ) * 2.0 );
+      graph.assign( tail, blaze::subvector( z, h, n-h ) * 3.0 );
+      graph.assign( w, y + x );
+
+      checkStages( graph, 3UL, 3UL );
+
+      blaze::DynamicVector<double> yRef( y ), wRef;
+      blaze::subvector( yRef, 0UL, h ) = blaze::subvector( x, 0UL, h ) * 2.0;
+      blaze::subvector( yRef, h, n-h ) = blaze::subvector( z, h, n-h ) * 3.0;
+      wRef = yRef + x;
+
+      graph.run();
+
+      checkResult( y, yRef );
+      checkResult( w, wRef );
+   }
+
+   test_ = "Reading a subvector of a written vector";
+
+   {
+      initialize( y, 3UL );
+
+      blaze::DynamicVector<double> v( h );
+
+      blaze::TaskGraph graph;
+      graph.assign( y, A * x );
+      graph.assign( v, blaze::subvector( y, h, h ) * 2.0 );
+
+      checkStages( graph, 2UL, 2UL );
+
+      blaze::DynamicVector<double> yRef, vRef;
+      yRef = A * x;
+      vRef = blaze::subvector( yRef, h, h ) * 2.0;
+
+      graph.run();
+
+      checkResult( y, yRef );
+      checkResult( v, vRef );
+   }
+
+   test_ = "Writing rows of the same matrix";
+
+   {
+      initialize( B, 5UL );
+
+      auto row0( blaze::row( B, 0UL ) );
+      auto row1( blaze::row( B, 1UL ) );
+      const blaze::DynamicVector<double,blaze::rowVector> xt( trans( x ) );
+      const blaze::DynamicVector<double,blaze::rowVector> zt( trans( z ) );
+
+      blaze::TaskGraph graph;
+      graph.assign( row0, xt );
+      graph.assign( row1, zt );
+      graph.assign( w, B * x );
+
+      checkStages( graph, 3UL, 3UL );
+
+      blaze::DynamicMatrix<double> BRef( B );
+      blaze::DynamicVector<double> wRef;
+      blaze::row( BRef, 0UL ) = xt;
+      blaze::row( BRef, 1UL ) = zt;
+      wRef = BRef * x;
+
+      graph.run();
+
+      checkResult( B, BRef );
+      checkResult( w, wRef );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the number of stages of the documented example.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the number of stages and the results of the example given in the
+// documentation of the TaskGraph class. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void TaskGraphTest::testStages()
+{
+   test_ = "Stages of the documented example";
+
+   const size_t n( 1009UL );
+
+   blaze::DynamicMatrix<double> A( n, n ), M( n, n );
+   blaze::DynamicVector<double> b( n ), x( n ), r( n ), z( n ), p( n ), t( n ), u( n );
+
+   initialize( A, 0UL );
+   initialize( M, 1UL );
+   initialize( b, 2UL );
+   initialize( x, 3UL );
+   initialize( p, 4UL );
+
+   blaze::TaskGraph graph;
+
+   graph.assign( r, b - A*x );
+   graph.assign( t, p * 2.0 );
+   graph.assign( z, M*r );
+   graph.assign( u, z + t );
+   graph.addAssign( u, z );
+
+   checkStages( graph, 5UL, 3UL );
+
+   blaze::DynamicVector<double> rRef, tRef, zRef, uRef;
+   rRef = b - A*x;
+   tRef = p * 2.0;
+   zRef = M*rRef;
+   uRef = zRef + tRef;
+   uRef += zRef;
+
+   graph.run();
+
+   checkResult( r, rRef );
+   checkResult( t, tRef );
+   checkResult( z, zRef );
+   checkResult( u, uRef );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the pipelined execution of element-wise chains.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests chains of element-wise dense vector assignments, both with targets of
+// matching size (which are pipelined with the C++11 and Boost thread parallelizations) and with
+// a target that has to be resized by the first execution (which are executed assignment by
+// assignment). In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testPipeline()
+{
+   const size_t n( 100003UL );
+
+   blaze::DynamicVector<double> a( n ), b( n ), c( n ), d( n ), e( n ), f( n );
+
+   initialize( b, 1UL );
+   initialize( c, 2UL );
+
+   test_ = "Pipelined chains";
+
+   {
+      initialize( a, 3UL );
+      initialize( d, 4UL );
+      initialize( e, 5UL );
+      initialize( f, 6UL );
+
+      blaze::TaskGraph graph;
+      graph.assign( a, b + c );
+      graph.addAssign( a, b * 2.0 );
+      graph.assign( d, a - c );
+      graph.subAssign( d, b * c );
+      graph.assign( e, d / 2.0 );
+      graph.assign( f, b - c );
+      graph.addAssign( f, c );
+
+      checkStages( graph, 7UL, 1UL );
+
+      for( size_t run=0UL; run<2UL; ++run )
+      {
+         b[run] += 1.0;
+         c[n-1UL-run] -= 1.0;
+
+         blaze::DynamicVector<double> aRef, dRef, eRef, fRef;
+         aRef = b + c;
+         aRef += b * 2.0;
+         dRef = aRef - c;
+         dRef -= b * c;
+         eRef = dRef / 2.0;
+         fRef = b - c;
+         fRef += c;
+
+         graph.run();
+
+         checkResult( a, aRef );
+         checkResult( d, dRef );
+         checkResult( e, eRef );
+         checkResult( f, fRef );
+      }
+   }
+
+   test_ = "Chain with a target to be resized";
+
+   {
+      initialize( a, 3UL );
+
+      blaze::DynamicVector<double> g;
+
+      blaze::TaskGraph graph;
+      graph.assign( a, b + c );
+      graph.assign( g, a * 2.0 );
+
+      checkStages( graph, 2UL, 1UL );
+
+      for( size_t run=0UL; run<2UL; ++run )
+      {
+         b[run] += 1.0;
+
+         blaze::DynamicVector<double> aRef, gRef;
+         aRef = b + c;
+         gRef = aRef * 2.0;
+
+         graph.run();
+
+         checkResult( a, aRef );
+         checkResult( g, gRef );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the propagation of exceptions out of the run() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that an exception thrown by an assignment of a task graph is rethrown by
+// the run() function, both in case the assignment is executed by the calling thread and in case
+// it is executed concurrently, and that the subsequent stages are not executed. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testExceptions()
+{
+   const size_t n( 1009UL );
+
+   blaze::DynamicVector<double> a( n ), b( n ), c( n ), w( 5UL );
+   blaze::DynamicMatrix<double> S( 3UL, 3UL );
+
+   initialize( b, 1UL );
+   initialize( c, 2UL );
+   initialize( w, 3UL );
+   initialize( S, 4UL );
+
+   test_ = "Exception of the first unit of a stage";
+
+   {
+      blaze::StaticVector<double,3UL> s( 0.0 );
+      blaze::DynamicVector<double> v( 3UL, 1.0 );
+
+      blaze::TaskGraph graph;
+      graph.assign( s, w );
+      graph.assign( a, b + c );
+      graph.assign( v, S * s );
+
+      checkStages( graph, 3UL, 2UL );
+      checkThrows<std::invalid_argument>( "Assignment to a vector of different size", graph );
+      checkResult( v, blaze::DynamicVector<double>( 3UL, 1.0 ) );
+   }
+
+   test_ = "Exception of a concurrent unit of a stage";
+
+   {
+      blaze::StaticVector<double,3UL> s( 0.0 );
+      blaze::DynamicVector<double> v( 3UL, 1.0 );
+
+      blaze::TaskGraph graph;
+      graph.assign( a, b + c );
+      graph.assign( s, w );
+      graph.assign( v, S * s );
+
+      checkStages( graph, 3UL, 2UL );
+      checkThrows<std::invalid_argument>( "Assignment to a vector of different size", graph );
+      checkResult( v, blaze::DynamicVector<double>( 3UL, 1.0 ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of task graphs of matrix assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests a task graph of dependent matrix and vector assignments, which is executed
+// twice with different values of its operands. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void TaskGraphTest::testMatrices()
+{
+   test_ = "Matrix assignments";
+
+   const size_t n( 67UL );
+
+   blaze::DynamicMatrix<double> A( n, n ), B( n, n ), C( n, n ), D( n, n ), E( n, n, 0.0 ), F;
+   blaze::DynamicVector<double> x( n ), y( n );
+
+   initialize( A, 0UL );
+   initialize( B, 1UL );
+   initialize( x, 2UL );
+
+   blaze::TaskGraph graph;
+   graph.assign( C, A * B );
+   graph.assign( D, A + B );
+   graph.addAssign( D, C );
+   graph.subAssign( E, D * 2.0 );
+   graph.assign( y, C * x );
+   graph.assign( F, trans( A ) );
+
+   checkStages( graph, 6UL, 3UL );
+
+   blaze::DynamicMatrix<double> ERef( n, n, 0.0 );
+
+   for( size_t run=0UL; run<2UL; ++run )
+   {
+      A(run,run) += 1.0;
+
+      blaze::DynamicMatrix<double> CRef, DRef, FRef;
+      blaze::DynamicVector<double> yRef;
+      CRef = A * B;
+      DRef = A + B;
+      DRef += CRef;
+      ERef -= DRef * 2.0;
+      yRef = CRef * x;
+      FRef = trans( A );
+
+      graph.run();
+
+      checkResult( C, CRef );
+      checkResult( D, DRef );
+      checkResult( E, ERef );
+      checkResult( y, yRef );
+      checkResult( F, FRef );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP task graph test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_TASKGRAPH_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP task graph test:\n" << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,451 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/ThreadLimitTest.cpp
+//  \brief Source file for the SMP thread limit test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SMP.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blazetest/mathtest/smp/ThreadLimitTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ThreadLimitTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ThreadLimitTest::ThreadLimitTest()
+   : threads_( blaze::getNumThreads() )  // The number of threads without thread limit
+   , test_   ()                          // Label of the currently performed test
+{
+   testNestedLimits();
+   testInvalidLimit();
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t threads( threads_ );
+
+   blaze::setNumThreads( 4UL );
+   threads_ = 4UL;
+
+   testConcurrentCallers();
+   testIndependentWaits();
+
+   blaze::setNumThreads( threads );
+   threads_ = threads;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of nested thread limits.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that nested thread limits can only narrow, but never widen the number
+// of threads, that the previous limit is restored at the end of each section, and that the
+// parallel operations within a thread limit produce the correct results. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testNestedLimits()
+{
+   test_ = "Nested thread limits";
+
+   checkLimit( std::numeric_limits<size_t>::max() );
+
+   BLAZE_THREAD_LIMIT( 3UL )
+   {
+      checkLimit( 3UL );
+
+      BLAZE_THREAD_LIMIT( 5UL )
+      {
+         checkLimit( 3UL );
+      }
+
+      checkLimit( 3UL );
+
+      BLAZE_THREAD_LIMIT( 2UL )
+      {
+         checkLimit( 2UL );
+
+         BLAZE_THREAD_LIMIT( 1UL )
+         {
+            checkLimit( 1UL );
+
+            blaze::DynamicVector<int> a( 1000UL, 1 ), b( 1000UL, 2 ), c;
+            c = a + b;
+
+            if( c != blaze::DynamicVector<int>( 1000UL, 3 ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: Invalid result of a limited operation\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+
+         checkLimit( 2UL );
+      }
+
+      checkLimit( 3UL );
+   }
+
+   checkLimit( std::numeric_limits<size_t>::max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rejection of a thread limit of 0.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a thread limit of 0 results in a \a std::invalid_argument exception,
+// both outside and within another thread limit, and that the active thread limit remains
+// unchanged. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testInvalidLimit()
+{
+   test_ = "Invalid thread limit";
+
+   const size_t zero( 0UL );
+
+   for( size_t outer : { std::numeric_limits<size_t>::max(), 2UL } )
+   {
+      BLAZE_THREAD_LIMIT( outer )
+      {
+         bool thrown( false );
+
+         try {
+            BLAZE_THREAD_LIMIT( zero ) {
+               checkLimit( zero );
+            }
+         }
+         catch( std::invalid_argument& ) {
+            thrown = true;
+         }
+
+         if( !thrown ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Thread limit of 0 succeeded\n";
+            throw std::runtime_error( oss.str() );
+         }
+
+         checkLimit( outer );
+      }
+   }
+
+   checkLimit( std::numeric_limits<size_t>::max() );
+}
+//*************************************************************************************************
+
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+//*************************************************************************************************
+/*!\brief Test of the concurrent execution of parallel operations by two application threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests two application threads that concurrently execute parallel operations
+// via the shared thread pool, each with its own task group and its own thread limit. Every
+// thread checks that its thread limit is not affected by the other thread and that all of its
+// results are correct. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ThreadLimitTest::testConcurrentCallers()
+{
+   test_ = "Concurrent callers";
+
+   const size_t assignThreshold( blaze::SMP_DVECASSIGN_THRESHOLD );
+   const size_t addThreshold   ( blaze::SMP_DVECDVECADD_THRESHOLD );
+   const size_t multThreshold  ( blaze::SMP_DVECSCALARMULT_THRESHOLD );
+
+   blaze::SMP_DVECASSIGN_THRESHOLD     = 0UL;
+   blaze::SMP_DVECDVECADD_THRESHOLD    = 0UL;
+   blaze::SMP_DVECSCALARMULT_THRESHOLD = 0UL;
+
+   std::vector<std::string> errors( 2UL );
+
+   const auto caller = [this,&errors]( size_t id, size_t limit )
+   {
+      try {
+         BLAZE_THREAD_LIMIT( limit )
+         {
+            if( blaze::getThreadLimit() != limit ||
+                blaze::getNumThreads() != blaze::min( threads_, limit ) ) {
+               throw std::runtime_error( "Thread limit affected by the concurrent caller" );
+            }
+
+            for( size_t rep=0UL; rep<100UL; ++rep )
+            {
+               const size_t n( 1000UL + 37UL*rep + id );
+
+               blaze::DynamicVector<int> a( n ), b( n ), c;
+
+               for( size_t i=0UL; i<n; ++i ) {
+                  a[i] = static_cast<int>( i % 13UL + id );
+                  b[i] = static_cast<int>( i % 7UL );
+               }
+
+               c = a + 2 * b;
+
+               for( size_t i=0UL; i<n; ++i ) {
+                  if( c[i] != a[i] + 2 * b[i] ) {
+                     throw std::runtime_error( "Invalid result of a concurrent operation" );
+                  }
+               }
+            }
+         }
+      }
+      catch( std::exception& ex ) {
+         errors[id] = ex.what();
+      }
+   };
+
+   std::thread first ( caller, 0UL, 1UL );
+   std::thread second( caller, 1UL, 3UL );
+
+   first.join();
+   second.join();
+
+   blaze::SMP_DVECASSIGN_THRESHOLD     = assignThreshold;
+   blaze::SMP_DVECDVECADD_THRESHOLD    = addThreshold;
+   blaze::SMP_DVECSCALARMULT_THRESHOLD = multThreshold;
+
+   for( size_t id=0UL; id<errors.size(); ++id ) {
+      if( !errors[id].empty() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << errors[id] << "\n"
+             << " Details:\n"
+             << "   Calling thread: " << id << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   checkLimit( std::numeric_limits<size_t>::max() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the independent waits of concurrent callers.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that a parallel operation of the calling thread completes while a task
+// of another application thread is still blocked, i.e. that every calling thread only waits for
+// the tasks of its own task group. The blocked task releases itself after ten seconds, such
+// that an erroneous wait for the blocked task is detected instead of resulting in a deadlock.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ThreadLimitTest::testIndependentWaits()
+{
+   test_ = "Independent waits of concurrent callers";
+
+   using Clock = std::chrono::steady_clock;
+
+   const std::chrono::seconds timeout( 10 );
+
+   const size_t assignThreshold( blaze::SMP_DVECASSIGN_THRESHOLD );
+   const size_t addThreshold   ( blaze::SMP_DVECDVECADD_THRESHOLD );
+
+   blaze::SMP_DVECASSIGN_THRESHOLD  = 0UL;
+   blaze::SMP_DVECDVECADD_THRESHOLD = 0UL;
+
+   std::atomic<bool> started( false ), release( false ), finished( false );
+
+   std::thread other( [&]()
+   {
+      blaze::TheThreadBackend::schedule( [&]()
+      {
+         started = true;
+         const Clock::time_point start( Clock::now() );
+         while( !release && Clock::now() - start < timeout ) {
+            std::this_thread::yield();
+         }
+         finished = true;
+      } );
+
+      blaze::TheThreadBackend::wait();
+   } );
+
+   while( !started ) {
+      std::this_thread::yield();
+   }
+
+   blaze::DynamicVector<int> a( 10000UL, 1 ), b( 10000UL, 2 ), c;
+
+   c = a + b;
+
+   const bool waited( finished );
+
+   release = true;
+   other.join();
+
+   blaze::SMP_DVECASSIGN_THRESHOLD  = assignThreshold;
+   blaze::SMP_DVECDVECADD_THRESHOLD = addThreshold;
+
+   if( waited ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Operation waited for the task of another thread\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( c != blaze::DynamicVector<int>( 10000UL, 3 ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result of a concurrent operation\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+#endif
+
+
+//*************************************************************************************************
+/*!\brief Checking the active thread limit.
+//
+// \param limit The expected thread limit.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the thread limit returned by getThreadLimit() and, in case of the C++11
+// and Boost thread parallelizations, the number of threads returned by getNumThreads().
+*/
+void ThreadLimitTest::checkLimit( size_t limit ) const
+{
+   const size_t active( blaze::getThreadLimit() );
+
+   if( active != limit ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid thread limit\n"
+          << " Details:\n"
+          << "   Thread limit          : " << active << "\n"
+          << "   Expected thread limit : " << limit << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const size_t threads( blaze::getNumThreads() );
+
+   if( threads != blaze::min( threads_, limit ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of threads\n"
+          << " Details:\n"
+          << "   Number of threads          : " << threads << "\n"
+          << "   Expected number of threads : " << blaze::min( threads_, limit ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running SMP thread limit test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_THREADLIMIT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during SMP thread limit test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,388 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/IntersectionTest.cpp
+//  \brief Source file for the sparse index intersection test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedSoAMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/PatternMatrix.h>
+#include <blaze/math/sparse/Intersection.h>
+#include <blazetest/mathtest/sparsematrix/IntersectionTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the IntersectionTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+IntersectionTest::IntersectionTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   const size_t N( 2000UL );
+
+   const blaze::CompressedVector<int> dense( createVector( N, 0UL, N, 1UL ) );
+
+   testVectors( "Sparse and dense vector", createVector( N, 3UL, N, 97UL ), dense );
+   testVectors( "Disjoint indices", createVector( N, 1UL, N, 98UL ),
+                createVector( N, 0UL, N, 2UL ) );
+   testVectors( "Sparse indices behind the dense range", createVector( N, 600UL, N, 50UL ),
+                createVector( N, 0UL, 500UL, 1UL ) );
+   testVectors( "Sparse indices in front of the dense range", createVector( N, 0UL, 300UL, 30UL ),
+                createVector( N, 250UL, N, 1UL ) );
+   testVectors( "Density ratio of eight", createVector( N, 0UL, 800UL, 80UL ),
+                createVector( N, 0UL, 80UL, 1UL ) );
+   testVectors( "Density ratio above eight", createVector( N, 0UL, 810UL, 80UL ),
+                createVector( N, 0UL, 81UL, 1UL ) );
+   testVectors( "Empty vector", blaze::CompressedVector<int>( N ), dense );
+
+   testSchur<rowMajor,rowMajor>();
+   testSchur<rowMajor,columnMajor>();
+   testSchur<columnMajor,rowMajor>();
+   testSchur<columnMajor,columnMajor>();
+
+   testContiguousIndices();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the intersection based operations on two sparse vectors.
+//
+// \param label The label of the pair of operands.
+// \param a The first sparse operand.
+// \param b The second sparse operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the nextCommonIndex() function, the inner product and the element-wise
+// product of the two given sparse vectors in both orders of the operands. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void IntersectionTest::testVectors( const std::string& label, const blaze::CompressedVector<int>& a,
+                                    const blaze::CompressedVector<int>& b )
+{
+   using blaze::trans;
+
+   const blaze::DynamicVector<int> da( a ), db( b );
+   const blaze::DynamicVector<int> ref( da * db );
+
+   for( size_t swap=0UL; swap<2UL; ++swap )
+   {
+      const blaze::CompressedVector<int>& lhs( swap ? b : a );
+      const blaze::CompressedVector<int>& rhs( swap ? a : b );
+      const std::string order( swap ? " (swapped)" : "" );
+
+      {
+         test_ = label + ": nextCommonIndex()" + order;
+
+         blaze::CompressedVector<int> c( lhs.size(), lhs.nonZeros() );
+
+         auto l( lhs.begin() );
+         auto r( rhs.begin() );
+
+         while( blaze::nextCommonIndex( l, lhs.end(), r, rhs.end() ) ) {
+            if( l->index() != r->index() ) {
+               throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid common index\n" );
+            }
+            c.append( l->index(), l->value() * r->value() );
+            ++l;
+            ++r;
+         }
+
+         checkResult( c, ref );
+      }
+
+      {
+         test_ = label + ": inner product" + order;
+
+         checkResult( trans( lhs ) * rhs, trans( da ) * db );
+      }
+
+      {
+         test_ = label + ": element-wise product" + order;
+
+         const blaze::CompressedVector<int> c( lhs * rhs );
+
+         checkResult( c, ref );
+         checkResult( c.nonZeros(), blaze::nonZeros( ref ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the Schur product of two sparse matrices with strongly differing densities.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the Schur product of a sparse matrix with a completely filled sparse
+// matrix for the given combination of storage orders and for sparse and dense targets. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO1    // Storage order of the sparse operand
+        , bool SO2 >  // Storage order of the filled operand
+void IntersectionTest::testSchur()
+{
+   const std::string orders( std::string( SO1 ? "column-major" : "row-major" ) + "/" +
+                             std::string( SO2 ? "column-major" : "row-major" ) );
+
+   const blaze::CompressedMatrix<int,SO1> A( createMatrix<SO1>( 40UL, 1000UL, 64UL ) );
+   const blaze::CompressedMatrix<int,SO2> B( createMatrix<SO2>( 40UL, 1000UL, 1UL ) );
+
+   const blaze::DynamicMatrix<int> ref( blaze::DynamicMatrix<int>( A ) %
+                                        blaze::DynamicMatrix<int>( B ) );
+
+   {
+      test_ = "Schur product (" + orders + ", sparse target)";
+
+      const blaze::CompressedMatrix<int,SO1> C1( A % B );
+      const blaze::CompressedMatrix<int,SO1> C2( B % A );
+
+      checkResult( C1, ref );
+      checkResult( C2, ref );
+      checkResult( C1.nonZeros(), A.nonZeros() );
+   }
+
+   {
+      test_ = "Schur product (" + orders + ", dense target)";
+
+      const blaze::DynamicMatrix<int,SO2> C1( A % B );
+      const blaze::DynamicMatrix<int,SO2> C2( B % A );
+
+      checkResult( C1, ref );
+      checkResult( C2, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the intersection of sparse operands with contiguous 32-bit indices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the SIMD block comparison of the nextCommonIndex() function for the rows
+// of CompressedSoAMatrix and PatternMatrix instances with a 32-bit index type. The operands have
+// comparable densities and differently shifted patterns, such that common indices occur at all
+// positions within the compared blocks. Rows with fewer than four elements, which are shorter
+// than a single block, are tested as well. Additionally, the Schur product of two
+// CompressedSoAMatrix instances is tested. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void IntersectionTest::testContiguousIndices()
+{
+   using blaze::rowMajor;
+
+   using MatrixType        = blaze::CompressedMatrix<int,rowMajor>;
+   using SoAMatrixType     = blaze::CompressedSoAMatrix<int,rowMajor,uint32_t>;
+   using PatternMatrixType = blaze::PatternMatrix<int,rowMajor,uint32_t>;
+
+   static_assert( blaze::HasSIMDIndices< SoAMatrixType::ConstIterator >::value,
+                  "CompressedSoAMatrix iterator without contiguous indices detected" );
+   static_assert( blaze::HasSIMDIndices< PatternMatrixType::ConstIterator >::value,
+                  "PatternMatrix iterator without contiguous indices detected" );
+   static_assert( !blaze::HasSIMDIndices< blaze::CompressedMatrix<int>::ConstIterator >::value,
+                  "CompressedMatrix iterator with contiguous indices detected" );
+
+   const size_t strides[][2] = { { 1UL, 1UL }, { 1UL, 3UL }, { 2UL, 3UL }, { 3UL, 5UL },
+                                 { 4UL, 4UL }, { 5UL, 7UL }, { 7UL, 2UL }, { 9UL, 11UL } };
+
+   for( const auto& stride : strides )
+   {
+      const std::string label( "Strides " + std::to_string( stride[0] ) + " and " +
+                               std::to_string( stride[1] ) );
+
+      const MatrixType A( createMatrix<rowMajor>( 12UL, 1000UL, stride[0] ) );
+      const MatrixType B( createMatrix<rowMajor>( 12UL, 1000UL, stride[1] ) );
+
+      testRows( label + ", CompressedSoAMatrix", SoAMatrixType( A ), SoAMatrixType( B ) );
+      testRows( label + ", PatternMatrix", PatternMatrixType( A ), PatternMatrixType( B ) );
+
+      {
+         test_ = label + ", Schur product of CompressedSoAMatrix";
+
+         const SoAMatrixType SA( A ), SB( B );
+         const blaze::CompressedMatrix<int,rowMajor,uint32_t> C( SA % SB );
+
+         checkResult( C, blaze::DynamicMatrix<int>( A ) % blaze::DynamicMatrix<int>( B ) );
+      }
+   }
+
+   {
+      const std::string label( "Rows with 0 to 5 elements" );
+
+      MatrixType A( 6UL, 20UL ), B( 6UL, 20UL );
+
+      for( size_t i=0UL; i<6UL; ++i ) {
+         for( size_t k=0UL; k<i; ++k ) {
+            A(i,3UL*k) = 1;
+            B(i,2UL*k+i%2UL) = 1;
+         }
+      }
+
+      testRows( label + ", CompressedSoAMatrix", SoAMatrixType( A ), SoAMatrixType( B ) );
+      testRows( label + ", PatternMatrix", PatternMatrixType( A ), PatternMatrixType( B ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the nextCommonIndex() function on all pairs of rows of two sparse matrices.
+//
+// \param label The label of the pair of operands.
+// \param A The first sparse operand.
+// \param B The second sparse operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function determines all common indices of each row of \a A with each row of \a B via
+// the nextCommonIndex() function and compares them to the result of std::set_intersection().
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT >  // Type of the sparse matrices
+void IntersectionTest::testRows( const std::string& label, const MT& A, const MT& B )
+{
+   test_ = label + ": nextCommonIndex()";
+
+   for( size_t i=0UL; i<A.rows(); ++i ) {
+      for( size_t j=0UL; j<B.rows(); ++j )
+      {
+         std::vector<size_t> result, ref;
+
+         std::set_intersection( A.indices( i ), A.indices( i ) + A.nonZeros( i ),
+                                B.indices( j ), B.indices( j ) + B.nonZeros( j ),
+                                std::back_inserter( ref ) );
+
+         auto l( A.begin( i ) );
+         auto r( B.begin( j ) );
+
+         while( blaze::nextCommonIndex( l, A.end( i ), r, B.end( j ) ) ) {
+            if( l->index() != r->index() ) {
+               throw std::runtime_error( " Test: " + test_ + "\n Error: Invalid common index\n" );
+            }
+            result.push_back( l->index() );
+            ++l;
+            ++r;
+         }
+
+         if( result != ref ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid common indices\n"
+                << " Details:\n"
+                << "   Rows: " << i << " and " << j << "\n"
+                << "   Number of common indices: " << result.size() << "\n"
+                << "   Expected number of common indices: " << ref.size() << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse index intersection test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_INTERSECTION_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse index intersection test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
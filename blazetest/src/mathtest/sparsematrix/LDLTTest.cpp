@@ -0,0 +1,433 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/LDLTTest.cpp
+//  \brief Source file for the sparse LDLT decomposition test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/sparse/LDLT.h>
+#include <blaze/math/sparse/Ordering.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blazetest/mathtest/sparsematrix/LDLTTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the LDLTTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+LDLTTest::LDLTTest()
+{
+   testMinimumDegree();
+   testFactorization();
+   testRefactorization();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the \c minimumDegree() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the minimum degree ordering for an arrowhead matrix, whose
+// dense row and column must not be eliminated before the remaining leaves, and for a Laplace
+// matrix, whose fill-in must be smaller than for the natural ordering. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void LDLTTest::testMinimumDegree()
+{
+   test_ = "minimumDegree()";
+
+   const size_t n( 8UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,0UL) = 1.0;
+      A(0UL,i) = 1.0;
+      A(i,i  ) = 8.0;
+   }
+
+   const std::vector<size_t> perm( blaze::minimumDegree( A ) );
+
+   if( perm.size() != n || perm[n-1UL] * perm[n-2UL] != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid minimum degree ordering of arrowhead matrix\n"
+          << " Details:\n"
+          << "   Last eliminated rows: " << perm[n-2UL] << ", " << perm[n-1UL] << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   const blaze::SparseLDLT<double> ldlt( A );
+
+   if( ldlt.nonZeros() != 2UL*n-1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fill-in detected for arrowhead matrix\n"
+          << " Details:\n"
+          << "   Number of non-zeros of L: " << ldlt.nonZeros() << "\n"
+          << "   Expected number         : " << 2UL*n-1UL << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   test_ = "minimumDegree() (two-dimensional Laplace matrix)";
+
+   const size_t g( 30UL );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> L( g*g, g*g );
+
+   for( size_t i=0UL; i<g; ++i ) {
+      for( size_t j=0UL; j<g; ++j ) {
+         const size_t k( i*g+j );
+         L(k,k) = 4.0;
+         if( i > 0UL ) { L(k,k-g) = -1.0; L(k-g,k) = -1.0; }
+         if( j > 0UL ) { L(k,k-1) = -1.0; L(k-1,k) = -1.0; }
+      }
+   }
+
+   const std::vector<size_t> amd( blaze::minimumDegree( L ) );
+
+   if( blaze::inversePermutation( amd ).size() != g*g ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation size\n"
+          << " Details:\n"
+          << "   Size: " << amd.size() << " (expected " << g*g << ")\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::vector<size_t> natural( g*g );
+   for( size_t k=0UL; k<g*g; ++k ) {
+      natural[k] = k;
+   }
+
+   blaze::SparseLDLT<double> ldlt1, ldlt2;
+   ldlt1.analyze( L, amd );
+   ldlt2.analyze( L, natural );
+
+   if( 2UL*ldlt1.nonZeros() > ldlt2.nonZeros() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Insufficient fill reduction\n"
+          << " Details:\n"
+          << "   Number of non-zeros of L (minimum degree): " << ldlt1.nonZeros() << "\n"
+          << "   Number of non-zeros of L (natural)       : " << ldlt2.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the numeric factorization and the solution of linear systems.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the SparseLDLT class template for a two-dimensional Laplace
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LDLTTest::testFactorization()
+{
+   const size_t g( 6UL );
+   const size_t n( g*g );
+
+   blaze::CompressedMatrix<double,blaze::rowMajor> A( n, n );
+
+   for( size_t i=0UL; i<g; ++i ) {
+      for( size_t j=0UL; j<g; ++j ) {
+         const size_t k( i*g+j );
+         A(k,k) = 4.0;
+         if( i > 0UL ) { A(k,k-g) = -1.0; A(k-g,k) = -1.0; }
+         if( j > 0UL ) { A(k,k-1) = -1.0; A(k-1,k) = -1.0; }
+      }
+   }
+
+   blaze::DynamicVector<double> ref( n );
+   for( size_t k=0UL; k<n; ++k ) {
+      ref[k] = double( k % 7UL ) - 3.0;
+   }
+
+   const blaze::DynamicVector<double> b( A * ref );
+
+   {
+      test_ = "Row-major SymmetricMatrix LDLT decomposition";
+
+      const blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > S( A );
+      const blaze::SparseLDLT<double> ldlt( S );
+      blaze::DynamicVector<double> x;
+
+      ldlt.solve( x, b );
+      checkSolution( x, ref );
+
+      if( ldlt.supernodes() >= n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No supernodes detected\n"
+             << " Details:\n"
+             << "   Number of supernodes: " << ldlt.supernodes() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major LDLT decomposition";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> T( A );
+      const blaze::SparseLDLT<double> ldlt( T );
+      blaze::DynamicVector<double> x( b );
+
+      ldlt.solve( x, x );
+      checkSolution( x, ref );
+   }
+
+   {
+      test_ = "LDLT decomposition with large supernodes";
+
+      const size_t m( 100UL );
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> D( m+n, m+n );
+
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<m; ++j ) {
+            D(i,j) = ( i == j ) ? double( 2UL*m ) : 1.0 / double( 1UL + i + j );
+         }
+      }
+
+      for( size_t i=0UL; i<n; ++i ) {
+         for( auto element=A.begin(i); element!=A.end(i); ++element ) {
+            D(m+i,m+element->index()) = element->value();
+         }
+         D(m+i,i%m) = 1.0;
+         D(i%m,m+i) = 1.0;
+      }
+
+      blaze::DynamicVector<double> y( m+n );
+      for( size_t k=0UL; k<m+n; ++k ) {
+         y[k] = double( k % 5UL ) - 2.0;
+      }
+
+      const blaze::SparseLDLT<double> ldlt( D );
+      blaze::DynamicVector<double> x;
+
+      ldlt.solve( x, D * y );
+      checkSolution( x, y );
+
+      if( ldlt.supernodes() > m+n-64UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: No large supernode detected\n"
+             << " Details:\n"
+             << "   Number of supernodes: " << ldlt.supernodes() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "LDLT decomposition of quasi-definite matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> K{ { 4, 0,  1 },
+                                                               { 0, 3,  1 },
+                                                               { 1, 1, -2 } };
+      const blaze::DynamicVector<double> y{ 1, -2, 3 };
+      const blaze::SparseLDLT<double> ldlt( K );
+      blaze::DynamicVector<double> x;
+
+      ldlt.solve( x, K * y );
+      checkSolution( x, y );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of the symbolic analysis.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of repeated numeric factorizations based on a single symbolic
+// analysis. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void LDLTTest::testRefactorization()
+{
+   test_ = "LDLT refactorization";
+
+   blaze::SymmetricMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( 5UL );
+   A(0,0) = 4.0; A(1,1) = 5.0; A(2,2) = 6.0; A(3,3) = 7.0; A(4,4) = 8.0;
+   A(1,0) = 1.0; A(3,1) = 2.0; A(4,2) = 1.0; A(4,0) = 1.0;
+
+   const blaze::DynamicVector<double> ref{ 1, 2, -1, 0, 3 };
+
+   blaze::SparseLDLT<double> ldlt;
+   ldlt.analyze( A );
+
+   if( ldlt.isFactorized() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Numeric factorization detected after symbolic analysis\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   for( size_t i=1UL; i<4UL; ++i )
+   {
+      A *= double( i );
+
+      blaze::DynamicVector<double> x;
+
+      ldlt.factorize( A );
+      ldlt.solve( x, A * ref );
+      checkSolution( x, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the SparseLDLT class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that non-symmetric and singular matrices are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void LDLTTest::testErrors()
+{
+   {
+      test_ = "LDLT decomposition of non-symmetric matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A{ { 2, 1 },
+                                                               { 0, 2 } };
+
+      try {
+         const blaze::SparseLDLT<double> ldlt( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of non-symmetric matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "LDLT decomposition of singular matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A{ { 1, 1 },
+                                                               { 1, 1 } };
+
+      try {
+         const blaze::SparseLDLT<double> ldlt( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Decomposition of singular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "singular" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse LDLT decomposition test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_LDLT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse LDLT decomposition test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
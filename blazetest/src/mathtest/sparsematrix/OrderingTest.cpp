@@ -0,0 +1,309 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/OrderingTest.cpp
+//  \brief Source file for the sparse matrix ordering test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/sparse/Ordering.h>
+#include <blazetest/mathtest/sparsematrix/OrderingTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the OrderingTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+OrderingTest::OrderingTest()
+{
+   testRCM();
+   testPermuteMatrix();
+   testPermuteVector();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the \c rcm() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the reverse Cuthill-McKee ordering for a scrambled path
+// graph and a matrix with several connected components. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void OrderingTest::testRCM()
+{
+   {
+      test_ = "rcm() of scrambled path graph";
+
+      const size_t n( 10UL );
+      const std::vector<size_t> scramble{ 3, 7, 0, 9, 5, 1, 8, 2, 6, 4 };
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> A( n, n );
+
+      for( size_t k=0UL; k<n; ++k ) {
+         A(scramble[k],scramble[k]) = 2;
+         if( k > 0UL ) {
+            A(scramble[k],scramble[k-1UL]) = -1;
+            A(scramble[k-1UL],scramble[k]) = -1;
+         }
+      }
+
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> B( blaze::permute( A, perm ) );
+
+      if( bandwidth( A ) <= 1UL || bandwidth( B ) != 1UL || B.nonZeros() != A.nonZeros() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid bandwidth reduction\n"
+             << " Details:\n"
+             << "   Bandwidth of permuted matrix: " << bandwidth( B ) << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "rcm() of matrix with several connected components";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A{ { 1, 0, 0, 0, 1 },
+                                                            { 0, 1, 0, 0, 0 },
+                                                            { 0, 0, 1, 1, 0 },
+                                                            { 0, 0, 1, 1, 0 },
+                                                            { 1, 0, 0, 0, 1 } };
+
+      const std::vector<size_t> perm( blaze::rcm( A ) );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> B( blaze::permute( A, perm ) );
+
+      if( perm.size() != 5UL || bandwidth( B ) != 1UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid ordering of disconnected matrix\n"
+             << " Details:\n"
+             << "   Bandwidth of permuted matrix: " << bandwidth( B ) << " (expected 1)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c permute() functions for sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the symmetric and general permutation of row-major and
+// column-major sparse matrices. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void OrderingTest::testPermuteMatrix()
+{
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A{ { 1, 0, 2, 0 },
+                                                         { 0, 3, 0, 4 },
+                                                         { 5, 0, 6, 0 },
+                                                         { 0, 7, 0, 8 } };
+   const std::vector<size_t> perm{ 2, 0, 3, 1 };
+
+   {
+      test_ = "Row-major symmetric permute()";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> B( blaze::permute( A, perm ) );
+      const blaze::CompressedMatrix<int,blaze::rowMajor> ref{ { 6, 5, 0, 0 },
+                                                              { 2, 1, 0, 0 },
+                                                              { 0, 0, 8, 7 },
+                                                              { 0, 0, 4, 3 } };
+
+      if( B != ref || B.nonZeros() != 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation result\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Column-major general permute()";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( A );
+      const std::vector<size_t> columnPerm{ 3, 2, 1, 0 };
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> B( blaze::permute( T, perm, columnPerm ) );
+      const blaze::CompressedMatrix<int,blaze::columnMajor> ref{ { 0, 6, 0, 5 },
+                                                                 { 0, 2, 0, 1 },
+                                                                 { 8, 0, 7, 0 },
+                                                                 { 4, 0, 3, 0 } };
+
+      if( B != ref || B.nonZeros() != 8UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid permutation result\n"
+             << " Details:\n"
+             << "   Result:\n" << B << "\n"
+             << "   Expected result:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c permute() function for dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the permutation of dense vectors and of the inverse
+// permutation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void OrderingTest::testPermuteVector()
+{
+   test_ = "Dense vector permute()";
+
+   const blaze::DynamicVector<int> v{ 10, 11, 12, 13, 14 };
+   const std::vector<size_t> perm{ 4, 2, 0, 1, 3 };
+
+   const blaze::DynamicVector<int> w( blaze::permute( v, perm ) );
+   const blaze::DynamicVector<int> ref{ 14, 12, 10, 11, 13 };
+
+   if( w != ref || blaze::permute( w, blaze::inversePermutation( perm ) ) != v ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation result\n"
+          << " Details:\n"
+          << "   Result:\n" << w << "\n"
+          << "   Expected result:\n" << ref << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the permutation functions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that invalid permutations are rejected. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void OrderingTest::testErrors()
+{
+   test_ = "permute() with invalid permutation";
+
+   const blaze::DynamicVector<int> v{ 1, 2, 3 };
+
+   try {
+      blaze::permute( v, std::vector<size_t>{ 0, 2, 2 } );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid permutation accepted\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse matrix ordering test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_ORDERING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse matrix ordering test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,398 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/SemiringTest.cpp
+//  \brief Source file for the semiring sparse matrix product test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/sparse/Semiring.h>
+#include <blazetest/mathtest/sparsematrix/SemiringTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SemiringTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SemiringTest::SemiringTest()
+{
+   testPlusTimes();
+   testMinPlus();
+   testOrAnd();
+   testMasked();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the semiring products with the (+,*) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the semiring products with the (+,*) semiring to the conventional
+// sparse matrix products. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SemiringTest::testPlusTimes()
+{
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A{ { 1, 0, 2, 0 },
+                                                         { 0, 0, 0, 0 },
+                                                         { 3, 4, 0, 5 },
+                                                         { 0, 6, 0, 7 } };
+   const blaze::DynamicVector<int> x{ 1, -2, 3, 4 };
+
+   {
+      test_ = "Row-major mxv() with (+,*) semiring";
+
+      checkResult( blaze::mxv( A, x ), A * x );
+      checkResult( blaze::mxv( A, x, blaze::PlusTimes() ), A * x );
+   }
+
+   {
+      test_ = "Column-major mxv() with (+,*) semiring";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( A );
+
+      checkResult( blaze::mxv( T, x, blaze::PlusTimes() ), A * x );
+   }
+
+   {
+      test_ = "mxm() with (+,*) semiring";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( A );
+
+      checkResult( blaze::mxm( A, A ), A * A );
+      checkResult( blaze::mxm( T, A, blaze::PlusTimes() ), A * A );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring products with the (min,+) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs shortest path computations with the (min,+) semiring. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SemiringTest::testMinPlus()
+{
+   const double inf( std::numeric_limits<double>::infinity() );
+
+   // Replacing infinite distances for the comparison of the results
+   const auto unreachable = []( double d ){ return std::isinf( d ) ? -1.0 : d; };
+
+   // Transposed weighted adjacency matrix of the graph 0->1 (4), 0->2 (1), 2->1 (2), 1->3 (5)
+   const blaze::CompressedMatrix<double,blaze::rowMajor> W{ { 0, 0, 0, 0 },
+                                                            { 4, 0, 2, 0 },
+                                                            { 1, 0, 0, 0 },
+                                                            { 0, 5, 0, 0 } };
+
+   {
+      test_ = "Row-major mxv() with (min,+) semiring";
+
+      const blaze::DynamicVector<double> d{ 0, inf, inf, inf };
+      const blaze::DynamicVector<double> ref{ inf, 4, 1, inf };
+
+      checkResult( blaze::map( blaze::mxv( W, d, blaze::MinPlus() ), unreachable ),
+                   blaze::map( ref, unreachable ) );
+   }
+
+   {
+      test_ = "Column-major mxv() with (min,+) semiring";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> T( W );
+      const blaze::DynamicVector<double> d{ 0, 4, 1, inf };
+      const blaze::DynamicVector<double> ref{ inf, 3, 1, 9 };
+
+      checkResult( blaze::map( blaze::mxv( T, d, blaze::MinPlus() ), unreachable ),
+                   blaze::map( ref, unreachable ) );
+   }
+
+   {
+      test_ = "mxm() with (min,+) semiring";
+
+      // Shortest paths with exactly two edges
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref{ { 0, 0, 0, 0 },
+                                                                 { 3, 0, 0, 0 },
+                                                                 { 0, 0, 0, 0 },
+                                                                 { 9, 0, 7, 0 } };
+
+      checkResult( blaze::mxm( W, W, blaze::MinPlus() ), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the semiring products with the (or,and) semiring.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs breadth-first search steps with the (or,and) semiring. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SemiringTest::testOrAnd()
+{
+   // Transposed adjacency matrix of the path graph 0->1->2->3
+   blaze::CompressedMatrix<bool,blaze::rowMajor> G( 4UL, 4UL );
+   G(1,0) = true;
+   G(2,1) = true;
+   G(3,2) = true;
+
+   {
+      test_ = "mxv() with (or,and) semiring";
+
+      const blaze::DynamicVector<bool> frontier{ true, false, false, false };
+      const blaze::DynamicVector<bool> ref{ false, true, false, false };
+
+      checkResult( blaze::mxv( G, frontier, blaze::OrAnd() ), ref );
+   }
+
+   {
+      test_ = "mxm() with (or,and) semiring";
+
+      blaze::CompressedMatrix<bool,blaze::rowMajor> ref( 4UL, 4UL );
+      ref(2,0) = true;
+      ref(3,1) = true;
+
+      checkResult( blaze::mxm( G, G, blaze::OrAnd() ), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the masked semiring products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the masked and complement-masked semiring products to the filtered
+// results of the conventional sparse matrix product. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SemiringTest::testMasked()
+{
+   // Banded matrices of a size large enough to trigger the parallel execution
+   const size_t N( 60UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> A( N, N ), M( N, N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=( i < 3UL ? 0UL : i-3UL ); j<N && j<=i+2UL; ++j ) {
+         A(i,j) = int( ( i*7UL + j*3UL ) % 5UL ) - 2;
+      }
+      for( size_t j=i%4UL; j<N; j+=4UL ) {
+         M(i,j) = 1;
+      }
+   }
+
+   const blaze::DynamicMatrix<int,blaze::rowMajor> C( A * A );
+
+   {
+      test_ = "Masked mxm() with (+,*) semiring";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( N, N, 0 );
+      for( size_t i=0UL; i<N; ++i ) {
+         for( auto element=M.begin(i); element!=M.end(i); ++element ) {
+            ref(i,element->index()) = C(i,element->index());
+         }
+      }
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( A );
+
+      checkResult( blaze::mxm( A, A, M ), ref );
+      checkResult( blaze::mxm( T, T, M, blaze::PlusTimes() ), ref );
+      checkResult( blaze::mxm( A, A, blaze::trans( blaze::trans( M ) ) ), ref );
+   }
+
+   {
+      test_ = "Complement-masked mxm() with (+,*) semiring";
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> ref( C );
+      for( size_t i=0UL; i<N; ++i ) {
+         for( auto element=M.begin(i); element!=M.end(i); ++element ) {
+            ref(i,element->index()) = 0;
+         }
+      }
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( A );
+
+      checkResult( blaze::mxm( A, A, blaze::complement( M ) ), ref );
+      checkResult( blaze::mxm( T, A, blaze::complement( M ), blaze::PlusTimes() ), ref );
+   }
+
+   {
+      test_ = "Triangle counting with masked mxm()";
+
+      // Strictly lower adjacency matrix of two triangles sharing the edge 1-2
+      blaze::CompressedMatrix<int,blaze::rowMajor> L( 4UL, 4UL );
+      L(1,0) = 1;
+      L(2,0) = 1;
+      L(2,1) = 1;
+      L(3,1) = 1;
+      L(3,2) = 1;
+
+      const int triangles( blaze::sum( blaze::mxm( L, L, L ) ) );
+
+      if( triangles != 2 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid number of triangles\n"
+             << " Details:\n"
+             << "   Result:\n" << triangles << "\n"
+             << "   Expected result:\n2\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "Complement-masked mxm() with (or,and) semiring";
+
+      // Adjacency matrix of the path graph 0->1->2->3 with the additional edge 0->2
+      blaze::CompressedMatrix<bool,blaze::rowMajor> G( 4UL, 4UL );
+      G(0,1) = true;
+      G(0,2) = true;
+      G(1,2) = true;
+      G(2,3) = true;
+
+      blaze::CompressedMatrix<bool,blaze::rowMajor> ref( 4UL, 4UL );
+      ref(0,3) = true;
+      ref(1,3) = true;
+
+      checkResult( blaze::mxm( G, G, blaze::complement( G ), blaze::OrAnd() ), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the semiring products.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that operands with non-matching sizes are rejected. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void SemiringTest::testErrors()
+{
+   test_ = "mxv() with non-matching sizes";
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+   const blaze::DynamicVector<int> x( 3UL );
+
+   try {
+      blaze::mxv( A, x, blaze::PlusTimes() );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Semiring product with non-matching sizes succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running semiring sparse matrix product test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_SEMIRING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during semiring sparse matrix product test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,424 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/SolveTest.cpp
+//  \brief Source file for the sparse triangular solve test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/sparse/TriangularSolve.h>
+#include <blaze/math/UniLowerMatrix.h>
+#include <blazetest/mathtest/sparsematrix/SolveTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SolveTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SolveTest::SolveTest()
+{
+   testLevelSchedule();
+   testLowerSolve();
+   testUpperSolve();
+   testUniLowerSolve();
+   testMatrixSolve();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the LevelSchedule class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the level analysis of the LevelSchedule class. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolveTest::testLevelSchedule()
+{
+   test_ = "LevelSchedule";
+
+   // ( 2 0 0 0 0 )
+   // ( 1 4 0 0 0 )
+   // ( 0 0 1 0 0 )
+   // ( 0 2 0 2 0 )
+   // ( 1 0 3 0 4 )
+   blaze::CompressedMatrix<double,blaze::rowMajor> L{ { 2, 0, 0, 0, 0 },
+                                                      { 1, 4, 0, 0, 0 },
+                                                      { 0, 0, 1, 0, 0 },
+                                                      { 0, 2, 0, 2, 0 },
+                                                      { 1, 0, 3, 0, 4 } };
+
+   // Row-major lower matrix
+   {
+      const blaze::LevelSchedule schedule( L );
+
+      if( schedule.size() != 5UL || schedule.nonZeros() != 9UL || !schedule.isLower() ||
+          schedule.levels() != 3UL || schedule.size( 0UL ) != 2UL ||
+          schedule.size( 1UL ) != 2UL || schedule.size( 2UL ) != 1UL ||
+          schedule.begin( 0UL )[0] != 0UL || schedule.begin( 0UL )[1] != 2UL ||
+          schedule.begin( 1UL )[0] != 1UL || schedule.begin( 1UL )[1] != 4UL ||
+          schedule.begin( 2UL )[0] != 3UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid level schedule of row-major lower matrix\n"
+             << " Details:\n"
+             << "   Number of levels: " << schedule.levels() << " (expected 3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   // Column-major upper matrix
+   {
+      const blaze::CompressedMatrix<double,blaze::columnMajor> U( trans( L ) );
+      const blaze::LevelSchedule schedule( U );
+
+      if( schedule.size() != 5UL || schedule.isLower() || schedule.levels() != 3UL ||
+          schedule.size( 0UL ) != 2UL || schedule.size( 1UL ) != 2UL ||
+          schedule.size( 2UL ) != 1UL || schedule.begin( 2UL )[0] != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid level schedule of column-major upper matrix\n"
+             << " Details:\n"
+             << "   Number of levels: " << schedule.levels() << " (expected 3)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function for lower triangular sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function for lower triangular sparse
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolveTest::testLowerSolve()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> L{ { 2, 0, 0, 0, 0 },
+                                                            { 1, 4, 0, 0, 0 },
+                                                            { 0, 0, 1, 0, 0 },
+                                                            { 0, 2, 0, 2, 0 },
+                                                            { 1, 0, 3, 0, 4 } };
+   const blaze::DynamicVector<double> ref{ 1, 2, 3, 4, 5 };
+
+   {
+      test_ = "Row-major lower solve()";
+
+      const blaze::DynamicVector<double> b( L * ref );
+      blaze::DynamicVector<double> x;
+
+      solve( L, x, b );
+      checkSolution( x, ref );
+   }
+
+   {
+      test_ = "Row-major LowerMatrix solve()";
+
+      const blaze::LowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( L );
+      blaze::DynamicVector<double> x( A * ref );
+
+      solve( A, x, x );
+      checkSolution( x, ref );
+   }
+
+   {
+      test_ = "Column-major lower solve()";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A( L );
+      const blaze::DynamicVector<double> b( A * ref );
+      blaze::DynamicVector<double> x;
+
+      solve( A, x, b );
+      checkSolution( x, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function for upper triangular sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function for upper triangular sparse
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolveTest::testUpperSolve()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> U{ { 2, 1, 0, 0, 1 },
+                                                            { 0, 4, 0, 2, 0 },
+                                                            { 0, 0, 1, 0, 3 },
+                                                            { 0, 0, 0, 2, 0 },
+                                                            { 0, 0, 0, 0, 4 } };
+   const blaze::DynamicVector<double> ref{ 1, 2, 3, 4, 5 };
+
+   {
+      test_ = "Row-major upper solve()";
+
+      const blaze::DynamicVector<double> b( U * ref );
+      blaze::DynamicVector<double> x;
+
+      solve( U, x, b );
+      checkSolution( x, ref );
+   }
+
+   {
+      test_ = "Column-major upper solve()";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> A( U );
+      const blaze::LevelSchedule schedule( A );
+      const blaze::DynamicVector<double> b( A * ref );
+      blaze::DynamicVector<double> x;
+
+      solve( A, x, b, schedule );
+      checkSolution( x, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function for unilower sparse matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function for UniLowerMatrix adaptors, whose
+// unit diagonal is implied. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void SolveTest::testUniLowerSolve()
+{
+   test_ = "Row-major UniLowerMatrix solve()";
+
+   blaze::UniLowerMatrix< blaze::CompressedMatrix<double,blaze::rowMajor> > A( 4UL );
+   A(1,0) = 2.0;
+   A(2,1) = 1.0;
+   A(3,0) = 1.0;
+   A(3,2) = 3.0;
+
+   const blaze::DynamicVector<double> ref{ 1, -1, 2, 0 };
+   const blaze::DynamicVector<double> b( A * ref );
+   blaze::DynamicVector<double> x;
+
+   solve( A, x, b );
+   checkSolution( x, ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c solve() function for multiple right-hand sides.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c solve() function for dense matrix right-hand sides.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolveTest::testMatrixSolve()
+{
+   const blaze::CompressedMatrix<double,blaze::rowMajor> L{ { 2, 0, 0, 0, 0 },
+                                                            { 1, 4, 0, 0, 0 },
+                                                            { 0, 0, 1, 0, 0 },
+                                                            { 0, 2, 0, 2, 0 },
+                                                            { 1, 0, 3, 0, 4 } };
+   const blaze::DynamicMatrix<double,blaze::rowMajor> ref{ { 1,  2 },
+                                                           { 2, -1 },
+                                                           { 3,  0 },
+                                                           { 4,  1 },
+                                                           { 5, -2 } };
+
+   {
+      test_ = "Row-major lower solve() with row-major right-hand side";
+
+      const blaze::LevelSchedule schedule( L );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( L * ref );
+      blaze::DynamicMatrix<double,blaze::rowMajor> X;
+
+      solve( L, X, B, schedule );
+      checkSolution( X, ref );
+   }
+
+   {
+      test_ = "Row-major lower solve() with column-major right-hand side";
+
+      const blaze::DynamicMatrix<double,blaze::columnMajor> B( L * ref );
+      blaze::DynamicMatrix<double,blaze::columnMajor> X;
+
+      solve( L, X, B );
+      checkSolution( X, ref );
+   }
+
+   {
+      test_ = "Column-major upper solve() with row-major right-hand side";
+
+      const blaze::CompressedMatrix<double,blaze::columnMajor> U( trans( L ) );
+      const blaze::DynamicMatrix<double,blaze::rowMajor> B( U * ref );
+      blaze::DynamicMatrix<double,blaze::rowMajor> X;
+
+      solve( U, X, B );
+      checkSolution( X, ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the \c solve() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the \c solve() function rejects non-triangular and singular
+// matrices. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolveTest::testErrors()
+{
+   {
+      test_ = "solve() with non-triangular matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A{ { 2, 1 },
+                                                               { 1, 2 } };
+      const blaze::DynamicVector<double> b{ 1, 1 };
+      blaze::DynamicVector<double> x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a non-triangular system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "solve() with singular matrix";
+
+      const blaze::CompressedMatrix<double,blaze::rowMajor> A{ { 2, 0, 0 },
+                                                               { 1, 0, 0 },
+                                                               { 0, 1, 1 } };
+      const blaze::DynamicVector<double> b{ 1, 1, 1 };
+      blaze::DynamicVector<double> x;
+
+      try {
+         solve( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a singular system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::runtime_error& ex ) {
+         if( std::string( ex.what() ).find( "singular" ) == std::string::npos )
+            throw;
+      }
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running sparse triangular solve test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_SOLVE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during sparse triangular solve test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,428 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/sparsematrix/SymmetricMultTest.cpp
+//  \brief Source file for the half-storage symmetric sparse matrix multiplication test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blazetest/mathtest/sparsematrix/SymmetricMultTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace sparsematrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the SymmetricMultTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SymmetricMultTest::SymmetricMultTest()
+{
+   testLower();
+   testUpper();
+   testAdaptor();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with the lower triangle of a symmetric matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication with the lower triangle of a banded symmetric
+// matrix, which is large enough to trigger the parallel execution, to the multiplication with
+// the complete matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SymmetricMultTest::testLower()
+{
+   const size_t N( 120UL );
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> S( N, N );
+   blaze::CompressedMatrix<int,blaze::rowMajor> L( N, N );
+   blaze::DynamicVector<int> x( N );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      x[i] = int( i % 7UL ) - 3;
+      for( size_t j=( i < 40UL ? 0UL : i-40UL ); j<=i; j+=( j % 3UL ) + 1UL ) {
+         const int value( int( ( i*5UL + j*3UL ) % 9UL ) + 1 );
+         S(i,j) = value;
+         S(j,i) = value;
+         L(i,j) = value;
+      }
+   }
+
+   const blaze::DynamicVector<int> ref( S * x );
+
+   {
+      test_ = "Row-major lower symv()";
+
+      checkResult( blaze::symv( L, x ), ref );
+   }
+
+   {
+      test_ = "Column-major lower symv()";
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> T( L );
+      blaze::DynamicVector<int> y( 3UL );
+
+      blaze::symv( y, T, x );
+      checkResult( y, ref );
+   }
+
+   {
+      test_ = "LowerMatrix symv()";
+
+      const blaze::LowerMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > A( L );
+
+      checkResult( blaze::symv( A, x ), ref );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication with the upper triangle of a symmetric matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the multiplication with the upper triangle of a symmetric matrix to
+// the multiplication with the complete matrix, including a banded matrix with a few dense
+// columns that is large enough to trigger the parallel execution. In case an error is detected,
+// a \a std::runtime_error exception is thrown.
+*/
+void SymmetricMultTest::testUpper()
+{
+   const blaze::CompressedMatrix<int,blaze::rowMajor> S{ { 4, 1, 0, 2 },
+                                                         { 1, 0, 3, 0 },
+                                                         { 0, 3, 5, 0 },
+                                                         { 2, 0, 0, 6 } };
+   const blaze::CompressedMatrix<int,blaze::rowMajor> U{ { 4, 1, 0, 2 },
+                                                         { 0, 0, 3, 0 },
+                                                         { 0, 0, 5, 0 },
+                                                         { 0, 0, 0, 6 } };
+   const blaze::DynamicVector<int> x{ 1, -2, 3, 4 };
+
+   {
+      test_ = "Row-major upper symv()";
+
+      checkResult( blaze::symv( U, x ), S * x );
+   }
+
+   {
+      test_ = "UpperMatrix symv()";
+
+      const blaze::UpperMatrix< blaze::CompressedMatrix<int,blaze::columnMajor> > A( U );
+
+      checkResult( blaze::symv( A, x ), S * x );
+   }
+
+   {
+      test_ = "Row-major upper symv() (parallel execution)";
+
+      const size_t N( blaze::SMP_SMATDVECMULT_THRESHOLD + 77UL );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> S2( N, N );
+      blaze::CompressedMatrix<int,blaze::rowMajor> U2( N, N );
+      blaze::DynamicVector<int> x2( N );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         x2[i] = int( i % 5UL ) - 2;
+         for( size_t j=i; j<N && j<=i+25UL; j+=( j % 4UL ) + 1UL ) {
+            const int value( int( ( i*3UL + j*7UL ) % 11UL ) - 5 );
+            S2(i,j) = value;
+            S2(j,i) = value;
+            U2(i,j) = value;
+         }
+         if( i % 50UL == 0UL ) {
+            S2(i,N-1UL) = 1;
+            S2(N-1UL,i) = 1;
+            U2(i,N-1UL) = 1;
+         }
+      }
+
+      checkResult( blaze::symv( U2, x2 ), S2 * x2 );
+
+      const blaze::CompressedMatrix<int,blaze::columnMajor> L2( trans( U2 ) );
+
+      checkResult( blaze::symv( L2, x2 ), S2 * x2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the HalfSymmetricMatrix adaptor.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the multiplication of a HalfSymmetricMatrix and a dense vector
+// computes the product with the complete symmetric matrix, both for the serial and the parallel
+// execution. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SymmetricMultTest::testAdaptor()
+{
+   const blaze::CompressedMatrix<int,blaze::rowMajor> S{ { 4, 1, 0, 2 },
+                                                         { 1, 0, 3, 0 },
+                                                         { 0, 3, 5, 0 },
+                                                         { 2, 0, 0, 6 } };
+   const blaze::CompressedMatrix<int,blaze::rowMajor> L{ { 4, 0, 0, 0 },
+                                                         { 1, 0, 0, 0 },
+                                                         { 0, 3, 5, 0 },
+                                                         { 2, 0, 0, 6 } };
+   const blaze::DynamicVector<int> x{ 1, -2, 3, 4 };
+
+   {
+      test_ = "Row-major lower HalfSymmetricMatrix";
+
+      const blaze::HalfSymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > A( L );
+
+      checkResult( A * x, S * x );
+   }
+
+   {
+      test_ = "Column-major upper HalfSymmetricMatrix";
+
+      const blaze::HalfSymmetricMatrix< blaze::CompressedMatrix<int,blaze::columnMajor> > A( trans( L ) );
+
+      checkResult( A * x, S * x );
+   }
+
+   {
+      test_ = "LowerMatrix HalfSymmetricMatrix (parallel execution)";
+
+      const size_t N( blaze::SMP_SMATDVECMULT_THRESHOLD + 31UL );
+
+      blaze::CompressedMatrix<int,blaze::rowMajor> S2( N, N );
+      blaze::LowerMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > L2( N );
+      blaze::DynamicVector<int> x2( N );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         x2[i] = int( i % 5UL ) - 2;
+         for( size_t j=( i < 20UL ? 0UL : i-20UL ); j<=i; j+=( j % 3UL ) + 1UL ) {
+            const int value( int( ( i*7UL + j*3UL ) % 11UL ) - 5 );
+            S2(i,j) = value;
+            S2(j,i) = value;
+            L2(i,j) = value;
+         }
+      }
+
+      const blaze::HalfSymmetricMatrix< blaze::LowerMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > > A( L2 );
+
+      checkResult( A * x2, S2 * x2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the symmetric multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that non-square matrices, non-triangular matrices and non-matching
+// vectors are rejected, both by the symv() functions and the HalfSymmetricMatrix adaptor. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SymmetricMultTest::testErrors()
+{
+   const blaze::CompressedMatrix<int,blaze::rowMajor> S{ { 4, 1, 0 },
+                                                         { 1, 0, 3 },
+                                                         { 0, 3, 5 } };
+
+   {
+      test_ = "symv() with non-square matrix";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 4UL );
+      const blaze::DynamicVector<int> x( 4UL );
+
+      try {
+         blaze::symv( A, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric multiplication with non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "symv() with non-matching sizes";
+
+      const blaze::CompressedMatrix<int,blaze::rowMajor> A( 3UL, 3UL );
+      const blaze::DynamicVector<int> x( 4UL );
+
+      try {
+         blaze::symv( A, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric multiplication with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "symv() with non-triangular matrix";
+
+      const blaze::DynamicVector<int> x( 3UL );
+
+      try {
+         blaze::symv( S, x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric multiplication with non-triangular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "HalfSymmetricMatrix with non-triangular matrix";
+
+      try {
+         const blaze::HalfSymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > A( S );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with non-triangular matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "HalfSymmetricMatrix with non-square matrix";
+
+      try {
+         const blaze::HalfSymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > A(
+            blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 4UL ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Construction with non-square matrix succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "HalfSymmetricMatrix multiplication with non-matching sizes";
+
+      const blaze::HalfSymmetricMatrix< blaze::CompressedMatrix<int,blaze::rowMajor> > A(
+         blaze::CompressedMatrix<int,blaze::rowMajor>( 3UL, 3UL ) );
+      const blaze::DynamicVector<int> x( 4UL );
+
+      try {
+         const blaze::DynamicVector<int> y( A * x );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Symmetric multiplication with non-matching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+} // namespace sparsematrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running half-storage symmetric sparse matrix multiplication test..." << std::endl;
+
+   try
+   {
+      RUN_SPARSEMATRIX_SYMMETRICMULT_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during half-storage symmetric sparse matrix multiplication test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
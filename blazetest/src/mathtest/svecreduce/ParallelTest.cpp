@@ -0,0 +1,218 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/svecreduce/ParallelTest.cpp
+//  \brief Source file for the parallel sparse vector norm test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/HybridVector.h>
+#include <blaze/system/Thresholds.h>
+#include <blazetest/mathtest/svecreduce/ParallelTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace svecreduce {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ParallelTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ParallelTest::ParallelTest()
+   : sizes_()  // The number of non-zero elements of the test vectors
+   , mode_()   // Label of the currently used thresholds
+   , test_()   // Label of the currently performed test
+{
+   const size_t threshold( blaze::SMP_SPARSEREDUCE_THRESHOLD );
+
+   sizes_ = { 1UL, 2UL, 3UL, 5UL, 6UL, 7UL, 9UL, 13UL, 17UL, threshold + 7UL };
+
+   mode_ = "default thresholds";
+
+   testNorm();
+   testVectorElements();
+
+   mode_ = "enforced parallel evaluation";
+
+   blaze::SMP_SPARSEREDUCE_THRESHOLD = 0UL;
+
+   testNorm();
+   testVectorElements();
+
+   blaze::SMP_SPARSEREDUCE_THRESHOLD = threshold;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norms of a sparse vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests several norms of sparse vectors for numbers of non-zero elements that
+// are and that are not multiples of the number of threads. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testNorm()
+{
+   for( size_t nonzeros : sizes_ )
+   {
+      blaze::CompressedVector<double> a( 3UL*nonzeros, nonzeros );
+
+      double sqrSum( 0.0 ), absSum( 0.0 ), cubeSum( 0.0 ), maxAbs( 0.0 );
+
+      for( size_t i=0UL; i<nonzeros; ++i )
+      {
+         const double value( double( i % 9UL + 1UL ) * ( i % 2UL ? 1 : -1 ) );
+
+         a.append( 3UL*i+1UL, value );
+
+         sqrSum  += value*value;
+         absSum  += std::abs( value );
+         cubeSum += std::abs( value*value*value );
+         maxAbs   = std::max( maxAbs, std::abs( value ) );
+      }
+
+      test_ = "Norm (nonzeros=" + std::to_string( nonzeros ) + ")";
+
+      checkResult( blaze::sqrNorm( a ), sqrSum );
+      checkResult( blaze::norm( a ), std::sqrt( sqrSum ) );
+      checkResult( blaze::l1Norm( a ), absSum );
+      checkResult( blaze::l2Norm( a ), std::sqrt( sqrSum ) );
+      checkResult( blaze::l3Norm( a ), std::cbrt( cubeSum ) );
+      checkResult( blaze::maxNorm( a ), maxAbs );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel norms of a sparse vector with resizable vector elements.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the norms of sparse vectors, whose elements are resizable vectors. Since
+// default constructed vector elements cannot be combined with the non-empty partial results,
+// this test fails in case an empty block contributes to the result. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ParallelTest::testVectorElements()
+{
+   using ElementType = blaze::HybridVector<double,3UL>;
+
+   for( size_t nonzeros : sizes_ )
+   {
+      blaze::CompressedVector<ElementType> a( 2UL*nonzeros, nonzeros );
+
+      ElementType sqrSum( 3UL, 0.0 ), absSum( 3UL, 0.0 );
+
+      for( size_t i=0UL; i<nonzeros; ++i )
+      {
+         const ElementType value{ double( i % 7UL ), -1.0, double( i % 2UL ) - 2.0 };
+
+         a.append( 2UL*i, value );
+
+         sqrSum += value * value;
+         absSum += abs( value );
+      }
+
+      test_ = "Norm with vector elements (nonzeros=" + std::to_string( nonzeros ) + ")";
+
+      checkResult( blaze::sqrNorm( a ), sqrSum );
+      checkResult( blaze::l1Norm( a ), absSum );
+   }
+}
+//*************************************************************************************************
+
+} // namespace svecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running parallel sparse vector norm test..." << std::endl;
+
+   try
+   {
+      RUN_SVECREDUCE_PARALLEL_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during parallel sparse vector norm test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,490 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/thresholds/ClassTest.cpp
+//  \brief Source file for the runtime threshold test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <blaze/system/Debugging.h>
+#include <blazetest/mathtest/thresholds/ClassTest.h>
+
+#ifdef BLAZE_USE_HPX_THREADS
+#  include <hpx/hpx_main.hpp>
+#endif
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace thresholds {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ClassTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+   : test_()  // Label of the currently performed test
+{
+   std::istringstream initial( snapshot() );
+
+   testGetThreshold();
+   testSetThreshold();
+   testReset();
+   testLoadSave();
+   testMalformedInput();
+   testFiles();
+   testEnvironment();
+
+   blaze::loadThresholds( initial );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the getThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the query of thresholds by name, both with and without the \c BLAZE_
+// prefix of the according configuration macro. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testGetThreshold()
+{
+   test_ = "getThreshold()";
+
+   checkThreshold( "DMATDVECMULT_THRESHOLD", blaze::DMATDVECMULT_THRESHOLD );
+   checkThreshold( "BLAZE_DMATDVECMULT_THRESHOLD", blaze::DMATDVECMULT_THRESHOLD );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", blaze::SMP_DVECASSIGN_THRESHOLD );
+   checkThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", blaze::SMP_DVECASSIGN_THRESHOLD );
+   checkThreshold( "SMP_DMATREDUCE_THRESHOLD", blaze::SMP_DMATREDUCE_THRESHOLD );
+
+   checkThrows<std::invalid_argument>( "Query of an unknown threshold", [](){
+      blaze::getThreshold( "SMP_UNKNOWN_THRESHOLD" );
+   } );
+
+   checkThrows<std::invalid_argument>( "Query of a threshold without suffix", [](){
+      blaze::getThreshold( "SMP_DVECASSIGN" );
+   } );
+
+   checkThrows<std::invalid_argument>( "Query of a threshold with lowercase prefix", [](){
+      blaze::getThreshold( "blaze_SMP_DVECASSIGN_THRESHOLD" );
+   } );
+
+   checkThrows<std::invalid_argument>( "Query of a threshold with duplicate prefix", [](){
+      blaze::getThreshold( "BLAZE_BLAZE_SMP_DVECASSIGN_THRESHOLD" );
+   } );
+
+   checkThrows<std::invalid_argument>( "Query of the bare prefix", [](){
+      blaze::getThreshold( "BLAZE_" );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the setThreshold() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the change of thresholds by name, both with and without the \c BLAZE_
+// prefix, and the rejection of unknown thresholds and of values below the minimum of a
+// threshold. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testSetThreshold()
+{
+   test_ = "setThreshold()";
+
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 1234UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 1234UL );
+   checkThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 1234UL );
+
+   if( blaze::SMP_DVECASSIGN_THRESHOLD != 1234UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Threshold constant not updated\n"
+          << " Details:\n"
+          << "   Value            : " << blaze::SMP_DVECASSIGN_THRESHOLD << "\n"
+          << "   Expected value   : 1234\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   blaze::setThreshold( "BLAZE_SMP_DVECASSIGN_THRESHOLD", 4321UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 4321UL );
+
+   // All SMP thresholds accept 0, all kernel thresholds require a value of at least 1
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 0UL );
+
+   blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+   checkThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+
+   checkThrows<std::invalid_argument>( "Setting a kernel threshold to 0", [](){
+      blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 0UL );
+   } );
+   checkThreshold( "DMATDVECMULT_THRESHOLD", 1UL );
+
+   checkThrows<std::invalid_argument>( "Setting a prefixed kernel threshold to 0", [](){
+      blaze::setThreshold( "BLAZE_TSMATTDMATMULT_THRESHOLD", 0UL );
+   } );
+
+   const std::string before( snapshot() );
+
+   checkThrows<std::invalid_argument>( "Setting an unknown threshold", [](){
+      blaze::setThreshold( "SMP_UNKNOWN_THRESHOLD", 10UL );
+   } );
+
+   checkUnchanged( before );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resetThresholds() function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that resetThresholds() restores the compile time defaults of all
+// thresholds. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "resetThresholds()";
+
+   blaze::setThreshold( "DMATDVECMULT_THRESHOLD", 7UL );
+   blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 7UL );
+   blaze::setThreshold( "SMP_DMATREDUCE_THRESHOLD", 7UL );
+
+   blaze::resetThresholds();
+
+   const size_t kernelDefault( BLAZE_DEBUG_MODE ? blaze::DMATDVECMULT_DEBUG_THRESHOLD
+                                                : BLAZE_DMATDVECMULT_THRESHOLD );
+   const size_t assignDefault( BLAZE_DEBUG_MODE ? blaze::SMP_DVECASSIGN_DEBUG_THRESHOLD
+                                                : BLAZE_SMP_DVECASSIGN_THRESHOLD );
+   const size_t reduceDefault( BLAZE_DEBUG_MODE ? blaze::SMP_DMATREDUCE_DEBUG_THRESHOLD
+                                                : BLAZE_SMP_DMATREDUCE_THRESHOLD );
+
+   checkThreshold( "DMATDVECMULT_THRESHOLD", kernelDefault );
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", assignDefault );
+   checkThreshold( "SMP_DMATREDUCE_THRESHOLD", reduceDefault );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() and saveThresholds() functions for streams.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the round trip of all thresholds via saveThresholds() and
+// loadThresholds() and the supported syntax of threshold files, i.e. comments, empty lines,
+// the \c BLAZE_ prefix, and both the \c "NAME = VALUE" and the \c "NAME VALUE" form. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testLoadSave()
+{
+   test_ = "Round trip via saveThresholds() and loadThresholds()";
+
+   blaze::setThreshold( "DMATDMATMULT_THRESHOLD", 11UL );
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 0UL );
+   blaze::setThreshold( "SMP_DMATREDUCE_THRESHOLD", 99UL );
+
+   std::istringstream saved( snapshot() );
+
+   blaze::resetThresholds();
+   blaze::loadThresholds( saved );
+
+   checkThreshold( "DMATDMATMULT_THRESHOLD", 11UL );
+   checkThreshold( "SMP_DVECDVECADD_THRESHOLD", 0UL );
+   checkThreshold( "SMP_DMATREDUCE_THRESHOLD", 99UL );
+
+   test_ = "Syntax of threshold files";
+
+   blaze::resetThresholds();
+
+   const size_t smatdvec( blaze::SMP_SMATDVECMULT_THRESHOLD );
+
+   std::istringstream iss( "# Comment line\n"
+                           "\n"
+                           "   \t  \n"
+                           "SMP_DVECASSIGN_THRESHOLD = 100   # Trailing comment\n"
+                           "BLAZE_SMP_DVECDVECSUB_THRESHOLD=200\n"
+                           "  DMATDVECMULT_THRESHOLD 300\n"
+                           "BLAZE_TDMATDVECMULT_THRESHOLD\t= 400\n" );
+   blaze::loadThresholds( iss );
+
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 100UL );
+   checkThreshold( "SMP_DVECDVECSUB_THRESHOLD", 200UL );
+   checkThreshold( "DMATDVECMULT_THRESHOLD", 300UL );
+   checkThreshold( "TDMATDVECMULT_THRESHOLD", 400UL );
+   checkThreshold( "SMP_SMATDVECMULT_THRESHOLD", smatdvec );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the rejection of malformed threshold specifications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that loadThresholds() rejects malformed threshold specifications, unknown
+// thresholds, and values below the minimum of a threshold with a \a std::invalid_argument
+// exception, and that in all these cases none of the thresholds is changed, even if the
+// specification contains valid lines in front of the invalid one. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMalformedInput()
+{
+   const std::string invalid[] = {
+      "SMP_DVECASSIGN_THRESHOLD",                          // Missing value
+      "SMP_DVECASSIGN_THRESHOLD =",                        // Missing value
+      "= 100",                                             // Missing name
+      "SMP_DVECASSIGN_THRESHOLD = 12a",                    // Invalid number
+      "SMP_DVECASSIGN_THRESHOLD = -3",                     // Negative number
+      "SMP_DVECASSIGN_THRESHOLD = 1.5",                    // Floating point number
+      "SMP_DVECASSIGN_THRESHOLD = 1 2",                    // Trailing characters
+      "SMP_DVECASSIGN_THRESHOLD = 99999999999999999999999",  // Out of range
+      "SMP_UNKNOWN_THRESHOLD = 100",                       // Unknown threshold
+      "blaze_SMP_DVECASSIGN_THRESHOLD = 100",              // Invalid prefix
+      "DMATDVECMULT_THRESHOLD = 0",                        // Below the minimum
+      "BLAZE_DMATDMATMULT_THRESHOLD = 0"                   // Below the minimum
+   };
+
+   blaze::setThreshold( "SMP_DVECDVECADD_THRESHOLD", 77UL );
+
+   for( const std::string& line : invalid )
+   {
+      test_ = "Malformed threshold specification \"" + line + "\"";
+
+      const std::string before( snapshot() );
+
+      checkThrows<std::invalid_argument>( "Loading the specification", [&line](){
+         std::istringstream iss( "SMP_DVECDVECADD_THRESHOLD = 10\n"
+                                 "DMATDVECMULT_THRESHOLD = 10\n" + line + "\n"
+                                 "SMP_DVECDVECSUB_THRESHOLD = 10\n" );
+         blaze::loadThresholds( iss );
+      } );
+
+      checkUnchanged( before );
+      checkThreshold( "SMP_DVECDVECADD_THRESHOLD", 77UL );
+   }
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the loadThresholds() and saveThresholds() functions for files.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the round trip of all thresholds via a threshold file, the rejection of
+// a malformed file, and the failure to load a file that does not exist. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testFiles()
+{
+   const std::string filename( "ThresholdsClassTest.tmp" );
+
+   test_ = "Round trip via a threshold file";
+
+   blaze::setThreshold( "SMP_TDMATDVECMULT_THRESHOLD", 5UL );
+   blaze::saveThresholds( filename );
+   blaze::resetThresholds();
+   blaze::loadThresholds( filename );
+   checkThreshold( "SMP_TDMATDVECMULT_THRESHOLD", 5UL );
+
+   test_ = "Malformed threshold file";
+
+   {
+      std::ofstream file( filename );
+      file << "SMP_TDMATDVECMULT_THRESHOLD = 6\n"
+           << "SMP_DVECASSIGN_THRESHOLD = invalid\n";
+   }
+
+   const std::string before( snapshot() );
+
+   checkThrows<std::invalid_argument>( "Loading a malformed threshold file", [&filename](){
+      blaze::loadThresholds( filename );
+   } );
+
+   checkUnchanged( before );
+
+   std::remove( filename.c_str() );
+
+   test_ = "Missing threshold file";
+
+   checkThrows<std::runtime_error>( "Loading a missing threshold file", [&filename](){
+      blaze::loadThresholds( filename );
+   } );
+
+   checkUnchanged( before );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*!\brief Test of the initialization of the thresholds from the environment.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that environment variables named after the configuration macro of a
+// threshold are applied by the initialization of the threshold table, and that they are
+// validated in the same way as the values of a threshold file. Negative numbers, suffixes,
+// floating point numbers, values that are out of range, and values below the minimum of a
+// threshold are ignored. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testEnvironment()
+{
+   unsetEnvironment( "BLAZE_THRESHOLDS" );
+
+   test_ = "Valid environment variable";
+
+   setEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD", "4096" );
+   blaze::initThresholds();
+   checkThreshold( "SMP_DVECASSIGN_THRESHOLD", 4096UL );
+
+   const std::string invalid[] = {
+      "",                         // Empty value
+      "-1",                       // Negative number
+      "+5",                       // Explicit sign
+      " 12",                      // Leading whitespace
+      "16k",                      // Suffix
+      "1e6",                      // Floating point number
+      "1.5",                      // Floating point number
+      "0x10",                     // Hexadecimal number
+      "99999999999999999999999"   // Out of range
+   };
+
+   for( const std::string& value : invalid )
+   {
+      test_ = "Invalid environment variable \"" + value + "\"";
+
+      blaze::setThreshold( "SMP_DVECASSIGN_THRESHOLD", 77UL );
+      setEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD", value );
+
+      const std::string before( snapshot() );
+      blaze::initThresholds();
+      checkUnchanged( before );
+   }
+
+   unsetEnvironment( "BLAZE_SMP_DVECASSIGN_THRESHOLD" );
+
+   test_ = "Environment variable below the minimum";
+
+   blaze::resetThresholds();
+   setEnvironment( "BLAZE_DMATDVECMULT_THRESHOLD", "0" );
+
+   {
+      const std::string before( snapshot() );
+      blaze::initThresholds();
+      checkUnchanged( before );
+   }
+
+   unsetEnvironment( "BLAZE_DMATDVECMULT_THRESHOLD" );
+
+   blaze::resetThresholds();
+}
+//*************************************************************************************************
+
+} // namespace thresholds
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running runtime threshold class test..." << std::endl;
+
+   try
+   {
+      RUN_THRESHOLDS_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during runtime threshold class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,314 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/AffinityTest.cpp
+//  \brief Source file for the thread affinity test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <set>
+#include <blazetest/utiltest/threadpool/AffinityTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the AffinityTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+AffinityTest::AffinityTest()
+{
+   testNone();
+   testLists();
+   testPolicies();
+   testInvalid();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the specifications disabling the thread pinning.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the empty specification and the \c "none" specification result in
+// an empty list of CPUs. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void AffinityTest::testNone()
+{
+   test_ = "No thread pinning";
+
+   checkCPUs( ""      , {} );
+   checkCPUs( "  "    , {} );
+   checkCPUs( "none"  , {} );
+   checkCPUs( " None ", {} );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of explicit lists of CPUs and CPU ranges.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests explicit lists of CPUs and CPU ranges. Since the specified CPUs have to
+// be available to the calling thread, the lists are composed of the available CPUs. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testLists()
+{
+   test_ = "Lists of CPUs";
+
+   const std::vector<size_t> available( blaze::threadpool::availableCPUs() );
+   const std::string first( std::to_string( available.front() ) );
+   const std::string last ( std::to_string( available.back()  ) );
+
+   // Single CPUs
+   checkCPUs( first, { available.front() } );
+   checkCPUs( " " + first + " ", { available.front() } );
+   checkCPUs( first + "-" + first, { available.front() } );
+   checkCPUs( first + "," + first, { available.front(), available.front() } );
+
+   // Lists of CPUs
+   {
+      std::string spec;
+      for( size_t cpu : available ) {
+         spec += ( spec.empty() ? "" : "," ) + std::to_string( cpu );
+      }
+      checkCPUs( spec, available );
+   }
+
+   {
+      std::string spec;
+      for( size_t i=available.size(); i-- > 0UL; ) {
+         spec += ( spec.empty() ? "" : ", " ) + std::to_string( available[i] );
+      }
+      checkCPUs( spec, std::vector<size_t>( available.rbegin(), available.rend() ) );
+   }
+
+   // Ranges of CPUs
+   {
+      size_t length( 1UL );
+      while( length < available.size() &&
+             available[length] == available.front() + length ) {
+         ++length;
+      }
+
+      const std::vector<size_t> range( available.begin(), available.begin()+length );
+      const std::string spec( first + "-" + std::to_string( range.back() ) );
+
+      checkCPUs( spec, range );
+
+      std::vector<size_t> expected( range );
+      expected.push_back( available.back() );
+      expected.insert( expected.end(), range.begin(), range.end() );
+
+      checkCPUs( spec + "," + last + "," + spec, expected );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the \c "compact" and \c "scatter" policies.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the \c "compact" and \c "scatter" policies use every available CPU
+// exactly once and that the \c "compact" policy keeps the CPUs of a processor package together.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testPolicies()
+{
+   test_ = "Thread affinity policies";
+
+   const std::vector<size_t> available( blaze::threadpool::availableCPUs() );
+
+   std::vector<size_t> packages;
+   for( size_t cpu : available ) {
+      packages.push_back( blaze::threadpool::cpuPackage( cpu ) );
+   }
+
+   // Compact policy: sorted by package, in ascending order within each package
+   {
+      std::vector<size_t> expected( available );
+      std::stable_sort( expected.begin(), expected.end(), [&]( size_t a, size_t b ) {
+         return blaze::threadpool::cpuPackage( a ) < blaze::threadpool::cpuPackage( b );
+      } );
+
+      checkCPUs( "compact"  , expected );
+      checkCPUs( " COMPACT ", expected );
+   }
+
+   // Scatter policy: every available CPU exactly once, packages visited round-robin
+   {
+      const std::vector<size_t> cpus( blaze::threadpool::parseAffinity( "scatter" ) );
+
+      std::vector<size_t> sorted( cpus );
+      std::sort( sorted.begin(), sorted.end() );
+
+      if( sorted != available ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Scatter policy does not use every available CPU exactly once\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      const size_t numPackages( std::set<size_t>( packages.begin(), packages.end() ).size() );
+
+      for( size_t i=1UL; i<numPackages; ++i ) {
+         if( blaze::threadpool::cpuPackage( cpus[i] ) == blaze::threadpool::cpuPackage( cpus[0] ) )
+         {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Scatter policy does not alternate between processor packages\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of invalid thread affinity specifications.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that malformed specifications, descending ranges, overflowing CPU
+// indices, and CPUs that are not available are rejected. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void AffinityTest::testInvalid()
+{
+   test_ = "Invalid thread affinities";
+
+   const std::vector<size_t> available( blaze::threadpool::availableCPUs() );
+   const std::string first( std::to_string( available.front() ) );
+   const std::string beyond( std::to_string( available.back() + 1UL ) );
+
+   // Malformed specifications
+   checkInvalid( "compacted" );
+   checkInvalid( "scatter,0" );
+   checkInvalid( "nonsense" );
+   checkInvalid( "," );
+   checkInvalid( first + "," );
+   checkInvalid( "," + first );
+   checkInvalid( first + ",," + first );
+   checkInvalid( first + "-" );
+   checkInvalid( "-" + first );
+   checkInvalid( first + "--" + first );
+   checkInvalid( first + "-" + first + "-" + first );
+   checkInvalid( first + ";" + first );
+   checkInvalid( "+" + first );
+   checkInvalid( "0x1" );
+
+   // Descending ranges
+   checkInvalid( beyond + "-" + first );
+   checkInvalid( "1-0" );
+
+   // Overflowing CPU indices
+   checkInvalid( "18446744073709551616" );
+   checkInvalid( "99999999999999999999999999" );
+   checkInvalid( first + "-99999999999999999999999999" );
+
+   // Unavailable CPUs
+   checkInvalid( beyond );
+   checkInvalid( first + "," + beyond );
+   checkInvalid( first + "-" + beyond );
+   checkInvalid( first + "-18446744073709551615" );
+   checkInvalid( "4294967295" );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running thread affinity test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_AFFINITY_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during thread affinity test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
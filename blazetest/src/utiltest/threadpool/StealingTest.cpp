@@ -0,0 +1,336 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/StealingTest.cpp
+//  \brief Source file for the ThreadPool work stealing test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/threadpool/TaskQueue.h>
+#include <blazetest/utiltest/threadpool/StealingTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StealingTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+StealingTest::StealingTest()
+{
+   testTaskQueue();
+   testBlockedThread();
+   testImbalancedTasks();
+   testTaskSplit();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the TaskQueue class.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the FIFO order of the TaskQueue class, which serves as overflow queue of
+// the per-thread work queues, and its swap() and clear() functions. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void StealingTest::testTaskQueue()
+{
+   test_ = "TaskQueue";
+
+   blaze::threadpool::TaskQueue queue1, queue2;
+   std::vector<size_t> order;
+
+   for( size_t i=0UL; i<5UL; ++i ) {
+      queue1.push( [&order,i](){ order.push_back( i ); } );
+   }
+
+   checkValue( queue1.size(), 5UL, "queue size" );
+
+   queue1.swap( queue2 );
+
+   checkValue( queue1.isEmpty(), true, "emptiness after swap()" );
+   checkValue( queue2.size(), 5UL, "queue size after swap()" );
+
+   queue2.pop()();
+   queue2.pop()();
+
+   checkValue( order.size(), 2UL, "number of executed tasks" );
+   checkValue( order[0], 0UL, "order of the tasks" );
+   checkValue( order[1], 1UL, "order of the tasks" );
+
+   queue2.clear();
+
+   checkValue( queue2.isEmpty(), true, "emptiness after clear()" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the stealing of tasks from the work queue of a blocked thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules a task that blocks its thread until all other tasks have been
+// executed. Since the tasks are distributed round-robin over the work queues of all threads,
+// the remaining tasks in the work queue of the blocked thread can only be executed in case
+// they are stolen by the other threads. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void StealingTest::testBlockedThread()
+{
+   test_ = "Stealing from a blocked thread";
+
+   const size_t N( 64UL );
+
+   Pool pool( 4UL );
+
+   std::atomic<size_t> done( 0UL );
+   std::atomic<bool> stolen( false );
+
+   pool.schedule( [&done,&stolen,N]()
+   {
+      const auto deadline( std::chrono::steady_clock::now() + std::chrono::seconds( 30 ) );
+
+      while( done < N-1UL && std::chrono::steady_clock::now() < deadline ) {
+         std::this_thread::yield();
+      }
+
+      stolen = ( done == N-1UL );
+   } );
+
+   for( size_t i=1UL; i<N; ++i ) {
+      pool.schedule( [&done](){ ++done; } );
+   }
+
+   pool.wait();
+
+   checkValue( done.load(), N-1UL, "number of executed tasks" );
+   checkValue( stolen.load(), true, "stealing of the tasks of the blocked thread" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the execution of strongly imbalanced tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks whose runtime differs by several orders of magnitude and
+// shrinks the thread pool while the tasks are executed. All tasks, including the tasks in the
+// work queues of the removed threads, have to be executed. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void StealingTest::testImbalancedTasks()
+{
+   test_ = "Imbalanced tasks";
+
+   const size_t N( 96UL );
+
+   Pool pool( 4UL );
+
+   std::vector<size_t> results( N, 0UL );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.schedule( [&results,i]()
+      {
+         if( i % 16UL == 0UL )
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+         results[i] = i*i;
+      } );
+   }
+
+   pool.resize( 1UL );
+   pool.wait();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      checkValue( results[i], i*i, "result of task " + std::to_string( i ) );
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      pool.schedule( [&results,i](){ results[i] = i; } );
+   }
+
+   pool.resize( 3UL, true );
+   pool.wait();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      checkValue( results[i], i, "result of task " + std::to_string( i ) );
+   }
+
+   checkValue( pool.size(), 3UL, "size of the thread pool" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the splitting of parallel operations into several tasks per thread.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the C++11/Boost thread backend splits parallel operations into
+// \c BLAZE_SMP_TASKS_PER_THREAD tasks per thread, into one task per permitted thread in case
+// a thread limit is active, and into a single task for a single thread. Additionally, it tests
+// dense vector and dense matrix assignments whose sizes are not multiples of the number of
+// tasks. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void StealingTest::testTaskSplit()
+{
+#if BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+
+   test_ = "Splitting of parallel operations";
+
+   const size_t threads( blaze::getNumThreads() );
+
+   blaze::setNumThreads( 4UL );
+
+   checkValue( blaze::TheThreadBackend::tasks(), 4UL*blaze::smpTasksPerThread, "number of tasks" );
+
+   BLAZE_THREAD_LIMIT( 2UL ) {
+      checkValue( blaze::TheThreadBackend::tasks(), 2UL, "number of tasks with thread limit" );
+   }
+
+   {
+      const size_t N( blaze::SMP_DVECASSIGN_THRESHOLD + 37UL );
+
+      blaze::DynamicVector<double> a( N ), b( N ), c( N );
+      for( size_t i=0UL; i<N; ++i ) {
+         a[i] = double( i % 13UL );
+         b[i] = double( i % 7UL );
+      }
+
+      c = a + b;
+
+      for( size_t i=0UL; i<N; ++i ) {
+         checkValue( c[i], a[i] + b[i], "vector element " + std::to_string( i ) );
+      }
+   }
+
+   {
+      const size_t M( 61UL );
+      const size_t N( blaze::SMP_DMATASSIGN_THRESHOLD / M + 29UL );
+
+      blaze::DynamicMatrix<double> A( M, N ), B( M, N ), C( M, N );
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            A(i,j) = double( ( i + j ) % 11UL );
+            B(i,j) = double( ( i * j ) % 5UL );
+         }
+      }
+
+      C = A + B;
+
+      for( size_t i=0UL; i<M; ++i ) {
+         for( size_t j=0UL; j<N; ++j ) {
+            checkValue( C(i,j), A(i,j) + B(i,j), "matrix element (" + std::to_string( i ) +
+                                                 "," + std::to_string( j ) + ")" );
+         }
+      }
+   }
+
+   blaze::setNumThreads( 1UL );
+
+   checkValue( blaze::TheThreadBackend::tasks(), 1UL, "number of tasks for a single thread" );
+
+   blaze::setNumThreads( threads );
+
+#endif
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool work stealing test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_STEALING_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool work stealing test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
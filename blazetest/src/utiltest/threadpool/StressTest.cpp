@@ -0,0 +1,368 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/threadpool/StressTest.cpp
+//  \brief Source file for the ThreadPool stress test
+//
+//  Copyright (C) 2012-2019 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include <blaze/util/threadpool/WorkQueue.h>
+#include <blazetest/utiltest/threadpool/StressTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the StressTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+StressTest::StressTest()
+{
+   testWorkQueue();
+
+   for( size_t spin : { 0UL, 100UL } ) {
+      testConcurrentScheduling( spin );
+      testConcurrentGroups( spin );
+      testParkAndWake( spin );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of concurrent pushes to and pops from a single work queue.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function pushes tasks to a single work queue from several producer threads while
+// several consumer threads concurrently remove and execute tasks. The number of pushed tasks
+// exceeds the capacity of the ring buffer, such that the overflow queue is used as well. Every
+// task has to be executed exactly once. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void StressTest::testWorkQueue()
+{
+   test_ = "Concurrent work queue access";
+
+   using Queue = blaze::threadpool::WorkQueue< std::mutex, std::unique_lock<std::mutex> >;
+
+   const size_t producers( 4UL );
+   const size_t consumers( 3UL );
+   const size_t N( 2000UL );
+
+   Queue queue;
+
+   // Filling and draining the queue from a single thread
+   {
+      std::vector<size_t> counts( N, 0UL );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         queue.push( [&counts,i](){ ++counts[i]; } );
+      }
+
+      checkValue( queue.isEmpty(), false, "emptiness of the filled queue" );
+
+      blaze::threadpool::Task task;
+      size_t executed( 0UL );
+
+      while( queue.pop( task ) ) {
+         task();
+         ++executed;
+      }
+
+      checkValue( executed, N, "number of executed tasks" );
+      checkValue( queue.isEmpty(), true, "emptiness of the drained queue" );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         checkValue( counts[i], 1UL, "execution count of task " + std::to_string( i ) );
+      }
+
+      for( size_t i=0UL; i<N; ++i ) {
+         queue.push( [&counts,i](){ ++counts[i]; } );
+      }
+
+      checkValue( queue.clear(), N, "number of removed tasks" );
+      checkValue( queue.isEmpty(), true, "emptiness of the cleared queue" );
+   }
+
+   // Concurrent producers and consumers
+   {
+      std::unique_ptr< std::atomic<size_t>[] > counts( new std::atomic<size_t>[producers*N] );
+      for( size_t i=0UL; i<producers*N; ++i ) {
+         counts[i] = 0UL;
+      }
+
+      std::atomic<size_t> executed( 0UL );
+      std::vector<std::thread> threads;
+
+      for( size_t p=0UL; p<producers; ++p ) {
+         threads.emplace_back( [&queue,&counts,p,N]()
+         {
+            for( size_t i=p*N; i<(p+1UL)*N; ++i ) {
+               queue.push( [&counts,i](){ ++counts[i]; } );
+            }
+         } );
+      }
+
+      for( size_t c=0UL; c<consumers; ++c ) {
+         threads.emplace_back( [&queue,&executed,producers,N]()
+         {
+            const auto deadline( std::chrono::steady_clock::now() + std::chrono::seconds( 30 ) );
+            blaze::threadpool::Task task;
+
+            while( executed < producers*N && std::chrono::steady_clock::now() < deadline ) {
+               if( queue.pop( task ) ) {
+                  task();
+                  ++executed;
+               }
+               else std::this_thread::yield();
+            }
+         } );
+      }
+
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      checkValue( executed.load(), producers*N, "number of executed tasks" );
+      checkValue( queue.isEmpty(), true, "emptiness of the drained queue" );
+
+      for( size_t i=0UL; i<producers*N; ++i ) {
+         checkValue( counts[i].load(), 1UL, "execution count of task " + std::to_string( i ) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the concurrent scheduling of tasks from several threads.
+//
+// \param spin The number of spin iterations of the idle threads of the thread pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function schedules tasks to a thread pool from several threads at once. The number of
+// tasks exceeds the combined capacity of the ring buffers of all work queues. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void StressTest::testConcurrentScheduling( size_t spin )
+{
+   test_ = "Concurrent scheduling (spin count " + std::to_string( spin ) + ")";
+
+   const size_t schedulers( 4UL );
+   const size_t N( 3000UL );
+
+   Pool pool( 4UL, spin );
+
+   std::vector<size_t> results( schedulers*N, 0UL );
+   std::vector<std::thread> threads;
+
+   for( size_t s=0UL; s<schedulers; ++s ) {
+      threads.emplace_back( [&pool,&results,s,N]()
+      {
+         for( size_t i=s*N; i<(s+1UL)*N; ++i ) {
+            pool.schedule( [&results,i](){ results[i] = i+1UL; } );
+         }
+      } );
+   }
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   pool.wait();
+
+   checkValue( pool.isEmpty(), true, "emptiness of the thread pool" );
+
+   for( size_t i=0UL; i<schedulers*N; ++i ) {
+      checkValue( results[i], i+1UL, "result of task " + std::to_string( i ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of several threads concurrently scheduling and waiting for their own task groups.
+//
+// \param spin The number of spin iterations of the idle threads of the thread pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules tasks to a thread pool from several threads at once, each
+// of which waits for the completion of its own task group. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void StressTest::testConcurrentGroups( size_t spin )
+{
+   test_ = "Concurrent task groups (spin count " + std::to_string( spin ) + ")";
+
+   const size_t schedulers( 4UL );
+   const size_t rounds( 10UL );
+   const size_t N( 1500UL );
+
+   Pool pool( 3UL, spin );
+
+   std::vector< std::vector<size_t> > results( schedulers, std::vector<size_t>( N, 0UL ) );
+   std::vector<size_t> failures( schedulers, 0UL );
+   std::vector<std::thread> threads;
+
+   for( size_t s=0UL; s<schedulers; ++s ) {
+      threads.emplace_back( [&pool,&results,&failures,s,rounds,N]()
+      {
+         blaze::threadpool::TaskGroup group;
+
+         for( size_t r=1UL; r<=rounds; ++r )
+         {
+            for( size_t i=0UL; i<N; ++i ) {
+               pool.schedule( group, [&results,s,r,i](){ results[s][i] = r*i; } );
+            }
+
+            pool.wait( group );
+
+            for( size_t i=0UL; i<N; ++i ) {
+               if( results[s][i] != r*i )
+                  ++failures[s];
+            }
+         }
+      } );
+   }
+
+   for( std::thread& thread : threads ) {
+      thread.join();
+   }
+
+   for( size_t s=0UL; s<schedulers; ++s ) {
+      checkValue( failures[s], 0UL, "number of incomplete tasks of group " + std::to_string( s ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parking and waking of idle threads.
+//
+// \param spin The number of spin iterations of the idle threads of the thread pool.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function repeatedly schedules small batches of tasks after pauses long enough for all
+// threads of the thread pool to park. Every batch has to wake the parked threads. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void StressTest::testParkAndWake( size_t spin )
+{
+   test_ = "Parking and waking (spin count " + std::to_string( spin ) + ")";
+
+   const size_t rounds( 50UL );
+   const size_t N( 6UL );
+
+   Pool pool( 4UL, spin );
+
+   std::atomic<size_t> executed( 0UL );
+
+   for( size_t r=1UL; r<=rounds; ++r )
+   {
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+
+      for( size_t i=0UL; i<N; ++i ) {
+         pool.schedule( [&executed](){ ++executed; } );
+      }
+
+      pool.wait();
+
+      checkValue( executed.load(), r*N, "number of executed tasks" );
+   }
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running ThreadPool stress test..." << std::endl;
+
+   try
+   {
+      RUN_THREADPOOL_STRESS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during ThreadPool stress test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************